@@ -397,6 +397,16 @@ if(MAZE_RENDER_SYSTEM_VULKAN_REQUESTED)
 
 endif()
 
+# Maze Render System Null is not compiled by default.
+# Projects that want a headless render system (servers, CI benchmarks) set
+# MAZE_RENDER_SYSTEM_NULL_REQUESTED before including this config
+if(MAZE_RENDER_SYSTEM_NULL_REQUESTED)
+
+    set(MAZE_RENDER_SYSTEM_NULL_ENABLED 1)
+    add_definitions("-DMAZE_RENDER_SYSTEM_NULL_ENABLED=1")
+
+endif()
+
 # Production mode
 if (MAZE_PRODUCTION)
     set(MAZE_PRODUCTION 1)
@@ -71,6 +71,34 @@ namespace Maze
     }
 
 
+    //////////////////////////////////////////
+    enum class ComponentCopyPropertyType : U8
+    {
+        Value,
+        ComponentReference,
+        EntityReference
+    };
+
+
+    //////////////////////////////////////////
+    // Struct ComponentCopyPlan
+    // Flattened list of the copyable properties of a component class (all super classes included).
+    // Built once per MetaClass, so the copy does not walk the class hierarchy every time
+    //
+    //////////////////////////////////////////
+    struct MAZE_CORE_API ComponentCopyPlan
+    {
+        //////////////////////////////////////////
+        struct Property
+        {
+            MetaProperty* metaProperty;
+            ComponentCopyPropertyType type;
+        };
+
+        Vector<Property> properties;
+    };
+
+
     //////////////////////////////////////////
     // Struct EntityCopyData
     //
@@ -157,6 +185,15 @@ namespace Maze
         //////////////////////////////////////////
         inline void setScene(EcsScene* _scene) { m_scene = _scene; }
 
+
+        //////////////////////////////////////////
+        // The copied hierarchy is added to the world as a single batch,
+        // see EcsWorld::beginEntitiesBatch
+        inline void setBatchWorldInsertion(bool _value) { m_batchWorldInsertion = _value; }
+
+        //////////////////////////////////////////
+        inline bool getBatchWorldInsertion() const { return m_batchWorldInsertion; }
+
     private:
 
         //////////////////////////////////////////
@@ -176,6 +213,8 @@ namespace Maze
 
         EcsWorld* m_world = nullptr;
         EcsScene* m_scene = nullptr;
+
+        bool m_batchWorldInsertion = false;
     };
 
 
@@ -304,8 +343,13 @@ namespace Maze
         }
 
         //////////////////////////////////////////
+        // Should depend on the class only - the result is cached in ComponentCopyPlan
         virtual bool isMetaPropertyCopyable(MetaProperty* _metaProperty) { return true; }
 
+
+        //////////////////////////////////////////
+        static ComponentCopyPlan const& GetCopyPlan(Component* _component);
+
     protected:
 
         //////////////////////////////////////////
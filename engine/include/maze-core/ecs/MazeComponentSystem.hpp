@@ -202,6 +202,27 @@ namespace Maze
         //////////////////////////////////////////
         inline void setOrder(ComponentSystemOrder const& _order) { m_order = _order; }
 
+
+        //////////////////////////////////////////
+        // Handlers with declared access may be executed in parallel with non-conflicting ones.
+        // Sample components which are not written are treated as read
+        void setComponentAccess(
+            Vector<ComponentId> const& _readComponentIds,
+            Vector<ComponentId> const& _writeComponentIds);
+
+        //////////////////////////////////////////
+        inline bool getComponentAccessDeclared() const { return m_componentAccessDeclared; }
+
+        //////////////////////////////////////////
+        inline Vector<ComponentId> const& getReadComponentIds() const { return m_readComponentIds; }
+
+        //////////////////////////////////////////
+        inline Vector<ComponentId> const& getWriteComponentIds() const { return m_writeComponentIds; }
+
+        //////////////////////////////////////////
+        // True if handlers should not be executed at the same time
+        bool isConflicting(ComponentSystemEventHandler const* _other) const;
+
         
     protected:
 
@@ -236,6 +257,10 @@ namespace Maze
 
         VectorSet<HashedString> m_tags;
         ComponentSystemOrder m_order;
+
+        bool m_componentAccessDeclared = false;
+        Vector<ComponentId> m_readComponentIds;
+        Vector<ComponentId> m_writeComponentIds;
     };
 
 
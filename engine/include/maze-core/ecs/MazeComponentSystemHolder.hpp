@@ -95,11 +95,15 @@ namespace Maze
             VectorSet<HashedString> _tags = VectorSet<HashedString>(),
             ComponentSystemOrder const& _order = ComponentSystemOrder(),
             U8 _sampleFlags = 0,
-            ComponentIdsFunc _forbiddenComponentsFunc = nullptr)
+            ComponentIdsFunc _forbiddenComponentsFunc = nullptr,
+            ComponentIdsFunc _readComponentsFunc = nullptr,
+            ComponentIdsFunc _writeComponentsFunc = nullptr)
             : m_name(_name)
             , m_func((ComponentSystemEventHandler::Func)_func)
             , m_sampleFlags(_sampleFlags)
             , m_forbiddenComponentsFunc(_forbiddenComponentsFunc)
+            , m_readComponentsFunc(_readComponentsFunc)
+            , m_writeComponentsFunc(_writeComponentsFunc)
         {
             for (HashedString const& tag : _tags)
                 m_tags.insert(tag.toStdString());
@@ -145,6 +149,33 @@ namespace Maze
             GetSystemHolders().insert(this);
         }
 
+        //////////////////////////////////////////
+        template<typename TEventType>
+        inline ComponentSystemHolder(
+            HashedCString _name,
+            void(*_func)(TEventType&, EcsWorld*),
+            VectorSet<HashedString> _tags = VectorSet<HashedString>(),
+            ComponentSystemOrder const& _order = ComponentSystemOrder())
+            : m_name(_name)
+            , m_func((ComponentSystemEventHandler::Func)_func)
+        {
+            for (HashedString const& tag : _tags)
+                m_tags.insert(tag.toStdString());
+
+            for (HashedString const& order : _order.after)
+                m_orderAfter.insert(order.toStdString());
+
+            for (HashedString const& order : _order.before)
+                m_orderBefore.insert(order.toStdString());
+
+            m_type = Type::Global;
+
+            auto address = &EcsWorld::addSystemEventHandlerWorld<TEventType>;
+            m_addSystemGlobalFunc = (AddSystemGlobalFunc)(address);
+
+            GetSystemHolders().insert(this);
+        }
+
         //////////////////////////////////////////
         inline ~ComponentSystemHolder()
         {
@@ -178,6 +209,15 @@ namespace Maze
                         eastl::move(order),
                         m_sampleFlags,
                         m_forbiddenComponentsFunc ? m_forbiddenComponentsFunc() : Vector<ComponentId>());
+
+                    if (m_readComponentsFunc || m_writeComponentsFunc)
+                    {
+                        SharedPtr<ComponentSystemEventHandler> system = m_systems[_world].lock();
+                        if (system)
+                            system->setComponentAccess(
+                                m_readComponentsFunc ? m_readComponentsFunc() : Vector<ComponentId>(),
+                                m_writeComponentsFunc ? m_writeComponentsFunc() : Vector<ComponentId>());
+                    }
                     break;
                 }
                 case Type::Global:
@@ -209,6 +249,8 @@ namespace Maze
         StdSet<StdString> m_orderBefore;
         U8 m_sampleFlags = 0;
         ComponentIdsFunc m_forbiddenComponentsFunc = nullptr;
+        ComponentIdsFunc m_readComponentsFunc = nullptr;
+        ComponentIdsFunc m_writeComponentsFunc = nullptr;
         AddSystemFunc m_addSystemFunc;
         AddSystemGlobalFunc m_addSystemGlobalFunc;
         StdMap<EcsWorld*, WeakPtr<ComponentSystemEventHandler>> m_systems;
@@ -219,6 +261,12 @@ namespace Maze
     // Forbidden components list for COMPONENT_SYSTEM_EVENT_HANDLER_FORBID
     #define MAZE_ECS_FORBID(...) &Maze::GetStaticComponentIds<__VA_ARGS__>
 
+    //////////////////////////////////////////
+    // Component access lists for COMPONENT_SYSTEM_EVENT_HANDLER_RW
+    #define MAZE_ECS_READS(...) &Maze::GetStaticComponentIds<__VA_ARGS__>
+    #define MAZE_ECS_WRITES(...) &Maze::GetStaticComponentIds<__VA_ARGS__>
+    #define MAZE_ECS_NONE nullptr
+
 
     //////////////////////////////////////////
     #define COMPONENT_SYSTEM_EVENT_HANDLER(DName, DTags, DOrder, ...) \
@@ -245,6 +293,21 @@ namespace Maze
         void DName(__VA_ARGS__); \
         static ComponentSystemHolder DName##_holder(MAZE_HCS(#DName), DName, DTags, DOrder, DSampleFlags, DForbiddenComponents); \
         void DName(__VA_ARGS__)
+
+    //////////////////////////////////////////
+    // DReads - MAZE_ECS_READS(Comp0, ...), DWrites - MAZE_ECS_WRITES(Comp0, ...) or MAZE_ECS_NONE.
+    // Systems with declared access which do not conflict may be executed in parallel
+    // (see EcsWorld::broadcastEventParallel). Sample components are treated as read at least
+    #define COMPONENT_SYSTEM_EVENT_HANDLER_RW(DName, DTags, DOrder, DReads, DWrites, ...) \
+        void DName(__VA_ARGS__); \
+        static ComponentSystemHolder DName##_holder(MAZE_HCS(#DName), DName, DTags, DOrder, 0, nullptr, DReads, DWrites); \
+        void DName(__VA_ARGS__)
+
+    //////////////////////////////////////////
+    #define COMPONENT_SYSTEM_EVENT_HANDLER_RW_EX(DName, DTags, DOrder, DSampleFlags, DReads, DWrites, ...) \
+        void DName(__VA_ARGS__); \
+        static ComponentSystemHolder DName##_holder(MAZE_HCS(#DName), DName, DTags, DOrder, DSampleFlags, nullptr, DReads, DWrites); \
+        void DName(__VA_ARGS__)
         
 
 } // namespace Maze
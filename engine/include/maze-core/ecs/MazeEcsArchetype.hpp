@@ -34,6 +34,8 @@
 #include "maze-core/MazeTypes.hpp"
 #include "maze-core/ecs/MazeEcsTypes.hpp"
 #include "maze-core/containers/MazeFastVector.hpp"
+#include "maze-core/utils/MazeClassInfo.hpp"
+#include <type_traits>
 
 
 //////////////////////////////////////////
@@ -42,6 +44,90 @@ namespace Maze
     //////////////////////////////////////////
     MAZE_USING_SHARED_PTR(EcsArchetype);
     class IEntitiesSample;
+    class Entity;
+
+
+    //////////////////////////////////////////
+    // Writes the owner component state into the dense component row of the entity
+    using EcsDenseComponentFillFunc = void(*)(Entity* _entity, U8* _data);
+
+
+    //////////////////////////////////////////
+    // Struct EcsDenseComponentInfo
+    //
+    // Dense component is a trivially copyable data type which is stored directly
+    // in the contiguous columns of the entity archetype instead of the heap object.
+    // Owned dense component mirrors the hot data of a regular component - it exists
+    // while the entity has the owner component and is refilled on every archetype change
+    //
+    //////////////////////////////////////////
+    struct MAZE_CORE_API EcsDenseComponentInfo
+    {
+        ComponentId id = c_invalidComponentId;
+        U32 size = 0u;
+        CString name = nullptr;
+
+        ComponentId ownerComponentId = c_invalidComponentId;
+        EcsDenseComponentFillFunc fillFunc = nullptr;
+    };
+
+    //////////////////////////////////////////
+    MAZE_CORE_API void RegisterEcsDenseComponent(EcsDenseComponentInfo const& _info);
+
+    //////////////////////////////////////////
+    // Returns false if the component is not dense
+    MAZE_CORE_API bool GetEcsDenseComponentInfo(ComponentId _id, EcsDenseComponentInfo& _outInfo);
+
+    //////////////////////////////////////////
+    // Appends the owned dense components of the listed regular components
+    MAZE_CORE_API void CollectEcsOwnedDenseComponentIds(
+        Vector<ComponentId> const& _componentIds,
+        Vector<ComponentId>& _outDenseComponentIds);
+
+
+    //////////////////////////////////////////
+    // Specialize for the owned dense components:
+    //     static ComponentId GetOwnerComponentId();
+    //     static EcsDenseComponentFillFunc GetFillFunc();
+    template <typename TData>
+    struct EcsDenseComponentTraits
+    {
+        //////////////////////////////////////////
+        static inline ComponentId GetOwnerComponentId() { return c_invalidComponentId; }
+
+        //////////////////////////////////////////
+        static inline EcsDenseComponentFillFunc GetFillFunc() { return nullptr; }
+    };
+
+    //////////////////////////////////////////
+    template <typename TData>
+    inline ComponentId GetEcsDenseComponentId()
+    {
+        static_assert(std::is_trivially_copyable<TData>::value, "Dense component should be trivially copyable!");
+        static_assert(alignof(TData) <= 16, "Dense component alignment is too big!");
+
+        static ComponentId const s_componentId = []()
+        {
+            EcsDenseComponentInfo info;
+            info.id = ClassInfo<TData>::UID();
+            info.size = (U32)sizeof(TData);
+            info.name = ClassInfo<TData>::Name();
+            info.ownerComponentId = EcsDenseComponentTraits<TData>::GetOwnerComponentId();
+            info.fillFunc = EcsDenseComponentTraits<TData>::GetFillFunc();
+            RegisterEcsDenseComponent(info);
+            return info.id;
+        }();
+
+        return s_componentId;
+    }
+
+    //////////////////////////////////////////
+    template <typename ...TData>
+    inline Vector<ComponentId> const& GetEcsDenseComponentIds()
+    {
+        static Vector<ComponentId> const s_componentIds = { GetEcsDenseComponentId<TData>()... };
+        return s_componentIds;
+    }
 
 
     //////////////////////////////////////////
@@ -51,6 +137,8 @@ namespace Maze
     // Every entity with an assigned archetype is listed in m_entities, and the
     // archetype lazily caches which samples can be affected by entities of this
     // combination, so entity changes only touch the relevant samples.
+    // Dense components of the entities are stored in the archetype columns,
+    // row i of every column belongs to m_entities[i].
     //
     //////////////////////////////////////////
     class MAZE_CORE_API EcsArchetype
@@ -90,6 +178,28 @@ namespace Maze
         //////////////////////////////////////////
         inline FastVector<EntityId> const& getEntities() const { return m_entities; }
 
+        //////////////////////////////////////////
+        bool hasComponents(Vector<ComponentId> const& _componentIds) const;
+
+
+        //////////////////////////////////////////
+        // Column of getEntities().size() elements, nullptr if the archetype has no such dense component
+        U8* getDenseComponentsData(ComponentId _componentId);
+
+        //////////////////////////////////////////
+        // Row _index of the column, nullptr if the archetype has no such dense component
+        U8* getDenseComponentData(ComponentId _componentId, S32 _index);
+
+        //////////////////////////////////////////
+        template <typename TData>
+        inline TData* getDenseComponents()
+        {
+            return reinterpret_cast<TData*>(getDenseComponentsData(GetEcsDenseComponentId<TData>()));
+        }
+
+        //////////////////////////////////////////
+        inline bool hasDenseComponents() const { return !m_denseColumns.empty(); }
+
 
         //////////////////////////////////////////
         static U64 CalculateHash(Vector<ComponentId> const& _sortedComponentIds);
@@ -102,6 +212,33 @@ namespace Maze
             Vector<ComponentId> const& _sortedComponentIds,
             U64 _hash);
 
+
+        //////////////////////////////////////////
+        // Zero-filled row for the new entity, owned dense components are filled from _entity
+        void pushDenseRow(Entity* _entity);
+
+        //////////////////////////////////////////
+        // The last row is moved to _index
+        void removeDenseRow(S32 _index);
+
+        //////////////////////////////////////////
+        // Copies the columns existing in both archetypes, except the owned ones
+        void copyDenseRow(
+            EcsArchetype* _from,
+            S32 _fromIndex,
+            S32 _toIndex);
+
+    protected:
+
+        //////////////////////////////////////////
+        struct DenseColumn
+        {
+            ComponentId componentId = c_invalidComponentId;
+            U32 stride = 0u;
+            EcsDenseComponentFillFunc fillFunc = nullptr;
+            Vector<U8> data;
+        };
+
     protected:
         ArchetypeId m_id = c_invalidArchetypeId;
         Vector<ComponentId> m_componentIds;
@@ -109,6 +246,7 @@ namespace Maze
         S64 m_componentsMask = 0;
 
         FastVector<EntityId> m_entities;
+        Vector<DenseColumn> m_denseColumns;
 
         Vector<SampleEntry> m_samplesCache;
         U32 m_samplesCacheVersion = U32(-1);
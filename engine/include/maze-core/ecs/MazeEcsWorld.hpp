@@ -38,14 +38,18 @@
 #include "maze-core/ecs/MazeEntityAspect.hpp"
 #include "maze-core/ecs/MazeEntitiesSample.hpp"
 #include "maze-core/ecs/MazeEcsArchetype.hpp"
+#include "maze-core/ecs/MazeTransform3DHierarchy.hpp"
 #include "maze-core/utils/MazeSharedObject.hpp"
 #include "maze-core/utils/MazeMultiDelegate.hpp"
 #include "maze-core/utils/MazeClassInfo.hpp"
 #include "maze-core/utils/MazeSwitchableContainer.hpp"
 #include "maze-core/reflection/MazeMetaClass.hpp"
 #include "maze-core/memory/MazeMemory.hpp"
+#include "maze-core/memory/MazeFrameArena.hpp"
 #include "maze-core/events/MazeEvent.hpp"
 #include "maze-core/ecs/events/MazeEcsInputEvents.hpp"
+#include "maze-core/system/MazeMutex.hpp"
+#include <atomic>
 
 
 //////////////////////////////////////////
@@ -168,6 +172,38 @@ namespace Maze
         //////////////////////////////////////////
         bool removeEntity(EntityPtr const& _entity);
 
+
+        //////////////////////////////////////////
+        // Creates _count entities (copies of _prototype, or empty ones) and adds them as a single batch
+        Vector<EntityPtr> createEntities(
+            S32 _count,
+            EntityPtr const& _prototype = nullptr);
+
+        //////////////////////////////////////////
+        // Batched addEntity - the archetypes and the samples of the batch are resolved once
+        // and eventEntitiesAdded is invoked once for the whole batch
+        bool addEntities(EntityPtr const* _entities, Size _count);
+
+        //////////////////////////////////////////
+        inline bool addEntities(Vector<EntityPtr> const& _entities) { return addEntities(_entities.data(), _entities.size()); }
+
+        //////////////////////////////////////////
+        // Batched removeEntity, see addEntities
+        bool removeEntities(EntityPtr const* _entities, Size _count);
+
+        //////////////////////////////////////////
+        inline bool removeEntities(Vector<EntityPtr> const& _entities) { return removeEntities(_entities.data(), _entities.size()); }
+
+        //////////////////////////////////////////
+        // Until endEntitiesBatch every added entity joins a single addEntities batch. Unlike
+        // addEntities, the entities get the world at once, so copied components see it.
+        // Returns false (no batch is opened) if the entities cannot be added right now
+        bool beginEntitiesBatch();
+
+        //////////////////////////////////////////
+        void endEntitiesBatch();
+
+
         //////////////////////////////////////////
         void processEntityAddedToSample(
             ComponentSystemEventHandlerPtr const& _handler,
@@ -316,6 +352,27 @@ namespace Maze
             return system;
         }
 
+        //////////////////////////////////////////
+        // Global handler which receives the world - for the passes over the dense components (see queryDense)
+        template<typename TEventType>
+        inline ComponentSystemEventHandlerPtr addSystemEventHandlerWorld(
+            HashedCString _name,
+            void(*_func)(TEventType&, EcsWorld*),
+            VectorSet<HashedString> const& _tags = VectorSet<HashedString>(),
+            ComponentSystemOrder const& _order = ComponentSystemOrder())
+        {
+            ComponentSystemEventHandlerPtr system = ComponentSystemEventHandler::Create(
+                this,
+                _name,
+                ClassInfo<typename std::remove_const<TEventType>::type>::UID(),
+                (ComponentSystemEventHandler::GlobalCtxFunc)_func,
+                this,
+                _tags,
+                _order);
+            addSystemEventHandler(system);
+            return system;
+        }
+
         //////////////////////////////////////////
         template <typename TEventType>
         inline Vector<ComponentSystemEventHandlerPtr> const& getSystems()
@@ -371,19 +428,67 @@ namespace Maze
         }
 
 
+        //////////////////////////////////////////
+        // Handlers are grouped into stages by their declared component access
+        // (see ComponentSystemEventHandler::setComponentAccess) and the handlers
+        // of the same stage are executed at the same time on the job system workers
+        void broadcastEventParallel(Event* _event, EcsEventParams _params = EcsEventParams());
+
+        //////////////////////////////////////////
+        template <typename TEvent, typename ...TArgs>
+        inline void broadcastEventParallel(TArgs... _args)
+        {
+            TEvent evt(_args...);
+            broadcastEventParallel(&evt);
+        }
+
+        //////////////////////////////////////////
+        // Disabled by default. The declared component access covers the sample entities only:
+        // Transform3D writers dirty the children of other entities and the world transform
+        // getters fill the caches lazily, broadcastEventImmediate from a stage is not deferred.
+        // Enable only for the worlds whose parallel handlers avoid these paths
+        inline void setParallelSystemsEnabled(bool _value) { m_parallelSystemsEnabled = _value; }
+
+        //////////////////////////////////////////
+        inline bool getParallelSystemsEnabled() const { return m_parallelSystemsEnabled; }
+
+        //////////////////////////////////////////
+        inline void invalidateEventHandlersSchedule() { ++m_eventHandlersVersion; }
+
+
+        //////////////////////////////////////////
+        // While the parallel phase is active, structural changes (entities adding/removing,
+        // components and active changes, deferred events) are collected from any thread
+        // and applied on the main thread when the last phase ends
+        void beginParallelPhase();
+
+        //////////////////////////////////////////
+        void endParallelPhase();
+
+        //////////////////////////////////////////
+        inline bool getParallelPhase() const { return m_parallelPhaseCounter.load(std::memory_order_acquire) > 0; }
+
+
         //////////////////////////////////////////
         void broadcastEvent(EventUPtr&& _event);
 
+        //////////////////////////////////////////
+        // _event should be allocated from the frame arena
+        void broadcastFrameEvent(Event* _event);
+
         //////////////////////////////////////////
         template <typename TEvent, typename ...TArgs>
         inline void broadcastEvent(TArgs... _args)
         {
-            UniquePtr<TEvent> evt = MakeUnique<TEvent>(_args...);
+            if (!isEventsQueueAvailable())
+                return;
+
+            TEvent* evt = m_frameArena.construct<TEvent>(_args...);
             MAZE_DEBUG_ERROR_BP_IF(
                 evt->getClassUID() != ClassInfo<TEvent>::UID(),
                 "Event %s has wrong metadata!",
                 ClassInfo<TEvent>::Name());
-            broadcastEvent(eastl::move(evt));
+            broadcastFrameEvent(evt);
         }
 
 
@@ -425,11 +530,30 @@ namespace Maze
         //////////////////////////////////////////
         void sendEvent(EntityId _entityId, EventUPtr&& _event);
 
+        //////////////////////////////////////////
+        // _event should be allocated from the frame arena
+        void sendFrameEvent(EntityId _entityId, Event* _event);
+
         //////////////////////////////////////////
         template <typename TEvent, typename ...TArgs>
         inline void sendEvent(EntityId _entityId, TArgs&&... _args)
         {
-            sendEvent(_entityId, MakeUnique<TEvent>(eastl::forward<TArgs>(_args)...));
+            if (!isEventsQueueAvailable())
+                return;
+
+            sendFrameEvent(_entityId, m_frameArena.construct<TEvent>(eastl::forward<TArgs>(_args)...));
+        }
+
+
+        //////////////////////////////////////////
+        // Transient memory for events and systems scratch data.
+        // Allocations are valid until the end of the next world update
+        inline FrameArena& getFrameArena() { return m_frameArena; }
+
+        //////////////////////////////////////////
+        inline bool isEventsQueueAvailable() const
+        {
+            return m_state == EcsWorldState::Active || m_state == EcsWorldState::PreparingToDestroy;
         }
 
 
@@ -439,6 +563,12 @@ namespace Maze
         //////////////////////////////////////////
         void processEntityAddedForSamples(Entity* _entity);
 
+        //////////////////////////////////////////
+        void processEntitiesAddedForSamples(Entity* const* _entities, Size _count);
+
+        //////////////////////////////////////////
+        void processEntitiesRemovedForSamples(Entity* const* _entities, Size _count);
+
 
         //////////////////////////////////////////
         EcsArchetype* getArchetype(ArchetypeId _id) const;
@@ -449,6 +579,67 @@ namespace Maze
         //////////////////////////////////////////
         inline Size getArchetypesCount() const { return m_archetypes.size(); }
 
+        //////////////////////////////////////////
+        inline Transform3DHierarchy* getTransform3DHierarchy() const { return m_transform3DHierarchy.get(); }
+
+
+        //////////////////////////////////////////
+        // Dense components live in the archetype columns of the entity.
+        // The entity should be already added to the world. Returned pointers are valid
+        // until the next structural change of any entity of the same archetype.
+        // Owned dense components (see EcsDenseComponentTraits) are managed by their owners only
+        U8* addDenseComponent(Entity* _entity, ComponentId _componentId);
+
+        //////////////////////////////////////////
+        bool removeDenseComponent(Entity* _entity, ComponentId _componentId);
+
+        //////////////////////////////////////////
+        U8* getDenseComponent(Entity* _entity, ComponentId _componentId) const;
+
+        //////////////////////////////////////////
+        template <typename TData>
+        inline TData* addDenseComponent(Entity* _entity, TData const& _value = TData())
+        {
+            TData* data = reinterpret_cast<TData*>(addDenseComponent(_entity, GetEcsDenseComponentId<TData>()));
+            if (data)
+                *data = _value;
+            return data;
+        }
+
+        //////////////////////////////////////////
+        template <typename TData>
+        inline bool removeDenseComponent(Entity* _entity)
+        {
+            return removeDenseComponent(_entity, GetEcsDenseComponentId<TData>());
+        }
+
+        //////////////////////////////////////////
+        template <typename TData>
+        inline TData* getDenseComponent(Entity* _entity) const
+        {
+            return reinterpret_cast<TData*>(getDenseComponent(_entity, GetEcsDenseComponentId<TData>()));
+        }
+
+        //////////////////////////////////////////
+        // _func(Size _count, EntityId const* _entityIds, TData* ..._columns) is called
+        // for every archetype with all the listed dense components
+        template <typename ...TData, typename TFunction>
+        inline void queryDense(TFunction const& _func)
+        {
+            Vector<ComponentId> const& componentIds = GetEcsDenseComponentIds<TData...>();
+            for (Size i = 0, in = m_archetypes.size(); i < in; ++i)
+            {
+                EcsArchetype* archetype = m_archetypes[i].get();
+                if (archetype->getEntities().empty() || !archetype->hasComponents(componentIds))
+                    continue;
+
+                _func(
+                    archetype->getEntities().size(),
+                    archetype->getEntities().begin(),
+                    archetype->template getDenseComponents<TData>()...);
+            }
+        }
+
         //////////////////////////////////////////
         inline UnorderedMap<ClassUID, Vector<ComponentSystemEventHandlerPtr>> const& getEventHandlers() const { return m_eventHandlers; }
 
@@ -474,6 +665,8 @@ namespace Maze
         MultiDelegate<EntityPtr const&> eventEntityAdded;
         MultiDelegate<EntityPtr const&> eventEntityChanged;
         MultiDelegate<EntityPtr const&> eventEntityRemoved;
+        MultiDelegate<Vector<EntityPtr> const&> eventEntitiesAdded;
+        MultiDelegate<Vector<EntityPtr> const&> eventEntitiesRemoved;
 
 
     protected:
@@ -517,6 +710,13 @@ namespace Maze
         //////////////////////////////////////////
         void removeEntityFromArchetype(Entity* _entity);
 
+        //////////////////////////////////////////
+        void removeEntityFromArchetype(EcsArchetype* _archetype, S32 _index);
+
+        //////////////////////////////////////////
+        // Moves the entity with the shared dense components data
+        void transferEntityToArchetype(EcsArchetype* _archetype, Entity* _entity);
+
         //////////////////////////////////////////
         void processNewSampleForExistingEntities(IEntitiesSample* _sample);
 
@@ -524,6 +724,69 @@ namespace Maze
         void processEntitySampleRefs(Entity* _entity);
 
 
+        //////////////////////////////////////////
+        enum class ParallelPhaseCommandType : U8
+        {
+            AddEntity,
+            RemoveEntity,
+            AddEntities,
+            RemoveEntities,
+            EntityComponentsChanged,
+            EntityActiveChanged,
+            BroadcastEvent,
+            SendEvent,
+            BroadcastFrameEvent,
+            SendFrameEvent
+        };
+
+        //////////////////////////////////////////
+        // Structural change collected during the parallel phase
+        struct ParallelPhaseCommand
+        {
+            ParallelPhaseCommandType type;
+            EntityId entityId;
+            EntityPtr entity;
+
+            // Owned by the command for BroadcastEvent/SendEvent, frame arena memory otherwise
+            Event* event;
+
+            // Range of m_parallelPhaseCommandEntities for AddEntities/RemoveEntities
+            U32 entitiesOffset;
+            U32 entitiesCount;
+        };
+
+        //////////////////////////////////////////
+        // Returns true if the command is deferred until the end of the parallel phase
+        bool deferParallelPhaseCommand(
+            ParallelPhaseCommandType _type,
+            EntityId _entityId,
+            EntityPtr const& _entity = nullptr,
+            Event* _event = nullptr);
+
+        //////////////////////////////////////////
+        bool deferParallelPhaseEntitiesCommand(
+            ParallelPhaseCommandType _type,
+            EntityPtr const* _entities,
+            Size _count);
+
+        //////////////////////////////////////////
+        void flushParallelPhaseCommands();
+
+        //////////////////////////////////////////
+        struct EventHandlersSchedule
+        {
+            U32 version = U32(-1);
+            bool parallel = false;
+
+            // Stage i is [stageOffsets[i], stageOffsets[i + 1]) of eventHandlers
+            Vector<ComponentSystemEventHandlerPtr> eventHandlers;
+            Vector<S32> stageOffsets;
+        };
+
+        //////////////////////////////////////////
+        EventHandlersSchedule const& ensureEventHandlersSchedule(ClassUID _eventUID);
+
+
         //////////////////////////////////////////
         void notifyMouse(InputEventMouseData const& _data);
 
@@ -549,11 +812,24 @@ namespace Maze
         Vector<EcsArchetypePtr> m_archetypes;
         FlatHashMap<U64, Vector<ArchetypeId>> m_archetypesByHash;
         Vector<ComponentId> m_archetypeIdsScratch;
+        Vector<ComponentId> m_archetypeDenseIdsScratch;
+
+        Transform3DHierarchyUPtr m_transform3DHierarchy;
 
         UnorderedMap<ClassUID, Vector<ComponentSystemEventHandlerPtr>> m_eventHandlers;
         FastVector<ComponentSystemEntityAddedToSampleEventHandlerPtr> m_entityAddedToSampleEventHandlers;
         FastVector<ComponentSystemEntityRemovedFromSampleEventHandlerPtr> m_entityRemovedFromSampleEventHandlers;
 
+        bool m_parallelSystemsEnabled = false;
+        U32 m_eventHandlersVersion = 0u;
+        UnorderedMap<ClassUID, EventHandlersSchedule> m_eventHandlersSchedules;
+        S32 m_parallelBroadcastDepth = 0;
+
+        std::atomic<S32> m_parallelPhaseCounter{ 0 };
+        Mutex m_parallelPhaseCommandsMutex;
+        Vector<ParallelPhaseCommand> m_parallelPhaseCommands;
+        Vector<EntityPtr> m_parallelPhaseCommandEntities;
+
     private:
 
         //////////////////////////////////////////
@@ -572,6 +848,7 @@ namespace Maze
         EcsWorldState m_state = EcsWorldState::None;
         S32 m_newEntityIdsCount = 0;
         SwitchableContainer<EcsWorldEventsQueuePtr> m_eventHolders;
+        FrameArena m_frameArena;
 
         S32 m_frameNumber = 0;
     };
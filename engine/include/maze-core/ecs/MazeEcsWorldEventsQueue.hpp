@@ -65,7 +65,9 @@ namespace Maze
         ComponentsChanged,
         ActiveChanged,
         Broadcast,
-        Unicast
+        Unicast,
+        AddingEntities,
+        RemovingEntities
     };
 
 
@@ -75,6 +77,18 @@ namespace Maze
     //////////////////////////////////////////
     class MAZE_CORE_API EcsWorldEventsQueue
     {
+    private:
+
+        //////////////////////////////////////////
+        struct QueuedEvent
+        {
+            EntityId entityId;
+            Event* event;
+            bool frameArena;
+            // FrameArena::getFrameIndex at the moment the frame event was queued
+            U32 frameIndex;
+        };
+
     public:
 
         //////////////////////////////////////////
@@ -85,7 +99,7 @@ namespace Maze
 
 
         //////////////////////////////////////////
-        inline Size getEventsCount() const { return m_eventTypes.size(); }
+        inline Size getEventsCount() const { return m_eventTypes.size() - m_eventTypesHead; }
 
         //////////////////////////////////////////
         inline Size getAddingEntitiesCount() const { return m_addingEntities.size(); }
@@ -103,12 +117,40 @@ namespace Maze
         //////////////////////////////////////////
         bool removeEntity(EntityPtr const& _entity);
 
+        //////////////////////////////////////////
+        // Queues the entities as a single batch - see EcsWorld::addEntities
+        bool addEntities(EntityPtr const* _entities, Size _count);
+
+        //////////////////////////////////////////
+        // Opens an AddingEntities batch - the entities added until endAddingEntities
+        // join it, but they get their ids and the world right away, as with addEntity
+        void beginAddingEntities();
+
+        //////////////////////////////////////////
+        void endAddingEntities();
+
+        //////////////////////////////////////////
+        bool removeEntities(EntityPtr const* _entities, Size _count);
+
         //////////////////////////////////////////
         bool addBroadcastEvent(EventUPtr&& _event);
 
         //////////////////////////////////////////
         bool addUnicastEvent(EntityId _eid, EventUPtr&& _event);
 
+        //////////////////////////////////////////
+        // The event is allocated from the world frame arena, the queue only calls its destructor
+        bool addBroadcastFrameEvent(Event* _event);
+
+        //////////////////////////////////////////
+        // The event is allocated from the world frame arena, the queue only calls its destructor
+        bool addUnicastFrameEvent(EntityId _eid, Event* _event);
+
+        //////////////////////////////////////////
+        // Should be called right before the frame arena swap - the swap rewinds the memory
+        // of the frame before _frameIndex, so no queued frame event may come from it
+        void checkFrameEventsBeforeArenaSwap(U32 _frameIndex) const;
+
         //////////////////////////////////////////
         void processEntityAddedToSample(
             ComponentSystemEventHandlerPtr const& _handler,
@@ -163,30 +205,61 @@ namespace Maze
         //////////////////////////////////////////
         void invokeActiveChangedEvent();
 
+        //////////////////////////////////////////
+        void invokeAddingEntitiesEvent();
+
+        //////////////////////////////////////////
+        void invokeRemovingEntitiesEvent();
+
         //////////////////////////////////////////
         void invokeBroadcastEvent();
 
         //////////////////////////////////////////
         void invokeUnicastEvent();
 
+
+        //////////////////////////////////////////
+        void pushEventType(EcsWorldEventType _eventType);
+
+        //////////////////////////////////////////
+        EntityId queueAddingEntity(EntityPtr const& _entity);
+
+        //////////////////////////////////////////
+        // Rewinds the linear queues when everything is processed, so the storage is reused
+        void compactQueues();
+
+        //////////////////////////////////////////
+        static void DestroyQueuedEvent(QueuedEvent const& _queuedEvent);
+
+        //////////////////////////////////////////
+        static void DestroyQueuedEvents(FastVector<QueuedEvent>& _events, Size _head);
+
     private:
         EcsWorld* m_world = nullptr;
 
         Timer m_timer;
 
-        Queue<EcsWorldEventType> m_eventTypes;
+        // Linear queues (storage + head index) - no per-node allocations in the steady state
+        FastVector<EcsWorldEventType> m_eventTypes;
+        Size m_eventTypesHead = 0u;
+
         Deque<EntityPtr> m_addingEntities;
         Map<EntityId, EntityPtr> m_addingEntitiesById;
 
         Queue<EntityId> m_removingEntities;
+        Queue<S32> m_addingEntitiesBatches;
+        Queue<S32> m_removingEntitiesBatches;
         // Queue<Pair<ComponentSystemEventHandlerPtr, EntityId>> m_addingToSampleEntities;
         // Queue<Pair<ComponentSystemEventHandlerPtr, EntityId>> m_removingFromSampleEntities;
         Queue<EntityId> m_componentsChangedEntities;
         Queue<EntityId> m_activeChangedEntities;
-        Queue<EventUPtr> m_broadcastEvents;
-        Queue<std::pair<EntityId, EventUPtr>> m_unicastEvents;
+        FastVector<QueuedEvent> m_broadcastEvents;
+        Size m_broadcastEventsHead = 0u;
+        FastVector<QueuedEvent> m_unicastEvents;
+        Size m_unicastEventsHead = 0u;
 
         bool m_processingEvents = false;
+        S32 m_addingEntitiesBatchDepth = 0;
     };
 
 
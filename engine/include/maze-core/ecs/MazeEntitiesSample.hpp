@@ -42,6 +42,7 @@
 #include "maze-core/memory/MazeMemory.hpp"
 #include "maze-core/ecs/MazeEntityAspect.hpp"
 #include "maze-core/utils/MazeIndexTupleBuilder.hpp"
+#include "maze-core/system/MazeJobSystem.hpp"
 #include <functional>
 #include <tuple>
 #include <utility>
@@ -74,7 +75,10 @@ namespace Maze
     {
         None = 0,
 
-        IncludeInactive = MAZE_BIT(0)
+        IncludeInactive = MAZE_BIT(0),
+        // Events are processed for the different entities at the same time on the job system workers
+        // (GenericInclusiveEntitiesSample only). The handler should touch only its own entity data
+        ProcessEventsParallel = MAZE_BIT(1)
     };
 
 
@@ -99,6 +103,10 @@ namespace Maze
         //////////////////////////////////////////
         virtual void processEntity(Entity* _entity) MAZE_ABSTRACT;
 
+        //////////////////////////////////////////
+        // Called before processing a batch of entities (see EcsWorld::addEntities)
+        virtual void reserveEntities(Size _additionalCount) {}
+
 
         //////////////////////////////////////////
         EntityAspect const& getAspect() const { return m_aspect; }
@@ -137,9 +145,41 @@ namespace Maze
             EntityAspect const& _aspect,
             U8 _flags = 0);
 
+        //////////////////////////////////////////
+        // Calls _func(begin, end) for the chunks of [0, _count) on the job system workers.
+        // World structural changes are deferred until all chunks are processed.
+        // Dirty world transforms are recalculated before the chunks, so Transform3D getters
+        // are read-only inside _func. _func should not change transforms with children
+        template <typename TFunction>
+        inline void parallelForChunks(
+            S32 _count,
+            S32 _grainSize,
+            TFunction const& _func)
+        {
+            if (_count <= 0)
+                return;
+
+            JobSystem* jobSystem = beginParallelChunks();
+            if (!jobSystem)
+            {
+                _func(0, _count);
+                return;
+            }
+
+            jobSystem->parallelFor(_count, _grainSize, _func);
+            endParallelChunks();
+        }
+
+        //////////////////////////////////////////
+        // Returns nullptr if the chunks should be processed serially (no workers or no world)
+        JobSystem* beginParallelChunks();
+
+        //////////////////////////////////////////
+        void endParallelChunks();
+
     protected:
         EcsWorldWPtr m_world;
-        EcsWorld* m_worldRaw;
+        EcsWorld* m_worldRaw = nullptr;
         EntityAspect m_aspect;
         U8 m_flags = 0;
     };
@@ -188,6 +228,12 @@ namespace Maze
         //////////////////////////////////////////
         virtual void processEntity(Entity* _entity) MAZE_OVERRIDE;
 
+        //////////////////////////////////////////
+        virtual void reserveEntities(Size _additionalCount) MAZE_OVERRIDE
+        {
+            m_entities.reserve(m_entities.size() + _additionalCount);
+        }
+
 
         //////////////////////////////////////////
         virtual void query(void (*_func)()) MAZE_OVERRIDE
@@ -364,6 +410,13 @@ namespace Maze
             }
         }
 
+        //////////////////////////////////////////
+        virtual void reserveEntities(Size _additionalCount) MAZE_OVERRIDE
+        {
+            m_entitiesData.reserve(m_entitiesData.size() + _additionalCount);
+            m_entityIndices.reserve(m_entityIndices.size() + _additionalCount);
+        }
+
         //////////////////////////////////////////
         void query(QueryFunc _func)
         {
@@ -377,6 +430,31 @@ namespace Maze
             }
         }
 
+        //////////////////////////////////////////
+        // _func is called from the worker threads for the different entities at the same time.
+        // Entities adding/removing and components changes are deferred until the query ends.
+        // _grainSize <= 0 means automatic chunk size
+        void queryParallel(
+            QueryFunc const& _func,
+            S32 _grainSize = 0)
+        {
+            parallelForChunks(
+                (S32)m_entitiesData.size(),
+                _grainSize,
+                [this, &_func](S32 _begin, S32 _end)
+                {
+                    for (S32 i = _begin; i < _end; ++i)
+                    {
+                        EntityData& entityData = m_entitiesData[i];
+                        callQuery(
+                            _func,
+                            entityData.entity,
+                            entityData.components,
+                            typename Indices::Indexes());
+                    }
+                });
+        }
+
         //////////////////////////////////////////
         virtual void query(void (*_func)()) MAZE_OVERRIDE
         {
@@ -414,6 +492,34 @@ namespace Maze
         //////////////////////////////////////////
         inline void processEvent(Event* _event, EcsEventParams _params, ProcessEventFunc _func)
         {
+            if (m_flags & (U8)EntitiesSampleFlags::ProcessEventsParallel)
+            {
+                parallelForChunks(
+                    (S32)m_entitiesData.size(),
+                    0,
+                    [this, _event, &_params, &_func](S32 _begin, S32 _end)
+                    {
+                        for (S32 i = _begin; i < _end; ++i)
+                        {
+                            EntityData& entityData = m_entitiesData[i];
+
+                            if (entityData.entity->getRemoving() && _params.ignoreRemovingEntity)
+                                continue;
+
+                            if (!entityData.entity->getEcsWorld() && _params.ignoreNullWorldEntity)
+                                continue;
+
+                            callProcessEvent(
+                                _event,
+                                _func,
+                                entityData.entity,
+                                entityData.components,
+                                typename Indices::Indexes());
+                        }
+                    });
+                return;
+            }
+
             for (EntityData entityData : m_entitiesData)
             {
                 if (entityData.entity->getRemoving() && _params.ignoreRemovingEntity)
@@ -490,7 +596,7 @@ namespace Maze
 
         template<S32 ...Idxs> 
         inline void callQuery(
-            QueryFunc _func,
+            QueryFunc const& _func,
             Entity* _entity,
             eastl::tuple<TComponents*...>& _components,
             IndexesTuple<Idxs...> const&)
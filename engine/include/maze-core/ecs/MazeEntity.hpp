@@ -551,6 +551,10 @@ namespace Maze
         //////////////////////////////////////////
         inline S32 getIndexInArchetype() const { return m_indexInArchetype; }
 
+        //////////////////////////////////////////
+        // Sorted ids of the dense components (see EcsWorld::addDenseComponent)
+        inline Vector<ComponentId> const& getDenseComponentIds() const { return m_denseComponentIds; }
+
 
         //////////////////////////////////////////
         // Internal (IEntitiesSample bookkeeping) - samples this entity is currently a member of
@@ -641,6 +645,7 @@ namespace Maze
 
         ArchetypeId m_archetypeId = c_invalidArchetypeId;
         S32 m_indexInArchetype = -1;
+        Vector<ComponentId> m_denseComponentIds;
         FastVector<IEntitiesSample*> m_samplesRefs;
 
     protected:
@@ -0,0 +1,134 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeTransform3DHierarchy_hpp_))
+#define _MazeTransform3DHierarchy_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-core/MazeCoreHeader.hpp"
+#include "maze-core/MazeTypes.hpp"
+#include "maze-core/math/MazeTMat.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_UNIQUE_PTR(Transform3DHierarchy);
+    class Transform3D;
+
+
+    //////////////////////////////////////////
+    // Class Transform3DHierarchy
+    //
+    // Flat breadth-first order of all Transform3D components of the world.
+    // Every level of the hierarchy is a contiguous range and the parents are always
+    // processed before their children. update() recomputes dirty world transforms
+    // level by level, the levels are split between the job system workers.
+    // World matrices are stored in the components, so the references stay valid.
+    // Called before PreUpdateEvent and after PostUpdateEvent, transforms changed
+    // inside the update stages are still calculated on demand until the second pass
+    //
+    //////////////////////////////////////////
+    class MAZE_CORE_API Transform3DHierarchy
+    {
+    public:
+
+        //////////////////////////////////////////
+        friend class Transform3D;
+
+        //////////////////////////////////////////
+        static S32 const c_parallelLevelSizeMin = 1024;
+
+    public:
+
+        //////////////////////////////////////////
+        Transform3DHierarchy();
+
+        //////////////////////////////////////////
+        ~Transform3DHierarchy();
+
+        //////////////////////////////////////////
+        Transform3DHierarchy(Transform3DHierarchy const&) = delete;
+
+        //////////////////////////////////////////
+        Transform3DHierarchy& operator=(Transform3DHierarchy const&) = delete;
+
+
+        //////////////////////////////////////////
+        void addTransform(Transform3D* _transform);
+
+        //////////////////////////////////////////
+        void removeTransform(Transform3D* _transform);
+
+        //////////////////////////////////////////
+        inline void invalidateOrder() { m_orderDirty = true; }
+
+
+        //////////////////////////////////////////
+        void update();
+
+
+        //////////////////////////////////////////
+        inline Size getTransformsCount() const { return m_transforms.size(); }
+
+        //////////////////////////////////////////
+        inline Size getLevelsCount() const { return m_levelOffsets.empty() ? 0u : m_levelOffsets.size() - 1u; }
+
+
+    protected:
+
+        //////////////////////////////////////////
+        void rebuildOrder();
+
+        //////////////////////////////////////////
+        void updateTransforms(S32 _begin, S32 _end);
+
+    private:
+        Vector<Transform3D*> m_transforms;
+        Vector<S32> m_parentIndices;
+
+        // Level i is [m_levelOffsets[i], m_levelOffsets[i + 1])
+        Vector<S32> m_levelOffsets;
+
+        // Roots with the parent outside of the hierarchy (not added to the world yet)
+        Vector<S32> m_externalRoots;
+
+        bool m_orderDirty = false;
+
+        Vector<Transform3D*> m_transformsScratch;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeTransform3DHierarchy_hpp_
+//////////////////////////////////////////
@@ -32,6 +32,7 @@
 //////////////////////////////////////////
 #include "maze-core/MazeCoreHeader.hpp"
 #include "maze-core/ecs/MazeComponent.hpp"
+#include "maze-core/ecs/MazeEcsArchetype.hpp"
 #include "maze-core/math/MazeMat4.hpp"
 #include "maze-core/math/MazeRotation2D.hpp"
 
@@ -44,6 +45,23 @@ namespace Maze
     MAZE_USING_SHARED_PTR(Transform3D);
 
 
+    //////////////////////////////////////////
+    // Struct Rotor3DData
+    //
+    // Rotor3D hot data - owned dense component, processed by Rotor3DSystem through EcsWorld::queryDense
+    //
+    //////////////////////////////////////////
+    struct Rotor3DData
+    {
+        Transform3D* transform = nullptr;
+        F32 axisX = 0.0f;
+        F32 axisY = 1.0f;
+        F32 axisZ = 0.0f;
+        F32 speed = 0.0f;
+        bool active = false;
+    };
+
+
     //////////////////////////////////////////
     // Class Rotor3D
     //
@@ -75,21 +93,26 @@ namespace Maze
         inline bool getActive() const { return m_active; }
 
         //////////////////////////////////////////
-        inline void setActive(bool _active) { m_active = _active; }
+        inline void setActive(bool _active) { m_active = _active; updateDenseData(); }
 
 
         //////////////////////////////////////////
         inline Vec3F const& getAxis() const { return m_axis; }
 
         //////////////////////////////////////////
-        inline void setAxis(Vec3F const& _axis) { m_axis = _axis; }
+        inline void setAxis(Vec3F const& _axis) { m_axis = _axis; updateDenseData(); }
 
 
         //////////////////////////////////////////
         inline F32 getSpeed() const { return m_speed; }
 
         //////////////////////////////////////////
-        inline void setSpeed(F32 _speed) { m_speed = _speed; }
+        inline void setSpeed(F32 _speed) { m_speed = _speed; updateDenseData(); }
+
+
+        //////////////////////////////////////////
+        // EcsDenseComponentFillFunc of Rotor3DData
+        static void FillDenseData(Entity* _entity, U8* _data);
 
     protected:
 
@@ -102,6 +125,14 @@ namespace Maze
         //////////////////////////////////////////
         bool init(Vec3F const& _axis = Vec3F::c_unitY, F32 _speed = 5.0f);
 
+
+        //////////////////////////////////////////
+        void writeDenseData(Rotor3DData& _data) const;
+
+        //////////////////////////////////////////
+        // Rotor3DData row exists once the entity archetype is updated
+        void updateDenseData();
+
     protected:
         bool m_active = true;
         Vec3F m_axis = Vec3F::c_unitY;
@@ -109,6 +140,18 @@ namespace Maze
     };
 
 
+    //////////////////////////////////////////
+    template <>
+    struct EcsDenseComponentTraits<Rotor3DData>
+    {
+        //////////////////////////////////////////
+        static inline ComponentId GetOwnerComponentId() { return GetStaticComponentId<Rotor3D>(); }
+
+        //////////////////////////////////////////
+        static inline EcsDenseComponentFillFunc GetFillFunc() { return &Rotor3D::FillDenseData; }
+    };
+
+
 } // namespace Maze
 //////////////////////////////////////////
 
@@ -78,6 +78,7 @@ namespace Maze
             LocalTransformDirty               = MAZE_BIT(0),
             WorldTransformDirty               = MAZE_BIT(1),
             ChildrenOrderDirty                = MAZE_BIT(2),
+            WorldAABBDirty                    = MAZE_BIT(3),
 
             LocalTransformChangedCurrentFrame = MAZE_BIT(8),  LocalTransformChangedPreviousFrame = MAZE_BIT(9),
             WorldTransformChangedCurrentFrame = MAZE_BIT(10), WorldTransformChangedPreviousFrame = MAZE_BIT(11),
@@ -140,6 +141,19 @@ namespace Maze
         //////////////////////////////////////////
         AABB2D calculateWorldAABB();
 
+        //////////////////////////////////////////
+        // Cached calculateWorldAABB(), invalidated together with the world transform
+        inline AABB2D const& getWorldAABB()
+        {
+            if (m_flags & Flags::WorldAABBDirty)
+            {
+                m_worldAABB = calculateWorldAABB();
+                m_flags &= ~Flags::WorldAABBDirty;
+            }
+
+            return m_worldAABB;
+        }
+
 
         //////////////////////////////////////////
         void setPivot(Vec2F const& _pivot);
@@ -666,7 +680,7 @@ namespace Maze
         ////////////////////////////////////
         inline void _dirtyWorldTransformRecursive(S32 _flags)
         {
-            m_flags |= _flags;
+            m_flags |= _flags | Flags::WorldAABBDirty;
 
             for (Transform2D* transform : m_children)
                 transform->_dirtyWorldTransformRecursive(_flags);
@@ -696,9 +710,10 @@ namespace Maze
         Vec2F m_size = Vec2F(100.0f, 100.0f);
         Vec2F m_anchor = Vec2F(0.5f, 0.5f);
 
-        S32 m_flags = 0;
+        S32 m_flags = Flags::WorldAABBDirty;
         TMat m_localTransform = TMat::c_identity;
         TMat m_worldTransform = TMat::c_identity;
+        AABB2D m_worldAABB = AABB2D::c_zero;
 
         Transform2DPtr m_parent;
         Vector<Transform2D*> m_children;
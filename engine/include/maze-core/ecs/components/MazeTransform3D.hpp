@@ -44,6 +44,7 @@ namespace Maze
 {
     //////////////////////////////////////////
     MAZE_USING_SHARED_PTR(Transform3D);
+    class Transform3DHierarchy;
 
 
     //////////////////////////////////////////
@@ -64,6 +65,9 @@ namespace Maze
         //////////////////////////////////////////
         friend class Entity;
 
+        //////////////////////////////////////////
+        friend class Transform3DHierarchy;
+
     protected:
 
         //////////////////////////////////////////
@@ -446,6 +450,13 @@ namespace Maze
         //////////////////////////////////////////
         void processActiveChanged();
 
+
+        //////////////////////////////////////////
+        inline Transform3DHierarchy* getHierarchy() const { return m_hierarchy; }
+
+        //////////////////////////////////////////
+        inline S32 getHierarchyIndex() const { return m_hierarchyIndex; }
+
     protected:
 
         //////////////////////////////////////////
@@ -514,6 +525,10 @@ namespace Maze
 
         Transform3DPtr m_parent;
         Vector<Transform3D*> m_children;
+
+        // World transform is stored in the hierarchy buffer while the transform is registered there
+        Transform3DHierarchy* m_hierarchy = nullptr;
+        S32 m_hierarchyIndex = -1;
     };
 
 
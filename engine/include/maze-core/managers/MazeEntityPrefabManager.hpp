@@ -162,6 +162,14 @@ namespace Maze
             EcsWorld* _world,
             EcsScene* _scene);
 
+        //////////////////////////////////////////
+        // Instantiates _count copies of the prefab, all of them are added to the world as a single batch
+        Vector<EntityPtr> instantiatePrefabs(
+            EntityPtr const& _entity,
+            S32 _count,
+            EcsWorld* _world,
+            EcsScene* _scene);
+
         //////////////////////////////////////////
         EntityPtr instantiatePrefab(
             HashedCString _name,
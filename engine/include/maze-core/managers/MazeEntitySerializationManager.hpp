@@ -37,6 +37,9 @@
 #include "maze-core/math/MazeQuaternion.hpp"
 #include "maze-core/data/MazeDataBlock.hpp"
 #include "maze-core/assets/MazeAssetUnitId.hpp"
+#include "maze-core/system/MazePath.hpp"
+#include "maze-core/system/MazeFileStats.hpp"
+#include "maze-core/system/MazeMutex.hpp"
 #include <tinyxml2/tinyxml2.h>
 
 
@@ -171,6 +174,12 @@ namespace Maze
             EcsWorld* _world = nullptr,
             EcsScene* _scene = nullptr) const;
 
+        //////////////////////////////////////////
+        // Parsed prefab files are cached until the file is changed, moved or removed
+        // (the file is checked at most once per frame).
+        // Only the last c_prefabDataBlocksCacheMaxSize used files are kept
+        void clearPrefabDataBlocksCache() const;
+
 
 
         //////////////////////////////////////////
@@ -205,6 +214,19 @@ namespace Maze
         bool init();
 
 
+        //////////////////////////////////////////
+        void subscribeAssetManager();
+
+        //////////////////////////////////////////
+        void notifyAssetManagerInitialized();
+
+        //////////////////////////////////////////
+        void notifyAssetFileRemoved(AssetFilePtr const& _assetFile);
+
+        //////////////////////////////////////////
+        void notifyAssetFileMoved(AssetFilePtr const& _assetFile, Path const& _prevFullPath);
+
+
         //////////////////////////////////////////
         void saveComponentToDataBlockDefault(
             EntitiesToDataBlockContext& _context,
@@ -260,6 +282,29 @@ namespace Maze
 
         VectorSet<ClassUID> m_componentsToIgnore;
         VectorMap<ClassUID, ComponentSerializationFunctions> m_componentCustomSerializationByClassUID;
+
+        //////////////////////////////////////////
+        static Size const c_prefabDataBlocksCacheMaxSize = 64u;
+
+        //////////////////////////////////////////
+        struct PrefabDataBlockCacheEntry
+        {
+            UnixTime lastChangeTimeUTC = 0u;
+            Size fileSize = 0u;
+            U32 lastUseIndex = 0u;
+            U32 checkFrameIndex = 0u;
+
+            // Never modified after parsing, the loads in progress share it
+            SharedPtr<DataBlock> dataBlock;
+
+            // restoreDataBlockEcsIds rewrites the ids in place, such blocks are loaded from a copy
+            bool hasEcsIds = false;
+        };
+
+        // The cache is logically const - every access is guarded by m_prefabDataBlocksCacheMutex
+        mutable Mutex m_prefabDataBlocksCacheMutex;
+        mutable UnorderedMap<Path, PrefabDataBlockCacheEntry> m_prefabDataBlocksCache;
+        mutable U32 m_prefabDataBlocksCacheUseIndex = 0u;
     };
 
 
@@ -37,6 +37,7 @@
 #include "maze-core/utils/MazeSwitchableContainer.hpp"
 #include "maze-core/system/MazeTaskDelegate.hpp"
 #include "maze-core/system/MazeMutex.hpp"
+#include "maze-core/system/MazeJobSystem.hpp"
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -155,6 +156,34 @@ namespace Maze
         // After this call addBackgroundTask always returns false
         void shutdownBackgroundThread();
 
+
+        //////////////////////////////////////////
+        inline JobSystem& getJobSystem() { return m_jobSystem; }
+
+        //////////////////////////////////////////
+        // Short-living job for the worker threads. Long blocking work should go to addBackgroundTask
+        template <typename TFunction>
+        inline JobHandle addJob(
+            TFunction&& _function,
+            JobHandle _parent = JobHandle())
+        {
+            return m_jobSystem.schedule(eastl::forward<TFunction>(_function), _parent);
+        }
+
+        //////////////////////////////////////////
+        inline void waitJob(JobHandle _handle) { m_jobSystem.wait(_handle); }
+
+        //////////////////////////////////////////
+        // _function(S32 _begin, S32 _end)
+        template <typename TFunction>
+        inline void parallelFor(
+            S32 _count,
+            S32 _grainSize,
+            TFunction const& _function)
+        {
+            m_jobSystem.parallelFor(_count, _grainSize, _function);
+        }
+
     protected:
 
         //////////////////////////////////////////
@@ -185,6 +214,8 @@ namespace Maze
         std::thread m_backgroundThread;
         bool m_backgroundThreadShutdown = false;
 
+        JobSystem m_jobSystem;
+
         bool m_update = false;
 
     };
@@ -82,6 +82,10 @@ namespace Maze
         //////////////////////////////////////////
         inline F32 getAppTime() const { return m_appTime; }
 
+        //////////////////////////////////////////
+        // Incremented on every processed (not skipped) update
+        inline U32 getFrameIndex() const { return m_frameIndex; }
+
         //////////////////////////////////////////
         inline void pushPause() { m_pauseCounter++; }
 
@@ -132,6 +136,7 @@ namespace Maze
         S32 m_pauseCounter = 0;
 
         F32 m_appTime = 0.0f;
+        U32 m_frameIndex = 0u;
 
         F32 m_unscaledDeltaTime = 0.0f;
         F32 m_deltaTime = 0.0f;
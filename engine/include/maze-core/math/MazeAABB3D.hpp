@@ -43,6 +43,16 @@
 //////////////////////////////////////////
 namespace Maze
 {
+    //////////////////////////////////////////
+    // Enum AABBContainment
+    //
+    //////////////////////////////////////////
+    enum class AABBContainment
+    {
+        Outside = 0,
+        Intersects,
+        Inside
+    };
 
 
     //////////////////////////////////////////
@@ -278,6 +288,14 @@ namespace Maze
             return false;
         }
         
+        //////////////////////////////////////////
+        inline bool contains(AABB3D const& _aabb) const
+        {
+            return  m_min.x <= _aabb.m_min.x && m_max.x >= _aabb.m_max.x
+                &&  m_min.y <= _aabb.m_min.y && m_max.y >= _aabb.m_max.y
+                &&  m_min.z <= _aabb.m_min.z && m_max.z >= _aabb.m_max.z;
+        }
+
         //////////////////////////////////////////
         inline F32 closestDistanceTo(AABB3D const& _aabb) const
         {            
@@ -361,6 +379,21 @@ namespace Maze
             return Vec3F(m_max.x - m_min.x, m_max.y - m_min.y, m_max.z - m_min.z);
         }
         
+        //////////////////////////////////////////
+        inline MAZE_CONSTEXPR Vec3F getCenter() const
+        {
+            return Vec3F((m_min.x + m_max.x) * 0.5f, (m_min.y + m_max.y) * 0.5f, (m_min.z + m_max.z) * 0.5f);
+        }
+
+        //////////////////////////////////////////
+        inline MAZE_CONSTEXPR F32 getSurfaceArea() const
+        {
+            return 2.0f * (
+                (m_max.x - m_min.x) * (m_max.y - m_min.y) +
+                (m_max.y - m_min.y) * (m_max.z - m_min.z) +
+                (m_max.z - m_min.z) * (m_max.x - m_min.x));
+        }
+
         //////////////////////////////////////////
         inline MAZE_CONSTEXPR bool isValid() const
         {
@@ -0,0 +1,228 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeDynamicAABBTree3D_hpp_))
+#define _MazeDynamicAABBTree3D_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-core/MazeCoreHeader.hpp"
+#include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/MazeTypes.hpp"
+#include "maze-core/math/MazeAABB3D.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class DynamicAABBTree3D
+    // Incrementally updated bounding volume hierarchy.
+    // Leaves store "fat" AABBs (enlarged by the margin), so small movements
+    // don't touch the tree. Internal nodes are kept balanced with AVL-style rotations
+    //
+    //////////////////////////////////////////
+    class MAZE_CORE_API DynamicAABBTree3D
+    {
+    public:
+
+        //////////////////////////////////////////
+        static S32 const c_nullNode = -1;
+
+    private:
+
+        //////////////////////////////////////////
+        struct Node
+        {
+            //////////////////////////////////////////
+            inline bool isLeaf() const { return child1 == c_nullNode; }
+
+            AABB3D aabb;
+            void* userData = nullptr;
+
+            // Next free node for the nodes in the free list
+            S32 parent = c_nullNode;
+            S32 child1 = c_nullNode;
+            S32 child2 = c_nullNode;
+
+            // Leaf = 0, free node = -1
+            S32 height = -1;
+        };
+
+        //////////////////////////////////////////
+        struct QueryStackEntry
+        {
+            S32 nodeId;
+            bool inside;
+        };
+
+    public:
+
+        //////////////////////////////////////////
+        DynamicAABBTree3D(F32 _fatMargin = 0.1f);
+
+        //////////////////////////////////////////
+        DynamicAABBTree3D(DynamicAABBTree3D const&) = delete;
+
+        //////////////////////////////////////////
+        DynamicAABBTree3D& operator=(DynamicAABBTree3D const&) = delete;
+
+
+        //////////////////////////////////////////
+        S32 createProxy(AABB3D const& _aabb, void* _userData);
+
+        //////////////////////////////////////////
+        void destroyProxy(S32 _proxyId);
+
+        //////////////////////////////////////////
+        // Returns true if the proxy was reinserted.
+        // Nothing is changed while _aabb is still inside the fat AABB
+        bool moveProxy(S32 _proxyId, AABB3D const& _aabb);
+
+        //////////////////////////////////////////
+        inline void* getUserData(S32 _proxyId) const { return m_nodes[_proxyId].userData; }
+
+        //////////////////////////////////////////
+        inline void setUserData(S32 _proxyId, void* _userData) { m_nodes[_proxyId].userData = _userData; }
+
+        //////////////////////////////////////////
+        inline AABB3D const& getFatAABB(S32 _proxyId) const { return m_nodes[_proxyId].aabb; }
+
+        //////////////////////////////////////////
+        inline S32 getProxiesCount() const { return m_proxiesCount; }
+
+        //////////////////////////////////////////
+        inline S32 getHeight() const { return m_root != c_nullNode ? m_nodes[m_root].height : 0; }
+
+        //////////////////////////////////////////
+        inline F32 getFatMargin() const { return m_fatMargin; }
+
+        //////////////////////////////////////////
+        void clear();
+
+
+        //////////////////////////////////////////
+        // _test(AABB3D const&) -> AABBContainment is called for the visited nodes.
+        // Subtrees which are fully inside are reported without further tests.
+        // _callback(S32 _proxyId, void* _userData) is called for every accepted leaf.
+        // Not reentrant - the traversal stack is shared
+        template <typename TTestFunction, typename TCallback>
+        inline void query(
+            TTestFunction const& _test,
+            TCallback const& _callback) const
+        {
+            if (m_root == c_nullNode)
+                return;
+
+            m_queryStack.clear();
+            m_queryStack.push_back({ m_root, false });
+
+            while (!m_queryStack.empty())
+            {
+                QueryStackEntry entry = m_queryStack.back();
+                m_queryStack.pop_back();
+
+                Node const& node = m_nodes[entry.nodeId];
+
+                if (!entry.inside)
+                {
+                    AABBContainment containment = _test(node.aabb);
+                    if (containment == AABBContainment::Outside)
+                        continue;
+
+                    entry.inside = (containment == AABBContainment::Inside);
+                }
+
+                if (node.isLeaf())
+                {
+                    _callback(entry.nodeId, node.userData);
+                }
+                else
+                {
+                    m_queryStack.push_back({ node.child1, entry.inside });
+                    m_queryStack.push_back({ node.child2, entry.inside });
+                }
+            }
+        }
+
+        //////////////////////////////////////////
+        template <typename TCallback>
+        inline void queryAABB(
+            AABB3D const& _aabb,
+            TCallback const& _callback) const
+        {
+            query(
+                [&_aabb](AABB3D const& _nodeAABB)
+                {
+                    if (!_aabb.intersects(_nodeAABB))
+                        return AABBContainment::Outside;
+
+                    return _aabb.contains(_nodeAABB) ? AABBContainment::Inside : AABBContainment::Intersects;
+                },
+                _callback);
+        }
+
+    protected:
+
+        //////////////////////////////////////////
+        S32 allocateNode();
+
+        //////////////////////////////////////////
+        void freeNode(S32 _nodeId);
+
+        //////////////////////////////////////////
+        void insertLeaf(S32 _leaf);
+
+        //////////////////////////////////////////
+        void removeLeaf(S32 _leaf);
+
+        //////////////////////////////////////////
+        S32 balance(S32 _nodeId);
+
+        //////////////////////////////////////////
+        void refitAncestors(S32 _nodeId);
+
+        //////////////////////////////////////////
+        AABB3D calculateFatAABB(AABB3D const& _aabb) const;
+
+    private:
+        Vector<Node> m_nodes;
+        S32 m_root = c_nullNode;
+        S32 m_freeList = c_nullNode;
+        S32 m_proxiesCount = 0;
+        F32 m_fatMargin = 0.1f;
+
+        mutable Vector<QueryStackEntry> m_queryStack;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeDynamicAABBTree3D_hpp_
+//////////////////////////////////////////
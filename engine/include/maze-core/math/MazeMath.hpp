@@ -481,6 +481,12 @@ namespace Maze
             return expf(_value);
         }
 
+        //////////////////////////////////////////
+        inline F32 Log(F32 _value)
+        {
+            return logf(_value);
+        }
+
         //////////////////////////////////////////
         template <class TValue>
         inline TValue Sign(TValue const& _value)
@@ -0,0 +1,253 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeSimd_hpp_))
+#define _MazeSimd_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-core/MazeCoreHeader.hpp"
+#include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/math/MazeMath.hpp"
+
+
+//////////////////////////////////////////
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#   define MAZE_SIMD_SSE (1)
+#   include <emmintrin.h>
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#   define MAZE_SIMD_NEON (1)
+#   include <arm_neon.h>
+#endif
+
+#if (!defined(MAZE_SIMD_SSE))
+#   define MAZE_SIMD_SSE (0)
+#endif
+
+#if (!defined(MAZE_SIMD_NEON))
+#   define MAZE_SIMD_NEON (0)
+#endif
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Struct Simd4F
+    // 4 x F32 vector. SSE2/NEON when available, scalar fallback otherwise.
+    // Loads and stores are unaligned
+    //
+    //////////////////////////////////////////
+    struct Simd4F
+    {
+#if (MAZE_SIMD_SSE)
+        using ValueType = __m128;
+#elif (MAZE_SIMD_NEON)
+        using ValueType = float32x4_t;
+#else
+        struct ValueType { F32 v[4]; };
+#endif
+
+        //////////////////////////////////////////
+        static MAZE_FORCEINLINE Simd4F Load(F32 const* _data)
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_loadu_ps(_data) };
+#elif (MAZE_SIMD_NEON)
+            return Simd4F{ vld1q_f32(_data) };
+#else
+            return Simd4F{ { { _data[0], _data[1], _data[2], _data[3] } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        static MAZE_FORCEINLINE Simd4F Splat(F32 _value)
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_set1_ps(_value) };
+#elif (MAZE_SIMD_NEON)
+            return Simd4F{ vdupq_n_f32(_value) };
+#else
+            return Simd4F{ { { _value, _value, _value, _value } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        static MAZE_FORCEINLINE Simd4F Zero() { return Splat(0.0f); }
+
+        //////////////////////////////////////////
+        MAZE_FORCEINLINE void store(F32* _data) const
+        {
+#if (MAZE_SIMD_SSE)
+            _mm_storeu_ps(_data, value);
+#elif (MAZE_SIMD_NEON)
+            vst1q_f32(_data, value);
+#else
+            for (S32 i = 0; i < 4; ++i)
+                _data[i] = value.v[i];
+#endif
+        }
+
+        //////////////////////////////////////////
+        MAZE_FORCEINLINE Simd4F operator+(Simd4F const& _other) const
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_add_ps(value, _other.value) };
+#elif (MAZE_SIMD_NEON)
+            return Simd4F{ vaddq_f32(value, _other.value) };
+#else
+            return Simd4F{ { { value.v[0] + _other.value.v[0], value.v[1] + _other.value.v[1], value.v[2] + _other.value.v[2], value.v[3] + _other.value.v[3] } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        MAZE_FORCEINLINE Simd4F operator-(Simd4F const& _other) const
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_sub_ps(value, _other.value) };
+#elif (MAZE_SIMD_NEON)
+            return Simd4F{ vsubq_f32(value, _other.value) };
+#else
+            return Simd4F{ { { value.v[0] - _other.value.v[0], value.v[1] - _other.value.v[1], value.v[2] - _other.value.v[2], value.v[3] - _other.value.v[3] } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        MAZE_FORCEINLINE Simd4F operator*(Simd4F const& _other) const
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_mul_ps(value, _other.value) };
+#elif (MAZE_SIMD_NEON)
+            return Simd4F{ vmulq_f32(value, _other.value) };
+#else
+            return Simd4F{ { { value.v[0] * _other.value.v[0], value.v[1] * _other.value.v[1], value.v[2] * _other.value.v[2], value.v[3] * _other.value.v[3] } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        MAZE_FORCEINLINE Simd4F& operator+=(Simd4F const& _other) { return *this = *this + _other; }
+
+        //////////////////////////////////////////
+        MAZE_FORCEINLINE Simd4F& operator*=(Simd4F const& _other) { return *this = *this * _other; }
+
+        //////////////////////////////////////////
+        // _a * _b + _c
+        static MAZE_FORCEINLINE Simd4F MulAdd(Simd4F const& _a, Simd4F const& _b, Simd4F const& _c)
+        {
+#if (MAZE_SIMD_NEON)
+            return Simd4F{ vmlaq_f32(_c.value, _a.value, _b.value) };
+#else
+            return _a * _b + _c;
+#endif
+        }
+
+        //////////////////////////////////////////
+        static MAZE_FORCEINLINE Simd4F Min(Simd4F const& _a, Simd4F const& _b)
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_min_ps(_a.value, _b.value) };
+#elif (MAZE_SIMD_NEON)
+            return Simd4F{ vminq_f32(_a.value, _b.value) };
+#else
+            return Simd4F{ { { Math::Min(_a.value.v[0], _b.value.v[0]), Math::Min(_a.value.v[1], _b.value.v[1]), Math::Min(_a.value.v[2], _b.value.v[2]), Math::Min(_a.value.v[3], _b.value.v[3]) } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        static MAZE_FORCEINLINE Simd4F Max(Simd4F const& _a, Simd4F const& _b)
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_max_ps(_a.value, _b.value) };
+#elif (MAZE_SIMD_NEON)
+            return Simd4F{ vmaxq_f32(_a.value, _b.value) };
+#else
+            return Simd4F{ { { Math::Max(_a.value.v[0], _b.value.v[0]), Math::Max(_a.value.v[1], _b.value.v[1]), Math::Max(_a.value.v[2], _b.value.v[2]), Math::Max(_a.value.v[3], _b.value.v[3]) } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        // 1 / sqrt(_a). NEON estimation is refined by two Newton-Raphson steps
+        static MAZE_FORCEINLINE Simd4F InvSqrt(Simd4F const& _a)
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_a.value)) };
+#elif (MAZE_SIMD_NEON)
+            float32x4_t e = vrsqrteq_f32(_a.value);
+            e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(_a.value, e), e));
+            e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(_a.value, e), e));
+            return Simd4F{ e };
+#else
+            return Simd4F{ { { 1.0f / Math::Sqrt(_a.value.v[0]), 1.0f / Math::Sqrt(_a.value.v[1]), 1.0f / Math::Sqrt(_a.value.v[2]), 1.0f / Math::Sqrt(_a.value.v[3]) } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        // 1 / _a. NEON estimation is refined by two Newton-Raphson steps
+        static MAZE_FORCEINLINE Simd4F Reciprocal(Simd4F const& _a)
+        {
+#if (MAZE_SIMD_SSE)
+            return Simd4F{ _mm_div_ps(_mm_set1_ps(1.0f), _a.value) };
+#elif (MAZE_SIMD_NEON)
+            float32x4_t e = vrecpeq_f32(_a.value);
+            e = vmulq_f32(e, vrecpsq_f32(_a.value, e));
+            e = vmulq_f32(e, vrecpsq_f32(_a.value, e));
+            return Simd4F{ e };
+#else
+            return Simd4F{ { { 1.0f / _a.value.v[0], 1.0f / _a.value.v[1], 1.0f / _a.value.v[2], 1.0f / _a.value.v[3] } } };
+#endif
+        }
+
+        //////////////////////////////////////////
+        // Negates the lanes of _a where _sign is negative
+        static MAZE_FORCEINLINE Simd4F NegateIfNegative(Simd4F const& _a, Simd4F const& _sign)
+        {
+#if (MAZE_SIMD_SSE)
+            __m128 signBits = _mm_and_ps(_sign.value, _mm_set1_ps(-0.0f));
+            return Simd4F{ _mm_xor_ps(_a.value, signBits) };
+#elif (MAZE_SIMD_NEON)
+            uint32x4_t signBits = vandq_u32(vreinterpretq_u32_f32(_sign.value), vdupq_n_u32(0x80000000u));
+            return Simd4F{ vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(_a.value), signBits)) };
+#else
+            Simd4F result = _a;
+            for (S32 i = 0; i < 4; ++i)
+                if (_sign.value.v[i] < 0.0f)
+                    result.value.v[i] = -result.value.v[i];
+            return result;
+#endif
+        }
+
+        ValueType value;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeSimd_hpp_
+//////////////////////////////////////////
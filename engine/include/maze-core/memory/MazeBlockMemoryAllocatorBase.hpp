@@ -0,0 +1,432 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeBlockMemoryAllocatorBase_hpp_))
+#define _MazeBlockMemoryAllocatorBase_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/MazeStdTypes.hpp"
+#include "maze-core/system/MazeMutex.hpp"
+#include "maze-core/memory/MazeMemoryAllocatorBase.hpp"
+#include "maze-core/math/MazeMath.hpp"
+#include "maze-core/helpers/MazeLogHelper.hpp"
+#include <atomic>
+#include <algorithm>
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class BlockMemoryAllocatorBase
+    //
+    // Fixed size blocks allocator over the platform page pool (TPagePool should
+    // provide allocPage, freePage, freePages, getPages and getPagesCount).
+    // The allocator with enabled thread cache keeps per-thread magazines of free blocks
+    // in front of the shared free list, so the common alloc/free path takes no lock.
+    // Only one instance of the allocator type may own the thread caches,
+    // other instances always use the shared list.
+    // Blocks sitting in the magazine of a thread keep their pages alive - trim
+    // cannot release them until that thread flushes its cache or exits.
+    //
+    //////////////////////////////////////////
+    template <Size TBlockSize, Size TPageSize, Size TAlignment, typename TPagePool>
+    class BlockMemoryAllocatorBase
+        : protected TPagePool
+        , public MemoryAllocatorBase
+    {
+    public:
+
+        //////////////////////////////////////////
+        static Size const c_alignedBlockSize = Math::Align(TBlockSize < sizeof(void*) ? sizeof(void*) : TBlockSize, TAlignment);
+        static Size const c_blocksPerPage = TPageSize / c_alignedBlockSize;
+
+        //////////////////////////////////////////
+        // Magazine is about 4KB, but not less than 16 and not more than 256 blocks
+        static U32 const c_threadCacheCapacity = U32(
+            (4096 / c_alignedBlockSize) < 16 ? 16 : (4096 / c_alignedBlockSize) > 256 ? 256 : (4096 / c_alignedBlockSize));
+        static U32 const c_threadCacheBatchSize = c_threadCacheCapacity / 2;
+
+        static_assert(c_blocksPerPage > 0, "Page is too small for the block!");
+
+    protected:
+
+        //////////////////////////////////////////
+        struct ThreadCache
+        {
+            //////////////////////////////////////////
+            ~ThreadCache()
+            {
+                if (owner && owner == s_threadCacheOwner.load(std::memory_order_acquire))
+                {
+                    owner->flushThreadCache(*this, getCount());
+                    owner->detachThreadCache(*this);
+                }
+            }
+
+            //////////////////////////////////////////
+            // Written by the cache thread only, read by getStats from any thread
+            inline U32 getCount() const { return count.load(std::memory_order_relaxed); }
+
+            //////////////////////////////////////////
+            inline void setCount(U32 _count) { count.store(_count, std::memory_order_relaxed); }
+
+            BlockMemoryAllocatorBase* owner = nullptr;
+            void* head = nullptr;
+            std::atomic<U32> count{ 0u };
+            ThreadCache* prev = nullptr;
+            ThreadCache* next = nullptr;
+        };
+
+    public:
+
+        ////////////////////////////////////
+        BlockMemoryAllocatorBase()
+        {}
+
+        ////////////////////////////////////
+        ~BlockMemoryAllocatorBase()
+        {
+            BlockMemoryAllocatorBase* owner = this;
+            s_threadCacheOwner.compare_exchange_strong(owner, nullptr);
+        }
+
+
+        ////////////////////////////////////
+        // Returns false if the thread cache is owned by another instance of this type
+        bool enableThreadCache()
+        {
+            BlockMemoryAllocatorBase* owner = nullptr;
+            if (s_threadCacheOwner.compare_exchange_strong(owner, this))
+                return true;
+
+            return owner == this;
+        }
+
+        ////////////////////////////////////
+        inline bool getThreadCacheEnabled() const { return s_threadCacheOwner.load(std::memory_order_relaxed) == this; }
+
+
+        ////////////////////////////////////
+        void* allocBlock()
+        {
+            if (getThreadCacheEnabled())
+            {
+                ThreadCache& cache = GetThreadCache();
+                if (!cache.head)
+                {
+                    attachThreadCache(cache);
+                    refillThreadCache(cache);
+                    if (!cache.head)
+                        return nullptr;
+                }
+
+                void* block = cache.head;
+                cache.head = *(void**)block;
+                cache.setCount(cache.getCount() - 1u);
+                return block;
+            }
+
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            if (!m_head)
+                formatNewPage();
+
+            if (!m_head)
+                return nullptr;
+
+            void* block = m_head;
+            m_head = *(void**)m_head;
+            --m_freeBlocksCount;
+            return block;
+        }
+
+        ////////////////////////////////////
+        void freeBlock(void* _block)
+        {
+            if (getThreadCacheEnabled())
+            {
+                ThreadCache& cache = GetThreadCache();
+                attachThreadCache(cache);
+                *(void**)_block = cache.head;
+                cache.head = _block;
+                cache.setCount(cache.getCount() + 1u);
+
+                if (cache.getCount() > c_threadCacheCapacity)
+                    flushThreadCache(cache, c_threadCacheBatchSize);
+                return;
+            }
+
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            *(void**)_block = m_head;
+            m_head = _block;
+            ++m_freeBlocksCount;
+        }
+
+        ////////////////////////////////////
+        // Returns the blocks cached by the current thread to the shared list
+        void flushCurrentThreadCache()
+        {
+            if (!getThreadCacheEnabled())
+                return;
+
+            ThreadCache& cache = GetThreadCache();
+            flushThreadCache(cache, cache.getCount());
+        }
+
+
+        ////////////////////////////////////
+        virtual Size getAllocatedMemorySize() MAZE_OVERRIDE
+        {
+            return this->getPagesCount() * TPageSize;
+        }
+
+        ////////////////////////////////////
+        virtual MemoryAllocatorStats getStats() MAZE_OVERRIDE
+        {
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            // Magazines fill levels are read without their threads synchronization,
+            // so the value is a snapshot which may be a few blocks behind.
+            // It is clamped, so the counters never exceed the blocks of the pages
+            Size totalBlocksCount = this->getPagesCount() * c_blocksPerPage;
+            Size freeBlocksCount = Math::Min(m_freeBlocksCount, totalBlocksCount);
+            Size cachedBlocksCount = 0u;
+            for (ThreadCache* cache = m_threadCaches; cache; cache = cache->next)
+                cachedBlocksCount += cache->getCount();
+            cachedBlocksCount = Math::Min(cachedBlocksCount, totalBlocksCount - freeBlocksCount);
+
+            MemoryAllocatorStats stats;
+            stats.allocatedMemorySize = this->getPagesCount() * TPageSize;
+            stats.blockSize = c_alignedBlockSize;
+            stats.pagesCount = this->getPagesCount();
+            stats.peakPagesCount = m_peakPagesCount;
+            stats.trimmedPagesCount = m_trimmedPagesCount;
+            stats.freeBlocksCount = freeBlocksCount;
+            stats.cachedBlocksCount = cachedBlocksCount;
+            stats.usedBlocksCount = totalBlocksCount - freeBlocksCount - cachedBlocksCount;
+            return stats;
+        }
+
+        ////////////////////////////////////
+        // Releases the pages with all blocks in the shared free list.
+        // Blocks kept by the caches of other threads are not touched,
+        // so their pages stay allocated (see the class comment)
+        virtual Size trim() MAZE_OVERRIDE
+        {
+            flushCurrentThreadCache();
+
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            if (m_freeBlocksCount < c_blocksPerPage)
+                return 0u;
+
+            StdVector<void*> pages = this->getPages();
+            std::sort(pages.begin(), pages.end());
+
+            StdVector<U32> freeBlocksPerPage(pages.size(), 0u);
+            for (void* block = m_head; block; block = *(void**)block)
+                ++freeBlocksPerPage[findPageIndex(pages, block)];
+
+            // Rebuild the free list without the blocks of the released pages
+            void* head = nullptr;
+            void** tail = &head;
+            void* block = m_head;
+            while (block)
+            {
+                void* next = *(void**)block;
+                if (freeBlocksPerPage[findPageIndex(pages, block)] != c_blocksPerPage)
+                {
+                    *tail = block;
+                    tail = (void**)block;
+                }
+                block = next;
+            }
+            *tail = nullptr;
+            m_head = head;
+
+            // Sorted, so the pool releases all of them in one pass
+            StdVector<void*> releasedPages;
+            for (Size i = 0, in = pages.size(); i < in; ++i)
+                if (freeBlocksPerPage[i] == c_blocksPerPage)
+                    releasedPages.push_back(pages[i]);
+
+            Size releasedPagesCount = releasedPages.size();
+            if (releasedPagesCount > 0u)
+                this->freePages(releasedPages);
+
+            m_freeBlocksCount -= releasedPagesCount * c_blocksPerPage;
+            m_trimmedPagesCount += releasedPagesCount;
+
+            return releasedPagesCount * TPageSize;
+        }
+
+    protected:
+
+        ////////////////////////////////////
+        static inline ThreadCache& GetThreadCache()
+        {
+            static thread_local ThreadCache s_threadCache;
+            return s_threadCache;
+        }
+
+        ////////////////////////////////////
+        static inline Size findPageIndex(StdVector<void*> const& _sortedPages, void* _block)
+        {
+            auto it = std::upper_bound(_sortedPages.begin(), _sortedPages.end(), _block);
+            MAZE_DEBUG_ASSERT(it != _sortedPages.begin());
+            return Size(it - _sortedPages.begin()) - 1u;
+        }
+
+        ////////////////////////////////////
+        // Links the cache of the current thread into the list read by getStats
+        inline void attachThreadCache(ThreadCache& _cache)
+        {
+            if (_cache.owner == this)
+                return;
+
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            _cache.owner = this;
+            _cache.prev = nullptr;
+            _cache.next = m_threadCaches;
+            if (m_threadCaches)
+                m_threadCaches->prev = &_cache;
+            m_threadCaches = &_cache;
+        }
+
+        ////////////////////////////////////
+        void detachThreadCache(ThreadCache& _cache)
+        {
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            if (_cache.prev)
+                _cache.prev->next = _cache.next;
+            else
+                m_threadCaches = _cache.next;
+
+            if (_cache.next)
+                _cache.next->prev = _cache.prev;
+
+            _cache.owner = nullptr;
+            _cache.prev = nullptr;
+            _cache.next = nullptr;
+        }
+
+        ////////////////////////////////////
+        void refillThreadCache(ThreadCache& _cache)
+        {
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            if (!m_head)
+                formatNewPage();
+
+            U32 count = 0u;
+            while (m_head && count < c_threadCacheBatchSize)
+            {
+                void* block = m_head;
+                m_head = *(void**)block;
+                *(void**)block = _cache.head;
+                _cache.head = block;
+                ++count;
+            }
+
+            _cache.setCount(_cache.getCount() + count);
+            m_freeBlocksCount -= count;
+        }
+
+        ////////////////////////////////////
+        void flushThreadCache(ThreadCache& _cache, U32 _count)
+        {
+            if (_count == 0u)
+                return;
+
+            // Detach the chain before taking the lock
+            void* first = _cache.head;
+            void* last = first;
+            for (U32 i = 1u; i < _count; ++i)
+                last = *(void**)last;
+
+            _cache.head = *(void**)last;
+            _cache.setCount(_cache.getCount() - _count);
+
+            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
+
+            *(void**)last = m_head;
+            m_head = first;
+            m_freeBlocksCount += _count;
+        }
+
+        ////////////////////////////////////
+        void formatNewPage()
+        {
+            void* page = this->allocPage();
+            if (!page)
+                return;
+
+            void* block = page;
+            for (Size i = 0; i < c_blocksPerPage - 1; i++)
+            {
+                void* next = (S8*)block + c_alignedBlockSize;
+                *(void**)block = next;
+                block = next;
+            }
+
+            *(void**)block = m_head;
+            m_head = page;
+            m_freeBlocksCount += c_blocksPerPage;
+            m_peakPagesCount = Math::Max(m_peakPagesCount, this->getPagesCount());
+        }
+
+    protected:
+        void* m_head = nullptr;
+        Size m_freeBlocksCount = 0u;
+        ThreadCache* m_threadCaches = nullptr;
+        Size m_peakPagesCount = 0u;
+        Size m_trimmedPagesCount = 0u;
+        Mutex m_mutex;
+
+        static std::atomic<BlockMemoryAllocatorBase*> s_threadCacheOwner;
+    };
+
+
+    //////////////////////////////////////////
+    template <Size TBlockSize, Size TPageSize, Size TAlignment, typename TPagePool>
+    std::atomic<BlockMemoryAllocatorBase<TBlockSize, TPageSize, TAlignment, TPagePool>*>
+        BlockMemoryAllocatorBase<TBlockSize, TPageSize, TAlignment, TPagePool>::s_threadCacheOwner{ nullptr };
+
+    
+} // namespace Maze
+//////////////////////////////////////////
+    
+
+#endif // _MazeBlockMemoryAllocatorBase_hpp_
+//////////////////////////////////////////
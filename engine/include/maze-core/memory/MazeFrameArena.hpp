@@ -0,0 +1,229 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeFrameArena_hpp_))
+#define _MazeFrameArena_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-core/MazeCoreHeader.hpp"
+#include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/MazeTypes.hpp"
+#include "maze-core/system/MazeMutex.hpp"
+#include <atomic>
+#include <new>
+#include <utility>
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class LinearArena
+    // Bump allocator over a list of memory chunks.
+    // allocate is thread-safe, reset is not (no allocations should be running).
+    // Memory is never returned to the arena separately - only all at once with reset,
+    // objects created with construct are not destroyed by the arena
+    //
+    //////////////////////////////////////////
+    class MAZE_CORE_API LinearArena
+    {
+    public:
+
+        //////////////////////////////////////////
+        static Size const c_defaultChunkSize = 64 * 1024;
+
+        //////////////////////////////////////////
+        static Size const c_maxAlignment = 16;
+
+    private:
+
+        //////////////////////////////////////////
+        // Header of the chunk memory block, the data follows it
+        struct Chunk
+        {
+            U8* data = nullptr;
+            Size capacity = 0u;
+            std::atomic<Size> offset{ 0u };
+        };
+
+    public:
+
+        //////////////////////////////////////////
+        LinearArena(Size _chunkSize = c_defaultChunkSize);
+
+        //////////////////////////////////////////
+        ~LinearArena();
+
+        //////////////////////////////////////////
+        LinearArena(LinearArena const&) = delete;
+
+        //////////////////////////////////////////
+        LinearArena& operator=(LinearArena const&) = delete;
+
+
+        //////////////////////////////////////////
+        void* allocate(Size _size, Size _alignment = c_maxAlignment);
+
+        //////////////////////////////////////////
+        template <typename T>
+        inline T* allocateArray(Size _count)
+        {
+            static_assert(alignof(T) <= c_maxAlignment, "Type alignment is too big!");
+            return static_cast<T*>(allocate(sizeof(T) * _count, alignof(T)));
+        }
+
+        //////////////////////////////////////////
+        template <typename T, typename ...TArgs>
+        inline T* construct(TArgs&&... _args)
+        {
+            static_assert(alignof(T) <= c_maxAlignment, "Type alignment is too big!");
+            void* memory = allocate(sizeof(T), alignof(T));
+            if (!memory)
+                return nullptr;
+
+            return ::new (memory) T(std::forward<TArgs>(_args)...);
+        }
+
+        //////////////////////////////////////////
+        // Rewinds the arena. If the memory was spread across several chunks
+        // they are merged into a single one, so the steady state is one chunk
+        void reset();
+
+        //////////////////////////////////////////
+        // Frees all the chunks
+        void release();
+
+
+        //////////////////////////////////////////
+        Size getUsedSize() const;
+
+        //////////////////////////////////////////
+        Size getCapacity() const;
+
+        //////////////////////////////////////////
+        inline Size getPeakUsedSize() const { return m_peakUsedSize; }
+
+        //////////////////////////////////////////
+        inline Size getChunksCount() const { return m_chunks.size(); }
+
+        //////////////////////////////////////////
+        inline void setChunkSize(Size _chunkSize) { m_chunkSize = _chunkSize; }
+
+        //////////////////////////////////////////
+        inline Size getChunkSize() const { return m_chunkSize; }
+
+    protected:
+
+        //////////////////////////////////////////
+        Chunk* addChunk(Size _capacity);
+
+        //////////////////////////////////////////
+        void freeChunks();
+
+    private:
+        Size m_chunkSize = c_defaultChunkSize;
+
+        Vector<Chunk*> m_chunks;
+        std::atomic<Chunk*> m_currentChunk{ nullptr };
+        Mutex m_chunksMutex;
+
+        Size m_peakUsedSize = 0u;
+    };
+
+
+    //////////////////////////////////////////
+    // Class FrameArena
+    // Double-buffered LinearArena. Memory allocated during the frame stays valid
+    // until the end of the next frame - swap rewinds the buffer of the frame before previous
+    //
+    //////////////////////////////////////////
+    class MAZE_CORE_API FrameArena
+    {
+    public:
+
+        //////////////////////////////////////////
+        FrameArena(Size _chunkSize = LinearArena::c_defaultChunkSize);
+
+        //////////////////////////////////////////
+        FrameArena(FrameArena const&) = delete;
+
+        //////////////////////////////////////////
+        FrameArena& operator=(FrameArena const&) = delete;
+
+
+        //////////////////////////////////////////
+        inline void* allocate(Size _size, Size _alignment = LinearArena::c_maxAlignment)
+        {
+            return getCurrentArena().allocate(_size, _alignment);
+        }
+
+        //////////////////////////////////////////
+        template <typename T>
+        inline T* allocateArray(Size _count)
+        {
+            return getCurrentArena().allocateArray<T>(_count);
+        }
+
+        //////////////////////////////////////////
+        template <typename T, typename ...TArgs>
+        inline T* construct(TArgs&&... _args)
+        {
+            return getCurrentArena().construct<T>(std::forward<TArgs>(_args)...);
+        }
+
+        //////////////////////////////////////////
+        // Should be called once per frame when nothing allocates from the arena
+        void swap();
+
+        //////////////////////////////////////////
+        void release();
+
+
+        //////////////////////////////////////////
+        inline LinearArena& getCurrentArena() { return m_arenas[m_currentArenaIndex]; }
+
+        //////////////////////////////////////////
+        inline LinearArena& getPreviousArena() { return m_arenas[m_currentArenaIndex ^ 1u]; }
+
+        //////////////////////////////////////////
+        inline U32 getFrameIndex() const { return m_frameIndex; }
+
+    private:
+        LinearArena m_arenas[2];
+        U32 m_currentArenaIndex = 0u;
+        U32 m_frameIndex = 0u;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeFrameArena_hpp_
+//////////////////////////////////////////
@@ -107,12 +107,18 @@ namespace Maze
 
     //////////////////////////////////////////
     MAZE_CORE_API std::string BuildMemoryAllocatorsDebugInfo();
+
+    //////////////////////////////////////////
+    // Returns fully free pages of all registered allocators to the OS.
+    // Useful after the level unload. Returns released bytes count
+    MAZE_CORE_API Size TrimMemoryAllocators();
     
     //////////////////////////////////////////
     template <Size TBlockSize, Size TPageSize = 65536, Size TAlignment = 8>
     BlockMemoryAllocator<TBlockSize, TPageSize, TAlignment>& CreateBlockMemoryAllocator()
     {
         static BlockMemoryAllocator<TBlockSize, TPageSize, TAlignment> s_allocator;
+        s_allocator.enableThreadCache();
         RegisterMemoryAllocator(&s_allocator);
         return s_allocator;
     }
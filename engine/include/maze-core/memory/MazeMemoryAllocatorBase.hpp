@@ -37,6 +37,25 @@
 //////////////////////////////////////////
 namespace Maze
 {
+    //////////////////////////////////////////
+    // Struct MemoryAllocatorStats
+    //
+    //////////////////////////////////////////
+    struct MemoryAllocatorStats
+    {
+        Size allocatedMemorySize = 0u;
+        Size blockSize = 0u;
+        Size pagesCount = 0u;
+        Size peakPagesCount = 0u;
+        Size trimmedPagesCount = 0u;
+        Size usedBlocksCount = 0u;
+        Size freeBlocksCount = 0u;
+
+        // Free blocks kept by the thread caches
+        Size cachedBlocksCount = 0u;
+    };
+
+
     //////////////////////////////////////////
     // Class MemoryAllocatorBase
     //
@@ -50,6 +69,18 @@ namespace Maze
 
         //////////////////////////////////////////
         virtual Size getAllocatedMemorySize() { return 0; }
+
+        //////////////////////////////////////////
+        virtual MemoryAllocatorStats getStats()
+        {
+            MemoryAllocatorStats stats;
+            stats.allocatedMemorySize = getAllocatedMemorySize();
+            return stats;
+        }
+
+        //////////////////////////////////////////
+        // Returns unused memory to the OS, returns released bytes count
+        virtual Size trim() { return 0; }
     };
 
     
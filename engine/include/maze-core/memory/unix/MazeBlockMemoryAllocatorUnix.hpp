@@ -34,6 +34,7 @@
 #include "maze-core/MazeStdTypes.hpp"
 #include "maze-core/system/MazeMutex.hpp"
 #include "maze-core/memory/MazeMemoryAllocatorBase.hpp"
+#include "maze-core/memory/MazeBlockMemoryAllocatorBase.hpp"
 #include "maze-core/math/MazeMath.hpp"
 #include "maze-core/utils/MazeClassInfo.hpp"
 #include "maze-core/helpers/MazeLogHelper.hpp"
@@ -86,9 +87,45 @@ namespace Maze
             return page;
         }
 
+        //////////////////////////////////////////
+        void freePage(void* _page)
+        {
+            StdVector<void*>::iterator it = std::find(m_pages.begin(), m_pages.end(), _page);
+            MAZE_ERROR_RETURN_IF(it == m_pages.end(), "Unknown page!");
+
+            S32 result = munmap(_page, TPageSize);
+            MAZE_ERROR_IF(result == -1, "munmap failed!");
+
+            *it = m_pages.back();
+            m_pages.pop_back();
+        }
+
+        //////////////////////////////////////////
+        // Releases the listed pages in one pass over the pool
+        void freePages(StdVector<void*> const& _sortedPages)
+        {
+            Size count = 0u;
+            for (Size i = 0, in = m_pages.size(); i < in; ++i)
+            {
+                void* page = m_pages[i];
+                if (std::binary_search(_sortedPages.begin(), _sortedPages.end(), page))
+                {
+                    S32 result = munmap(page, TPageSize);
+                    MAZE_ERROR_IF(result == -1, "munmap failed!");
+                    continue;
+                }
+
+                m_pages[count++] = page;
+            }
+            m_pages.resize(count);
+        }
+
         //////////////////////////////////////////
         inline Size getPagesCount() const { return m_pages.size(); }
 
+        //////////////////////////////////////////
+        inline StdVector<void*> const& getPages() const { return m_pages; }
+
     private:
         StdVector<void*> m_pages;
     };
@@ -101,18 +138,13 @@ namespace Maze
     //////////////////////////////////////////
     template <Size TBlockSize, Size TPageSize = 65536, Size TAlignment = 8>
     class BlockMemoryAllocatorUnix
-        : protected MemoryPagePool<TPageSize>
-        , public MemoryAllocatorBase
+        : public BlockMemoryAllocatorBase<TBlockSize, TPageSize, TAlignment, MemoryPagePool<TPageSize>>
     {
     public:
 
         ////////////////////////////////////
         BlockMemoryAllocatorUnix()
-            : m_head(nullptr)
-        {
-            m_alignedBlockSize = Math::Align(TBlockSize, TAlignment);
-            m_alignedBlocksPerPage = TPageSize / m_alignedBlockSize;
-        }
+        {}
 
         ////////////////////////////////////
         ~BlockMemoryAllocatorUnix()
@@ -121,62 +153,11 @@ namespace Maze
         ////////////////////////////////////
         inline static SharedPtr<BlockMemoryAllocatorUnix> Create() { return Maze::MakeShared<BlockMemoryAllocatorUnix>(); }
 
-        ////////////////////////////////////
-        void* allocBlock()
-        {
-            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
-
-            if (!m_head)
-                formatNewPage();
-
-            void* tmp = m_head;
-            m_head = *(void**)m_head;
-            return tmp;
-        }
-
-        ////////////////////////////////////
-        void freeBlock(void* _tmp) 
-        {
-            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
-
-            *(void**)_tmp = m_head;
-            m_head = _tmp;
-        }
-
         ////////////////////////////////////
         virtual CString getName() MAZE_OVERRIDE
         { 
             return ClassInfo<BlockMemoryAllocatorUnix<TBlockSize, TPageSize, TAlignment>>::Name();
         }
-
-        ////////////////////////////////////
-        virtual Size getAllocatedMemorySize() MAZE_OVERRIDE
-        { 
-            return this->getPagesCount() * TPageSize; 
-        }
-
-    protected:
-
-        ////////////////////////////////////
-        void formatNewPage()
-        {
-            void* tmp = this->allocPage();
-            m_head = tmp;
-            for (Size i = 0; i < m_alignedBlocksPerPage - 1; i++)
-            {
-                void* next = (S8*)tmp + m_alignedBlockSize;
-                *(void**)tmp = next;
-                tmp = next;
-            }
-
-            *(void**)tmp = nullptr;
-        }
-
-    protected:
-        void* m_head;
-        Size m_alignedBlockSize;
-        Size m_alignedBlocksPerPage;
-        Mutex m_mutex;
     };
 
     
@@ -35,6 +35,7 @@
 #include "maze-core/MazeTypes.hpp"
 #include "maze-core/system/MazeMutex.hpp"
 #include "maze-core/memory/MazeMemoryAllocatorBase.hpp"
+#include "maze-core/memory/MazeBlockMemoryAllocatorBase.hpp"
 
 
 //////////////////////////////////////////
@@ -73,9 +74,44 @@ namespace Maze
             return page;
         }
 
+        //////////////////////////////////////////
+        void freePage(void* _page)
+        {
+            StdVector<void*>::iterator it = std::find(m_pages.begin(), m_pages.end(), _page);
+            if (it == m_pages.end())
+                return;
+
+            VirtualFree(_page, 0, MEM_RELEASE);
+
+            *it = m_pages.back();
+            m_pages.pop_back();
+        }
+
+        //////////////////////////////////////////
+        // Releases the listed pages in one pass over the pool
+        void freePages(StdVector<void*> const& _sortedPages)
+        {
+            Size count = 0u;
+            for (Size i = 0, in = m_pages.size(); i < in; ++i)
+            {
+                void* page = m_pages[i];
+                if (std::binary_search(_sortedPages.begin(), _sortedPages.end(), page))
+                {
+                    VirtualFree(page, 0, MEM_RELEASE);
+                    continue;
+                }
+
+                m_pages[count++] = page;
+            }
+            m_pages.resize(count);
+        }
+
         //////////////////////////////////////////
         inline Size getPagesCount() const { return m_pages.size(); }
 
+        //////////////////////////////////////////
+        inline StdVector<void*> const& getPages() const { return m_pages; }
+
     private:
         StdVector<void*> m_pages;
     };
@@ -87,84 +123,26 @@ namespace Maze
     //////////////////////////////////////////
     template <Size TBlockSize, Size TPageSize = 65536, Size TAlignment = 8>
     class BlockMemoryAllocatorWin
-        : private MemoryPagePool<TPageSize>
-        , public MemoryAllocatorBase
+        : public BlockMemoryAllocatorBase<TBlockSize, TPageSize, TAlignment, MemoryPagePool<TPageSize>>
     {
     public:
 
         //////////////////////////////////////////
         BlockMemoryAllocatorWin()
-            : m_head(nullptr)
-        {
-            m_alignedBlockSize = Math::Align(TBlockSize, TAlignment);
-            m_alignedBlocksPerPage = TPageSize / m_alignedBlockSize;
-        }
+        {}
 
         //////////////////////////////////////////
         ~BlockMemoryAllocatorWin()
-        {
-            
-        }
+        {}
 
         //////////////////////////////////////////
         inline static SharedPtr<BlockMemoryAllocatorWin> Create() { return MakeShared<BlockMemoryAllocatorWin>(); }
 
-        //////////////////////////////////////////
-        void* allocBlock()
-        {
-            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
-
-            if (!m_head)
-                formatNewPage();
-
-            void* tmp = m_head;
-            m_head = *(void**)m_head;
-            return tmp;
-        }
-
-        //////////////////////////////////////////
-        void freeBlock(void* _tmp) 
-        {
-            MAZE_MUTEX_SCOPED_LOCK(m_mutex);
-
-            *(void**)_tmp = m_head;
-            m_head = _tmp;
-        }
-
         //////////////////////////////////////////
         virtual CString getName() MAZE_OVERRIDE
         { 
             return ClassInfo<BlockMemoryAllocatorWin<TBlockSize, TPageSize, TAlignment>>::Name();
         }
-
-        //////////////////////////////////////////
-        virtual Size getAllocatedMemorySize() MAZE_OVERRIDE
-        { 
-            return getPagesCount() * TPageSize; 
-        }
-
-    protected:
-
-        //////////////////////////////////////////
-        void formatNewPage()
-        {
-            void* tmp = allocPage();
-            m_head = tmp;
-            for (Size i = 0; i < m_alignedBlocksPerPage - 1; i++)
-            {
-                void* next = (S8*)tmp + m_alignedBlockSize;
-                *(void**)tmp = next;
-                tmp = next;
-            }
-
-            *(void**)tmp = nullptr;
-        }
-
-    protected:
-        void* m_head;
-        Size m_alignedBlockSize;
-        Size m_alignedBlocksPerPage;
-        Mutex m_mutex;
     };
 
     
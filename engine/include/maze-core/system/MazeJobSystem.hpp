@@ -0,0 +1,351 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeJobSystem_hpp_))
+#define _MazeJobSystem_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-core/MazeCoreHeader.hpp"
+#include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/MazeTypes.hpp"
+#include "maze-core/math/MazeMath.hpp"
+#include "maze-core/system/MazeMutex.hpp"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <type_traits>
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Struct JobHandle
+    //
+    //////////////////////////////////////////
+    struct MAZE_CORE_API JobHandle
+    {
+        //////////////////////////////////////////
+        static U32 const c_invalidIndex = U32(-1);
+
+        //////////////////////////////////////////
+        inline bool isValid() const { return index != c_invalidIndex; }
+
+        //////////////////////////////////////////
+        inline bool operator==(JobHandle const& _other) const { return index == _other.index && generation == _other.generation; }
+
+        //////////////////////////////////////////
+        inline bool operator!=(JobHandle const& _other) const { return !(*this == _other); }
+
+        U32 index = c_invalidIndex;
+        U32 generation = 0;
+    };
+
+
+    //////////////////////////////////////////
+    // Class JobWorkStealingQueue
+    // Chase-Lev deque of job indices.
+    // push/pop are allowed from the owner thread only, steal - from any thread
+    //
+    //////////////////////////////////////////
+    class MAZE_CORE_API JobWorkStealingQueue
+    {
+    public:
+
+        //////////////////////////////////////////
+        JobWorkStealingQueue() = default;
+
+        //////////////////////////////////////////
+        JobWorkStealingQueue(JobWorkStealingQueue const&) = delete;
+
+        //////////////////////////////////////////
+        JobWorkStealingQueue& operator=(JobWorkStealingQueue const&) = delete;
+
+
+        //////////////////////////////////////////
+        // _capacity should be power of two
+        void init(U32 _capacity);
+
+        //////////////////////////////////////////
+        bool push(U32 _jobIndex);
+
+        //////////////////////////////////////////
+        bool pop(U32& _outJobIndex);
+
+        //////////////////////////////////////////
+        bool steal(U32& _outJobIndex);
+
+    private:
+        std::atomic<S64> m_top{ 0 };
+        U8 m_padding[64];
+        std::atomic<S64> m_bottom{ 0 };
+        UniquePtr<std::atomic<U32>[]> m_buffer;
+        S64 m_mask = 0;
+    };
+
+
+    //////////////////////////////////////////
+    // Class JobSystem
+    // Paged pool of jobs executed by worker threads with work stealing.
+    // The thread which calls init (the main thread) gets worker index 0
+    // and takes part in the execution while waiting for jobs.
+    //
+    //////////////////////////////////////////
+    class MAZE_CORE_API JobSystem
+    {
+    public:
+
+        //////////////////////////////////////////
+        static Size const c_jobFunctionStorageSize = 64;
+
+        //////////////////////////////////////////
+        static U32 const c_jobPagesMax = 64;
+
+        //////////////////////////////////////////
+        using JobInvokeFunction = void(*)(void*);
+        using JobDestroyFunction = void(*)(void*);
+
+    private:
+
+        //////////////////////////////////////////
+        struct Job
+        {
+            alignas(16) U8 functionStorage[c_jobFunctionStorageSize];
+            JobInvokeFunction invokeFunction = nullptr;
+            JobDestroyFunction destroyFunction = nullptr;
+            U32 parentIndex = JobHandle::c_invalidIndex;
+            std::atomic<S32> unfinishedJobs{ 0 };
+            std::atomic<U32> generation{ 0 };
+            std::atomic<U32> nextFree{ JobHandle::c_invalidIndex };
+        };
+
+        //////////////////////////////////////////
+        template <typename TFunction>
+        static void InvokeJobFunction(void* _storage)
+        {
+            (*reinterpret_cast<TFunction*>(_storage))();
+        }
+
+        //////////////////////////////////////////
+        template <typename TFunction>
+        static void DestroyJobFunction(void* _storage)
+        {
+            reinterpret_cast<TFunction*>(_storage)->~TFunction();
+        }
+
+    public:
+
+        //////////////////////////////////////////
+        JobSystem();
+
+        //////////////////////////////////////////
+        ~JobSystem();
+
+        //////////////////////////////////////////
+        JobSystem(JobSystem const&) = delete;
+
+        //////////////////////////////////////////
+        JobSystem& operator=(JobSystem const&) = delete;
+
+
+        //////////////////////////////////////////
+        // _workersCount < 0 means "hardware concurrency - 1".
+        // _jobsPageSize is the pool growth step (rounded up to power of two)
+        bool init(
+            S32 _workersCount = -1,
+            U32 _jobsPageSize = 4096);
+
+        //////////////////////////////////////////
+        // Waits for the running jobs and joins worker threads
+        void shutdown();
+
+
+        //////////////////////////////////////////
+        // Background workers count (not including the main thread)
+        inline S32 getWorkersCount() const { return m_workersCount; }
+
+        //////////////////////////////////////////
+        // Worker index of the current thread, 0 - main thread, -1 - not a job thread
+        static S32 GetCurrentWorkerIndex();
+
+
+        //////////////////////////////////////////
+        // Creates a job without scheduling it. Child jobs should be created
+        // before the parent is finished (from the parent job itself or before run)
+        template <typename TFunction>
+        inline JobHandle createJob(
+            TFunction&& _function,
+            JobHandle _parent = JobHandle())
+        {
+            using FunctionType = typename std::decay<TFunction>::type;
+            static_assert(sizeof(FunctionType) <= c_jobFunctionStorageSize, "Job function is too big, capture by pointer!");
+            static_assert(alignof(FunctionType) <= 16, "Job function alignment is too big!");
+
+            U32 index = allocateJob();
+            Job& job = getJob(index);
+            new (job.functionStorage) FunctionType(std::forward<TFunction>(_function));
+            job.invokeFunction = &InvokeJobFunction<FunctionType>;
+            job.destroyFunction = &DestroyJobFunction<FunctionType>;
+
+            return initJob(index, _parent);
+        }
+
+        //////////////////////////////////////////
+        // Pushes job into the queue of the current thread
+        void run(JobHandle _handle);
+
+        //////////////////////////////////////////
+        template <typename TFunction>
+        inline JobHandle schedule(
+            TFunction&& _function,
+            JobHandle _parent = JobHandle())
+        {
+            JobHandle handle = createJob(std::forward<TFunction>(_function), _parent);
+            run(handle);
+            return handle;
+        }
+
+        //////////////////////////////////////////
+        // Job is completed when it and all its children are finished
+        bool isCompleted(JobHandle _handle) const;
+
+        //////////////////////////////////////////
+        // Executes other jobs while waiting
+        void wait(JobHandle _handle);
+
+
+        //////////////////////////////////////////
+        // Splits [0, _count) into ranges of _grainSize and calls _function(begin, end) for each range.
+        // Returns when all ranges are processed. _grainSize <= 0 means automatic
+        template <typename TFunction>
+        inline void parallelFor(
+            S32 _count,
+            S32 _grainSize,
+            TFunction const& _function)
+        {
+            if (_count <= 0)
+                return;
+
+            if (_grainSize <= 0)
+                _grainSize = calculateGrainSize(_count);
+
+            if (m_workersCount == 0 || _count <= _grainSize)
+            {
+                _function(0, _count);
+                return;
+            }
+
+            TFunction const* function = &_function;
+            JobHandle root = createJob([]() {});
+            for (S32 begin = 0; begin < _count;)
+            {
+                // Remainder based step - begin + _grainSize may overflow near the S32 max
+                S32 end = begin + Math::Min(_grainSize, _count - begin);
+                run(createJob([function, begin, end]() { (*function)(begin, end); }, root));
+                begin = end;
+            }
+            run(root);
+            wait(root);
+        }
+
+    protected:
+
+        //////////////////////////////////////////
+        inline Job& getJob(U32 _index) const { return m_jobPages[_index >> m_jobsPageShift][_index & m_jobsPageMask]; }
+
+        //////////////////////////////////////////
+        U32 allocateJob();
+
+        //////////////////////////////////////////
+        bool addJobsPage();
+
+        //////////////////////////////////////////
+        JobHandle initJob(U32 _index, JobHandle _parent);
+
+        //////////////////////////////////////////
+        // Increments unfinished jobs counter of the parent, fails if the parent is already completed
+        bool addChildJob(JobHandle _parent);
+
+        //////////////////////////////////////////
+        void releaseJob(U32 _index);
+
+        //////////////////////////////////////////
+        void executeJob(U32 _index);
+
+        //////////////////////////////////////////
+        void finishJob(U32 _index);
+
+        //////////////////////////////////////////
+        bool fetchJob(S32 _workerIndex, U32& _outJobIndex);
+
+        //////////////////////////////////////////
+        bool executeNextJob(S32 _workerIndex);
+
+        //////////////////////////////////////////
+        S32 calculateGrainSize(S32 _count) const;
+
+        //////////////////////////////////////////
+        void workerThreadEntry(S32 _workerIndex);
+
+    private:
+        S32 m_workersCount = 0;
+
+        // Pages are never moved, so the job index stays valid while the pool grows
+        Job* m_jobPages[c_jobPagesMax] = { nullptr };
+        U32 m_jobPagesCount = 0;
+        U32 m_jobsPageShift = 0;
+        U32 m_jobsPageMask = 0;
+        Mutex m_jobPagesMutex;
+
+        // Tagged lock-free stack head: [tag:32][index:32]
+        std::atomic<U64> m_freeJobsHead{ U64(JobHandle::c_invalidIndex) };
+
+        // Queue 0 belongs to the main thread, queues [1, m_workersCount] - to the worker threads
+        UniquePtr<JobWorkStealingQueue[]> m_queues;
+
+        // Jobs pushed from the threads which are not the part of the job system
+        Mutex m_externalQueueMutex;
+        Deque<U32> m_externalQueue;
+        std::atomic<S32> m_externalQueueSize{ 0 };
+
+        Vector<std::thread> m_workerThreads;
+        std::atomic<S32> m_queuedJobsCount{ 0 };
+        std::atomic<S32> m_sleepingWorkersCount{ 0 };
+        std::atomic<bool> m_shutdown{ false };
+        std::mutex m_sleepMutex;
+        std::condition_variable m_sleepCondVar;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeJobSystem_hpp_
+//////////////////////////////////////////
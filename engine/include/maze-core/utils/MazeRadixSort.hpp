@@ -0,0 +1,115 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRadixSort_hpp_))
+#define _MazeRadixSort_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-core/MazeCoreHeader.hpp"
+#include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/MazeTypes.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Struct RadixSortKeyIndex
+    //
+    //////////////////////////////////////////
+    struct MAZE_CORE_API RadixSortKeyIndex
+    {
+        //////////////////////////////////////////
+        RadixSortKeyIndex() = default;
+
+        //////////////////////////////////////////
+        inline RadixSortKeyIndex(U64 _key, U32 _index)
+            : key(_key)
+            , index(_index)
+        {}
+
+        U64 key = 0u;
+        U32 index = 0u;
+    };
+
+
+    //////////////////////////////////////////
+    // Class RadixSorter
+    // Stable LSD radix sort of (key, index) pairs, 8 bits per pass.
+    // Passes over bytes which are the same for every key are skipped,
+    // so keys with unused high bits cost less.
+    // The scratch buffer is kept between the calls - no allocations
+    // once the sorter has seen the biggest array
+    //
+    //////////////////////////////////////////
+    class MAZE_CORE_API RadixSorter
+    {
+    public:
+
+        //////////////////////////////////////////
+        // Smaller arrays are sorted with insertion sort
+        static Size const c_insertionSortThreshold = 64;
+
+    public:
+
+        //////////////////////////////////////////
+        RadixSorter() = default;
+
+        //////////////////////////////////////////
+        RadixSorter(RadixSorter const&) = delete;
+
+        //////////////////////////////////////////
+        RadixSorter& operator=(RadixSorter const&) = delete;
+
+
+        //////////////////////////////////////////
+        // Sorts _items by key in ascending order.
+        // _items may be swapped with the scratch buffer, so the storage
+        // of both vectors is reused by the following calls
+        void sort(Vector<RadixSortKeyIndex>& _items);
+
+        //////////////////////////////////////////
+        void clear();
+
+    protected:
+
+        //////////////////////////////////////////
+        static void InsertionSort(RadixSortKeyIndex* _items, Size _count);
+
+    protected:
+        Vector<RadixSortKeyIndex> m_scratch;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRadixSort_hpp_
+//////////////////////////////////////////
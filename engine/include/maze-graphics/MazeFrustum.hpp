@@ -32,6 +32,7 @@
 //////////////////////////////////////////
 #include "maze-graphics/MazeGraphicsHeader.hpp"
 #include "maze-core/math/MazePlane.hpp"
+#include "maze-core/math/MazeAABB3D.hpp"
 
 
 //////////////////////////////////////////
@@ -53,6 +54,31 @@ namespace Maze
             }
             return true;
         }
+
+        //////////////////////////////////////////
+        inline AABBContainment calculateAABBContainment(AABB3D const& _aabb) const
+        {
+            Vec3F center = _aabb.getCenter();
+            Vec3F halfSize = _aabb.getMax() - center;
+
+            AABBContainment result = AABBContainment::Inside;
+            for (const Plane& plane : planes)
+            {
+                Vec3F const& normal = plane.getNormal();
+                float distance = normal.dotProduct(center) + plane.getD();
+                float radius =
+                    Math::Abs(normal.x) * halfSize.x +
+                    Math::Abs(normal.y) * halfSize.y +
+                    Math::Abs(normal.z) * halfSize.z;
+
+                if (distance < -radius)
+                    return AABBContainment::Outside;
+
+                if (distance < radius)
+                    result = AABBContainment::Intersects;
+            }
+            return result;
+        }
     };
 
 } // namespace Maze
@@ -79,6 +79,12 @@ namespace Maze
         //////////////////////////////////////////
         Texture2DPtr const& getTexture() const { return m_texture; }
 
+        //////////////////////////////////////////
+        inline Vec2U const& getSize() const { return m_size; }
+
+        //////////////////////////////////////////
+        inline PixelFormat::Enum getPixelFormat() const { return m_pixelFormat; }
+
     protected:
         Vec2U m_size;
         PixelFormat::Enum m_pixelFormat;
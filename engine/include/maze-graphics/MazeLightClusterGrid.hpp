@@ -0,0 +1,205 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeLightClusterGrid_hpp_))
+#define _MazeLightClusterGrid_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-graphics/MazeGraphicsHeader.hpp"
+#include "maze-graphics/config/MazeGraphicsConfig.hpp"
+#include "maze-graphics/MazePixelFormat.hpp"
+#include "maze-core/math/MazeVec3.hpp"
+#include "maze-core/math/MazeVec4.hpp"
+#include "maze-core/math/MazeMat4.hpp"
+#include "maze-core/math/MazeTMat.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(LightClusterGrid);
+    MAZE_USING_SHARED_PTR(Texture2D);
+    MAZE_USING_SHARED_PTR(GlobalShaderUniform);
+    MAZE_USING_SHARED_PTR(ShaderManager);
+    class RenderSystem;
+
+
+    //////////////////////////////////////////
+    // Struct LightClusterGridLight
+    //
+    //////////////////////////////////////////
+    struct MAZE_GRAPHICS_API LightClusterGridLight
+    {
+        Vec4F posRadiusWS = Vec4F::c_zero;
+        Vec3F color = Vec3F::c_zero;
+    };
+
+
+    //////////////////////////////////////////
+    // Class LightClusterGrid
+    // Clustered forward lighting: point lights are binned into a froxel grid
+    // (screen tiles x exponential depth slices) on the CPU.
+    // The result is uploaded into three data textures which are read by MazeClusteredLighting.mzglsl:
+    //  - lights: 2 RGBA_F32 texels per light (posRadiusWS, color)
+    //  - grid: RG_F32 texel per cluster (first index, lights count)
+    //  - indices: R_F32 light index per texel
+    //
+    //////////////////////////////////////////
+    class MAZE_GRAPHICS_API LightClusterGrid
+    {
+    public:
+
+        //////////////////////////////////////////
+        static U32 const c_gridSizeX = 16;
+        static U32 const c_gridSizeY = 9;
+        static U32 const c_gridSizeZ = 24;
+        static U32 const c_clustersCount = c_gridSizeX * c_gridSizeY * c_gridSizeZ;
+
+    public:
+
+        //////////////////////////////////////////
+        static LightClusterGridPtr Create(RenderSystem* _renderSystem);
+
+        //////////////////////////////////////////
+        ~LightClusterGrid();
+
+
+        //////////////////////////////////////////
+        // Lights which are over MAZE_CLUSTERED_LIGHTS_MAX are ignored
+        void build(
+            TMat const& _viewMatrix,
+            Mat4F const& _projectionMatrix,
+            F32 _nearZ,
+            F32 _farZ,
+            LightClusterGridLight const* _lights,
+            S32 _lightsCount);
+
+        //////////////////////////////////////////
+        // Uploads the data textures and sets the global shader uniforms.
+        // _viewportRect is in pixels of the render target
+        void upload(
+            ShaderManager* _shaderManager,
+            Vec4F const& _viewportRect);
+
+
+        //////////////////////////////////////////
+        inline S32 getLightsCount() const { return m_lightsCount; }
+
+        //////////////////////////////////////////
+        inline S32 getLightIndicesCount() const { return m_lightIndicesCount; }
+
+        //////////////////////////////////////////
+        inline Texture2DPtr const& getLightsTexture() const { return m_lightsTexture; }
+
+        //////////////////////////////////////////
+        inline Texture2DPtr const& getGridTexture() const { return m_gridTexture; }
+
+        //////////////////////////////////////////
+        inline Texture2DPtr const& getIndicesTexture() const { return m_indicesTexture; }
+
+    protected:
+
+        //////////////////////////////////////////
+        struct ClusterRange
+        {
+            U16 minX = 0;
+            U16 maxX = 0;
+            U16 minY = 0;
+            U16 maxY = 0;
+            U16 minZ = 0;
+            U16 maxZ = 0;
+            bool visible = false;
+        };
+
+        //////////////////////////////////////////
+        struct SliceData
+        {
+            Vector<U32> indices;
+            U32 baseOffset = 0;
+        };
+
+    protected:
+
+        //////////////////////////////////////////
+        LightClusterGrid();
+
+        //////////////////////////////////////////
+        bool init(RenderSystem* _renderSystem);
+
+        //////////////////////////////////////////
+        Texture2DPtr createDataTexture(
+            RenderSystem* _renderSystem,
+            U32 _width,
+            U32 _height,
+            PixelFormat::Enum _pixelFormat);
+
+        //////////////////////////////////////////
+        S32 calculateSlice(F32 _viewZ) const;
+
+        //////////////////////////////////////////
+        void calculateClusterRange(
+            TMat const& _viewMatrix,
+            Mat4F const& _projectionMatrix,
+            Vec4F const& _posRadiusWS,
+            ClusterRange& _outRange) const;
+
+        //////////////////////////////////////////
+        void buildSlice(U32 _z);
+
+        //////////////////////////////////////////
+        inline U32 getClusterIndex(U32 _x, U32 _y, U32 _z) const { return (_z * c_gridSizeY + _y) * c_gridSizeX + _x; }
+
+    protected:
+        F32 m_nearZ = 0.001f;
+        F32 m_farZ = 100.0f;
+        F32 m_sliceScale = 0.0f;
+        F32 m_sliceBias = 0.0f;
+
+        S32 m_lightsCount = 0;
+        S32 m_lightIndicesCount = 0;
+
+        Vector<ClusterRange> m_lightRanges;
+        Vector<SliceData> m_slices;
+
+        Vector<Vec4F> m_lightsData;
+        Vector<Vec2F> m_gridData;
+        Vector<F32> m_indicesData;
+
+        Texture2DPtr m_lightsTexture;
+        Texture2DPtr m_gridTexture;
+        Texture2DPtr m_indicesTexture;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeLightClusterGrid_hpp_
+//////////////////////////////////////////
@@ -42,6 +42,7 @@
 #include "maze-core/system/MazeInputEvent.hpp"
 #include "maze-core/containers/MazeFastVector.hpp"
 #include "maze-core/containers/MazeStringKeyMap.hpp"
+#include "maze-core/math/MazeQuaternion.hpp"
 
 
 //////////////////////////////////////////
@@ -51,6 +52,222 @@ namespace Maze
     MAZE_USING_SHARED_PTR(MeshSkeletonAnimation);
     
 
+    //////////////////////////////////////////
+    // Struct MeshSkeletonAnimationCompressionParams
+    //
+    //////////////////////////////////////////
+    struct MAZE_GRAPHICS_API MeshSkeletonAnimationCompressionParams
+    {
+        // Max value deviation for the constant translation/scale tracks
+        F32 valueTolerance = 0.0001f;
+        // Max (1 - |dot|) deviation for the constant rotation tracks
+        F32 rotationTolerance = 0.000001f;
+        // Max key spacing deviation (relative to the average spacing) for the uniform tracks
+        F32 uniformSpacingTolerance = 0.01f;
+        bool quantizeRotations = true;
+    };
+
+
+    //////////////////////////////////////////
+    // Struct MeshSkeletonQuantizedQuaternion
+    // "Smallest three" encoding - the largest component is dropped and restored from the unit length,
+    // the rest are stored as 15 bit values. Index of the dropped component is stored in the high bits
+    //
+    //////////////////////////////////////////
+    struct MAZE_GRAPHICS_API MeshSkeletonQuantizedQuaternion
+    {
+        //////////////////////////////////////////
+        static inline MeshSkeletonQuantizedQuaternion FromQuaternion(Quaternion const& _q)
+        {
+            S32 largestIndex = 0;
+            for (S32 i = 1; i < 4; ++i)
+                if (Math::Abs(_q[i]) > Math::Abs(_q[largestIndex]))
+                    largestIndex = i;
+
+            F32 sign = _q[largestIndex] < 0.0f ? -1.0f : 1.0f;
+
+            MeshSkeletonQuantizedQuaternion result;
+            S32 k = 0;
+            for (S32 i = 0; i < 4; ++i)
+            {
+                if (i == largestIndex)
+                    continue;
+
+                F32 value = Math::Clamp(_q[i] * sign * c_sqrt2, -1.0f, 1.0f);
+                result.data[k++] = (U16)((value * 0.5f + 0.5f) * c_valueMax + 0.5f);
+            }
+            result.data[0] |= (U16)((largestIndex & 1) << 15);
+            result.data[1] |= (U16)((largestIndex >> 1) << 15);
+
+            return result;
+        }
+
+        //////////////////////////////////////////
+        inline Quaternion toQuaternion() const
+        {
+            S32 largestIndex = (data[0] >> 15) | ((data[1] >> 15) << 1);
+
+            Quaternion result;
+            F32 sumSq = 0.0f;
+            S32 k = 0;
+            for (S32 i = 0; i < 4; ++i)
+            {
+                if (i == largestIndex)
+                    continue;
+
+                F32 value = ((F32)(data[k++] & c_valueMax) / c_valueMax * 2.0f - 1.0f) * c_sqrt2Inv;
+                result[i] = value;
+                sumSq += value * value;
+            }
+            result[largestIndex] = Math::Sqrt(Math::Max(0.0f, 1.0f - sumSq));
+
+            return result;
+        }
+
+        static U16 const c_valueMax = 0x7FFF;
+        static F32 constexpr c_sqrt2 = 1.41421356f;
+        static F32 constexpr c_sqrt2Inv = 0.70710678f;
+
+        U16 data[3] = { 0, 0, 0 };
+    };
+
+
+    //////////////////////////////////////////
+    // Struct MeshSkeletonAnimationKeyTimes
+    // Key times of the track. Uniform tracks store only the start time and the sample interval
+    //
+    //////////////////////////////////////////
+    struct MAZE_GRAPHICS_API MeshSkeletonAnimationKeyTimes
+    {
+        //////////////////////////////////////////
+        inline bool isUniform() const { return sampleInterval > 0.0f; }
+
+        //////////////////////////////////////////
+        inline void setTimes(FastVector<F32> const& _times)
+        {
+            times = _times;
+            setNonUniform();
+        }
+
+        //////////////////////////////////////////
+        inline void setTimes(FastVector<F32>&& _times)
+        {
+            times = eastl::move(_times);
+            setNonUniform();
+        }
+
+        //////////////////////////////////////////
+        inline void setUniform(F32 _startTime, F32 _sampleInterval)
+        {
+            MAZE_DEBUG_ASSERT(_sampleInterval > 0.0f);
+            times.clear();
+            startTime = _startTime;
+            sampleInterval = _sampleInterval;
+            sampleIntervalInv = 1.0f / _sampleInterval;
+        }
+
+        //////////////////////////////////////////
+        inline void setNonUniform()
+        {
+            startTime = 0.0f;
+            sampleInterval = 0.0f;
+            sampleIntervalInv = 0.0f;
+        }
+
+        //////////////////////////////////////////
+        inline void clear()
+        {
+            times.clear();
+            setNonUniform();
+        }
+
+        //////////////////////////////////////////
+        inline F32 getKeyTime(S32 _i) const
+        {
+            return isUniform() ? startTime + sampleInterval * (F32)_i : times[_i];
+        }
+
+        //////////////////////////////////////////
+        // Returns index i of the key pair (i - 1, i) for the _time and the interpolation factor between them.
+        // _cursor is the key index of the previous call - the playback moves forward
+        // by few keys per frame, so the search is O(1) in most cases.
+        // Seeks fallback to the binary search. _keysCount should be >= 2
+        inline S32 findKey(
+            F32 _time,
+            S32 _keysCount,
+            S32& _cursor,
+            F32& _outT) const
+        {
+            if (isUniform())
+            {
+                F32 position = (_time - startTime) * sampleIntervalInv;
+                if (position <= 0.0f)
+                {
+                    _outT = 0.0f;
+                    return 1;
+                }
+
+                F32 positionFloor = Math::Floor(position);
+                S32 i = (S32)positionFloor + 1;
+                if (i >= _keysCount)
+                {
+                    _outT = 1.0f;
+                    return _keysCount - 1;
+                }
+
+                _outT = position - positionFloor;
+                return i;
+            }
+
+            MAZE_DEBUG_ASSERT((S32)times.size() == _keysCount);
+
+            if (_time <= times[0])
+            {
+                _outT = 0.0f;
+                return 1;
+            }
+
+            if (_time >= times[_keysCount - 1])
+            {
+                _outT = 1.0f;
+                return _keysCount - 1;
+            }
+
+            S32 i = _cursor;
+            bool found = false;
+            if (i > 0 && i < _keysCount && times[i - 1] <= _time)
+            {
+                for (S32 end = Math::Min(i + c_cursorForwardSteps, _keysCount); i < end; ++i)
+                {
+                    if (times[i] >= _time)
+                    {
+                        found = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!found)
+                i = (S32)(eastl::lower_bound(times.begin() + 1, times.begin() + _keysCount - 1, _time) - times.begin());
+
+            _cursor = i;
+            _outT = (_time - times[i - 1]) / (times[i] - times[i - 1]);
+            return i;
+        }
+
+        //////////////////////////////////////////
+        // Converts the times into the uniform form if the keys are evenly spaced
+        bool tryMakeUniform(F32 _spacingTolerance);
+
+        static S32 const c_cursorForwardSteps = 4;
+
+        FastVector<F32> times;
+        F32 startTime = 0.0f;
+        F32 sampleInterval = 0.0f;
+        F32 sampleIntervalInv = 0.0f;
+    };
+
+
     //////////////////////////////////////////
     class MAZE_GRAPHICS_API MeshSkeletonAnimationCurve
     {
@@ -60,20 +277,20 @@ namespace Maze
         inline MeshSkeletonAnimationCurve(
             FastVector<F32> const& _times = FastVector<F32>(),
             FastVector<F32> const& _values = FastVector<F32>())
-            : m_times(_times)
-            , m_values(_values)
+            : m_values(_values)
         {
-            MAZE_DEBUG_ASSERT(m_times.size() == m_values.size());
+            m_keyTimes.setTimes(_times);
+            MAZE_DEBUG_ASSERT(m_keyTimes.times.size() == m_values.size());
         }
 
         //////////////////////////////////////////
         inline MeshSkeletonAnimationCurve(
             FastVector<F32>&& _times,
             FastVector<F32>&& _values)
-            : m_times(eastl::move(_times))
-            , m_values(eastl::move(_values))
+            : m_values(eastl::move(_values))
         {
-            MAZE_DEBUG_ASSERT(m_times.size() == m_values.size());
+            m_keyTimes.setTimes(eastl::move(_times));
+            MAZE_DEBUG_ASSERT(m_keyTimes.times.size() == m_values.size());
         }
 
         //////////////////////////////////////////
@@ -81,14 +298,14 @@ namespace Maze
 
         //////////////////////////////////////////
         inline MeshSkeletonAnimationCurve(MeshSkeletonAnimationCurve&& _value)
-            : m_times(eastl::move(_value.m_times))
+            : m_keyTimes(eastl::move(_value.m_keyTimes))
             , m_values(eastl::move(_value.m_values))
         {}
 
         //////////////////////////////////////////
         inline MeshSkeletonAnimationCurve& operator=(MeshSkeletonAnimationCurve const& _value)
         {
-            m_times = _value.m_times;
+            m_keyTimes = _value.m_keyTimes;
             m_values = _value.m_values;
 
             return *this;
@@ -97,7 +314,7 @@ namespace Maze
         //////////////////////////////////////////
         inline MeshSkeletonAnimationCurve& operator=(MeshSkeletonAnimationCurve&& _value)
         {
-            m_times = eastl::move(_value.m_times);
+            m_keyTimes = eastl::move(_value.m_keyTimes);
             m_values = eastl::move(_value.m_values);
 
             return *this;
@@ -109,7 +326,7 @@ namespace Maze
             FastVector<F32> const& _times,
             FastVector<F32> const& _values)
         {
-            m_times = _times;
+            m_keyTimes.setTimes(_times);
             m_values = _values;
         }
 
@@ -118,7 +335,17 @@ namespace Maze
             FastVector<F32>&& _times,
             FastVector<F32>&& _values)
         {
-            m_times = eastl::move(_times);
+            m_keyTimes.setTimes(eastl::move(_times));
+            m_values = eastl::move(_values);
+        }
+
+        //////////////////////////////////////////
+        inline void setUniformValues(
+            F32 _startTime,
+            F32 _sampleInterval,
+            FastVector<F32>&& _values)
+        {
+            m_keyTimes.setUniform(_startTime, _sampleInterval);
             m_values = eastl::move(_values);
         }
 
@@ -130,39 +357,49 @@ namespace Maze
         }
 
         //////////////////////////////////////////
-        inline F32 evaluate(F32 _time) const
+        inline F32 evaluate(F32 _time, S32& _cursor) const
         {
             S32 count = (S32)m_values.size();
-            if (count == 0)
-                return 0.0f;
+            if (count <= 1)
+                return count == 0 ? 0.0f : m_values[0];
 
-            if (_time <= m_times[0])
-                return m_values[0];
+            F32 t;
+            S32 i = m_keyTimes.findKey(_time, count, _cursor, t);
+            return m_values[i - 1] * (1 - t) + m_values[i] * t;
+        }
+
+        //////////////////////////////////////////
+        inline F32 evaluate(F32 _time) const
+        {
+            S32 cursor = 0;
+            return evaluate(_time, cursor);
+        }
 
-            if (_time >= m_times[count - 1])
-                return m_values[count - 1];
+        //////////////////////////////////////////
+        // Elides constant track to a single key and drops the times of the evenly sampled track
+        void compress(MeshSkeletonAnimationCompressionParams const& _params);
 
-            for (S32 i = 1; i < count; ++i)
-            {
-                if (m_times[i] >= _time)
-                {
-                    F32 t = (_time - m_times[i - 1]) / (m_times[i] - m_times[i - 1]);
-                    return m_values[i - 1] * (1 - t) + m_values[i] * t;
-                }
-            }
+        //////////////////////////////////////////
+        inline S32 getKeysCount() const { return (S32)m_values.size(); }
 
-            MAZE_ERROR("Unexpected skeleton curve state!");
-            return 0.0f;
-        }
+        //////////////////////////////////////////
+        inline bool isUniform() const { return m_keyTimes.isUniform(); }
 
         //////////////////////////////////////////
-        FastVector<F32> const& getTimes() const { return m_times; }
+        inline F32 getStartTime() const { return m_keyTimes.startTime; }
+
+        //////////////////////////////////////////
+        inline F32 getSampleInterval() const { return m_keyTimes.sampleInterval; }
+
+        //////////////////////////////////////////
+        // Empty for the uniform and constant tracks
+        FastVector<F32> const& getTimes() const { return m_keyTimes.times; }
 
         //////////////////////////////////////////
         FastVector<F32> const& getValues() const { return m_values; }
 
     private:
-        FastVector<F32> m_times;
+        MeshSkeletonAnimationKeyTimes m_keyTimes;
         FastVector<F32> m_values;
     };
 
@@ -176,20 +413,20 @@ namespace Maze
         inline MeshSkeletonRotationCurve(
             FastVector<F32> const& _times = FastVector<F32>(),
             FastVector<Quaternion> const& _values = FastVector<Quaternion>())
-            : m_times(_times)
-            , m_values(_values)
+            : m_values(_values)
         {
-            MAZE_DEBUG_ASSERT(m_times.size() == m_values.size());
+            m_keyTimes.setTimes(_times);
+            MAZE_DEBUG_ASSERT(m_keyTimes.times.size() == m_values.size());
         }
 
         //////////////////////////////////////////
         inline MeshSkeletonRotationCurve(
             FastVector<F32>&& _times,
             FastVector<Quaternion>&& _values)
-            : m_times(eastl::move(_times))
-            , m_values(eastl::move(_values))
+            : m_values(eastl::move(_values))
         {
-            MAZE_DEBUG_ASSERT(m_times.size() == m_values.size());
+            m_keyTimes.setTimes(eastl::move(_times));
+            MAZE_DEBUG_ASSERT(m_keyTimes.times.size() == m_values.size());
         }
 
         //////////////////////////////////////////
@@ -197,15 +434,17 @@ namespace Maze
 
         //////////////////////////////////////////
         inline MeshSkeletonRotationCurve(MeshSkeletonRotationCurve&& _value)
-            : m_times(eastl::move(_value.m_times))
+            : m_keyTimes(eastl::move(_value.m_keyTimes))
             , m_values(eastl::move(_value.m_values))
+            , m_quantizedValues(eastl::move(_value.m_quantizedValues))
         {}
 
         //////////////////////////////////////////
         inline MeshSkeletonRotationCurve& operator=(MeshSkeletonRotationCurve const& _value)
         {
-            m_times = _value.m_times;
+            m_keyTimes = _value.m_keyTimes;
             m_values = _value.m_values;
+            m_quantizedValues = _value.m_quantizedValues;
 
             return *this;
         }
@@ -213,8 +452,9 @@ namespace Maze
         //////////////////////////////////////////
         inline MeshSkeletonRotationCurve& operator=(MeshSkeletonRotationCurve&& _value)
         {
-            m_times = eastl::move(_value.m_times);
+            m_keyTimes = eastl::move(_value.m_keyTimes);
             m_values = eastl::move(_value.m_values);
+            m_quantizedValues = eastl::move(_value.m_quantizedValues);
 
             return *this;
         }
@@ -225,8 +465,9 @@ namespace Maze
             FastVector<F32> const& _times,
             FastVector<Quaternion> const& _values)
         {
-            m_times = _times;
+            m_keyTimes.setTimes(_times);
             m_values = _values;
+            m_quantizedValues.clear();
         }
 
         //////////////////////////////////////////
@@ -234,52 +475,119 @@ namespace Maze
             FastVector<F32>&& _times,
             FastVector<Quaternion>&& _values)
         {
-            m_times = eastl::move(_times);
+            m_keyTimes.setTimes(eastl::move(_times));
             m_values = eastl::move(_values);
+            m_quantizedValues.clear();
         }
 
         //////////////////////////////////////////
-        inline void modifyValues(std::function<void(Quaternion&)> const& _cb)
+        inline void setQuantizedValues(
+            FastVector<F32>&& _times,
+            FastVector<MeshSkeletonQuantizedQuaternion>&& _values)
         {
-            for (Quaternion& value : m_values)
-                _cb(value);
+            m_keyTimes.setTimes(eastl::move(_times));
+            m_values.clear();
+            m_quantizedValues = eastl::move(_values);
         }
 
         //////////////////////////////////////////
-        inline Quaternion evaluate(F32 _time) const
+        inline void setUniformValues(
+            F32 _startTime,
+            F32 _sampleInterval,
+            FastVector<Quaternion>&& _values)
         {
-            S32 count = (S32)m_values.size();
-            if (count == 0)
-                return Quaternion::c_identity;
+            m_keyTimes.setUniform(_startTime, _sampleInterval);
+            m_values = eastl::move(_values);
+            m_quantizedValues.clear();
+        }
 
-            if (_time <= m_times[0])
-                return m_values[0];
+        //////////////////////////////////////////
+        inline void setUniformQuantizedValues(
+            F32 _startTime,
+            F32 _sampleInterval,
+            FastVector<MeshSkeletonQuantizedQuaternion>&& _values)
+        {
+            m_keyTimes.setUniform(_startTime, _sampleInterval);
+            m_values.clear();
+            m_quantizedValues = eastl::move(_values);
+        }
 
-            if (_time >= m_times[count - 1])
-                return m_values[count - 1];
+        //////////////////////////////////////////
+        void modifyValues(std::function<void(Quaternion&)> const& _cb);
 
-            for (S32 i = 1; i < count; ++i)
-            {
-                if (m_times[i] >= _time)
-                {
-                    F32 t = (_time - m_times[i - 1]) / (m_times[i] - m_times[i - 1]);
-                    return Quaternion::Slerp(t, m_values[i - 1], m_values[i]);
-                }
-            }
+        //////////////////////////////////////////
+        inline Quaternion getValue(S32 _i) const
+        {
+            return isQuantized() ? m_quantizedValues[_i].toQuaternion() : m_values[_i];
+        }
+
+        //////////////////////////////////////////
+        inline Quaternion evaluate(F32 _time, S32& _cursor) const
+        {
+            S32 count = getKeysCount();
+            if (count <= 1)
+                return count == 0 ? Quaternion::c_identity : getValue(0);
+
+            F32 t;
+            S32 i = m_keyTimes.findKey(_time, count, _cursor, t);
+            return Quaternion::Slerp(t, getValue(i - 1), getValue(i));
+        }
 
-            MAZE_ERROR("Unexpected skeleton curve state!");
-            return Quaternion::c_identity;
+        //////////////////////////////////////////
+        inline Quaternion evaluate(F32 _time) const
+        {
+            S32 cursor = 0;
+            return evaluate(_time, cursor);
         }
 
         //////////////////////////////////////////
-        FastVector<F32> const& getTimes() const { return m_times; }
+        // Elides constant track to a single key, drops the times of the evenly sampled track
+        // and quantizes the values if requested
+        void compress(MeshSkeletonAnimationCompressionParams const& _params);
+
+        //////////////////////////////////////////
+        inline S32 getKeysCount() const { return isQuantized() ? (S32)m_quantizedValues.size() : (S32)m_values.size(); }
+
+        //////////////////////////////////////////
+        inline bool isUniform() const { return m_keyTimes.isUniform(); }
+
+        //////////////////////////////////////////
+        inline bool isQuantized() const { return !m_quantizedValues.empty(); }
 
         //////////////////////////////////////////
+        inline F32 getStartTime() const { return m_keyTimes.startTime; }
+
+        //////////////////////////////////////////
+        inline F32 getSampleInterval() const { return m_keyTimes.sampleInterval; }
+
+        //////////////////////////////////////////
+        // Empty for the uniform and constant tracks
+        FastVector<F32> const& getTimes() const { return m_keyTimes.times; }
+
+        //////////////////////////////////////////
+        // Empty for the quantized tracks
         FastVector<Quaternion> const& getValues() const { return m_values; }
 
+        //////////////////////////////////////////
+        FastVector<MeshSkeletonQuantizedQuaternion> const& getQuantizedValues() const { return m_quantizedValues; }
+
     private:
-        FastVector<F32> m_times;
+        MeshSkeletonAnimationKeyTimes m_keyTimes;
         FastVector<Quaternion> m_values;
+        FastVector<MeshSkeletonQuantizedQuaternion> m_quantizedValues;
+    };
+
+
+    //////////////////////////////////////////
+    // Struct MeshSkeletonAnimationBoneCursor
+    // Last found key indices of the bone tracks
+    //
+    //////////////////////////////////////////
+    struct MAZE_GRAPHICS_API MeshSkeletonAnimationBoneCursor
+    {
+        S32 translation[3] = { 0, 0, 0 };
+        S32 rotation = 0;
+        S32 scale[3] = { 0, 0, 0 };
     };
 
 
@@ -331,6 +639,17 @@ namespace Maze
             Quaternion& _outRotation,
             Vec3F& _outScale) const;
 
+        //////////////////////////////////////////
+        void evaluateBoneTransform(
+            F32 _time,
+            MeshSkeletonAnimationBoneCursor& _cursor,
+            Vec3F& _outTranslation,
+            Quaternion& _outRotation,
+            Vec3F& _outScale) const;
+
+        //////////////////////////////////////////
+        void compress(MeshSkeletonAnimationCompressionParams const& _params);
+
         MeshSkeletonAnimationCurve translation[3];
         MeshSkeletonRotationCurve rotation;
         MeshSkeletonAnimationCurve scale[3];
@@ -389,6 +708,19 @@ namespace Maze
             Quaternion& _outRotation,
             Vec3F& _outScale) const;
 
+        //////////////////////////////////////////
+        void evaluateBoneTransform(
+            MeshSkeleton::BoneIndex _i,
+            F32 _time,
+            MeshSkeletonAnimationBoneCursor& _cursor,
+            Vec3F& _outTranslation,
+            Quaternion& _outRotation,
+            Vec3F& _outScale) const;
+
+
+        //////////////////////////////////////////
+        void compress(MeshSkeletonAnimationCompressionParams const& _params = MeshSkeletonAnimationCompressionParams());
+
     protected:
 
         //////////////////////////////////////////
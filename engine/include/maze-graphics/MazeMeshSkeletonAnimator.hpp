@@ -35,6 +35,7 @@
 #include "maze-graphics/MazeRenderDrawTopology.hpp"
 #include "maze-graphics/config/MazeGraphicsConfig.hpp"
 #include "maze-graphics/MazeMeshSkeleton.hpp"
+#include "maze-graphics/MazeMeshSkeletonAnimation.hpp"
 #include "maze-core/utils/MazeMultiDelegate.hpp"
 #include "maze-core/utils/MazeEnumClass.hpp"
 #include "maze-core/system/MazeWindowVideoMode.hpp"
@@ -43,6 +44,7 @@
 #include "maze-core/system/MazeInputEvent.hpp"
 #include "maze-core/containers/MazeFastVector.hpp"
 #include "maze-core/containers/MazeStringKeyMap.hpp"
+#include "maze-core/system/MazeMutex.hpp"
 
 
 //////////////////////////////////////////
@@ -83,6 +85,49 @@ namespace Maze
     };
 
 
+    //////////////////////////////////////////
+    enum class MAZE_GRAPHICS_API MeshSkeletonAnimationLOD : U8
+    {
+        Full = 0,                   // Pose is evaluated every update
+        Reduced,                    // Pose is evaluated every few updates and interpolated in between
+        ReducedBones,               // Same as Reduced, leaf bones (fingers, face) are kept in the bind pose
+        Frozen,                     // Pose is not updated, players time is still advanced
+
+        MAX
+    };
+
+    //////////////////////////////////////////
+    struct MAZE_GRAPHICS_API MeshSkeletonAnimationLODSettings
+    {
+        bool enabled = true;
+
+        // Projected bounds size relative to the viewport height
+        F32 fullScreenSize = 0.2f;
+        F32 reducedScreenSize = 0.05f;
+
+        // Updates count between the pose evaluations
+        S32 reducedUpdateInterval = 2;
+        S32 reducedBonesUpdateInterval = 4;
+
+        // Animator is frozen when it was not rendered for this updates count
+        S32 frozenDelayUpdates = 8;
+
+        // Non-branching chains attached to a bone with this children count are skipped
+        // in ReducedBones as well as the leaf bones (fingers of a hand, face bones of a head)
+        S32 reducedBonesHubChildrenMin = 4;
+    };
+
+    //////////////////////////////////////////
+    // Counters since the last MeshSkeletonAnimator::ResetLODStats
+    struct MAZE_GRAPHICS_API MeshSkeletonAnimationLODStats
+    {
+        U32 updatesCount[(Size)MeshSkeletonAnimationLOD::MAX] = { 0u };
+        U32 evaluatedPosesCount = 0u;
+        U32 interpolatedPosesCount = 0u;
+        U64 sampledBonesCount = 0u;
+    };
+
+
     //////////////////////////////////////////
     // Class MeshSkeletonAnimator
     //
@@ -91,6 +136,24 @@ namespace Maze
     {
     public:
 
+        //////////////////////////////////////////
+        // Local pose SoA channels
+        enum class PoseChannel
+        {
+            TranslationX = 0,
+            TranslationY,
+            TranslationZ,
+            RotationW,
+            RotationX,
+            RotationY,
+            RotationZ,
+            ScaleX,
+            ScaleY,
+            ScaleZ,
+
+            MAX
+        };
+
     public:
 
         //////////////////////////////////////////
@@ -137,6 +200,35 @@ namespace Maze
         //////////////////////////////////////////
         inline MeshSkeletonAnimatorPlayerPtr const& getPlayer(Size _i) const { return m_players[_i]; }
 
+
+        //////////////////////////////////////////
+        // Called by the renderers for every pass the animator is rendered in.
+        // _screenSize is the projected bounds size relative to the viewport height (0 for the shadow passes).
+        // LOD is selected on the next update, animators which were never rendered are always at Full LOD.
+        // A Frozen animator evaluates its pose right away, so it is not shown with the stale pose.
+        // Thread-safe - renderers sharing the animator may be gathered in parallel
+        void notifyRendered(F32 _screenSize);
+
+        //////////////////////////////////////////
+        inline MeshSkeletonAnimationLOD getLOD() const { return m_lod; }
+
+        //////////////////////////////////////////
+        void setLODSettings(MeshSkeletonAnimationLODSettings const& _settings);
+
+        //////////////////////////////////////////
+        inline MeshSkeletonAnimationLODSettings const& getLODSettings() const { return m_lodSettings; }
+
+        //////////////////////////////////////////
+        // Bones which are evaluated at ReducedBones LOD
+        inline FastVector<MeshSkeleton::BoneIndex> const& getLODReducedBones() const { return m_lodReducedBones; }
+
+
+        //////////////////////////////////////////
+        static MeshSkeletonAnimationLODStats GetLODStats();
+
+        //////////////////////////////////////////
+        static void ResetLODStats();
+
     protected:
 
         //////////////////////////////////////////
@@ -146,7 +238,44 @@ namespace Maze
         bool init();
 
         //////////////////////////////////////////
-        void calculateBoneTransforms(MeshSkeleton::BoneIndex _i);
+        void rebuildBonesOrder();
+
+        //////////////////////////////////////////
+        void rebuildBindPose();
+
+        //////////////////////////////////////////
+        void rebuildLODReducedBones();
+
+        //////////////////////////////////////////
+        void updateLOD();
+
+        //////////////////////////////////////////
+        // Evaluates the pose of the current LOD and the bones transforms
+        void updatePose();
+
+        //////////////////////////////////////////
+        // Blends players poses into m_pose, bones out of _bones are taken from the bind pose
+        void evaluatePose(
+            MeshSkeleton::BoneIndex const* _bones,
+            S32 _bonesCount);
+
+        //////////////////////////////////////////
+        void samplePlayerPose(
+            MeshSkeletonAnimatorPlayer* _player,
+            MeshSkeleton::BoneIndex const* _bones,
+            S32 _bonesCount);
+
+        //////////////////////////////////////////
+        void blendPose(
+            F32 const* _sourcePose,
+            F32 _weight);
+
+        //////////////////////////////////////////
+        void normalizePoseRotations();
+
+        //////////////////////////////////////////
+        // Flat pass over m_bonesOrder, writes global and skinning transforms
+        void calculatePoseTransforms();
 
         //////////////////////////////////////////
         S32 findPlayerIndexForNewAnimation(
@@ -166,10 +295,31 @@ namespace Maze
         F32 m_animationSpeed = 1.0f;
 
         Vector<TMat> m_bonesGlobalTransforms; // Mesh space
-        FastVector<bool> m_bonesTransformsDirty;
-
         Vector<TMat> m_bonesSkinningTransforms; // Animation delta, Mesh space
 
+        // Bone indices sorted by the hierarchy depth
+        FastVector<MeshSkeleton::BoneIndex> m_bonesOrder;
+
+        // Local pose, PoseChannel::MAX channels of m_poseStride values
+        FastVector<F32> m_pose;
+        FastVector<F32> m_samplePose;
+        FastVector<F32> m_bindPose;
+        S32 m_poseStride = 0;
+
+        MeshSkeletonAnimationLODSettings m_lodSettings;
+        MeshSkeletonAnimationLOD m_lod = MeshSkeletonAnimationLOD::Full;
+        FastVector<MeshSkeleton::BoneIndex> m_lodReducedBones;
+        bool m_lodRenderedOnce = false;
+        F32 m_lodScreenSize = -1.0f; // Max screen size since the last update, -1 - not rendered
+        S32 m_lodNotRenderedUpdates = 0;
+        Mutex m_lodRenderedMutex;
+
+        // Evaluated poses of the reduced LODs, m_pose is interpolated between them
+        FastVector<F32> m_lodPoseFrom;
+        FastVector<F32> m_lodPoseTo;
+        S32 m_lodUpdatesSinceEvaluation = 0;
+        bool m_lodPosesValid = false;
+
         MeshSkeletonAnimatorPlayerPtr m_players[MESH_SKELETON_ANIMATOR_PLAYERS_COUNT];
         F32 m_playersBlendWeights[MESH_SKELETON_ANIMATOR_PLAYERS_COUNT];
     };
@@ -291,9 +441,15 @@ namespace Maze
         //////////////////////////////////////////
         void setState(State _state);
 
+        //////////////////////////////////////////
+        void resetCursors();
+
     protected:
         MeshSkeletonAnimationPtr m_animation;
         F32 m_currentTime = 0.0f;
+
+        // Key search cursors per bone
+        FastVector<MeshSkeletonAnimationBoneCursor> m_cursors;
         
         bool m_looped = true;
         bool m_additive = false;
@@ -127,6 +127,10 @@ namespace Maze
         //////////////////////////////////////////
         virtual F32 getTextureMaxAnisotropyLevel() MAZE_ABSTRACT;
 
+        //////////////////////////////////////////
+        // Whether the ClearCurrentRenderTarget command is limited by the scissor rect
+        virtual bool isScissoredClearSupported() { return true; }
+
 
         //////////////////////////////////////////
         virtual bool setCurrentRenderTarget(RenderTarget* _renderTarget) MAZE_ABSTRACT;
@@ -0,0 +1,125 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeSkinningPaletteBuffer_hpp_))
+#define _MazeSkinningPaletteBuffer_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-graphics/MazeGraphicsHeader.hpp"
+#include "maze-graphics/config/MazeGraphicsConfig.hpp"
+#include "maze-core/math/MazeVec4.hpp"
+#include "maze-core/math/MazeTMat.hpp"
+#include "maze-core/MazeTypes.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(SkinningPaletteBuffer);
+    MAZE_USING_SHARED_PTR(Texture2D);
+    MAZE_USING_SHARED_PTR(ShaderManager);
+    class RenderSystem;
+    class MeshSkeletonAnimator;
+
+
+    //////////////////////////////////////////
+    // Class SkinningPaletteBuffer
+    // Bone skinning transforms of all the animators drawn during the frame.
+    // Every animator gets its palette written once per frame (shared by the shadow and default passes),
+    // skinned draws pass only the palette offset via MAZE_SKINNING_PALETTE_UV_CHANNEL instance stream.
+    // The palettes are uploaded into RGBA_F32 data texture u_global_skinningPaletteTexture:
+    //  - 3 texels per bone, texel N is the row N of the transposed TMat (column N of TMat + translation)
+    //
+    //////////////////////////////////////////
+    class MAZE_GRAPHICS_API SkinningPaletteBuffer
+    {
+    public:
+
+        //////////////////////////////////////////
+        static U32 const c_textureWidth = 1024;
+        static U32 const c_texelsPerBone = 3;
+
+    public:
+
+        //////////////////////////////////////////
+        static SkinningPaletteBufferPtr Create(RenderSystem* _renderSystem);
+
+        //////////////////////////////////////////
+        ~SkinningPaletteBuffer();
+
+
+        //////////////////////////////////////////
+        // Should be called once per frame, before the first pass
+        void reset();
+
+        //////////////////////////////////////////
+        // Returns the first bone index of the animator palette in the buffer (-1 on fail).
+        // The palette is written on the first call in the frame
+        S32 ensurePalette(MeshSkeletonAnimator const* _animator);
+
+        //////////////////////////////////////////
+        // Uploads the palettes written since the last upload and sets the global shader uniform
+        void upload(ShaderManager* _shaderManager);
+
+
+        //////////////////////////////////////////
+        inline S32 getBonesCount() const { return m_bonesCount; }
+
+        //////////////////////////////////////////
+        inline Texture2DPtr const& getTexture() const { return m_texture; }
+
+    protected:
+
+        //////////////////////////////////////////
+        SkinningPaletteBuffer();
+
+        //////////////////////////////////////////
+        bool init(RenderSystem* _renderSystem);
+
+        //////////////////////////////////////////
+        bool ensureCapacity(S32 _bonesCount);
+
+    protected:
+        RenderSystem* m_renderSystem = nullptr;
+
+        FlatHashMap<MeshSkeletonAnimator const*, S32> m_paletteOffsets;
+        S32 m_bonesCount = 0;
+        S32 m_uploadedBonesCount = 0;
+
+        Vector<Vec4F> m_data;
+        Texture2DPtr m_texture;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeSkinningPaletteBuffer_hpp_
+//////////////////////////////////////////
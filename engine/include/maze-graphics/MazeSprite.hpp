@@ -41,6 +41,7 @@
 #include "maze-core/utils/MazeManagedSharedObject.hpp"
 #include "maze-core/system/MazeInputEvent.hpp"
 #include "maze-core/containers/MazeFastVector.hpp"
+#include "maze-core/math/MazeVec4.hpp"
 
 
 //////////////////////////////////////////
@@ -196,6 +197,32 @@ namespace Maze
         //////////////////////////////////////////
         void updateTextureCoords();
 
+
+        //////////////////////////////////////////
+        // Texture which should be used for rendering - atlas page if the sprite is packed into SpriteAtlas
+        inline Texture2DPtr const& getRenderTexture() const { return m_atlasTexture ? m_atlasTexture : m_texture; }
+
+        //////////////////////////////////////////
+        inline Texture2DPtr const& getAtlasTexture() const { return m_atlasTexture; }
+
+        //////////////////////////////////////////
+        // xy - scale, zw - offset of the texture coords inside the atlas page
+        inline Vec4F const& getAtlasUVTransform() const { return m_atlasUVTransform; }
+
+        //////////////////////////////////////////
+        inline Vec2F transformUVToRenderTexture(Vec2F const& _uv) const
+        {
+            return Vec2F(
+                _uv.x * m_atlasUVTransform.x + m_atlasUVTransform.z,
+                _uv.y * m_atlasUVTransform.y + m_atlasUVTransform.w);
+        }
+
+        //////////////////////////////////////////
+        void setAtlasRegion(Texture2DPtr const& _atlasTexture, Vec4F const& _uvTransform);
+
+        //////////////////////////////////////////
+        void resetAtlasRegion();
+
     public:
 
         //////////////////////////////////////////
@@ -251,6 +278,9 @@ namespace Maze
 
         SpriteSliceBorder m_sliceBorder;
 
+        Texture2DPtr m_atlasTexture;
+        Vec4F m_atlasUVTransform = Vec4F(1.0f, 1.0f, 0.0f, 0.0f);
+
         // True while colorSize/nativeSize mirror the texture size,
         // so they are recalculated when the texture data arrives
         bool m_autoSize = false;
@@ -0,0 +1,203 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeSpriteAtlas_hpp_))
+#define _MazeSpriteAtlas_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-graphics/MazeGraphicsHeader.hpp"
+#include "maze-graphics/MazePixelSheet2D.hpp"
+#include "maze-core/utils/MazeMultiDelegate.hpp"
+#include "maze-core/math/MazeRect2.hpp"
+#include "maze-core/math/MazeVec4.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(SpriteAtlas);
+    MAZE_USING_MANAGED_SHARED_PTR(Sprite);
+    MAZE_USING_MANAGED_SHARED_PTR(Texture2D);
+    class RenderSystem;
+
+
+    //////////////////////////////////////////
+    // Class SpriteAtlas
+    // Runtime atlas for small sprite textures.
+    // Textures are packed into RGBA_U8 pages with shelf packing,
+    // every region is extruded by c_padding pixels to avoid bleeding with linear filtering.
+    // Freed regions are reused by the next insertions, a page is repacked
+    // only when a new texture doesn't fit but the page has enough freed space.
+    // Packed sprites receive the page texture and the UV transform via Sprite::setAtlasRegion
+    //
+    //////////////////////////////////////////
+    class MAZE_GRAPHICS_API SpriteAtlas
+        : public MultiDelegateCallbackReceiver
+    {
+    public:
+
+        //////////////////////////////////////////
+        static S32 const c_pageSize = 2048;
+
+        //////////////////////////////////////////
+        static S32 const c_pagesMax = 8;
+
+        //////////////////////////////////////////
+        static S32 const c_padding = 2;
+
+        //////////////////////////////////////////
+        static S32 const c_textureSizeMax = 256;
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~SpriteAtlas();
+
+        //////////////////////////////////////////
+        static SpriteAtlasPtr Create(RenderSystem* _renderSystem);
+
+
+        //////////////////////////////////////////
+        // Returns false if the sprite texture is not suitable for the atlas (yet).
+        // The sprite is tracked anyway - it will be packed when its texture is loaded
+        bool addSprite(Sprite* _sprite);
+
+        //////////////////////////////////////////
+        void removeSprite(Sprite* _sprite);
+
+        //////////////////////////////////////////
+        void clear();
+
+
+        //////////////////////////////////////////
+        bool isTextureSuitable(Texture2D const* _texture) const;
+
+
+        //////////////////////////////////////////
+        inline S32 getPagesCount() const { return (S32)m_pages.size(); }
+
+        //////////////////////////////////////////
+        Texture2DPtr const& getPageTexture(S32 _index) const { return m_pages[_index].texture; }
+
+    protected:
+
+        //////////////////////////////////////////
+        struct Shelf
+        {
+            S32 y = 0;
+            S32 height = 0;
+            S32 cursorX = 0;
+            Vector<Rect2S> freeSlots;
+        };
+
+        //////////////////////////////////////////
+        struct Page
+        {
+            Texture2DPtr texture;
+            Vector<Shelf> shelves;
+            S32 shelvesHeight = 0;
+            S32 freedArea = 0;
+        };
+
+        //////////////////////////////////////////
+        struct Entry
+        {
+            Texture2DPtr texture;
+            Vector<Sprite*> sprites;
+            S32 pageIndex = -1;
+            S32 shelfIndex = -1;
+
+            // Padded region in the page
+            Rect2S rect;
+        };
+
+    protected:
+
+        //////////////////////////////////////////
+        SpriteAtlas();
+
+        //////////////////////////////////////////
+        bool init(RenderSystem* _renderSystem);
+
+
+        //////////////////////////////////////////
+        void attachSprite(Sprite* _sprite, Texture2DPtr const& _texture);
+
+        //////////////////////////////////////////
+        void detachSprite(Sprite* _sprite);
+
+
+        //////////////////////////////////////////
+        bool packEntry(Entry& _entry);
+
+        //////////////////////////////////////////
+        void unpackEntry(Entry& _entry);
+
+        //////////////////////////////////////////
+        bool allocateRegion(S32 _pageIndex, Vec2S const& _size, S32& _outShelfIndex, Rect2S& _outRect);
+
+        //////////////////////////////////////////
+        void releaseRegion(S32 _pageIndex, S32 _shelfIndex, Rect2S const& _rect);
+
+        //////////////////////////////////////////
+        bool repackPage(S32 _pageIndex);
+
+        //////////////////////////////////////////
+        S32 createPage();
+
+        //////////////////////////////////////////
+        bool uploadEntry(Entry const& _entry);
+
+        //////////////////////////////////////////
+        void updateEntrySprites(Entry const& _entry);
+
+
+        //////////////////////////////////////////
+        void notifySpriteDataChanged(Sprite* _sprite);
+
+        //////////////////////////////////////////
+        void notifyTextureLoaded(Texture2D* _texture);
+
+    protected:
+        RenderSystem* m_renderSystem = nullptr;
+
+        Vector<Page> m_pages;
+        UnorderedMap<Texture2D*, Entry> m_entries;
+        UnorderedMap<Sprite*, Texture2D*> m_spriteTextures;
+
+        PixelSheet2D m_uploadPixelSheet;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeSpriteAtlas_hpp_
+//////////////////////////////////////////
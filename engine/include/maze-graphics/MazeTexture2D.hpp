@@ -41,6 +41,7 @@
 #include "maze-core/system/MazeWindow.hpp"
 #include "maze-core/utils/MazeUpdater.hpp"
 #include "maze-core/system/MazeInputEvent.hpp"
+#include "maze-core/math/MazeRect2.hpp"
 
 
 //////////////////////////////////////////
@@ -200,6 +201,33 @@ namespace Maze
             U32 _x,
             U32 _y) MAZE_ABSTRACT;
 
+        //////////////////////////////////////////
+        // Uploads the region without the GPU synchronization and the mipmaps generation.
+        // For the data textures rewritten every frame
+        virtual void uploadImageRegion(
+            U8 const* _pixels,
+            PixelFormat::Enum _pixelFormat,
+            U32 _width,
+            U32 _height,
+            U32 _x,
+            U32 _y)
+        {
+            copyImageFrom(_pixels, _pixelFormat, _width, _height, _x, _y);
+        }
+
+        //////////////////////////////////////////
+        // Copies _srcRects of the _texture into _dstRects of this texture on the GPU
+        // (stretched with the nearest filtering) without the GPU synchronization and the mipmaps generation.
+        // Returns false if the copy is not supported, nothing is copied in this case
+        virtual bool blitImageRegionsFrom(
+            Texture2D* _texture,
+            Rect2S const* _srcRects,
+            Rect2S const* _dstRects,
+            S32 _count)
+        {
+            return false;
+        }
+
         
 
         //////////////////////////////////////////
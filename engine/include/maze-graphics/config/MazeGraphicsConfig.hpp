@@ -47,7 +47,11 @@ namespace Maze
     //////////////////////////////////////////
     #define MAZE_UV_CHANNELS_MAX (8)
     #define MAZE_SKELETON_BONES_MAX (128)
+    #define MAZE_SKINNING_PALETTE_UV_CHANNEL (1)
     #define MAZE_DYNAMIC_LIGHTS_MAX (32)
+    #define MAZE_CLUSTERED_LIGHTS_MAX (1024)
+    #define MAZE_CLUSTERED_LIGHT_INDICES_MAX (65536)
+    #define MAZE_SHADOW_CASCADES_MAX (4)
 
 
 } // namespace Maze
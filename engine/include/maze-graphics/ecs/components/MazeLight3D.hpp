@@ -34,6 +34,7 @@
 #include "maze-core/ecs/MazeComponent.hpp"
 #include "maze-graphics/MazeRenderSystem.hpp"
 #include "maze-graphics/MazeColorF128.hpp"
+#include "maze-graphics/config/MazeGraphicsConfig.hpp"
 
 
 //////////////////////////////////////////
@@ -170,6 +171,27 @@ namespace Maze
         //////////////////////////////////////////
         inline F32 getShadowCastFarZ() const { return m_shadowCastFarZ; }
 
+
+        //////////////////////////////////////////
+        inline void setShadowCascadesCount(S32 _value) { m_shadowCascadesCount = Math::Clamp(_value, 1, MAZE_SHADOW_CASCADES_MAX); }
+
+        //////////////////////////////////////////
+        inline S32 getShadowCascadesCount() const { return m_shadowCascadesCount; }
+
+        //////////////////////////////////////////
+        // Far distances of the cascades from the camera (view space depth)
+        inline void setShadowCascadeSplits(Vec4F const& _value) { m_shadowCascadeSplits = _value; }
+
+        //////////////////////////////////////////
+        inline Vec4F const& getShadowCascadeSplits() const { return m_shadowCascadeSplits; }
+
+        //////////////////////////////////////////
+        // Cascades except the first one are re-rendered at most once per _value frames
+        inline void setShadowDistantCascadesUpdateInterval(S32 _value) { m_shadowDistantCascadesUpdateInterval = Math::Max(_value, 1); }
+
+        //////////////////////////////////////////
+        inline S32 getShadowDistantCascadesUpdateInterval() const { return m_shadowDistantCascadesUpdateInterval; }
+
     protected:
 
         //////////////////////////////////////////
@@ -204,6 +226,9 @@ namespace Maze
         F32 m_shadowCastSize = 10.0f;
         F32 m_shadowCastNearZ = 1.0f;
         F32 m_shadowCastFarZ = 50.0f;
+        S32 m_shadowCascadesCount = 1;
+        Vec4F m_shadowCascadeSplits = Vec4F(10.0f, 25.0f, 50.0f, 100.0f);
+        S32 m_shadowDistantCascadesUpdateInterval = 1;
     };
 
 
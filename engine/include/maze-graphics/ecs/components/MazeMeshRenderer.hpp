@@ -45,6 +45,7 @@ namespace Maze
     MAZE_USING_MANAGED_SHARED_PTR(RenderMesh);
     MAZE_USING_SHARED_PTR(MeshRenderer);
     MAZE_USING_SHARED_PTR(RenderMask);
+    MAZE_USING_SHARED_PTR(Transform3D);
 
 
     //////////////////////////////////////////
@@ -151,6 +152,20 @@ namespace Maze
         //////////////////////////////////////////
         inline bool getEnabled() const { return m_enabled; }
 
+
+        //////////////////////////////////////////
+        // Culling is done by the caller (see RenderControllerModule3D)
+        void gatherDefaultPassRenderUnits(
+            Transform3D* _transform3D,
+            DefaultPassParams const& _params,
+            Vector<RenderUnit>& _outRenderUnits);
+
+        //////////////////////////////////////////
+        void gatherShadowPassRenderUnits(
+            Transform3D* _transform3D,
+            ShadowPassParams const& _params,
+            Vector<RenderUnit>& _outRenderUnits);
+
     protected:
 
         //////////////////////////////////////////
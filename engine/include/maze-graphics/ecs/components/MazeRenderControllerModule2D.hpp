@@ -44,6 +44,7 @@
 #include "maze-graphics/ecs/components/MazeCanvasRenderer.hpp"
 #include "maze-graphics/ecs/components/MazeMeshRenderer.hpp"
 #include "maze-graphics/ecs/components/MazeMeshRendererInstanced.hpp"
+#include "maze-core/math/MazeAABB2D.hpp"
 
 
 //////////////////////////////////////////
@@ -202,6 +203,12 @@ namespace Maze
         //////////////////////////////////////////
         void updateSortedMeshRenderersList();
 
+        //////////////////////////////////////////
+        // _clipBounds are in the canvas space (the same as Transform2D world space)
+        bool isCanvasRenderCommandVisible(
+            CanvasRenderCommand const& _command,
+            AABB2D const& _clipBounds) const;
+
     protected:
         EcsWorld* m_world = nullptr;
         RenderSystemPtr m_renderSystem;
@@ -222,6 +229,9 @@ namespace Maze
         bool m_sortedMeshRenderersDirty;
         U32 m_hierarchyVersion = 0u;
         Vector<CanvasRenderData> m_sortedCanvasRenderData;
+
+        // Viewport and scissor masks intersection stack used for culling
+        Vector<AABB2D> m_clipBoundsStack;
     };
 
 
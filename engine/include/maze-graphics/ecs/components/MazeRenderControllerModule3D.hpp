@@ -37,12 +37,16 @@
 #include "maze-core/ecs/components/MazeTransform3D.hpp"
 #include "maze-core/math/MazeVec4.hpp"
 #include "maze-core/math/MazeMat4.hpp"
+#include "maze-core/math/MazeDynamicAABBTree3D.hpp"
+#include "maze-core/utils/MazeRadixSort.hpp"
 #include "maze-graphics/ecs/components/MazeCamera3D.hpp"
 #include "maze-graphics/ecs/components/MazeMeshRenderer.hpp"
 #include "maze-graphics/ecs/components/MazeMeshRendererInstanced.hpp"
 #include "maze-graphics/ecs/components/MazeSystemTextRenderer3D.hpp"
 #include "maze-graphics/ecs/events/MazeEcsGraphicsEvents.hpp"
 #include "maze-graphics/config/MazeGraphicsConfig.hpp"
+#include "maze-graphics/MazeLightClusterGrid.hpp"
+#include "maze-graphics/MazeSkinningPaletteBuffer.hpp"
 #include <functional>
 
 
@@ -95,9 +99,13 @@ namespace Maze
             std::function<void(RenderQueuePtr const&)> _endRenderQueueCallback = nullptr);
 
         //////////////////////////////////////////
+        // _outDynamicCasters is set when the pass has casters which are not tracked
+        // by the mesh renderers tree (gathered by events), so it can not be cached
         void drawShadowPass(
             RenderBuffer* _shadowBuffer,
-            ShadowPassParams const& _params);
+            ShadowPassParams const& _params,
+            bool* _outDynamicCasters = nullptr,
+            bool _clearDepth = true);
 
         //////////////////////////////////////////
         void draw(RenderTarget* _renderTarget);
@@ -109,6 +117,10 @@ namespace Maze
         void processPostUpdate(F32 _dt);
 
 
+        //////////////////////////////////////////
+        inline DynamicAABBTree3D const& getMeshRenderersTree() const { return m_meshRenderersTree; }
+
+
     protected:
 
         //////////////////////////////////////////
@@ -120,15 +132,117 @@ namespace Maze
             RenderSystemPtr const& _renderSystem);
 
 
+        //////////////////////////////////////////
+        void notifyMeshRendererEntityAdded(Entity* _entity);
+
+        //////////////////////////////////////////
+        void notifyMeshRendererEntityWillBeRemoved(Entity* _entity);
+
+        //////////////////////////////////////////
+        void updateMeshRenderersTree();
+
+        //////////////////////////////////////////
+        void gatherMeshRenderersDefaultPass(DefaultPassParams const& _params);
+
+        //////////////////////////////////////////
+        void gatherMeshRenderersShadowPass(ShadowPassParams const& _params);
+
+
+        //////////////////////////////////////////
+        void calculateShadowCascadesParams(
+            Light3D* _mainLight,
+            DefaultPassParams const& _params,
+            Vec2U const& _tileSize,
+            ShadowPassParams* _outCascadesParams);
+
+        //////////////////////////////////////////
+        // Renders the changed cascades of the main light shadow atlas
+        // and fills the shadow data of _params
+        void drawMainLightShadowCascades(
+            RenderBufferPtr const& _shadowBuffer,
+            Light3D* _mainLight,
+            DefaultPassParams& _params);
+
+        //////////////////////////////////////////
+        bool isShadowCastersChanged(Frustum const& _frustum) const;
+
+        //////////////////////////////////////////
+        void updateShadowCascadesUniforms(DefaultPassParams const& _params);
+
+    protected:
+
+        //////////////////////////////////////////
+        struct MeshRendererCullingProxy
+        {
+            Entity* entity = nullptr;
+            MeshRenderer* meshRenderer = nullptr;
+            Transform3D* transform = nullptr;
+            S32 treeProxyId = DynamicAABBTree3D::c_nullNode;
+            AABB3D localAABB;
+
+            // Shadow casting state, the cached cascades are invalidated when it is changed
+            bool enabled = false;
+            S32 renderMask = 0;
+            Size materialsKey = 0;
+        };
+
+        //////////////////////////////////////////
+        struct ShadowCascadeCache
+        {
+            Mat4F viewProjectionMatrix = Mat4F::c_identity;
+            Frustum frustum;
+            S32 renderMask = 0;
+            bool valid = false;
+            bool dirty = true;
+            bool dynamicCasters = false;
+        };
+
+        //////////////////////////////////////////
+        struct ShadowCascadesCache
+        {
+            RenderBuffer* shadowBufferRaw = nullptr;
+            RenderBufferWPtr shadowBuffer;
+            Vec2U shadowBufferSize = Vec2U::c_zero;
+            S32 cascadesCount = 0;
+            U32 frameIndex = 0;
+            ShadowCascadeCache cascades[MAZE_SHADOW_CASCADES_MAX];
+        };
+
+
     protected:
         EcsWorld* m_world = nullptr;
         RenderSystemPtr m_renderSystem;
 
         SharedPtr<GenericInclusiveEntitiesSample<Camera3D>> m_cameras3DSample;
         SharedPtr<GenericInclusiveEntitiesSample<Light3D>> m_lights3DSample;
+        SharedPtr<GenericInclusiveEntitiesSample<MeshRenderer, Transform3D>> m_meshRenderersSample;
+
+        // Mesh renderers with valid bounds are culled hierarchically via the tree
+        // (tree user data is the proxy index), the rest (raw VAO render meshes) are always gathered
+        DynamicAABBTree3D m_meshRenderersTree;
+        FastVector<MeshRendererCullingProxy> m_meshRendererProxies;
+        FlatHashMap<Entity*, S32> m_meshRendererProxyIndices;
+        FastVector<S32> m_unboundedMeshRendererProxies;
 
         Vector<RenderUnit> m_renderData;
-        Vector<RenderUnit*> m_renderDataSorted;
+        Mutex m_renderDataMutex;
+
+        // (sort key, index in m_renderData) pairs, sorted in place every pass
+        Vector<RadixSortKeyIndex> m_renderDataSortItems;
+        RadixSorter m_renderDataSorter;
+
+        LightClusterGridPtr m_lightClusterGrid;
+        Vector<LightClusterGridLight> m_clusterLights;
+
+        // Bone palettes of the animators drawn this frame, shared by all the passes
+        SkinningPaletteBufferPtr m_skinningPaletteBuffer;
+
+        // World bounds of the mesh renderers which were added, moved or removed this frame.
+        // Cached shadow cascades are re-rendered only when they are touched by these bounds
+        FastVector<AABB3D> m_shadowCastersDirtyAABBs;
+        FastVector<AABB3D> m_shadowCastersRemovedAABBs;
+        Vector<ShadowCascadesCache> m_shadowCascadesCaches;
+        U32 m_frameIndex = 0;
     };
 
 
@@ -40,11 +40,16 @@
 #include "maze-graphics/MazeVertexArrayObject.hpp"
 #include "maze-graphics/config/MazeGraphicsConfig.hpp"
 #include "maze-graphics/MazeFrustum.hpp"
+#include "maze-core/system/MazeMutex.hpp"
 
 
 //////////////////////////////////////////
 namespace Maze
 {
+    //////////////////////////////////////////
+    class SkinningPaletteBuffer;
+
+
     //////////////////////////////////////////
     // Struct DefaultPassParams
     //
@@ -71,9 +76,14 @@ namespace Maze
         Vec3F mainLightDirection = Vec3F::c_negativeUnitY;
         Mat4F mainLightViewProjectionMatrix = Mat4F::c_identity;
         Texture2DPtr mainLightShadowMap; // #TODO: Replace with ResourceId?
+        S32 mainLightShadowCascadesCount = 0;
+        Mat4F mainLightShadowCascadeMatrices[MAZE_SHADOW_CASCADES_MAX];
+        Vec4F mainLightShadowCascadeRects[MAZE_SHADOW_CASCADES_MAX]; // Atlas tiles (offset, size)
+        Vec4F mainLightShadowCascadeSplits = Vec4F::c_zero;
         S32 lightsCount = 0;
         Vec4F lightsPosRadius[MAZE_DYNAMIC_LIGHTS_MAX];
         Vec3F lightsColor[MAZE_DYNAMIC_LIGHTS_MAX];
+        SkinningPaletteBuffer* skinningPaletteBuffer = nullptr;
     };
 
     //////////////////////////////////////////
@@ -89,6 +99,9 @@ namespace Maze
         Frustum mainLightFrustum;
         F32 nearZ = 0.001f;
         F32 farZ = 100.0f;
+        Rect2F viewport = Rect2F(0.0f, 0.0f, 1.0f, 1.0f);
+        S32 cascadeIndex = 0;
+        SkinningPaletteBuffer* skinningPaletteBuffer = nullptr;
     };
 
 
@@ -200,10 +213,12 @@ namespace Maze
         inline Render3DDefaultPassGatherRenderUnitsEvent(
             RenderTarget* _renderTarget = nullptr,
             DefaultPassParams const* _passParams = nullptr,
-            Vector<RenderUnit>* _renderUnits = nullptr)
+            Vector<RenderUnit>* _renderUnits = nullptr,
+            Mutex* _renderUnitsMutex = nullptr)
             : m_renderTarget(_renderTarget)
             , m_passParams(_passParams)
             , m_renderUnits(_renderUnits)
+            , m_renderUnitsMutex(_renderUnitsMutex)
         {}
 
         //////////////////////////////////////////
@@ -215,10 +230,15 @@ namespace Maze
         //////////////////////////////////////////
         inline Vector<RenderUnit>* getRenderUnits() const { return m_renderUnits; }
 
+        //////////////////////////////////////////
+        // Should be locked by the handlers which are gathering in parallel (EntitiesSampleFlags::ProcessEventsParallel)
+        inline Mutex* getRenderUnitsMutex() const { return m_renderUnitsMutex; }
+
     private:
         RenderTarget* m_renderTarget = nullptr;
         DefaultPassParams const* m_passParams;
         Vector<RenderUnit>* m_renderUnits;
+        Mutex* m_renderUnitsMutex = nullptr;
     };
 
 
@@ -239,10 +259,12 @@ namespace Maze
         inline Render3DShadowPassGatherRenderUnitsEvent(
             RenderBuffer* _shadowBuffer = nullptr,
             ShadowPassParams const* _passParams = nullptr,
-            Vector<RenderUnit>* _renderUnits = nullptr)
+            Vector<RenderUnit>* _renderUnits = nullptr,
+            Mutex* _renderUnitsMutex = nullptr)
             : m_shadowBuffer(_shadowBuffer)
             , m_passParams(_passParams)
             , m_renderUnits(_renderUnits)
+            , m_renderUnitsMutex(_renderUnitsMutex)
         {}
 
         //////////////////////////////////////////
@@ -254,10 +276,15 @@ namespace Maze
         //////////////////////////////////////////
         inline Vector<RenderUnit>* getRenderUnits() const { return m_renderUnits; }
 
+        //////////////////////////////////////////
+        // Should be locked by the handlers which are gathering in parallel (EntitiesSampleFlags::ProcessEventsParallel)
+        inline Mutex* getRenderUnitsMutex() const { return m_renderUnitsMutex; }
+
     private:
         RenderBuffer* m_shadowBuffer = nullptr;
         ShadowPassParams const* m_passParams;
         Vector<RenderUnit>* m_renderUnits;
+        Mutex* m_renderUnitsMutex = nullptr;
     };
 
 
@@ -129,6 +129,11 @@ namespace Maze
             Vec3F& _outCenter,
             F32& _outRadius);
 
+        //////////////////////////////////////////
+        MAZE_GRAPHICS_API AABB3D CalculateWorldAABB(
+            AABB3D const& _localAABB,
+            TMat const& _worldTransform);
+
     } // namespace GraphicsUtilsHelper
     //////////////////////////////////////////
 
@@ -74,6 +74,7 @@ namespace Maze
         bool mergeSubMeshes = false;
         ByteBufferPtr tangentsData;
 		bool generateTangents = false;
+        bool compressAnimations = false;
     };
 
 
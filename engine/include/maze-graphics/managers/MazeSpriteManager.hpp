@@ -46,6 +46,7 @@ namespace Maze
     //////////////////////////////////////////
     MAZE_USING_SHARED_PTR(RenderSystem);
     MAZE_USING_SHARED_PTR(SpriteManager);
+    MAZE_USING_SHARED_PTR(SpriteAtlas);
     MAZE_USING_MANAGED_SHARED_PTR(Sprite);
     MAZE_USING_MANAGED_SHARED_PTR(Material);
     MAZE_USING_MANAGED_SHARED_PTR(AssetFile);
@@ -147,6 +148,10 @@ namespace Maze
         MaterialPtr const& getDefaultSpriteMaterial() const { return m_defaultSpriteMaterial; }
 
 
+        //////////////////////////////////////////
+        inline SpriteAtlasPtr const& getSpriteAtlas() const { return m_spriteAtlas; }
+
+
         //////////////////////////////////////////
         void loadSpriteMetaData(SpritePtr const& _sprite, DataBlock const& _metaData);
 
@@ -215,6 +220,8 @@ namespace Maze
         SpritePtr m_builtinSprites[BuiltinSpriteType::MAX];
 
         MaterialPtr m_defaultSpriteMaterial;
+
+        SpriteAtlasPtr m_spriteAtlas;
     };
 
 } // namespace Maze
@@ -0,0 +1,108 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeParticleSystemKernels_hpp_))
+#define _MazeParticleSystemKernels_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-particles/MazeParticlesHeader.hpp"
+#include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/math/MazeVec3.hpp"
+#include "maze-core/math/MazeVec4.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    static_assert(sizeof(Vec3F) == sizeof(F32) * 3, "Vec3F streams are processed as flat F32 arrays");
+    static_assert(sizeof(Vec4F) == sizeof(F32) * 4, "Vec4F streams are processed as flat F32 arrays");
+
+
+    //////////////////////////////////////////
+    // Namespace ParticleSystemKernels
+    // SIMD loops over the Particles3D streams
+    //
+    //////////////////////////////////////////
+    namespace ParticleSystemKernels
+    {
+        //////////////////////////////////////////
+        // current -= _dt, scalar = 1 - current / initial clamped to [0, 1]
+        MAZE_PARTICLES_API void UpdateLifes(
+            F32* _lifesCurrent,
+            F32* _lifesScalar,
+            F32 const* _lifesInitial,
+            F32 _dt,
+            S32 _count);
+
+        //////////////////////////////////////////
+        // _values[i] += _deltas[i] * _scale
+        MAZE_PARTICLES_API void MultiplyAdd(
+            F32* _values,
+            F32 const* _deltas,
+            F32 _scale,
+            S32 _count);
+
+        //////////////////////////////////////////
+        // _results[i] = _values0[i] * _values1[i], _results may alias the arguments
+        MAZE_PARTICLES_API void Multiply(
+            F32* _results,
+            F32 const* _values0,
+            F32 const* _values1,
+            S32 _count);
+
+
+        //////////////////////////////////////////
+        inline void MultiplyAdd(
+            Vec3F* _values,
+            Vec3F const* _deltas,
+            F32 _scale,
+            S32 _count)
+        {
+            MultiplyAdd(&_values->x, &_deltas->x, _scale, _count * 3);
+        }
+
+        //////////////////////////////////////////
+        inline void Multiply(
+            Vec4F* _results,
+            Vec4F const* _values0,
+            Vec4F const* _values1,
+            S32 _count)
+        {
+            Multiply(&_results->x, &_values0->x, &_values1->x, _count * 4);
+        }
+
+    } // namespace ParticleSystemKernels
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeParticleSystemKernels_hpp_
+//////////////////////////////////////////
@@ -45,6 +45,10 @@ namespace Maze
     extern MAZE_PARTICLES_API const Size c_particleSystemParametersCount;
     extern MAZE_PARTICLES_API const F32 c_invParticleSystemParametersCount;
 
+    //////////////////////////////////////////
+    // Max particles count processed by one batch of the modules (stack buffers size)
+    static S32 const c_particlesBatchSize = 256;
+
 } // namespace Maze
 //////////////////////////////////////////
 
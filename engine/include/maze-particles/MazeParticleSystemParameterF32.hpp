@@ -160,6 +160,14 @@ namespace Maze
         //////////////////////////////////////////
         inline void sample(S32 _particleSeed, F32 _scalar, F32& _result) const;
 
+        //////////////////////////////////////////
+        // Samples _count particles at once, the sampling mode is dispatched once per batch
+        void sampleBatch(S32 const* _particleSeeds, F32 const* _scalars, F32* _results, S32 _count) const;
+
+        //////////////////////////////////////////
+        // Same as above with the scalar shared by all particles, so curves are evaluated once
+        void sampleBatch(S32 const* _particleSeeds, F32 _scalar, F32* _results, S32 _count) const;
+
 
         //////////////////////////////////////////
         inline String toString() const
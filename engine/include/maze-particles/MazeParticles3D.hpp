@@ -48,6 +48,8 @@ namespace Maze
 
     //////////////////////////////////////////
     // Class Particles3D
+    // Particles data is stored as SoA streams, so the modules
+    // are able to process them in batches (see ParticleSystemKernels)
     //
     //////////////////////////////////////////
     class MAZE_PARTICLES_API Particles3D
@@ -62,35 +64,6 @@ namespace Maze
 
     public:
 
-        //////////////////////////////////////////
-        struct ParticleLife
-        {
-            F32 initial;
-            F32 current;
-            F32 scalar;
-        };
-
-        //////////////////////////////////////////
-        struct ParticleSize
-        {
-            F32 initial;
-            F32 current;
-        };
-
-        //////////////////////////////////////////
-        struct ParticleRotation
-        {
-            F32 initial;
-            F32 current;
-        };
-
-        //////////////////////////////////////////
-        struct ParticleMovement
-        {
-            Vec3F velocity;
-            Vec3F acceleration;
-        };
-
         //////////////////////////////////////////
         struct ParticleAnimationFrame
         {
@@ -138,14 +111,18 @@ namespace Maze
             m_seeds[_index0] = m_seeds[_index1];
             m_positions[_index0] = m_positions[_index1];
             m_directions[_index0] = m_directions[_index1];
-            m_rotations[_index0] = m_rotations[_index1];
-            m_lifes[_index0] = m_lifes[_index1];
-            m_sizes[_index0] = m_sizes[_index1];
+            m_rotationsInitial[_index0] = m_rotationsInitial[_index1];
+            m_rotationsCurrent[_index0] = m_rotationsCurrent[_index1];
+            m_lifesInitial[_index0] = m_lifesInitial[_index1];
+            m_lifesCurrent[_index0] = m_lifesCurrent[_index1];
+            m_lifesScalar[_index0] = m_lifesScalar[_index1];
+            m_sizesInitial[_index0] = m_sizesInitial[_index1];
+            m_sizesCurrent[_index0] = m_sizesCurrent[_index1];
             m_colorsInitial[_index0] = m_colorsInitial[_index1];
             m_colorsCurrent[_index0] = m_colorsCurrent[_index1];
-            m_movements[_index0] = m_movements[_index1];
+            m_velocities[_index0] = m_velocities[_index1];
+            m_accelerations[_index0] = m_accelerations[_index1];
             m_animationFrames[_index0] = m_animationFrames[_index1];
-            
         }
 
         //////////////////////////////////////////
@@ -154,12 +131,17 @@ namespace Maze
             eastl::swap(m_seeds[_index0], m_seeds[_index1]);
             eastl::swap(m_positions[_index0], m_positions[_index1]);
             eastl::swap(m_directions[_index0], m_directions[_index1]);
-            eastl::swap(m_rotations[_index0], m_rotations[_index1]);
-            eastl::swap(m_lifes[_index0], m_lifes[_index1]);
-            eastl::swap(m_sizes[_index0], m_sizes[_index1]);
+            eastl::swap(m_rotationsInitial[_index0], m_rotationsInitial[_index1]);
+            eastl::swap(m_rotationsCurrent[_index0], m_rotationsCurrent[_index1]);
+            eastl::swap(m_lifesInitial[_index0], m_lifesInitial[_index1]);
+            eastl::swap(m_lifesCurrent[_index0], m_lifesCurrent[_index1]);
+            eastl::swap(m_lifesScalar[_index0], m_lifesScalar[_index1]);
+            eastl::swap(m_sizesInitial[_index0], m_sizesInitial[_index1]);
+            eastl::swap(m_sizesCurrent[_index0], m_sizesCurrent[_index1]);
             eastl::swap(m_colorsInitial[_index0], m_colorsInitial[_index1]);
             eastl::swap(m_colorsCurrent[_index0], m_colorsCurrent[_index1]);
-            eastl::swap(m_movements[_index0], m_movements[_index1]);
+            eastl::swap(m_velocities[_index0], m_velocities[_index1]);
+            eastl::swap(m_accelerations[_index0], m_accelerations[_index1]);
             eastl::swap(m_animationFrames[_index0], m_animationFrames[_index1]);
         }
 
@@ -171,12 +153,17 @@ namespace Maze
             memset((void*)(m_seeds.begin() + _indexFirst), 0, sizeof(m_seeds[0]) * count);
             memset((void*)(m_positions.begin() + _indexFirst), 0, sizeof(m_positions[0]) * count);
             memset((void*)(m_directions.begin() + _indexFirst), 0, sizeof(m_directions[0]) * count);
-            memset((void*)(m_rotations.begin() + _indexFirst), 0, sizeof(m_rotations[0]) * count);
-            memset((void*)(m_lifes.begin() + _indexFirst), 0, sizeof(m_lifes[0]) * count);
-            memset((void*)(m_sizes.begin() + _indexFirst), 0, sizeof(m_sizes[0]) * count);
+            memset((void*)(m_rotationsInitial.begin() + _indexFirst), 0, sizeof(m_rotationsInitial[0]) * count);
+            memset((void*)(m_rotationsCurrent.begin() + _indexFirst), 0, sizeof(m_rotationsCurrent[0]) * count);
+            memset((void*)(m_lifesInitial.begin() + _indexFirst), 0, sizeof(m_lifesInitial[0]) * count);
+            memset((void*)(m_lifesCurrent.begin() + _indexFirst), 0, sizeof(m_lifesCurrent[0]) * count);
+            memset((void*)(m_lifesScalar.begin() + _indexFirst), 0, sizeof(m_lifesScalar[0]) * count);
+            memset((void*)(m_sizesInitial.begin() + _indexFirst), 0, sizeof(m_sizesInitial[0]) * count);
+            memset((void*)(m_sizesCurrent.begin() + _indexFirst), 0, sizeof(m_sizesCurrent[0]) * count);
             memset((void*)(m_colorsInitial.begin() + _indexFirst), 0, sizeof(m_colorsInitial[0]) * count);
             memset((void*)(m_colorsCurrent.begin() + _indexFirst), 0, sizeof(m_colorsCurrent[0]) * count);
-            memset((void*)(m_movements.begin() + _indexFirst), 0, sizeof(m_movements[0]) * count);
+            memset((void*)(m_velocities.begin() + _indexFirst), 0, sizeof(m_velocities[0]) * count);
+            memset((void*)(m_accelerations.begin() + _indexFirst), 0, sizeof(m_accelerations[0]) * count);
             memset((void*)(m_animationFrames.begin() + _indexFirst), 0, sizeof(m_animationFrames[0]) * count);
         }
 
@@ -191,13 +178,26 @@ namespace Maze
         inline Vec3F& accessDirection(S32 _index) { return m_directions[_index]; }
 
         //////////////////////////////////////////
-        inline ParticleLife& accessLife(S32 _index) { return m_lifes[_index]; }
+        inline F32& accessLifeInitial(S32 _index) { return m_lifesInitial[_index]; }
+
+        //////////////////////////////////////////
+        inline F32& accessLifeCurrent(S32 _index) { return m_lifesCurrent[_index]; }
+
+        //////////////////////////////////////////
+        // Normalized age of the particle, [0, 1]
+        inline F32& accessLifeScalar(S32 _index) { return m_lifesScalar[_index]; }
+
+        //////////////////////////////////////////
+        inline F32& accessSizeInitial(S32 _index) { return m_sizesInitial[_index]; }
+
+        //////////////////////////////////////////
+        inline F32& accessSizeCurrent(S32 _index) { return m_sizesCurrent[_index]; }
 
         //////////////////////////////////////////
-        inline ParticleSize& accessSize(S32 _index) { return m_sizes[_index]; }
+        inline F32& accessRotationInitial(S32 _index) { return m_rotationsInitial[_index]; }
 
         //////////////////////////////////////////
-        inline ParticleRotation& accessRotation(S32 _index) { return m_rotations[_index]; }
+        inline F32& accessRotationCurrent(S32 _index) { return m_rotationsCurrent[_index]; }
 
         //////////////////////////////////////////
         inline Vec4F& accessColorInitial(S32 _index) { return m_colorsInitial[_index]; }
@@ -206,7 +206,10 @@ namespace Maze
         inline Vec4F& accessColorCurrent(S32 _index) { return m_colorsCurrent[_index]; }
 
         //////////////////////////////////////////
-        inline ParticleMovement& accessMovement(S32 _index) { return m_movements[_index]; }
+        inline Vec3F& accessVelocity(S32 _index) { return m_velocities[_index]; }
+
+        //////////////////////////////////////////
+        inline Vec3F& accessAcceleration(S32 _index) { return m_accelerations[_index]; }
 
         //////////////////////////////////////////
         inline ParticleAnimationFrame& accessAnimationFrame(S32 _index) { return m_animationFrames[_index]; }
@@ -226,6 +229,49 @@ namespace Maze
         inline F32& accessSqrDistanceToCamera(S32 _index) { return m_sqrDistanceToCamera[_index]; }
 
 
+        //////////////////////////////////////////
+        inline S32 const* getSeeds() const { return m_seeds.begin(); }
+
+        //////////////////////////////////////////
+        inline Vec3F* getPositions() { return m_positions.begin(); }
+
+        //////////////////////////////////////////
+        inline Vec3F const* getDirections() const { return m_directions.begin(); }
+
+        //////////////////////////////////////////
+        inline F32* getLifesInitial() { return m_lifesInitial.begin(); }
+
+        //////////////////////////////////////////
+        inline F32* getLifesCurrent() { return m_lifesCurrent.begin(); }
+
+        //////////////////////////////////////////
+        inline F32* getLifesScalar() { return m_lifesScalar.begin(); }
+
+        //////////////////////////////////////////
+        inline F32* getSizesInitial() { return m_sizesInitial.begin(); }
+
+        //////////////////////////////////////////
+        inline F32* getSizesCurrent() { return m_sizesCurrent.begin(); }
+
+        //////////////////////////////////////////
+        inline F32* getRotationsInitial() { return m_rotationsInitial.begin(); }
+
+        //////////////////////////////////////////
+        inline F32* getRotationsCurrent() { return m_rotationsCurrent.begin(); }
+
+        //////////////////////////////////////////
+        inline Vec4F* getColorsInitial() { return m_colorsInitial.begin(); }
+
+        //////////////////////////////////////////
+        inline Vec4F* getColorsCurrent() { return m_colorsCurrent.begin(); }
+
+        //////////////////////////////////////////
+        inline Vec3F* getVelocities() { return m_velocities.begin(); }
+
+        //////////////////////////////////////////
+        inline Vec3F* getAccelerations() { return m_accelerations.begin(); }
+
+
         //////////////////////////////////////////
         inline TMat const* getRenderTransforms() const { return m_renderTransforms.begin(); }
 
@@ -243,12 +289,17 @@ namespace Maze
         FastVector<S32> m_seeds;
         FastVector<Vec3F> m_positions;
         FastVector<Vec3F> m_directions;
-        FastVector<ParticleLife> m_lifes;
-        FastVector<ParticleSize> m_sizes;
-        FastVector<ParticleRotation> m_rotations;
+        FastVector<F32> m_lifesInitial;
+        FastVector<F32> m_lifesCurrent;
+        FastVector<F32> m_lifesScalar;
+        FastVector<F32> m_sizesInitial;
+        FastVector<F32> m_sizesCurrent;
+        FastVector<F32> m_rotationsInitial;
+        FastVector<F32> m_rotationsCurrent;
         FastVector<Vec4F> m_colorsInitial;
         FastVector<Vec4F> m_colorsCurrent;
-        FastVector<ParticleMovement> m_movements;
+        FastVector<Vec3F> m_velocities;
+        FastVector<Vec3F> m_accelerations;
         FastVector<ParticleAnimationFrame> m_animationFrames;
 
         FastVector<F32> m_sqrDistanceToCamera;
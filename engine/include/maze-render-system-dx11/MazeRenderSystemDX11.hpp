@@ -109,6 +109,10 @@ namespace Maze
         //////////////////////////////////////////
         virtual F32 getTextureMaxAnisotropyLevel() MAZE_OVERRIDE;
 
+        //////////////////////////////////////////
+        // ClearRenderTargetView/ClearDepthStencilView ignore the scissor rect
+        virtual bool isScissoredClearSupported() MAZE_OVERRIDE { return false; }
+
 
         //////////////////////////////////////////
         virtual bool setCurrentRenderTarget(RenderTarget* _renderTarget) MAZE_OVERRIDE;
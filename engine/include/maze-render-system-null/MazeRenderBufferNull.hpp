@@ -0,0 +1,123 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRenderBufferNull_hpp_))
+#define _MazeRenderBufferNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeRenderBuffer.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_MANAGED_SHARED_PTR(RenderBufferNull);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class RenderBufferNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API RenderBufferNull
+        : public RenderBuffer
+    {
+    public:
+
+        //////////////////////////////////////////
+        MAZE_DECLARE_METACLASS_WITH_PARENT(RenderBufferNull, RenderBuffer);
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~RenderBufferNull();
+
+        //////////////////////////////////////////
+        static RenderBufferNullPtr Create(
+            RenderSystemNull* _renderSystem,
+            RenderBufferDeleter const& _deleter = DefaultDelete<RenderBuffer>());
+
+        //////////////////////////////////////////
+        static RenderBufferNullPtr Create(
+            RenderBufferNullPtr const& _renderBuffer,
+            RenderBufferDeleter const& _deleter = DefaultDelete<RenderBuffer>());
+
+        //////////////////////////////////////////
+        virtual RenderBufferPtr createCopy() MAZE_OVERRIDE;
+
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+
+        //////////////////////////////////////////
+        virtual bool setSize(Vec2U const& _size) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void endDraw() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool processRenderTargetWillSet() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void processRenderTargetSet() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void processRenderTargetWillReset() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void blit(RenderBufferPtr const& _srcBuffer) MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        RenderBufferNull();
+
+        //////////////////////////////////////////
+        using RenderBuffer::init;
+
+        //////////////////////////////////////////
+        bool init(RenderSystemNull* _renderSystem);
+
+        //////////////////////////////////////////
+        bool init(RenderBufferNullPtr const& _renderBuffer);
+
+        //////////////////////////////////////////
+        void resizeTexture(TexturePtr const& _texture, Vec2U const& _size);
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRenderBufferNull_hpp_
+//////////////////////////////////////////
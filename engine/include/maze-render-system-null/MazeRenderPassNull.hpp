@@ -0,0 +1,96 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRenderPassNull_hpp_))
+#define _MazeRenderPassNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeRenderPass.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(RenderPassNull);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class RenderPassNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API RenderPassNull
+        : public RenderPass
+    {
+    public:
+
+        //////////////////////////////////////////
+        using RenderPassDeleter = std::function<void(RenderPassNull* _ptr)>;
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~RenderPassNull();
+
+        //////////////////////////////////////////
+        static RenderPassNullPtr Create(
+            RenderSystem* _renderSystem,
+            RenderPassType _passType,
+            RenderPassDeleter const& _deleter = DefaultDelete<RenderPassNull>());
+
+        //////////////////////////////////////////
+        static RenderPassNullPtr Create(
+            RenderPassNullPtr const& _renderPass,
+            RenderPassDeleter const& _deleter = DefaultDelete<RenderPassNull>());
+
+        //////////////////////////////////////////
+        virtual RenderPassPtr createCopy() MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        RenderPassNull();
+
+        //////////////////////////////////////////
+        virtual bool init(
+            RenderSystem* _renderSystem,
+            RenderPassType _passType) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        bool init(RenderPassNullPtr const& _renderPass);
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRenderPassNull_hpp_
+//////////////////////////////////////////
@@ -0,0 +1,97 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRenderQueueNull_hpp_))
+#define _MazeRenderQueueNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeRenderQueue.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(RenderQueueNull);
+    class RenderSystemNull;
+    class ShaderNull;
+
+
+    //////////////////////////////////////////
+    // Class RenderQueueNull
+    // Walks the commands like a real backend does (render pass uniforms,
+    // instance streams uploads) and records statistics instead of GPU calls
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API RenderQueueNull
+        : public RenderQueue
+    {
+    public:
+
+        //////////////////////////////////////////
+        virtual ~RenderQueueNull();
+
+        //////////////////////////////////////////
+        static RenderQueueNullPtr Create(RenderTarget* _renderTarget);
+
+
+        //////////////////////////////////////////
+        virtual void draw() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void clear() MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        RenderQueueNull();
+
+        //////////////////////////////////////////
+        virtual bool init(RenderTarget* _renderTarget) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+        //////////////////////////////////////////
+        void bindRenderPass(RenderPass* _renderPass);
+
+    protected:
+        ShaderNull* m_currentShader = nullptr;
+        S32 m_scissorRectsDepth = 0;
+        F32 m_drawTime = 0.0f;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRenderQueueNull_hpp_
+//////////////////////////////////////////
@@ -0,0 +1,220 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRenderSystemNull_hpp_))
+#define _MazeRenderSystemNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeRenderSystemNullConfig.hpp"
+#include "maze-graphics/MazeRenderSystem.hpp"
+#include "maze-core/math/MazeMath.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(RenderSystemNull);
+
+
+    //////////////////////////////////////////
+    // Struct RenderSystemNullStats
+    // Everything the null backend has been asked to do since the last reset
+    //
+    //////////////////////////////////////////
+    struct MAZE_RENDER_SYSTEM_NULL_API RenderSystemNullStats
+    {
+        // Render queue commands
+        U32 drawCalls = 0u;
+        U64 instancesCount = 0u;
+        U64 indicesCount = 0u;
+        U32 renderPassChanges = 0u;
+        U32 renderTargetChanges = 0u;
+        U32 clears = 0u;
+        U32 scissorRectChanges = 0u;
+        U32 clipPlaneChanges = 0u;
+        U32 presentedFrames = 0u;
+
+        // Shader uniforms
+        U32 uniformChanges = 0u;
+        U32 uniformUploads = 0u;
+        U64 uniformUploadedBytes = 0u;
+
+        // Resources
+        U32 shadersLoaded = 0u;
+        U32 texturesLoaded = 0u;
+        U64 textureUploadedBytes = 0u;
+        U64 vertexUploadedBytes = 0u;
+        U64 indexUploadedBytes = 0u;
+    };
+
+
+    //////////////////////////////////////////
+    // Class RenderSystemNull
+    // Headless render system. Accepts every command and only records statistics,
+    // nothing is submitted to a GPU (servers, CI benchmarks)
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API RenderSystemNull
+        : public RenderSystem
+    {
+    public:
+
+        //////////////////////////////////////////
+        MAZE_DECLARE_METACLASS_WITH_PARENT(RenderSystemNull, RenderSystem);
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~RenderSystemNull();
+
+        //////////////////////////////////////////
+        static RenderSystemNullPtr Create(RenderSystemNullConfig const& _config = RenderSystemNullConfig());
+
+
+        //////////////////////////////////////////
+        virtual String const& getName() MAZE_OVERRIDE;
+
+
+        //////////////////////////////////////////
+        inline RenderSystemNullConfig const& getConfig() const { return m_config; }
+
+
+        //////////////////////////////////////////
+        inline RenderSystemNullStats const& getStats() const { return m_stats; }
+
+        //////////////////////////////////////////
+        inline RenderSystemNullStats& getStats() { return m_stats; }
+
+        //////////////////////////////////////////
+        void resetStats();
+
+
+        //////////////////////////////////////////
+        virtual bool isTextureFormatSupported(PixelFormat::Enum _pixelFormat) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual S32 getWindowMaxAntialiasingLevelSupport() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual S32 getWindowCurrentAntialiasingLevelSupport() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual S32 getTextureMaxSize() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual S32 getTextureMaxAntialiasingLevelSupport() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual F32 getTextureMaxAnisotropyLevel() MAZE_OVERRIDE;
+
+
+        //////////////////////////////////////////
+        virtual bool setCurrentRenderTarget(RenderTarget* _renderTarget) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void clearCurrentRenderTarget(
+            bool _colorBuffer = true,
+            bool _depthBuffer = true,
+            bool _stencilBuffer = true) MAZE_OVERRIDE;
+
+
+        //////////////////////////////////////////
+        virtual ShaderUniformPtr createShaderUniform(
+            ShaderPtr const& _shader,
+            ShaderUniformType _type = ShaderUniformType::None) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual RenderWindowPtr createRenderWindow(RenderWindowParams const& _params) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual VertexArrayObjectPtr createVertexArrayObject(RenderTarget* _renderTarget = nullptr) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual VertexBufferObjectPtr createVertexBufferObject(
+            GPUByteBufferAccessType::Enum _accessType,
+            bool _singleMapping = false,
+            RenderTarget* _renderTarget = nullptr) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual Texture2DPtr createTexture2D() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual Texture2DMSPtr createTexture2DMS() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual TextureCubePtr createTextureCube() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual MaterialPtr createMaterial() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual RenderPassPtr createRenderPass(
+            RenderPassType _passType) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual GPUVertexBufferPtr createGPUVertexBuffer(
+            VertexDataDescription const& _vertexDataDescription,
+            Size _vertexCount,
+            GPUByteBufferAccessType::Enum _accessType,
+            void* _initialData = nullptr) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual GPUTextureBufferPtr createGPUTextureBuffer(
+            Vec2U const& _size,
+            PixelFormat::Enum _pixelFormat,
+            GPUByteBufferAccessType::Enum _accessType,
+            void* _initialData = nullptr) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual RenderBufferPtr createRenderBuffer(
+            RenderBuffer::RenderBufferDeleter const& _deleter = DefaultDelete<RenderBuffer>(),
+            RenderTarget* _renderTarget = nullptr) MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        RenderSystemNull();
+
+        //////////////////////////////////////////
+        virtual bool init(RenderSystemNullConfig const& _config);
+
+    protected:
+        RenderSystemNullConfig m_config;
+        RenderSystemNullStats m_stats;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRenderSystemNull_hpp_
+//////////////////////////////////////////
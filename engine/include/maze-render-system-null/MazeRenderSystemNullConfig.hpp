@@ -0,0 +1,62 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRenderSystemNullConfig_hpp_))
+#define _MazeRenderSystemNullConfig_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-core/MazeBaseTypes.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Struct RenderSystemNullConfig
+    //
+    //////////////////////////////////////////
+    struct MAZE_RENDER_SYSTEM_NULL_API RenderSystemNullConfig
+    {
+        // Instancing limits reported to the render queues (there is no GPU limit to respect)
+        U32 instancesPerDrawCall = 1024u;
+        U32 instancesPerDraw = 16384u * 2u;
+
+        // Values reported as device capabilities
+        S32 textureMaxSize = 16384;
+        S32 antialiasingLevelMax = 8;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRenderSystemNullConfig_hpp_
+//////////////////////////////////////////
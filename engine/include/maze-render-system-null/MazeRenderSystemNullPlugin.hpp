@@ -0,0 +1,113 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRenderSystemNullPlugin_hpp_))
+#define _MazeRenderSystemNullPlugin_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-core/system/MazePlugin.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(RenderSystemNullPlugin);
+    MAZE_USING_SHARED_PTR(RenderSystemNull);
+
+
+#if (MAZE_STATIC)
+
+    //////////////////////////////////////////
+    void InstallRenderSystemNullPlugin(RenderSystemNullConfig const& _config = RenderSystemNullConfig());
+
+    //////////////////////////////////////////
+    void UninstallRenderSystemNullPlugin();
+
+#endif
+
+
+    //////////////////////////////////////////
+    // Class RenderSystemNullPlugin
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API RenderSystemNullPlugin
+        : public Plugin
+        , public eastl::enable_shared_from_this<RenderSystemNullPlugin>
+    {
+    public:
+        //////////////////////////////////////////
+        static constexpr CString const c_libraryName = "maze-render-system-null";
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~RenderSystemNullPlugin();
+
+        //////////////////////////////////////////
+        static RenderSystemNullPluginPtr Create(RenderSystemNullConfig const& _config = RenderSystemNullConfig());
+
+        //////////////////////////////////////////
+        virtual String const& getName() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void install() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void uninstall() MAZE_OVERRIDE;
+
+
+        //////////////////////////////////////////
+        RenderSystemNullConfig const& getConfig() const { return m_config; }
+
+        //////////////////////////////////////////
+        void setConfig(RenderSystemNullConfig const& _config) { m_config = _config; }
+
+    protected:
+
+        //////////////////////////////////////////
+        RenderSystemNullPlugin();
+
+        //////////////////////////////////////////
+        bool init(RenderSystemNullConfig const& _config);
+
+    protected:
+        RenderSystemNullWPtr m_renderSystem;
+
+        RenderSystemNullConfig m_config;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRenderSystemNullPlugin_hpp_
+//////////////////////////////////////////
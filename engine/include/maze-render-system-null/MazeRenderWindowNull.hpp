@@ -0,0 +1,119 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeRenderWindowNull_hpp_))
+#define _MazeRenderWindowNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeRenderWindow.hpp"
+#include "maze-graphics/MazeRenderWindowParams.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_MANAGED_SHARED_PTR(RenderWindowNull);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class RenderWindowNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API RenderWindowNull
+        : public RenderWindow
+    {
+    public:
+
+        //////////////////////////////////////////
+        MAZE_DECLARE_METACLASS_WITH_PARENT(RenderWindowNull, RenderWindow);
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~RenderWindowNull();
+
+        //////////////////////////////////////////
+        static RenderWindowNullPtr Create(
+            RenderSystemNull* _renderSystem,
+            RenderWindowParams const& _params);
+
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+
+        //////////////////////////////////////////
+        virtual void swapBuffers() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool processRenderTargetWillSet() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void processRenderTargetSet() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void processRenderTargetWillReset() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void setVSync(S32 _vsync) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        inline S32 getVSync() const { return m_vsync; }
+
+    protected:
+
+        //////////////////////////////////////////
+        RenderWindowNull();
+
+        //////////////////////////////////////////
+        using RenderWindow::init;
+
+        //////////////////////////////////////////
+        bool init(
+            RenderSystemNull* _renderSystem,
+            RenderWindowParams const& _params);
+
+        //////////////////////////////////////////
+        virtual WindowPtr fetchSystemWindow(WindowParamsPtr const& _params) MAZE_OVERRIDE;
+
+    protected:
+        RenderSystemNull* m_renderSystemNull = nullptr;
+        S32 m_vsync = 0;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeRenderWindowNull_hpp_
+//////////////////////////////////////////
@@ -0,0 +1,150 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeShaderNull_hpp_))
+#define _MazeShaderNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeShader.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(ShaderNull);
+    MAZE_USING_SHARED_PTR(RenderSystem);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class ShaderNull
+    // Nothing is compiled - the uniforms are taken from the GLSL declarations
+    // of the source plus the engine default uniforms, so the material and
+    // render queue code paths work exactly like with a real backend
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API ShaderNull
+        : public Shader
+    {
+    public:
+
+        //////////////////////////////////////////
+        MAZE_DECLARE_METACLASS_WITH_PARENT(ShaderNull, Shader);
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~ShaderNull();
+
+        //////////////////////////////////////////
+        static ShaderPtr Create(RenderSystemPtr const& _renderSystem);
+
+        //////////////////////////////////////////
+        static ShaderPtr CreateFromFile(
+            RenderSystemPtr const& _renderSystem,
+            AssetFilePtr const& _shaderFile);
+
+        //////////////////////////////////////////
+        static ShaderPtr CreateFromSource(
+            RenderSystemPtr const& _renderSystem,
+            String const& _shaderSource,
+            CString _shaderName = nullptr);
+
+        //////////////////////////////////////////
+        static ShaderPtr Create(ShaderNullPtr const& _shader);
+
+        //////////////////////////////////////////
+        virtual ShaderPtr createCopy() MAZE_OVERRIDE;
+
+
+        //////////////////////////////////////////
+        virtual bool isValid() MAZE_OVERRIDE { return m_loaded; }
+
+        //////////////////////////////////////////
+        // Shader assets are authored in GLSL, so the null backend reads the GLSL sections
+        virtual CString getLanguage() const MAZE_OVERRIDE { return "GLSL"; }
+
+
+        //////////////////////////////////////////
+        virtual bool loadFromSource(String const& _shaderSource) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool loadFromSources(String const& _vertexShaderSource, String const& _fragmentShaderSource) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void recompile() MAZE_OVERRIDE;
+
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+    protected:
+
+        //////////////////////////////////////////
+        ShaderNull();
+
+        //////////////////////////////////////////
+        virtual bool init(RenderSystemPtr const& _renderSystem) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        bool init(
+            RenderSystemPtr const& _renderSystem,
+            AssetFilePtr const& _shaderFile);
+
+        //////////////////////////////////////////
+        bool init(
+            RenderSystemPtr const& _renderSystem,
+            String const& _shaderSource,
+            CString _shaderName);
+
+        //////////////////////////////////////////
+        bool init(ShaderNullPtr const& _shader);
+
+        //////////////////////////////////////////
+        virtual ShaderUniformPtr const& createUniformFromShader(HashedCString _uniformName, ShaderUniformType _type = ShaderUniformType::None) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        bool loadNullShader(String const& _vertexShaderSource, String const& _fragmentShaderSource);
+
+    protected:
+        String m_vertexShaderSource;
+        String m_fragmentShaderSource;
+
+        bool m_loaded = false;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeShaderNull_hpp_
+//////////////////////////////////////////
@@ -0,0 +1,113 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeTexture2DMSNull_hpp_))
+#define _MazeTexture2DMSNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeTexture2DMS.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_MANAGED_SHARED_PTR(Texture2DMSNull);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class Texture2DMSNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API Texture2DMSNull
+        : public Texture2DMS
+    {
+    public:
+
+        //////////////////////////////////////////
+        MAZE_DECLARE_METACLASS_WITH_PARENT(Texture2DMSNull, Texture2DMS);
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~Texture2DMSNull();
+
+        //////////////////////////////////////////
+        static Texture2DMSNullPtr Create(RenderSystemNull* _renderSystem);
+
+
+        //////////////////////////////////////////
+        virtual bool isValid() MAZE_OVERRIDE { return m_loaded; }
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+
+        //////////////////////////////////////////
+        virtual bool loadEmpty(
+            Vec2U const& _size,
+            PixelFormat::Enum _internalPixelFormat,
+            S32 _samples) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void copyImageFrom(
+            U8 const* _pixels,
+            PixelFormat::Enum _pixelFormat,
+            U32 _width,
+            U32 _height,
+            U32 _x,
+            U32 _y) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void saveToFileAsTGA(String const& _fileName, Vec2U _size = Vec2U::c_zero) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual PixelSheet2D readAsPixelSheet(PixelFormat::Enum _outputFormat = PixelFormat::None) MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        Texture2DMSNull();
+
+        //////////////////////////////////////////
+        virtual bool init(RenderSystem* _renderSystem) MAZE_OVERRIDE;
+
+    protected:
+        bool m_loaded = false;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeTexture2DMSNull_hpp_
+//////////////////////////////////////////
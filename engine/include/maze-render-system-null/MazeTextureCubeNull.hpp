@@ -0,0 +1,118 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeTextureCubeNull_hpp_))
+#define _MazeTextureCubeNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeTextureCube.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_MANAGED_SHARED_PTR(TextureCubeNull);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class TextureCubeNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API TextureCubeNull
+        : public TextureCube
+    {
+    public:
+
+        //////////////////////////////////////////
+        MAZE_DECLARE_METACLASS_WITH_PARENT(TextureCubeNull, TextureCube);
+
+    public:
+
+        //////////////////////////////////////////
+        virtual ~TextureCubeNull();
+
+        //////////////////////////////////////////
+        static TextureCubeNullPtr Create(RenderSystemNull* _renderSystem);
+
+
+        //////////////////////////////////////////
+        virtual bool isValid() MAZE_OVERRIDE { return m_loaded; }
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+
+        //////////////////////////////////////////
+        virtual bool loadTexture(
+            Vector<PixelSheet2D> const _pixelSheets[6],
+            PixelFormat::Enum _internalPixelFormat = PixelFormat::None) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool setMagFilter(TextureFilter _value) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool setMinFilter(TextureFilter _value) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool setWrapS(TextureWrap _value) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool setWrapT(TextureWrap _value) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool setWrapR(TextureWrap _value) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void generateMipmaps() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void reload() MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        TextureCubeNull();
+
+        //////////////////////////////////////////
+        virtual bool init(RenderSystem* _renderSystem) MAZE_OVERRIDE;
+
+    protected:
+        bool m_loaded = false;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeTextureCubeNull_hpp_
+//////////////////////////////////////////
@@ -0,0 +1,106 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeVertexArrayObjectNull_hpp_))
+#define _MazeVertexArrayObjectNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeVertexArrayObject.hpp"
+#include "maze-graphics/MazeVertex.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(VertexArrayObjectNull);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class VertexArrayObjectNull
+    // Only indices count is kept (draw calls statistics need it)
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API VertexArrayObjectNull
+        : public VertexArrayObject
+    {
+    public:
+
+        //////////////////////////////////////////
+        virtual ~VertexArrayObjectNull();
+
+        //////////////////////////////////////////
+        static VertexArrayObjectNullPtr Create(RenderSystemNull* _renderSystem);
+
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+
+        //////////////////////////////////////////
+        virtual void setIndices(
+            U8 const* _indicesData,
+            VertexAttributeType _indicesType,
+            Size _indicesCount) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void setVerticesData(
+            U8 const* _data,
+            VertexAttributeDescription _description,
+            Size _verticesCount) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual SubMeshPtr readAsSubMesh() const MAZE_OVERRIDE;
+
+#if MAZE_DEBUG
+        //////////////////////////////////////////
+        virtual void debug() MAZE_OVERRIDE;
+#endif
+
+    protected:
+
+        //////////////////////////////////////////
+        VertexArrayObjectNull();
+
+        //////////////////////////////////////////
+        using VertexArrayObject::init;
+
+        //////////////////////////////////////////
+        bool init(RenderSystemNull* _renderSystem);
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeVertexArrayObjectNull_hpp_
+//////////////////////////////////////////
@@ -0,0 +1,104 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeVertexBufferObjectNull_hpp_))
+#define _MazeVertexBufferObjectNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/MazeVertexBufferObject.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(VertexBufferObjectNull);
+    class RenderSystemNull;
+
+
+    //////////////////////////////////////////
+    // Class VertexBufferObjectNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API VertexBufferObjectNull
+        : public VertexBufferObject
+    {
+    public:
+
+        //////////////////////////////////////////
+        virtual ~VertexBufferObjectNull();
+
+        //////////////////////////////////////////
+        static VertexBufferObjectNullPtr Create(
+            RenderSystemNull* _renderSystem,
+            GPUByteBufferAccessType::Enum _accessType,
+            bool _singleMapping = false);
+
+
+        //////////////////////////////////////////
+        RenderSystemNull* getRenderSystemNullRaw() const;
+
+        //////////////////////////////////////////
+        inline Size getSizeBytes() const { return m_sizeBytes; }
+
+
+        //////////////////////////////////////////
+        virtual void resize(Size _bytes) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void upload(
+            void const* _data,
+            Size _bytes) MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        VertexBufferObjectNull();
+
+        //////////////////////////////////////////
+        using VertexBufferObject::init;
+
+        //////////////////////////////////////////
+        bool init(
+            RenderSystemNull* _renderSystem,
+            GPUByteBufferAccessType::Enum _accessType,
+            bool _singleMapping);
+
+    protected:
+        Size m_sizeBytes = 0u;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeVertexBufferObjectNull_hpp_
+//////////////////////////////////////////
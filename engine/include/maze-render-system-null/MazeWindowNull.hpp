@@ -0,0 +1,128 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeWindowNull_hpp_))
+#define _MazeWindowNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-core/system/MazeWindow.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(WindowNull);
+
+
+    //////////////////////////////////////////
+    // Class WindowNull
+    // Offscreen window without any OS window behind it
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API WindowNull
+        : public Window
+    {
+    public:
+
+        //////////////////////////////////////////
+        virtual ~WindowNull();
+
+        //////////////////////////////////////////
+        static WindowNullPtr Create(WindowParamsPtr const& _params = WindowParamsPtr());
+
+
+        //////////////////////////////////////////
+        virtual bool isOpened() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void setClientSize(Vec2U const& _size) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual Vec2U getClientSize() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual Vec2U getFullSize() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void setPosition(Vec2S const& _position) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual Vec2S getPosition() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void close() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool getFocused() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual void setFocused(bool _value) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual DisplayPtr const& getRelatedDisplay() MAZE_OVERRIDE;
+
+    protected:
+
+        //////////////////////////////////////////
+        WindowNull();
+
+        //////////////////////////////////////////
+        virtual bool init(WindowParamsPtr const& _params) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool updateCursor() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool updateTitle() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool updateWindowMode() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool updateMinimized() MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool updateCursorLock() MAZE_OVERRIDE;
+
+    protected:
+        Vec2U m_clientSize = Vec2U::c_zero;
+        Vec2S m_position = Vec2S::c_zero;
+        bool m_opened = false;
+        bool m_focused = true;
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeWindowNull_hpp_
+//////////////////////////////////////////
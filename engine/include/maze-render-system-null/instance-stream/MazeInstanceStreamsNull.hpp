@@ -0,0 +1,132 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeInstanceStreamsNull_hpp_))
+#define _MazeInstanceStreamsNull_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-null/MazeRenderSystemNullHeader.hpp"
+#include "maze-graphics/instance-stream/MazeInstanceStreamModelMatrix.hpp"
+#include "maze-graphics/instance-stream/MazeInstanceStreamColor.hpp"
+#include "maze-graphics/instance-stream/MazeInstanceStreamUV.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(InstanceStreamModelMatrixNull);
+    MAZE_USING_SHARED_PTR(InstanceStreamColorNull);
+    MAZE_USING_SHARED_PTR(InstanceStreamUVNull);
+    class RenderSystemNull;
+    class ShaderNull;
+
+
+    //////////////////////////////////////////
+    // Class InstanceStreamModelMatrixNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API InstanceStreamModelMatrixNull
+        : public InstanceStreamModelMatrix
+    {
+    public:
+
+        //////////////////////////////////////////
+        static InstanceStreamModelMatrixNullPtr Create(RenderSystemNull* _renderSystem);
+
+        //////////////////////////////////////////
+        void prepareForRender(
+            ShaderNull* _shader,
+            S32 _instancesCount);
+
+    protected:
+
+        //////////////////////////////////////////
+        bool init(RenderSystemNull* _renderSystem);
+    };
+
+
+    //////////////////////////////////////////
+    // Class InstanceStreamColorNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API InstanceStreamColorNull
+        : public InstanceStreamColor
+    {
+    public:
+
+        //////////////////////////////////////////
+        static InstanceStreamColorNullPtr Create(RenderSystemNull* _renderSystem);
+
+        //////////////////////////////////////////
+        void prepareForRender(
+            ShaderNull* _shader,
+            S32 _instancesCount);
+
+    protected:
+
+        //////////////////////////////////////////
+        bool init(RenderSystemNull* _renderSystem);
+    };
+
+
+    //////////////////////////////////////////
+    // Class InstanceStreamUVNull
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_NULL_API InstanceStreamUVNull
+        : public InstanceStreamUV
+    {
+    public:
+
+        //////////////////////////////////////////
+        static InstanceStreamUVNullPtr Create(
+            S32 _index,
+            RenderSystemNull* _renderSystem);
+
+        //////////////////////////////////////////
+        void prepareForRender(
+            ShaderNull* _shader,
+            S32 _instancesCount);
+
+    protected:
+
+        //////////////////////////////////////////
+        bool init(
+            S32 _index,
+            RenderSystemNull* _renderSystem);
+    };
+
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeInstanceStreamsNull_hpp_
+//////////////////////////////////////////
@@ -92,6 +92,12 @@ namespace Maze
         //////////////////////////////////////////
         inline bool getSupportFrameBufferBlit() const { return m_supportFrameBufferBlit; }
 
+        //////////////////////////////////////////
+        inline bool getSupportProgramBinary() const { return m_supportProgramBinary; }
+
+        //////////////////////////////////////////
+        inline bool getSupportArbSync() const { return m_supportArbSync; }
+
     public:
 
         //////////////////////////////////////////
@@ -123,6 +129,8 @@ namespace Maze
         bool m_supportClipDistance = false;
         bool m_supportFrameBufferObject = false;
         bool m_supportFrameBufferBlit = false;
+        bool m_supportProgramBinary = false;
+        bool m_supportArbSync = false;
 
         Vector<MZGLint> m_supportedCompressedTextureFormats;
     };
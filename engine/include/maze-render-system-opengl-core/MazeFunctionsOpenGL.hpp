@@ -90,6 +90,9 @@ MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglDrawArraysI
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglVertexAttribDivisor)(MZGLuint _index, MZGLuint _divisor);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void* (MAZE_GL_FUNCPTR *mzglMapBufferRange)(MZGLenum _target, MZGLintptr _offset, MZGLsizeiptr _length, MZGLbitfield _access);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglFlushMappedBufferRange)(MZGLenum _target, MZGLintptr _offset, MZGLsizeiptr _length);
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern MZGLsync (MAZE_GL_FUNCPTR *mzglFenceSync)(MZGLenum _condition, MZGLbitfield _flags);
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern MZGLenum (MAZE_GL_FUNCPTR *mzglClientWaitSync)(MZGLsync _sync, MZGLbitfield _flags, MZGLuint64 _timeout);
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglDeleteSync)(MZGLsync _sync);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglPixelStorei)(MZGLenum _pname, MZGLint _param);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglFramebufferTexture2D)(MZGLenum _target, MZGLenum _attachment, MZGLenum _textarget, MZGLuint _texture, MZGLint _level);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglDeleteFramebuffers)(MZGLsizei _n, const MZGLuint* _framebuffers);
@@ -101,6 +104,9 @@ MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglGetIntegerv
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglGetDoublev)(MZGLenum _pname, MZGLdouble* _params);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglGetBufferParameteriv)(MZGLenum _target, MZGLenum _value, MZGLint* _data);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglGetProgramiv)(MZGLuint _program, MZGLenum _pname, MZGLint* _param);
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglGetProgramBinary)(MZGLuint _program, MZGLsizei _bufSize, MZGLsizei* _length, MZGLenum* _binaryFormat, void* _binary);
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglProgramBinary)(MZGLuint _program, MZGLenum _binaryFormat, const void* _binary, MZGLsizei _length);
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglProgramParameteri)(MZGLuint _program, MZGLenum _pname, MZGLint _value);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern MZGLint (MAZE_GL_FUNCPTR *mzglGetUniformLocation)(MZGLuint _program, const MZGLchar* _name);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern void (MAZE_GL_FUNCPTR *mzglGetActiveUniform)(MZGLuint _program, MZGLuint _index, MZGLsizei _bufSize, MZGLsizei* _length, MZGLint* _size, MZGLenum* _type, MZGLchar* _name);
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API extern MZGLint (MAZE_GL_FUNCPTR *mzglGetAttribLocation)(MZGLuint _program, const MZGLchar* _name);
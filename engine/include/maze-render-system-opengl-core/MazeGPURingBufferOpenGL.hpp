@@ -0,0 +1,143 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeGPURingBufferOpenGL_hpp_))
+#define _MazeGPURingBufferOpenGL_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-opengl-core/MazeRenderSystemOpenGLCoreHeader.hpp"
+#include "maze-render-system-opengl-core/MazeHeaderOpenGL.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(GPURingBufferOpenGL);
+    class ContextOpenGL;
+
+
+    //////////////////////////////////////////
+    // Class GPURingBufferOpenGL
+    // Persistently mapped buffer split into several frame regions.
+    // All the draws of a frame share one region, and the region is protected by the fence
+    // placed after the last draw using it, so the CPU writes without map/unmap calls
+    // and without stalling the driver
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_OPENGL_CORE_API GPURingBufferOpenGL
+    {
+    public:
+
+        //////////////////////////////////////////
+        static U32 const c_regionsCount = 3;
+
+        //////////////////////////////////////////
+        static Size const c_invalidOffset = (Size)~0;
+
+    public:
+
+        //////////////////////////////////////////
+        static GPURingBufferOpenGLPtr Create(
+            ContextOpenGL* _context,
+            Size _regionSizeBytes);
+
+        //////////////////////////////////////////
+        static bool IsSupported(ContextOpenGL* _context);
+
+        //////////////////////////////////////////
+        ~GPURingBufferOpenGL();
+
+
+        //////////////////////////////////////////
+        // Switches to the next region on the first draw of the frame,
+        // waits for the GPU if the region is still in use
+        void beginDraw(U32 _frameIndex);
+
+        //////////////////////////////////////////
+        // Places the fence for the current region
+        void endDraw();
+
+        //////////////////////////////////////////
+        // Returns offset from the buffer start in bytes or c_invalidOffset if the region is full
+        Size allocate(
+            Size _sizeBytes,
+            Size _alignment,
+            U8*& _outPointer);
+
+
+        //////////////////////////////////////////
+        inline MZGLuint getGLBuffer() const { return m_glBuffer; }
+
+        //////////////////////////////////////////
+        inline Size getRegionSizeBytes() const { return m_regionSizeBytes; }
+
+        //////////////////////////////////////////
+        inline U32 getStallsCount() const { return m_stallsCount; }
+
+    protected:
+
+        //////////////////////////////////////////
+        GPURingBufferOpenGL();
+
+        //////////////////////////////////////////
+        bool init(
+            ContextOpenGL* _context,
+            Size _regionSizeBytes);
+
+        //////////////////////////////////////////
+        void waitRegion(U32 _regionIndex);
+
+        //////////////////////////////////////////
+        void deleteGLObjects();
+
+    protected:
+        ContextOpenGL* m_context = nullptr;
+
+        MZGLuint m_glBuffer = 0;
+        U8* m_mappedPointer = nullptr;
+        Size m_regionSizeBytes = 0;
+
+        MZGLsync m_regionFences[c_regionsCount] = { nullptr };
+        U32 m_regionIndex = 0;
+        U32 m_regionFrameIndex = 0;
+        Size m_regionHead = 0;
+        Size m_regionFencedHead = 0;
+        bool m_regionFrameValid = false;
+        bool m_drawStarted = false;
+
+        U32 m_stallsCount = 0;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeGPURingBufferOpenGL_hpp_
+//////////////////////////////////////////
@@ -0,0 +1,146 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeProgramBinaryCacheOpenGL_hpp_))
+#define _MazeProgramBinaryCacheOpenGL_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-opengl-core/MazeRenderSystemOpenGLCoreHeader.hpp"
+#include "maze-render-system-opengl-core/MazeHeaderOpenGL.hpp"
+#include "maze-core/system/MazePath.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(ProgramBinaryCacheOpenGL);
+
+
+    //////////////////////////////////////////
+    // Struct ProgramBinaryCacheKeyOpenGL
+    //
+    //////////////////////////////////////////
+    struct MAZE_RENDER_SYSTEM_OPENGL_CORE_API ProgramBinaryCacheKeyOpenGL
+    {
+        U32 vertexShaderHash = 0;
+        U32 vertexShaderLength = 0;
+        U32 fragmentShaderHash = 0;
+        U32 fragmentShaderLength = 0;
+        U32 driverHash = 0;
+    };
+
+
+    //////////////////////////////////////////
+    // Class ProgramBinaryCacheOpenGL
+    // On-disk cache of linked program binaries.
+    // Programs are keyed by the final (preprocessed, with all the defines) sources
+    // and by the driver vendor/renderer/version strings
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_OPENGL_CORE_API ProgramBinaryCacheOpenGL
+    {
+    public:
+
+        //////////////////////////////////////////
+        static U32 const c_fileVersion = 1;
+
+    public:
+
+        //////////////////////////////////////////
+        ~ProgramBinaryCacheOpenGL();
+
+        //////////////////////////////////////////
+        static ProgramBinaryCacheOpenGLPtr Create(
+            Path const& _directory,
+            String const& _driverId);
+
+
+        //////////////////////////////////////////
+        ProgramBinaryCacheKeyOpenGL buildKey(
+            String const& _vertexShaderSource,
+            String const& _fragmentShaderSource) const;
+
+        //////////////////////////////////////////
+        // Current context should be active.
+        // Returns true if the program is linked from the cached binary.
+        // A binary rejected by the driver invalidates the whole cache
+        bool loadProgramBinary(
+            MZGLuint _programId,
+            ProgramBinaryCacheKeyOpenGL const& _key);
+
+        //////////////////////////////////////////
+        // Program should be linked with MAZE_GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+        bool saveProgramBinary(
+            MZGLuint _programId,
+            ProgramBinaryCacheKeyOpenGL const& _key);
+
+        //////////////////////////////////////////
+        void invalidate();
+
+
+        //////////////////////////////////////////
+        inline Path const& getDirectory() const { return m_directory; }
+
+        //////////////////////////////////////////
+        inline U32 getDriverHash() const { return m_driverHash; }
+
+        //////////////////////////////////////////
+        inline S32 getHitsCount() const { return m_hitsCount; }
+
+        //////////////////////////////////////////
+        inline S32 getMissesCount() const { return m_missesCount; }
+
+    protected:
+
+        //////////////////////////////////////////
+        ProgramBinaryCacheOpenGL();
+
+        //////////////////////////////////////////
+        bool init(
+            Path const& _directory,
+            String const& _driverId);
+
+        //////////////////////////////////////////
+        Path buildFilePath(ProgramBinaryCacheKeyOpenGL const& _key) const;
+
+    protected:
+        Path m_directory;
+        U32 m_driverHash = 0;
+
+        S32 m_hitsCount = 0;
+        S32 m_missesCount = 0;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeProgramBinaryCacheOpenGL_hpp_
+//////////////////////////////////////////
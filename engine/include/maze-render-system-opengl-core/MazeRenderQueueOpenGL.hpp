@@ -48,6 +48,7 @@ namespace Maze
     //////////////////////////////////////////
     MAZE_USING_SHARED_PTR(RenderQueueOpenGL);
     MAZE_USING_SHARED_PTR(ContextOpenGL);
+    MAZE_USING_SHARED_PTR(GPURingBufferOpenGL);
     
 
     //////////////////////////////////////////
@@ -115,6 +116,8 @@ namespace Maze
         Stack<Rect2S> m_scissorRects;
 
         Vec4F m_clipPlanes[MAZE_GL_MAX_CLIP_DISTANCES_COUNT] = { Vec4F::c_zero };
+
+        GPURingBufferOpenGLPtr m_instanceRingBuffer;
     };
 
 } // namespace Maze
@@ -32,6 +32,7 @@
 //////////////////////////////////////////
 #include "maze-render-system-opengl-core/MazeRenderSystemOpenGLCoreHeader.hpp"
 #include "maze-graphics/MazeRenderSystem.hpp"
+#include "maze-core/system/MazePath.hpp"
 
 
 //////////////////////////////////////////
@@ -61,6 +62,12 @@ namespace Maze
         OpenGLMultiContextPolicy multiContextPolicy;
         bool useNullContexts;
         bool useDummyContext;
+
+        // Linked program binaries are stored on disk and reused on the next launch
+        bool programBinaryCacheEnabled = true;
+
+        // Empty path means "<default temporary directory>/gl-program-cache"
+        Path programBinaryCacheDirectory;
     };
 
 
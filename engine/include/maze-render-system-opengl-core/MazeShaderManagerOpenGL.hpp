@@ -32,6 +32,7 @@
 //////////////////////////////////////////
 #include "maze-render-system-opengl-core/MazeRenderSystemOpenGLCoreHeader.hpp"
 #include "maze-graphics/MazeShaderManager.hpp"
+#include "maze-render-system-opengl-core/MazeProgramBinaryCacheOpenGL.hpp"
 
 
 //////////////////////////////////////////
@@ -68,6 +69,10 @@ namespace Maze
         //////////////////////////////////////////
         inline MZGLint getGLSLVersion() const { return m_glslVersion; }
 
+        //////////////////////////////////////////
+        // Null if the cache is disabled in the render system config
+        inline ProgramBinaryCacheOpenGLPtr const& getProgramBinaryCache() const { return m_programBinaryCache; }
+
         //////////////////////////////////////////
         virtual ShaderPtr const& createBuiltinShader(BuiltinShaderType _shaderType) MAZE_OVERRIDE;
 
@@ -90,10 +95,15 @@ namespace Maze
 
         //////////////////////////////////////////
         void notifyGLContextSetup(ContextOpenGL* _contextOpenGL);
+
+        //////////////////////////////////////////
+        void createProgramBinaryCache();
     
     protected:
         MZGLint m_glslVersion;
 
+        ProgramBinaryCacheOpenGLPtr m_programBinaryCache;
+
         ContextOpenGLPtr m_contextOpenGL;
     };
 
@@ -175,6 +175,11 @@ namespace Maze
         //////////////////////////////////////////
         bool loadGLShader(String const& _vertexShaderSource, String const& _fragmentShaderSource);
 
+        //////////////////////////////////////////
+        bool compileAndLinkGLProgram(
+            String const& _completeVertexShader,
+            String const& _completeFragmentShader);
+
         //////////////////////////////////////////
         bool unloadGLShader();
 
@@ -167,6 +167,23 @@ namespace Maze
             U32 _x,
             U32 _y) MAZE_OVERRIDE;
 
+        //////////////////////////////////////////
+        // _pixels is an offset if MAZE_GL_PIXEL_UNPACK_BUFFER is bound
+        virtual void uploadImageRegion(
+            U8 const* _pixels,
+            PixelFormat::Enum _pixelFormat,
+            U32 _width,
+            U32 _height,
+            U32 _x,
+            U32 _y) MAZE_OVERRIDE;
+
+        //////////////////////////////////////////
+        virtual bool blitImageRegionsFrom(
+            Texture2D* _texture,
+            Rect2S const* _srcRects,
+            Rect2S const* _dstRects,
+            S32 _count) MAZE_OVERRIDE;
+
         //////////////////////////////////////////
         virtual void generateMipmaps() MAZE_OVERRIDE;
 
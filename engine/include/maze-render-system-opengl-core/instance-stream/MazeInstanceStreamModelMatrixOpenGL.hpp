@@ -71,7 +71,7 @@ namespace Maze
         void bindRenderPass();
 
         //////////////////////////////////////////
-        void processDrawBegin();
+        void processDrawBegin(GPURingBufferOpenGL* _ringBuffer = nullptr);
 
         //////////////////////////////////////////
         inline GPUTextureBufferPtr const& getModelMatriciesTextureBuffer() const { return m_bufferInfo.buffer; }
@@ -33,6 +33,7 @@
 #include "maze-render-system-opengl-core/MazeRenderSystemOpenGLCoreHeader.hpp"
 #include "maze-render-system-opengl-core/MazeHeaderOpenGL.hpp"
 #include "maze-graphics/MazeRenderQueue.hpp"
+#include "maze-graphics/MazeGPUTextureBuffer.hpp"
 
 
 //////////////////////////////////////////
@@ -42,6 +43,23 @@ namespace Maze
     MAZE_DECLARE_ENUMCLASS_2_API(MAZE_RENDER_SYSTEM_OPENGL_CORE_API, InstanceStreamModeOpenGL,
         UniformArray,
         UniformTexture);
+
+
+    //////////////////////////////////////////
+    class ContextOpenGL;
+    class GPURingBufferOpenGL;
+
+
+    //////////////////////////////////////////
+    // Copies _elementsCount texels into the texture of _textureBuffer
+    // through the persistently mapped ring buffer (no map/unmap calls).
+    // Returns false if the ring buffer is full - the caller should use the regular mapping
+    MAZE_RENDER_SYSTEM_OPENGL_CORE_API bool UploadInstanceStreamTextureOpenGL(
+        ContextOpenGL* _context,
+        GPURingBufferOpenGL* _ringBuffer,
+        GPUTextureBufferPtr const& _textureBuffer,
+        void const* _data,
+        Size _elementsCount);
     
 
 } // namespace Maze
@@ -0,0 +1,137 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazePipelineCacheVulkan_hpp_))
+#define _MazePipelineCacheVulkan_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-vulkan/MazeRenderSystemVulkanHeader.hpp"
+#include "maze-core/system/MazePath.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(PipelineCacheVulkan);
+
+
+    //////////////////////////////////////////
+    // Class PipelineCacheVulkan
+    // VkPipelineCache persisted on disk between launches.
+    // The stored data is accepted only if the Vulkan header matches
+    // the current physical device (vendorID, deviceID, pipelineCacheUUID),
+    // otherwise the cache starts empty and the file is overwritten on save
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_VULKAN_API PipelineCacheVulkan
+    {
+    public:
+
+        //////////////////////////////////////////
+        static U32 const c_fileVersion = 1;
+
+    public:
+
+        //////////////////////////////////////////
+        ~PipelineCacheVulkan();
+
+        //////////////////////////////////////////
+        // Empty _filePath means in-memory cache only
+        static PipelineCacheVulkanPtr Create(
+            VkDevice _device,
+            VkPhysicalDeviceProperties const& _physicalDeviceProperties,
+            Path const& _filePath);
+
+
+        //////////////////////////////////////////
+        inline VkPipelineCache getPipelineCache() const { return m_pipelineCache; }
+
+        //////////////////////////////////////////
+        inline Path const& getFilePath() const { return m_filePath; }
+
+
+        //////////////////////////////////////////
+        // Should be called for every pipeline created with this cache and
+        // VkPipelineCreationFeedbackCreateInfo attached
+        void notifyPipelineCreated(VkPipelineCreationFeedback const& _feedback);
+
+        //////////////////////////////////////////
+        // Writes the cache data to disk if new pipelines were compiled since the last save
+        bool save();
+
+        //////////////////////////////////////////
+        inline bool isDirty() const { return m_dirty; }
+
+
+        //////////////////////////////////////////
+        inline S32 getHitsCount() const { return m_hitsCount; }
+
+        //////////////////////////////////////////
+        inline S32 getMissesCount() const { return m_missesCount; }
+
+        //////////////////////////////////////////
+        inline Size getLoadedDataSize() const { return m_loadedDataSize; }
+
+    protected:
+
+        //////////////////////////////////////////
+        PipelineCacheVulkan();
+
+        //////////////////////////////////////////
+        bool init(
+            VkDevice _device,
+            VkPhysicalDeviceProperties const& _physicalDeviceProperties,
+            Path const& _filePath);
+
+        //////////////////////////////////////////
+        bool loadInitialData(Vector<U8>& _outData) const;
+
+        //////////////////////////////////////////
+        bool isVulkanHeaderValid(U8 const* _data, Size _size) const;
+
+    protected:
+        VkDevice m_device = VK_NULL_HANDLE;
+        VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+        VkPhysicalDeviceProperties m_physicalDeviceProperties;
+        Path m_filePath;
+
+        bool m_dirty = false;
+        Size m_loadedDataSize = 0;
+
+        S32 m_hitsCount = 0;
+        S32 m_missesCount = 0;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazePipelineCacheVulkan_hpp_
+//////////////////////////////////////////
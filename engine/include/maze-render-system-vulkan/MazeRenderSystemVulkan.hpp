@@ -33,6 +33,8 @@
 #include "maze-render-system-vulkan/MazeRenderSystemVulkanHeader.hpp"
 #include "maze-render-system-vulkan/MazeRenderSystemVulkanConfig.hpp"
 #include "maze-render-system-vulkan/MazeStateMachineVulkan.hpp"
+#include "maze-render-system-vulkan/MazePipelineCacheVulkan.hpp"
+#include "maze-render-system-vulkan/MazeUploadManagerVulkan.hpp"
 #include "maze-graphics/MazeRenderSystem.hpp"
 #include "maze-core/math/MazeMath.hpp"
 
@@ -142,7 +144,13 @@ namespace Maze
         inline VmaAllocator getAllocator() const { return m_allocator; }
 
         //////////////////////////////////////////
-        inline VkPipelineCache getPipelineCache() const { return m_pipelineCache; }
+        inline VkPipelineCache getPipelineCache() const { return m_pipelineCache ? m_pipelineCache->getPipelineCache() : VK_NULL_HANDLE; }
+
+        //////////////////////////////////////////
+        inline PipelineCacheVulkanPtr const& getPipelineCacheVulkan() const { return m_pipelineCache; }
+
+        //////////////////////////////////////////
+        inline UploadManagerVulkanPtr const& getUploadManager() const { return m_uploadManager; }
 
         //////////////////////////////////////////
         inline VkDescriptorPool getDescriptorPool() const { return m_descriptorPool; }
@@ -439,9 +447,10 @@ namespace Maze
 
 
         //////////////////////////////////////////
-        // Synchronous one-off command buffer, used by texture/buffer classes
-        // to record + submit + wait a staging-buffer upload or layout
-        // transition outside of the per-frame command buffer.
+        // Synchronous one-off command buffer, used for layout transitions and
+        // readbacks outside of the per-frame command buffer. Staging uploads
+        // go through getUploadManager() instead, which does not block.
+        // Pending upload batches are submitted before these commands.
         VkCommandBuffer beginSingleTimeCommands();
 
         //////////////////////////////////////////
@@ -496,6 +505,9 @@ namespace Maze
         //////////////////////////////////////////
         bool createInstanceStreamBuffers();
 
+        //////////////////////////////////////////
+        bool createPipelineCache();
+
     protected:
         RenderSystemVulkanConfig m_config;
 
@@ -512,7 +524,9 @@ namespace Maze
 
         VmaAllocator m_allocator = VK_NULL_HANDLE;
 
-        VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+        PipelineCacheVulkanPtr m_pipelineCache;
+        UploadManagerVulkanPtr m_uploadManager;
+        U64 m_pipelineCacheSaveFrame = 0u;
         VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
 
         UniquePtr<StateMachineVulkan> m_stateMachine;
@@ -32,6 +32,7 @@
 //////////////////////////////////////////
 #include "maze-render-system-vulkan/MazeRenderSystemVulkanHeader.hpp"
 #include "maze-core/MazeBaseTypes.hpp"
+#include "maze-core/system/MazePath.hpp"
 
 
 //////////////////////////////////////////
@@ -51,6 +52,18 @@ namespace Maze
 
         // Number of frames that may be in flight concurrently (double/triple buffering)
         U32 framesInFlight = 2u;
+
+        // Pipeline cache data is stored on disk and reused on the next launch
+        bool pipelineCacheEnabled = true;
+
+        // Empty path means "<default temporary directory>/vk-pipeline-cache"
+        Path pipelineCacheDirectory;
+
+        // Frames between the saves of a pipeline cache with new pipelines (0 - save on shutdown only)
+        U32 pipelineCacheSaveFramesInterval = 1800u;
+
+        // Size of the persistently mapped staging ring buffer used by the asynchronous uploads
+        U32 uploadStagingBufferSize = 32u * 1024u * 1024u;
     };
 
 
@@ -203,6 +203,11 @@ namespace Maze
         //////////////////////////////////////////
         inline Vec2U const& getRenderTargetSize() const { return m_renderTargetSize; }
 
+        //////////////////////////////////////////
+        // Current scissor rect in the top-down framebuffer space,
+        // the whole render target if the scissor test is disabled
+        VkRect2D calculateScissorRect() const;
+
         //////////////////////////////////////////
         inline bool isRenderingActive() const { return m_renderingActive; }
 
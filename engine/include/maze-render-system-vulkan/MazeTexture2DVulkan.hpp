@@ -126,6 +126,10 @@ namespace Maze
         // resource to _newLayout, and updates getCurrentLayout()
         void transitionTo(VkCommandBuffer _commandBuffer, VkImageLayout _newLayout);
 
+        //////////////////////////////////////////
+        // False while the last staging upload is still being copied by the GPU
+        bool isUploadCompleted() const;
+
 
         //////////////////////////////////////////
         virtual bool setMagFilter(TextureFilter _value) MAZE_OVERRIDE;
@@ -209,6 +213,8 @@ namespace Maze
         U32 m_mipLevels = 1u;
         bool m_hasMipmapsGenerationSupport = false;
         bool m_isRenderTarget = false;
+
+        U64 m_uploadTicket = 0u;
     };
 
 
@@ -78,6 +78,10 @@ namespace Maze
         //////////////////////////////////////////
         VkSampler ensureSampler();
 
+        //////////////////////////////////////////
+        // False while the last staging upload is still being copied by the GPU
+        bool isUploadCompleted() const;
+
 
         //////////////////////////////////////////
         virtual bool loadTexture(
@@ -125,6 +129,8 @@ namespace Maze
 
         U32 m_mipLevels = 1u;
         bool m_hasMipmapsGenerationSupport = false;
+
+        U64 m_uploadTicket = 0u;
     };
 
 
@@ -0,0 +1,206 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#pragma once
+#if (!defined(_MazeUploadManagerVulkan_hpp_))
+#define _MazeUploadManagerVulkan_hpp_
+
+
+//////////////////////////////////////////
+#include "maze-render-system-vulkan/MazeRenderSystemVulkanHeader.hpp"
+#include "maze-core/MazeTypes.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    MAZE_USING_SHARED_PTR(UploadManagerVulkan);
+    class RenderSystemVulkan;
+
+
+    //////////////////////////////////////////
+    // Struct UploadStagingVulkan
+    // Staging memory for a single copy, valid until the batch it belongs to is submitted
+    //
+    //////////////////////////////////////////
+    struct MAZE_RENDER_SYSTEM_VULKAN_API UploadStagingVulkan
+    {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0u;
+        U8* mappedData = nullptr;
+    };
+
+
+    //////////////////////////////////////////
+    // Class UploadManagerVulkan
+    // Asynchronous staging uploads.
+    // Copies are recorded into a batch command buffer and the data goes through
+    // a persistently mapped staging ring buffer. Batches are submitted to the graphics
+    // queue before the frame (or any synchronous single-time commands), so the
+    // submission order guarantees that the data is uploaded before it is used,
+    // and completion is tracked by a fence per batch - the CPU never waits for
+    // the copy unless the ring buffer is exhausted.
+    // Every upload returns a ticket, which is completed when its batch fence is signaled
+    //
+    //////////////////////////////////////////
+    class MAZE_RENDER_SYSTEM_VULKAN_API UploadManagerVulkan
+    {
+    public:
+
+        //////////////////////////////////////////
+        // Multiple of every texel block size uploaded by this backend (1, 2, 4, 8, 12 and 16 bytes)
+        static VkDeviceSize const c_stagingAlignment = 48u;
+
+        //////////////////////////////////////////
+        static U64 const c_completedTicket = 0u;
+
+    protected:
+
+        //////////////////////////////////////////
+        struct UploadBatch
+        {
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            VkFence fence = VK_NULL_HANDLE;
+            U64 ticket = 0u;
+            VkDeviceSize ringBytes = 0u;
+            Vector<VkBuffer> dedicatedBuffers;
+            Vector<VmaAllocation> dedicatedAllocations;
+        };
+
+    public:
+
+        //////////////////////////////////////////
+        ~UploadManagerVulkan();
+
+        //////////////////////////////////////////
+        static UploadManagerVulkanPtr Create(
+            RenderSystemVulkan* _renderSystem,
+            VkDeviceSize _stagingBufferSize);
+
+
+        //////////////////////////////////////////
+        // Reserves staging memory inside the current batch.
+        // Data should be written into mappedData before the next flush
+        UploadStagingVulkan allocateStaging(
+            VkDeviceSize _size,
+            VkDeviceSize _alignment = c_stagingAlignment);
+
+        //////////////////////////////////////////
+        // Command buffer of the current batch - copies from the staging memory
+        // and the layout transitions of the destination resources are recorded here
+        VkCommandBuffer getCommandBuffer();
+
+        //////////////////////////////////////////
+        // Ticket of the current batch. Should be called after the copies are recorded
+        U64 finishUpload();
+
+        //////////////////////////////////////////
+        // Helper for the plain buffer uploads
+        U64 uploadBuffer(
+            VkBuffer _dstBuffer,
+            VkDeviceSize _dstOffset,
+            void const* _data,
+            VkDeviceSize _size);
+
+
+        //////////////////////////////////////////
+        // Submits the current batch
+        void flush();
+
+        //////////////////////////////////////////
+        // Releases the staging memory of completed batches
+        void update();
+
+        //////////////////////////////////////////
+        // Submits the current batch and waits for every batch to complete
+        void waitIdle();
+
+        //////////////////////////////////////////
+        bool isCompleted(U64 _ticket) const;
+
+        //////////////////////////////////////////
+        inline bool hasPendingCommands() const { return m_currentBatch.commandBuffer != VK_NULL_HANDLE; }
+
+
+        //////////////////////////////////////////
+        inline VkDeviceSize getStagingBufferSize() const { return m_ringSize; }
+
+        //////////////////////////////////////////
+        inline VkDeviceSize getStagingBytesUsed() const { return m_ringUsed; }
+
+    protected:
+
+        //////////////////////////////////////////
+        UploadManagerVulkan();
+
+        //////////////////////////////////////////
+        bool init(
+            RenderSystemVulkan* _renderSystem,
+            VkDeviceSize _stagingBufferSize);
+
+        //////////////////////////////////////////
+        void beginBatch();
+
+        //////////////////////////////////////////
+        void releaseBatch(UploadBatch& _batch);
+
+        //////////////////////////////////////////
+        // Waits for the oldest submitted batch
+        bool waitOldestBatch();
+
+        //////////////////////////////////////////
+        UploadStagingVulkan allocateDedicatedStaging(VkDeviceSize _size);
+
+    protected:
+        RenderSystemVulkan* m_renderSystem = nullptr;
+        VkDevice m_device = VK_NULL_HANDLE;
+        VmaAllocator m_allocator = VK_NULL_HANDLE;
+        VkQueue m_queue = VK_NULL_HANDLE;
+        VkCommandPool m_commandPool = VK_NULL_HANDLE;
+
+        VkBuffer m_ringBuffer = VK_NULL_HANDLE;
+        VmaAllocation m_ringAllocation = VK_NULL_HANDLE;
+        U8* m_ringMappedData = nullptr;
+        VkDeviceSize m_ringSize = 0u;
+        VkDeviceSize m_ringHead = 0u;
+        VkDeviceSize m_ringUsed = 0u;
+
+        UploadBatch m_currentBatch;
+        Deque<UploadBatch> m_submittedBatches;
+        Vector<UploadBatch> m_freeBatches;
+
+        U64 m_nextTicket = 1u;
+        U64 m_completedTicket = 0u;
+    };
+
+} // namespace Maze
+//////////////////////////////////////////
+
+
+#endif // _MazeUploadManagerVulkan_hpp_
+//////////////////////////////////////////
@@ -56,8 +56,8 @@ namespace Maze
     //    memcpy's into directly, no command buffer involved.
     //  - Static/single-mapping data (GPUByteBufferAccessType::Immutable/Default, or
     //    _singleMapping == true, i.e. data uploaded once and never touched again) - a
-    //    device-local VMA allocation, written via a one-off staging buffer + copy
-    //    (RenderSystemVulkan::beginSingleTimeCommands/endSingleTimeCommands), trading
+    //    device-local VMA allocation, written via the staging ring buffer + an
+    //    asynchronous copy (RenderSystemVulkan::getUploadManager()), trading
     //    upload-time cost for the fastest possible GPU read access.
     //////////////////////////////////////////
     class MAZE_RENDER_SYSTEM_VULKAN_API VertexBufferObjectVulkan
@@ -87,6 +87,10 @@ namespace Maze
         //////////////////////////////////////////
         inline bool isHostVisible() const { return m_hostVisible; }
 
+        //////////////////////////////////////////
+        // False while the last staging upload is still being copied by the GPU
+        bool isUploadCompleted() const;
+
 
         //////////////////////////////////////////
         virtual void resize(Size _bytes) MAZE_OVERRIDE;
@@ -126,6 +130,8 @@ namespace Maze
 
         bool m_singleMapping = false;
         bool m_hostVisible = false;
+
+        U64 m_uploadTicket = 0u;
     };
 
 
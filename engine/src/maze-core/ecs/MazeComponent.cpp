@@ -28,6 +28,8 @@
 #include "maze-core/ecs/MazeComponent.hpp"
 #include "maze-core/ecs/MazeEntity.hpp"
 #include "maze-core/managers/MazeEntityManager.hpp"
+#include "maze-core/system/MazeMutex.hpp"
+#include <atomic>
 
 
 //////////////////////////////////////////
@@ -80,68 +82,128 @@ namespace Maze
         MAZE_DEBUG_BP_IF(getMetaClass() != _component->getMetaClass())
         MetaInstance metaInstance = getMetaInstance();
         MetaInstance objMetaInstance = _component->getMetaInstance();
-        
-        Vector<MetaClass*> const& componentSuperMetaClasses = _component->getMetaClass()->getAllSuperMetaClasses();
-        for (MetaClass* metaClass : componentSuperMetaClasses)
+
+        ComponentCopyPlan const& copyPlan = GetCopyPlan(_component);
+        for (ComponentCopyPlan::Property const& property : copyPlan.properties)
         {
-            for (S32 i = 0; i < metaClass->getPropertiesCount(); ++i)
+            switch (property.type)
             {
-                MetaProperty* metaProperty = metaClass->getProperty(i);
-
-                if (!isMetaPropertyCopyable(metaProperty))
-                    continue;
-
-                if (ClassInfo<Vector<ComponentPtr>>::UID() == metaProperty->getValueClassUID())
+                case ComponentCopyPropertyType::ComponentReference:
                 {
                     _copyData.getComponentProperties().emplace_back(
                         EntityCopyData::ComponentPropertyData
                         {
-                            metaProperty,
+                            property.metaProperty,
                             metaInstance,
                             objMetaInstance
                         });
+                    break;
                 }
-                else
-                if (ClassInfo<Vector<EntityPtr>>::UID() == metaProperty->getValueClassUID())
+                case ComponentCopyPropertyType::EntityReference:
                 {
                     _copyData.getEntityProperties().emplace_back(
                         EntityCopyData::EntityPropertyData
                         {
-                            metaProperty,
+                            property.metaProperty,
                             metaInstance,
                             objMetaInstance
                         });
+                    break;
                 }
-                else
-                if (ClassInfo<ComponentPtr>::UID() == metaProperty->getValueClassUID())
+                default:
                 {
-                    _copyData.getComponentProperties().emplace_back(
-                        EntityCopyData::ComponentPropertyData
-                        {
-                            metaProperty,
-                            metaInstance,
-                            objMetaInstance
-                        });
+                    property.metaProperty->copy(metaInstance, objMetaInstance);
+                    break;
                 }
+            }
+        }
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    using ComponentCopyPlans = UnorderedMap<MetaClass*, ComponentCopyPlan const*>;
+
+    //////////////////////////////////////////
+    static UniquePtr<ComponentCopyPlan> BuildComponentCopyPlan(Component* _component)
+    {
+        MetaClass* componentMetaClass = _component->getMetaClass();
+
+        UniquePtr<ComponentCopyPlan> copyPlan = MakeUnique<ComponentCopyPlan>();
+
+        ClassUID const componentUID = ClassInfo<ComponentPtr>::UID();
+        ClassUID const componentsUID = ClassInfo<Vector<ComponentPtr>>::UID();
+        ClassUID const entityUID = ClassInfo<EntityPtr>::UID();
+        ClassUID const entitiesUID = ClassInfo<Vector<EntityPtr>>::UID();
+
+        for (MetaClass* metaClass : componentMetaClass->getAllSuperMetaClasses())
+        {
+            for (S32 i = 0; i < metaClass->getPropertiesCount(); ++i)
+            {
+                MetaProperty* metaProperty = metaClass->getProperty(i);
+
+                if (!_component->isMetaPropertyCopyable(metaProperty))
+                    continue;
+
+                ClassUID valueUID = metaProperty->getValueClassUID();
+
+                ComponentCopyPlan::Property property;
+                property.metaProperty = metaProperty;
+                if (valueUID == componentUID || valueUID == componentsUID)
+                    property.type = ComponentCopyPropertyType::ComponentReference;
                 else
-                if (ClassInfo<EntityPtr>::UID() == metaProperty->getValueClassUID())
-                {
-                    _copyData.getEntityProperties().emplace_back(
-                        EntityCopyData::EntityPropertyData
-                        {
-                            metaProperty,
-                            metaInstance,
-                            objMetaInstance
-                        });
-                }
+                if (valueUID == entityUID || valueUID == entitiesUID)
+                    property.type = ComponentCopyPropertyType::EntityReference;
                 else
-                {
-                    metaProperty->copy(metaInstance, objMetaInstance);
-                }
+                    property.type = ComponentCopyPropertyType::Value;
+
+                copyPlan->properties.push_back(property);
             }
         }
 
-        return true;
+        return copyPlan;
+    }
+
+    //////////////////////////////////////////
+    ComponentCopyPlan const& Component::GetCopyPlan(Component* _component)
+    {
+        // Read-mostly map - the lookup reads an immutable snapshot without any locks,
+        // only an unknown class takes the mutex and publishes a new snapshot.
+        // Replaced snapshots are kept alive, other threads may still read them
+        static std::atomic<ComponentCopyPlans const*> s_copyPlans{ nullptr };
+        static Mutex s_mutex;
+        static Vector<UniquePtr<ComponentCopyPlans>> s_copyPlansSnapshots;
+        static Vector<UniquePtr<ComponentCopyPlan>> s_copyPlansStorage;
+
+        MetaClass* componentMetaClass = _component->getMetaClass();
+
+        ComponentCopyPlans const* copyPlans = s_copyPlans.load(std::memory_order_acquire);
+        if (copyPlans)
+        {
+            auto it = copyPlans->find(componentMetaClass);
+            if (it != copyPlans->end())
+                return *it->second;
+        }
+
+        MAZE_MUTEX_SCOPED_LOCK(s_mutex);
+
+        copyPlans = s_copyPlans.load(std::memory_order_acquire);
+        if (copyPlans)
+        {
+            auto it = copyPlans->find(componentMetaClass);
+            if (it != copyPlans->end())
+                return *it->second;
+        }
+
+        s_copyPlansStorage.emplace_back(BuildComponentCopyPlan(_component));
+
+        UniquePtr<ComponentCopyPlans> newCopyPlans = copyPlans ? MakeUnique<ComponentCopyPlans>(*copyPlans)
+                                                               : MakeUnique<ComponentCopyPlans>();
+        newCopyPlans->emplace(componentMetaClass, s_copyPlansStorage.back().get());
+        s_copyPlans.store(newCopyPlans.get(), std::memory_order_release);
+        s_copyPlansSnapshots.emplace_back(eastl::move(newCopyPlans));
+
+        return *s_copyPlansStorage.back();
     }
 
     //////////////////////////////////////////
@@ -30,11 +30,87 @@
 #include "maze-core/ecs/MazeEcsWorld.hpp"
 #include "maze-core/ecs/MazeEntitiesSample.hpp"
 #include "maze-core/managers/MazeEntityManager.hpp"
+#include <EASTL/algorithm.h>
 
 
 //////////////////////////////////////////
 namespace Maze
 {
+    //////////////////////////////////////////
+    inline bool HasSortedIntersection(
+        Vector<ComponentId> const& _a,
+        Vector<ComponentId> const& _b)
+    {
+        auto itA = _a.begin();
+        auto itB = _b.begin();
+        while (itA != _a.end() && itB != _b.end())
+        {
+            if (*itA < *itB)
+                ++itA;
+            else
+            if (*itB < *itA)
+                ++itB;
+            else
+                return true;
+        }
+
+        return false;
+    }
+
+
+    //////////////////////////////////////////
+    // Class ComponentSystemEventHandler
+    //
+    //////////////////////////////////////////
+    void ComponentSystemEventHandler::setComponentAccess(
+        Vector<ComponentId> const& _readComponentIds,
+        Vector<ComponentId> const& _writeComponentIds)
+    {
+        m_componentAccessDeclared = true;
+
+        m_writeComponentIds = _writeComponentIds;
+        eastl::sort(m_writeComponentIds.begin(), m_writeComponentIds.end());
+
+        m_readComponentIds = _readComponentIds;
+        if (m_sample)
+        {
+            for (ComponentId componentId : m_sample->getAspect().getRequiredComponentIds())
+                m_readComponentIds.push_back(componentId);
+        }
+        eastl::sort(m_readComponentIds.begin(), m_readComponentIds.end());
+        m_readComponentIds.erase(
+            eastl::unique(m_readComponentIds.begin(), m_readComponentIds.end()),
+            m_readComponentIds.end());
+        m_readComponentIds.erase(
+            eastl::remove_if(
+                m_readComponentIds.begin(),
+                m_readComponentIds.end(),
+                [this](ComponentId _id)
+                {
+                    return eastl::binary_search(m_writeComponentIds.begin(), m_writeComponentIds.end(), _id);
+                }),
+            m_readComponentIds.end());
+
+        if (m_world)
+            m_world->invalidateEventHandlersSchedule();
+    }
+
+    //////////////////////////////////////////
+    bool ComponentSystemEventHandler::isConflicting(ComponentSystemEventHandler const* _other) const
+    {
+        if (!m_componentAccessDeclared || !_other->m_componentAccessDeclared)
+            return true;
+
+        if (m_order.after.count(_other->m_name) || m_order.before.count(_other->m_name) ||
+            _other->m_order.after.count(m_name) || _other->m_order.before.count(m_name))
+            return true;
+
+        return HasSortedIntersection(m_writeComponentIds, _other->m_writeComponentIds) ||
+               HasSortedIntersection(m_writeComponentIds, _other->m_readComponentIds) ||
+               HasSortedIntersection(m_readComponentIds, _other->m_writeComponentIds);
+    }
+
+
     //////////////////////////////////////////
     // Class ComponentSystemEntityAddedToSampleEventHandler
     //
@@ -26,11 +26,74 @@
 //////////////////////////////////////////
 #include "MazeCoreHeader.hpp"
 #include "maze-core/ecs/MazeEcsArchetype.hpp"
+#include "maze-core/system/MazeMutex.hpp"
+#include <EASTL/algorithm.h>
 
 
 //////////////////////////////////////////
 namespace Maze
 {
+    //////////////////////////////////////////
+    // Dense component ids are registered lazily, possibly from the job system workers
+    struct EcsDenseComponentRegistry
+    {
+        Mutex mutex;
+        UnorderedMap<ComponentId, EcsDenseComponentInfo> infos;
+        UnorderedMap<ComponentId, ComponentId> idsByOwner;
+    };
+
+    //////////////////////////////////////////
+    static EcsDenseComponentRegistry& GetEcsDenseComponentRegistry()
+    {
+        static EcsDenseComponentRegistry s_registry;
+        return s_registry;
+    }
+
+    //////////////////////////////////////////
+    MAZE_CORE_API void RegisterEcsDenseComponent(EcsDenseComponentInfo const& _info)
+    {
+        EcsDenseComponentRegistry& registry = GetEcsDenseComponentRegistry();
+        MAZE_MUTEX_SCOPED_LOCK(registry.mutex);
+
+        registry.infos[_info.id] = _info;
+        if (_info.ownerComponentId != c_invalidComponentId)
+            registry.idsByOwner[_info.ownerComponentId] = _info.id;
+    }
+
+    //////////////////////////////////////////
+    MAZE_CORE_API bool GetEcsDenseComponentInfo(ComponentId _id, EcsDenseComponentInfo& _outInfo)
+    {
+        EcsDenseComponentRegistry& registry = GetEcsDenseComponentRegistry();
+        MAZE_MUTEX_SCOPED_LOCK(registry.mutex);
+
+        auto it = registry.infos.find(_id);
+        if (it == registry.infos.end())
+            return false;
+
+        _outInfo = it->second;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    MAZE_CORE_API void CollectEcsOwnedDenseComponentIds(
+        Vector<ComponentId> const& _componentIds,
+        Vector<ComponentId>& _outDenseComponentIds)
+    {
+        EcsDenseComponentRegistry& registry = GetEcsDenseComponentRegistry();
+        MAZE_MUTEX_SCOPED_LOCK(registry.mutex);
+
+        if (registry.idsByOwner.empty())
+            return;
+
+        for (ComponentId componentId : _componentIds)
+        {
+            auto it = registry.idsByOwner.find(componentId);
+            if (it != registry.idsByOwner.end())
+                _outDenseComponentIds.push_back(it->second);
+        }
+    }
+
+
     //////////////////////////////////////////
     // Class EcsArchetype
     //
@@ -44,7 +107,19 @@ namespace Maze
         , m_hash(_hash)
     {
         for (ComponentId componentId : m_componentIds)
+        {
             m_componentsMask |= (S64)1 << U32(componentId % 64);
+
+            EcsDenseComponentInfo denseInfo;
+            if (GetEcsDenseComponentInfo(componentId, denseInfo))
+            {
+                DenseColumn column;
+                column.componentId = componentId;
+                column.stride = denseInfo.size;
+                column.fillFunc = denseInfo.fillFunc;
+                m_denseColumns.emplace_back(eastl::move(column));
+            }
+        }
     }
 
     //////////////////////////////////////////
@@ -56,6 +131,94 @@ namespace Maze
         return EcsArchetypePtr(new EcsArchetype(_id, _sortedComponentIds, _hash));
     }
 
+    //////////////////////////////////////////
+    bool EcsArchetype::hasComponents(Vector<ComponentId> const& _componentIds) const
+    {
+        for (ComponentId componentId : _componentIds)
+            if (!eastl::binary_search(m_componentIds.begin(), m_componentIds.end(), componentId))
+                return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    U8* EcsArchetype::getDenseComponentsData(ComponentId _componentId)
+    {
+        for (DenseColumn& column : m_denseColumns)
+            if (column.componentId == _componentId)
+                return column.data.data();
+
+        return nullptr;
+    }
+
+    //////////////////////////////////////////
+    U8* EcsArchetype::getDenseComponentData(ComponentId _componentId, S32 _index)
+    {
+        for (DenseColumn& column : m_denseColumns)
+            if (column.componentId == _componentId)
+                return &column.data[(Size)_index * column.stride];
+
+        return nullptr;
+    }
+
+    //////////////////////////////////////////
+    void EcsArchetype::pushDenseRow(Entity* _entity)
+    {
+        for (DenseColumn& column : m_denseColumns)
+        {
+            Size offset = column.data.size();
+            column.data.resize(offset + column.stride, 0u);
+
+            if (column.fillFunc)
+                column.fillFunc(_entity, &column.data[offset]);
+        }
+    }
+
+    //////////////////////////////////////////
+    void EcsArchetype::removeDenseRow(S32 _index)
+    {
+        for (DenseColumn& column : m_denseColumns)
+        {
+            Size lastOffset = column.data.size() - column.stride;
+            Size offset = (Size)_index * column.stride;
+            if (offset != lastOffset)
+                memcpy(&column.data[offset], &column.data[lastOffset], column.stride);
+            column.data.resize(lastOffset);
+        }
+    }
+
+    //////////////////////////////////////////
+    void EcsArchetype::copyDenseRow(
+        EcsArchetype* _from,
+        S32 _fromIndex,
+        S32 _toIndex)
+    {
+        // Both column lists are sorted by component id
+        Size i = 0;
+        Size j = 0;
+        while (i < _from->m_denseColumns.size() && j < m_denseColumns.size())
+        {
+            DenseColumn& from = _from->m_denseColumns[i];
+            DenseColumn& to = m_denseColumns[j];
+            if (from.componentId < to.componentId)
+                ++i;
+            else
+            if (to.componentId < from.componentId)
+                ++j;
+            else
+            {
+                // Owned rows are already filled from the current owner component state
+                if (!to.fillFunc)
+                        memcpy(
+                        &to.data[(Size)_toIndex * to.stride],
+                        &from.data[(Size)_fromIndex * from.stride],
+                        to.stride);
+                ++i;
+                ++j;
+            }
+        }
+    }
+
     //////////////////////////////////////////
     U64 EcsArchetype::CalculateHash(Vector<ComponentId> const& _sortedComponentIds)
     {
@@ -36,6 +36,8 @@
 #include "maze-core/services/MazeLogStream.hpp"
 #include "maze-core/managers/MazeEntityManager.hpp"
 #include "maze-core/managers/MazeInputManager.hpp"
+#include "maze-core/managers/MazeTaskManager.hpp"
+#include <EASTL/algorithm.h>
 
 
 //////////////////////////////////////////
@@ -314,6 +316,8 @@ namespace Maze
         m_eventHolders.current() = EcsWorldEventsQueue::Create(this);
         m_eventHolders.other() = EcsWorldEventsQueue::Create(this);
 
+        m_transform3DHierarchy = MakeUnique<Transform3DHierarchy>();
+
         if (_attachSystems)
         {
             ComponentSystemHolder::Attach(this);
@@ -387,6 +391,12 @@ namespace Maze
 
         MAZE_PROFILE_EVENT("EcsWorld::update");
 
+        // Everything allocated from the arena two updates ago is processed by now -
+        // queued events are always drained by the loop below
+        m_eventHolders.current()->checkFrameEventsBeforeArenaSwap(m_frameArena.getFrameIndex());
+        m_eventHolders.other()->checkFrameEventsBeforeArenaSwap(m_frameArena.getFrameIndex());
+        m_frameArena.swap();
+
         {
             MAZE_PROFILE_EVENT("EcsWorld - WorldPreUpdateEvent");
 
@@ -402,24 +412,38 @@ namespace Maze
             m_eventHolders.other()->processEvents();
         }
 
+        // Transforms moved by the queued events and outside of the world update are
+        // recalculated here, so the update stages read the clean world transforms
+        {
+            MAZE_PROFILE_EVENT("EcsWorld - Transform3DHierarchy");
+
+            m_transform3DHierarchy->update();
+        }
 
         {
             MAZE_PROFILE_EVENT("EcsWorld - PreUpdateEvent");
 
             PreUpdateEvent updateEvent(_dt);
-            broadcastEventImmediate<PreUpdateEvent>(updateEvent);
+            broadcastEventParallel(&updateEvent);
         }
         {
             MAZE_PROFILE_EVENT("EcsWorld - UpdateEvent");
 
             UpdateEvent updateEvent(_dt);
-            broadcastEventImmediate<UpdateEvent>(updateEvent);
+            broadcastEventParallel(&updateEvent);
         }
         {
             MAZE_PROFILE_EVENT("EcsWorld - PostUpdateEvent");
 
             PostUpdateEvent updateEvent(_dt);
-            broadcastEventImmediate<PostUpdateEvent>(updateEvent);
+            broadcastEventParallel(&updateEvent);
+        }
+
+        // Transforms moved during the update stages - for the rendering
+        {
+            MAZE_PROFILE_EVENT("EcsWorld - Transform3DHierarchy");
+
+            m_transform3DHierarchy->update();
         }
         
         bool samplesChanged = false;
@@ -460,15 +484,97 @@ namespace Maze
         if (m_state != EcsWorldState::Active)
             return false;
 
+        if (deferParallelPhaseCommand(ParallelPhaseCommandType::AddEntity, c_invalidEntityId, _entity))
+            return true;
+
         return m_eventHolders.current()->addEntity(_entity);
     }
 
     //////////////////////////////////////////
     bool EcsWorld::removeEntity(EntityPtr const& _entity)
     {
+        if (deferParallelPhaseCommand(ParallelPhaseCommandType::RemoveEntity, c_invalidEntityId, _entity))
+            return true;
+
         return m_eventHolders.current()->removeEntity(_entity);
     }
 
+    //////////////////////////////////////////
+    Vector<EntityPtr> EcsWorld::createEntities(
+        S32 _count,
+        EntityPtr const& _prototype)
+    {
+        Vector<EntityPtr> entities;
+        if (m_state != EcsWorldState::Active || _count <= 0)
+            return entities;
+
+        entities.reserve(_count);
+        if (_prototype)
+        {
+            // Every copy adds its hierarchy into the open batch
+            bool batch = beginEntitiesBatch();
+            for (S32 i = 0; i < _count; ++i)
+            {
+                EntityCopyData copyData;
+                copyData.setWorld(this);
+                entities.emplace_back(_prototype->createCopy(copyData));
+            }
+
+            if (batch)
+                endEntitiesBatch();
+        }
+        else
+        {
+            for (S32 i = 0; i < _count; ++i)
+                entities.emplace_back(Entity::Create());
+
+            addEntities(entities);
+        }
+
+        return entities;
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorld::addEntities(EntityPtr const* _entities, Size _count)
+    {
+        if (m_state != EcsWorldState::Active)
+            return false;
+
+        if (deferParallelPhaseEntitiesCommand(ParallelPhaseCommandType::AddEntities, _entities, _count))
+            return true;
+
+        return m_eventHolders.current()->addEntities(_entities, _count);
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorld::beginEntitiesBatch()
+    {
+        if (m_state != EcsWorldState::Active)
+            return false;
+
+        // Entities of the parallel phase are deferred and added one by one
+        if (m_parallelPhaseCounter.load(std::memory_order_acquire) > 0)
+            return false;
+
+        m_eventHolders.current()->beginAddingEntities();
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::endEntitiesBatch()
+    {
+        m_eventHolders.current()->endAddingEntities();
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorld::removeEntities(EntityPtr const* _entities, Size _count)
+    {
+        if (deferParallelPhaseEntitiesCommand(ParallelPhaseCommandType::RemoveEntities, _entities, _count))
+            return true;
+
+        return m_eventHolders.current()->removeEntities(_entities, _count);
+    }
+
     //////////////////////////////////////////
     void EcsWorld::processEntityAddedToSample(
         ComponentSystemEventHandlerPtr const& _handler,
@@ -488,12 +594,18 @@ namespace Maze
     //////////////////////////////////////////
     void EcsWorld::processEntityComponentsChanged(EntityId _id)
     {
+        if (deferParallelPhaseCommand(ParallelPhaseCommandType::EntityComponentsChanged, _id))
+            return;
+
         m_eventHolders.current()->processEntityComponentsChanged(_id);
     }
 
     //////////////////////////////////////////
     void EcsWorld::processEntityActiveChanged(EntityId _id)
     {
+        if (deferParallelPhaseCommand(ParallelPhaseCommandType::EntityActiveChanged, _id))
+            return;
+
         m_eventHolders.current()->processEntityActiveChanged(_id);
     }
 
@@ -526,6 +638,8 @@ namespace Maze
         if (!AddSystemEventHandler(eventHandlers, _system, true))
             return false;
 
+        ++m_eventHandlersVersion;
+
         if (eventUID == ClassInfo<EntityAddedToSampleEvent>::UID())
         {
             m_entityAddedToSampleEventHandlers.push_back(
@@ -557,6 +671,7 @@ namespace Maze
                 if (eventHandlers[i] == _system)
                 {
                     eventHandlers.erase(eventHandlers.begin() + i);
+                    ++m_eventHandlersVersion;
                     break;
                 }
             }
@@ -624,10 +739,12 @@ namespace Maze
 
         if (newArchetype != oldArchetype)
         {
+            if (oldArchetype && newArchetype)
+                transferEntityToArchetype(newArchetype, _entity);
+            else
             if (oldArchetype)
                 removeEntityFromArchetype(_entity);
-
-            if (newArchetype)
+            else
                 addEntityToArchetype(newArchetype, _entity);
         }
 
@@ -699,6 +816,102 @@ namespace Maze
         processEntitySampleRefs(_entity);
     }
 
+    //////////////////////////////////////////
+    void EcsWorld::processEntitiesAddedForSamples(Entity* const* _entities, Size _count)
+    {
+        MAZE_PROFILE_EVENT("EcsWorld::processEntitiesAddedForSamples");
+
+        if (_count == 0u)
+            return;
+
+        // See processEntityAddedForSamples - archetypes are assigned before any sample callbacks
+        Vector<Entity*> entities(_entities, _entities + _count);
+        for (Entity* entity : entities)
+        {
+            MAZE_DEBUG_ASSERT(entity->getArchetypeId() == c_invalidArchetypeId);
+            if (entity->getArchetypeId() != c_invalidArchetypeId)
+                removeEntityFromArchetype(entity);
+
+            addEntityToArchetype(evaluateEntityArchetype(entity), entity);
+        }
+
+        Vector<ComponentSystemEventHandlerPtr> const& eventHandlers = m_eventHandlers[ClassInfo<EntityAddedToSampleEvent>::UID()];
+        for (ComponentSystemEventHandlerPtr const& _eventHandler : eventHandlers)
+        {
+            IEntitiesSample* sample = _eventHandler->getSample().get();
+            if (!sample)
+                continue;
+
+            sample->reserveEntities(_count);
+            for (Entity* entity : entities)
+                sample->processEntity(entity);
+        }
+
+        // Group the batch by archetype, so every archetype samples list is resolved once
+        eastl::stable_sort(
+            entities.begin(),
+            entities.end(),
+            [](Entity* _a, Entity* _b) { return _a->getArchetypeId() < _b->getArchetypeId(); });
+
+        for (Size begin = 0u, end = 0u; begin < _count; begin = end)
+        {
+            ArchetypeId archetypeId = entities[begin]->getArchetypeId();
+            for (end = begin + 1u; end < _count && entities[end]->getArchetypeId() == archetypeId; ++end) {}
+
+            EcsArchetype* archetype = getArchetype(archetypeId);
+            if (!archetype)
+                continue;
+
+            Vector<EcsArchetype::SampleEntry> const& samples = updateArchetypeSamplesCache(archetype);
+            for (Size i = 0, in = samples.size(); i < in; ++i)
+            {
+                IEntitiesSample* sample = samples[i].sample;
+                sample->reserveEntities(end - begin);
+                for (Size j = begin; j < end; ++j)
+                    sample->processEntity(entities[j]);
+            }
+        }
+
+        for (Entity* entity : entities)
+            processEntitySampleRefs(entity);
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::processEntitiesRemovedForSamples(Entity* const* _entities, Size _count)
+    {
+        MAZE_PROFILE_EVENT("EcsWorld::processEntitiesRemovedForSamples");
+
+        if (_count == 0u)
+            return;
+
+        Vector<Entity*> entities(_entities, _entities + _count);
+        eastl::stable_sort(
+            entities.begin(),
+            entities.end(),
+            [](Entity* _a, Entity* _b) { return _a->getArchetypeId() < _b->getArchetypeId(); });
+
+        for (Size begin = 0u, end = 0u; begin < _count; begin = end)
+        {
+            ArchetypeId archetypeId = entities[begin]->getArchetypeId();
+            for (end = begin + 1u; end < _count && entities[end]->getArchetypeId() == archetypeId; ++end) {}
+
+            EcsArchetype* archetype = getArchetype(archetypeId);
+            if (!archetype)
+                continue;
+
+            for (Size j = begin; j < end; ++j)
+                removeEntityFromArchetype(entities[j]);
+
+            Vector<EcsArchetype::SampleEntry> const& samples = updateArchetypeSamplesCache(archetype);
+            for (Size i = 0, in = samples.size(); i < in; ++i)
+                for (Size j = begin; j < end; ++j)
+                    samples[i].sample->processEntity(entities[j]);
+        }
+
+        for (Entity* entity : entities)
+            processEntitySampleRefs(entity);
+    }
+
     //////////////////////////////////////////
     EcsArchetype* EcsWorld::getArchetype(ArchetypeId _id) const
     {
@@ -733,6 +946,22 @@ namespace Maze
         for (auto const& componentData : _entity->getComponents())
             m_archetypeIdsScratch.push_back(componentData.first);
 
+        m_archetypeDenseIdsScratch.clear();
+        CollectEcsOwnedDenseComponentIds(m_archetypeIdsScratch, m_archetypeDenseIdsScratch);
+        m_archetypeDenseIdsScratch.insert(
+            m_archetypeDenseIdsScratch.end(),
+            _entity->m_denseComponentIds.begin(),
+            _entity->m_denseComponentIds.end());
+
+        if (!m_archetypeDenseIdsScratch.empty())
+        {
+            m_archetypeIdsScratch.insert(
+                m_archetypeIdsScratch.end(),
+                m_archetypeDenseIdsScratch.begin(),
+                m_archetypeDenseIdsScratch.end());
+            eastl::sort(m_archetypeIdsScratch.begin(), m_archetypeIdsScratch.end());
+        }
+
         return requestArchetype(m_archetypeIdsScratch);
     }
 
@@ -767,6 +996,7 @@ namespace Maze
         _entity->m_archetypeId = _archetype->getId();
         _entity->m_indexInArchetype = (S32)_archetype->m_entities.size();
         _archetype->m_entities.push_back(_entity->getId());
+        _archetype->pushDenseRow(_entity);
     }
 
     //////////////////////////////////////////
@@ -782,19 +1012,106 @@ namespace Maze
             index < (S32)archetype->m_entities.size() &&
             archetype->m_entities[index] == _entity->getId());
 
-        S32 lastIndex = (S32)archetype->m_entities.size() - 1;
-        if (index != lastIndex)
+        removeEntityFromArchetype(archetype, index);
+
+        _entity->m_archetypeId = c_invalidArchetypeId;
+        _entity->m_indexInArchetype = -1;
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::removeEntityFromArchetype(EcsArchetype* _archetype, S32 _index)
+    {
+        S32 lastIndex = (S32)_archetype->m_entities.size() - 1;
+        if (_index != lastIndex)
         {
-            archetype->m_entities[index] = archetype->m_entities[lastIndex];
-            EntityPtr const& movedEntity = getEntity(archetype->m_entities[index]);
+            _archetype->m_entities[_index] = _archetype->m_entities[lastIndex];
+            EntityPtr const& movedEntity = getEntity(_archetype->m_entities[_index]);
             MAZE_DEBUG_ASSERT(movedEntity);
             if (movedEntity)
-                movedEntity->m_indexInArchetype = index;
+                movedEntity->m_indexInArchetype = _index;
         }
-        archetype->m_entities.pop_back();
+        _archetype->m_entities.pop_back();
+        _archetype->removeDenseRow(_index);
+    }
 
-        _entity->m_archetypeId = c_invalidArchetypeId;
-        _entity->m_indexInArchetype = -1;
+    //////////////////////////////////////////
+    void EcsWorld::transferEntityToArchetype(EcsArchetype* _archetype, Entity* _entity)
+    {
+        EcsArchetype* oldArchetype = getArchetype(_entity->m_archetypeId);
+        S32 oldIndex = _entity->m_indexInArchetype;
+
+        addEntityToArchetype(_archetype, _entity);
+
+        if (oldArchetype)
+        {
+            if (oldArchetype->hasDenseComponents() && _archetype->hasDenseComponents())
+                _archetype->copyDenseRow(oldArchetype, oldIndex, _entity->m_indexInArchetype);
+
+            removeEntityFromArchetype(oldArchetype, oldIndex);
+        }
+    }
+
+    //////////////////////////////////////////
+    U8* EcsWorld::addDenseComponent(Entity* _entity, ComponentId _componentId)
+    {
+        EcsDenseComponentInfo denseInfo;
+        MAZE_ERROR_RETURN_VALUE_IF(!GetEcsDenseComponentInfo(_componentId, denseInfo), nullptr, "Component %u is not dense!", _componentId);
+        MAZE_ERROR_RETURN_VALUE_IF(denseInfo.ownerComponentId != c_invalidComponentId, nullptr, "Dense component %s is owned by a regular component!", denseInfo.name);
+        MAZE_ERROR_RETURN_VALUE_IF(getParallelPhase(), nullptr, "Dense components cannot be added during the parallel phase!");
+
+        EcsArchetype* archetype = getArchetype(_entity->m_archetypeId);
+        MAZE_ERROR_RETURN_VALUE_IF(_entity->getEcsWorld() != this || !archetype, nullptr, "Entity is not added to the world yet!");
+
+        Vector<ComponentId>& denseComponentIds = _entity->m_denseComponentIds;
+        auto it = eastl::lower_bound(denseComponentIds.begin(), denseComponentIds.end(), _componentId);
+        if (it == denseComponentIds.end() || *it != _componentId)
+        {
+            denseComponentIds.insert(it, _componentId);
+
+            // Only the dense part of the signature is changed, regular components are processed as usual
+            m_archetypeIdsScratch = archetype->getComponentIds();
+            m_archetypeIdsScratch.insert(
+                eastl::lower_bound(m_archetypeIdsScratch.begin(), m_archetypeIdsScratch.end(), _componentId),
+                _componentId);
+            transferEntityToArchetype(requestArchetype(m_archetypeIdsScratch), _entity);
+        }
+
+        return getDenseComponent(_entity, _componentId);
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorld::removeDenseComponent(Entity* _entity, ComponentId _componentId)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(getParallelPhase(), false, "Dense components cannot be removed during the parallel phase!");
+
+        Vector<ComponentId>& denseComponentIds = _entity->m_denseComponentIds;
+        auto it = eastl::lower_bound(denseComponentIds.begin(), denseComponentIds.end(), _componentId);
+        if (it == denseComponentIds.end() || *it != _componentId)
+            return false;
+
+        denseComponentIds.erase(it);
+
+        EcsArchetype* archetype = getArchetype(_entity->m_archetypeId);
+        if (archetype && _entity->getEcsWorld() == this)
+        {
+            m_archetypeIdsScratch = archetype->getComponentIds();
+            m_archetypeIdsScratch.erase(
+                eastl::remove(m_archetypeIdsScratch.begin(), m_archetypeIdsScratch.end(), _componentId),
+                m_archetypeIdsScratch.end());
+            transferEntityToArchetype(requestArchetype(m_archetypeIdsScratch), _entity);
+        }
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    U8* EcsWorld::getDenseComponent(Entity* _entity, ComponentId _componentId) const
+    {
+        EcsArchetype* archetype = getArchetype(_entity->m_archetypeId);
+        if (!archetype)
+            return nullptr;
+
+        return archetype->getDenseComponentData(_componentId, _entity->m_indexInArchetype);
     }
 
     //////////////////////////////////////////
@@ -911,9 +1228,17 @@ namespace Maze
     //////////////////////////////////////////
     void EcsWorld::broadcastEvent(EventUPtr&& _event)
     {
-        if (m_state != EcsWorldState::Active && m_state != EcsWorldState::PreparingToDestroy)
+        if (!isEventsQueueAvailable())
             return;
 
+        if (getParallelPhase())
+        {
+            Event* event = _event.release();
+            if (deferParallelPhaseCommand(ParallelPhaseCommandType::BroadcastEvent, c_invalidEntityId, nullptr, event))
+                return;
+            _event.reset(event);
+        }
+
         m_eventHolders.current()->addBroadcastEvent(eastl::forward<EventUPtr>(_event));
     }
 
@@ -921,12 +1246,301 @@ namespace Maze
     //////////////////////////////////////////
     void EcsWorld::sendEvent(EntityId _entityId, EventUPtr&& _event)
     {
-        if (m_state != EcsWorldState::Active && m_state != EcsWorldState::PreparingToDestroy)
+        if (!isEventsQueueAvailable())
             return;
 
+        if (getParallelPhase())
+        {
+            Event* event = _event.release();
+            if (deferParallelPhaseCommand(ParallelPhaseCommandType::SendEvent, _entityId, nullptr, event))
+                return;
+            _event.reset(event);
+        }
+
         m_eventHolders.current()->addUnicastEvent(_entityId, eastl::forward<EventUPtr>(_event));
     }
 
+    //////////////////////////////////////////
+    void EcsWorld::broadcastFrameEvent(Event* _event)
+    {
+        if (!isEventsQueueAvailable())
+        {
+            _event->~Event();
+            return;
+        }
+
+        // Frame arena memory outlives the parallel phase, so the pointer is safe to capture
+        if (deferParallelPhaseCommand(ParallelPhaseCommandType::BroadcastFrameEvent, c_invalidEntityId, nullptr, _event))
+            return;
+
+        m_eventHolders.current()->addBroadcastFrameEvent(_event);
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::sendFrameEvent(EntityId _entityId, Event* _event)
+    {
+        if (!isEventsQueueAvailable())
+        {
+            _event->~Event();
+            return;
+        }
+
+        if (deferParallelPhaseCommand(ParallelPhaseCommandType::SendFrameEvent, _entityId, nullptr, _event))
+            return;
+
+        m_eventHolders.current()->addUnicastFrameEvent(_entityId, _event);
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::broadcastEventParallel(Event* _event, EcsEventParams _params)
+    {
+        TaskManager* taskManager = TaskManager::GetInstancePtr();
+        if (!m_parallelSystemsEnabled ||
+            !taskManager ||
+            taskManager->getJobSystem().getWorkersCount() == 0 ||
+            m_parallelBroadcastDepth > 0 ||
+            getParallelPhase())
+        {
+            broadcastEventImmediate(_event, _params);
+            return;
+        }
+
+        EventHandlersSchedule const& schedule = ensureEventHandlersSchedule(_event->getEventUID());
+        if (!schedule.parallel)
+        {
+            broadcastEventImmediate(_event, _params);
+            return;
+        }
+
+        JobSystem& jobSystem = taskManager->getJobSystem();
+
+        // Schedule is not rebuilt during the dispatch, handlers are kept alive by it
+        ++m_parallelBroadcastDepth;
+        for (Size s = 0, sn = schedule.stageOffsets.size() - 1; s < sn; ++s)
+        {
+            S32 begin = schedule.stageOffsets[s];
+            S32 end = schedule.stageOffsets[s + 1];
+
+            if (end - begin == 1)
+            {
+                schedule.eventHandlers[begin]->processEvent(_event, _params);
+                continue;
+            }
+
+            beginParallelPhase();
+
+            JobHandle stageJob = jobSystem.createJob([]() {});
+            for (S32 i = begin + 1; i < end; ++i)
+            {
+                ComponentSystemEventHandler* eventHandler = schedule.eventHandlers[i].get();
+                jobSystem.run(
+                    jobSystem.createJob(
+                        [eventHandler, _event, _params]()
+                        {
+                            MAZE_PROFILE_EVENT("EcsWorld - Parallel System");
+                            eventHandler->processEvent(_event, _params);
+                        },
+                        stageJob));
+            }
+            jobSystem.run(stageJob);
+
+            // The main thread takes the first handler of the stage by itself
+            schedule.eventHandlers[begin]->processEvent(_event, _params);
+            jobSystem.wait(stageJob);
+
+            endParallelPhase();
+        }
+        --m_parallelBroadcastDepth;
+    }
+
+    //////////////////////////////////////////
+    EcsWorld::EventHandlersSchedule const& EcsWorld::ensureEventHandlersSchedule(ClassUID _eventUID)
+    {
+        EventHandlersSchedule& schedule = m_eventHandlersSchedules[_eventUID];
+        if (schedule.version == m_eventHandlersVersion)
+            return schedule;
+
+        MAZE_PROFILE_EVENT("EcsWorld::ensureEventHandlersSchedule");
+
+        schedule.version = m_eventHandlersVersion;
+        schedule.parallel = false;
+        schedule.eventHandlers.clear();
+        schedule.stageOffsets.clear();
+
+        auto it = m_eventHandlers.find(_eventUID);
+        if (it == m_eventHandlers.end())
+            return schedule;
+
+        Vector<ComponentSystemEventHandlerPtr> const& eventHandlers = it->second;
+        S32 eventHandlersCount = (S32)eventHandlers.size();
+
+        // Each handler goes to the stage right after the last conflicting predecessor.
+        // Handlers without declared access conflict with everything, so they are executed alone
+        Vector<S32> stages(eventHandlersCount, 0);
+        S32 stagesCount = 0;
+        for (S32 i = 0; i < eventHandlersCount; ++i)
+        {
+            S32 stage = 0;
+            for (S32 j = 0; j < i; ++j)
+                if (stages[j] >= stage && eventHandlers[i]->isConflicting(eventHandlers[j].get()))
+                    stage = stages[j] + 1;
+
+            stages[i] = stage;
+            stagesCount = Math::Max(stagesCount, stage + 1);
+        }
+
+        schedule.stageOffsets.resize(stagesCount + 1, 0);
+        for (S32 i = 0; i < eventHandlersCount; ++i)
+            ++schedule.stageOffsets[stages[i] + 1];
+        for (S32 s = 0; s < stagesCount; ++s)
+        {
+            if (schedule.stageOffsets[s + 1] > 1)
+                schedule.parallel = true;
+            schedule.stageOffsets[s + 1] += schedule.stageOffsets[s];
+        }
+
+        // Stable placement keeps the original order inside each stage
+        Vector<S32> stageCursors(schedule.stageOffsets.begin(), schedule.stageOffsets.end() - 1);
+        schedule.eventHandlers.resize(eventHandlersCount);
+        for (S32 i = 0; i < eventHandlersCount; ++i)
+            schedule.eventHandlers[stageCursors[stages[i]]++] = eventHandlers[i];
+
+        return schedule;
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::beginParallelPhase()
+    {
+        m_parallelPhaseCounter.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::endParallelPhase()
+    {
+        MAZE_DEBUG_ASSERT(m_parallelPhaseCounter.load() > 0);
+
+        if (m_parallelPhaseCounter.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            flushParallelPhaseCommands();
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorld::deferParallelPhaseCommand(
+        ParallelPhaseCommandType _type,
+        EntityId _entityId,
+        EntityPtr const& _entity,
+        Event* _event)
+    {
+        if (m_parallelPhaseCounter.load(std::memory_order_acquire) == 0)
+            return false;
+
+        MAZE_MUTEX_SCOPED_LOCK(m_parallelPhaseCommandsMutex);
+        m_parallelPhaseCommands.push_back(ParallelPhaseCommand{ _type, _entityId, _entity, _event, 0u, 0u });
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorld::deferParallelPhaseEntitiesCommand(
+        ParallelPhaseCommandType _type,
+        EntityPtr const* _entities,
+        Size _count)
+    {
+        if (m_parallelPhaseCounter.load(std::memory_order_acquire) == 0)
+            return false;
+
+        MAZE_MUTEX_SCOPED_LOCK(m_parallelPhaseCommandsMutex);
+        U32 entitiesOffset = (U32)m_parallelPhaseCommandEntities.size();
+        m_parallelPhaseCommandEntities.insert(m_parallelPhaseCommandEntities.end(), _entities, _entities + _count);
+        m_parallelPhaseCommands.push_back(
+            ParallelPhaseCommand{ _type, c_invalidEntityId, nullptr, nullptr, entitiesOffset, (U32)_count });
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void EcsWorld::flushParallelPhaseCommands()
+    {
+        MAZE_PROFILE_EVENT("EcsWorld::flushParallelPhaseCommands");
+
+        Vector<ParallelPhaseCommand> commands;
+        Vector<EntityPtr> commandEntities;
+        {
+            MAZE_MUTEX_SCOPED_LOCK(m_parallelPhaseCommandsMutex);
+            commands.swap(m_parallelPhaseCommands);
+            commandEntities.swap(m_parallelPhaseCommandEntities);
+        }
+
+        for (ParallelPhaseCommand& command : commands)
+        {
+            switch (command.type)
+            {
+                case ParallelPhaseCommandType::AddEntity:
+                {
+                    addEntity(command.entity);
+                    break;
+                }
+                case ParallelPhaseCommandType::RemoveEntity:
+                {
+                    removeEntity(command.entity);
+                    break;
+                }
+                case ParallelPhaseCommandType::AddEntities:
+                {
+                    addEntities(commandEntities.data() + command.entitiesOffset, command.entitiesCount);
+                    break;
+                }
+                case ParallelPhaseCommandType::RemoveEntities:
+                {
+                    removeEntities(commandEntities.data() + command.entitiesOffset, command.entitiesCount);
+                    break;
+                }
+                case ParallelPhaseCommandType::EntityComponentsChanged:
+                {
+                    processEntityComponentsChanged(command.entityId);
+                    break;
+                }
+                case ParallelPhaseCommandType::EntityActiveChanged:
+                {
+                    processEntityActiveChanged(command.entityId);
+                    break;
+                }
+                case ParallelPhaseCommandType::BroadcastEvent:
+                {
+                    broadcastEvent(EventUPtr(command.event));
+                    break;
+                }
+                case ParallelPhaseCommandType::SendEvent:
+                {
+                    sendEvent(command.entityId, EventUPtr(command.event));
+                    break;
+                }
+                case ParallelPhaseCommandType::BroadcastFrameEvent:
+                {
+                    broadcastFrameEvent(command.event);
+                    break;
+                }
+                case ParallelPhaseCommandType::SendFrameEvent:
+                {
+                    sendFrameEvent(command.entityId, command.event);
+                    break;
+                }
+                default:
+                {
+                    MAZE_NOT_IMPLEMENTED;
+                    break;
+                }
+            }
+        }
+
+        // Keep the buffers capacity for the next phase
+        commands.clear();
+        commandEntities.clear();
+
+        MAZE_MUTEX_SCOPED_LOCK(m_parallelPhaseCommandsMutex);
+        if (m_parallelPhaseCommands.empty())
+            m_parallelPhaseCommands.swap(commands);
+        if (m_parallelPhaseCommandEntities.empty())
+            m_parallelPhaseCommandEntities.swap(commandEntities);
+    }
+
     //////////////////////////////////////////
     void EcsWorld::notifyMouse(InputEventMouseData const& _data)
     {
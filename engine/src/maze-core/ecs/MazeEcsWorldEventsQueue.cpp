@@ -50,6 +50,8 @@ namespace Maze
     //////////////////////////////////////////
     EcsWorldEventsQueue::~EcsWorldEventsQueue()
     {
+        DestroyQueuedEvents(m_broadcastEvents, m_broadcastEventsHead);
+        DestroyQueuedEvents(m_unicastEvents, m_unicastEventsHead);
     }
 
     //////////////////////////////////////////
@@ -75,10 +77,9 @@ namespace Maze
 
         m_processingEvents = true;
 
-        while (!m_eventTypes.empty())
+        while (m_eventTypesHead < m_eventTypes.size())
         {
-            EcsWorldEventType eventType = m_eventTypes.front();
-            m_eventTypes.pop();
+            EcsWorldEventType eventType = m_eventTypes[m_eventTypesHead++];
 
             switch (eventType)
             {
@@ -87,6 +88,11 @@ namespace Maze
                     invokeRemovingEntityEvent();
                     break;
                 }
+                case EcsWorldEventType::RemovingEntities:
+                {
+                    invokeRemovingEntitiesEvent();
+                    break;
+                }
                 case EcsWorldEventType::RemovingFromSampleEntity:
                 {
                     invokeRemovingFromSampleEntityEvent();
@@ -107,14 +113,15 @@ namespace Maze
     {
         MAZE_PROFILE_EVENT("EcsWorldEventsQueue::processEvents");
 
+        MAZE_DEBUG_ASSERT(m_addingEntitiesBatchDepth == 0);
+
         m_processingEvents = true;
 
         // U32 startTime = m_timer.getMilliseconds();
 
-        while (!m_eventTypes.empty())
+        while (m_eventTypesHead < m_eventTypes.size())
         {
-            EcsWorldEventType eventType = m_eventTypes.front();
-            m_eventTypes.pop();
+            EcsWorldEventType eventType = m_eventTypes[m_eventTypesHead++];
 
             switch (eventType)
             {
@@ -148,6 +155,16 @@ namespace Maze
                     invokeActiveChangedEvent();
                     break;
                 }
+                case EcsWorldEventType::AddingEntities:
+                {
+                    invokeAddingEntitiesEvent();
+                    break;
+                }
+                case EcsWorldEventType::RemovingEntities:
+                {
+                    invokeRemovingEntitiesEvent();
+                    break;
+                }
                 case EcsWorldEventType::Broadcast:
                 {
                     invokeBroadcastEvent();
@@ -165,12 +182,15 @@ namespace Maze
         }
 
         
-        MAZE_DEBUG_ASSERT(m_eventTypes.empty());
+        MAZE_DEBUG_ASSERT(m_eventTypesHead == m_eventTypes.size());
         MAZE_DEBUG_ASSERT(m_addingEntities.empty());
         MAZE_DEBUG_ASSERT(m_removingEntities.empty());
         MAZE_DEBUG_ASSERT(m_componentsChangedEntities.empty());
         MAZE_DEBUG_ASSERT(m_activeChangedEntities.empty());
-        MAZE_DEBUG_ASSERT(m_broadcastEvents.empty());
+        MAZE_DEBUG_ASSERT(m_broadcastEventsHead == m_broadcastEvents.size());
+        MAZE_DEBUG_ASSERT(m_unicastEventsHead == m_unicastEvents.size());
+
+        compactQueues();
 
         m_processingEvents = false;
     }
@@ -180,6 +200,82 @@ namespace Maze
     {
         MAZE_DEBUG_ASSERT(!m_processingEvents);
 
+        EntityId entityId = queueAddingEntity(_entity);
+
+        // The open batch is fully evaluated when it is processed, see addEntities
+        if (m_addingEntitiesBatchDepth > 0)
+        {
+            ++m_addingEntitiesBatches.back();
+            _entity->setEcsWorld(m_world);
+            return true;
+        }
+
+        pushEventType(EcsWorldEventType::AddingEntity);
+
+        // setEcsWorld triggers tryAwake, and awakened components may mutate the
+        // entity (ensureComponent etc.), queueing ComponentsChanged/ActiveChanged
+        // events - so the AddingEntity event must be queued before this call,
+        // otherwise those events are processed for an entity that is not added yet
+        _entity->setEcsWorld(m_world);
+
+        processEntityComponentsChanged(entityId);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorldEventsQueue::addEntities(EntityPtr const* _entities, Size _count)
+    {
+        MAZE_DEBUG_ASSERT(!m_processingEvents);
+
+        if (_count == 0u)
+            return false;
+
+        for (Size i = 0; i < _count; ++i)
+            queueAddingEntity(_entities[i]);
+
+        if (m_addingEntitiesBatchDepth > 0)
+        {
+            m_addingEntitiesBatches.back() += (S32)_count;
+        }
+        else
+        {
+            m_addingEntitiesBatches.push((S32)_count);
+            pushEventType(EcsWorldEventType::AddingEntities);
+        }
+
+        // See addEntity. The batch is fully evaluated when the event is processed,
+        // so there is no need in ComponentsChanged event for every entity
+        for (Size i = 0; i < _count; ++i)
+            _entities[i]->setEcsWorld(m_world);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::beginAddingEntities()
+    {
+        MAZE_DEBUG_ASSERT(!m_processingEvents);
+
+        if (m_addingEntitiesBatchDepth++ > 0)
+            return;
+
+        // The event goes first, so the events queued by the entities of the batch
+        // (ComponentsChanged, Name changes, parent changes etc.) are processed after it
+        m_addingEntitiesBatches.push(0);
+        pushEventType(EcsWorldEventType::AddingEntities);
+    }
+
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::endAddingEntities()
+    {
+        MAZE_DEBUG_ASSERT(m_addingEntitiesBatchDepth > 0);
+        --m_addingEntitiesBatchDepth;
+    }
+
+    //////////////////////////////////////////
+    EntityId EcsWorldEventsQueue::queueAddingEntity(EntityPtr const& _entity)
+    {
         MAZE_DEBUG_BP_IF(!_entity->getRemoving() && _entity->getEcsWorld());
         MAZE_DEBUG_BP_IF(_entity->getAdding());
 
@@ -208,17 +304,8 @@ namespace Maze
             eastl::piecewise_construct,
             eastl::forward_as_tuple(_entity->getId()),
             eastl::forward_as_tuple(_entity));
-        m_eventTypes.push(EcsWorldEventType::AddingEntity);
 
-        // setEcsWorld triggers tryAwake, and awakened components may mutate the
-        // entity (ensureComponent etc.), queueing ComponentsChanged/ActiveChanged
-        // events - so the AddingEntity event must be queued before this call,
-        // otherwise those events are processed for an entity that is not added yet
-        _entity->setEcsWorld(m_world);
-
-        processEntityComponentsChanged(entityId);
-
-        return true;
+        return entityId;
     }
 
     //////////////////////////////////////////
@@ -232,7 +319,33 @@ namespace Maze
         _entity->setRemoving(true);
         
         m_removingEntities.push(_entity->getId());
-        m_eventTypes.push(EcsWorldEventType::RemovingEntity);
+        pushEventType(EcsWorldEventType::RemovingEntity);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorldEventsQueue::removeEntities(EntityPtr const* _entities, Size _count)
+    {
+        MAZE_DEBUG_ASSERT(!m_processingEvents);
+
+        S32 batchSize = 0;
+        for (Size i = 0; i < _count; ++i)
+        {
+            EntityPtr const& entity = _entities[i];
+            if (!entity || entity->getRemoving())
+                continue;
+
+            entity->setRemoving(true);
+            m_removingEntities.push(entity->getId());
+            ++batchSize;
+        }
+
+        if (batchSize == 0)
+            return false;
+
+        m_removingEntitiesBatches.push(batchSize);
+        pushEventType(EcsWorldEventType::RemovingEntities);
 
         return true;
     }
@@ -240,19 +353,49 @@ namespace Maze
     //////////////////////////////////////////
     bool EcsWorldEventsQueue::addBroadcastEvent(EventUPtr&& _event)
     {
-        m_broadcastEvents.emplace(eastl::move(_event));
-        m_eventTypes.push(EcsWorldEventType::Broadcast);
+        m_broadcastEvents.push_back({ c_invalidEntityId, _event.release(), false, 0u });
+        pushEventType(EcsWorldEventType::Broadcast);
         return true;
     }
 
     //////////////////////////////////////////
     bool EcsWorldEventsQueue::addUnicastEvent(EntityId _eid, EventUPtr&& _event)
     {
-        m_unicastEvents.emplace(_eid, eastl::move(_event));
-        m_eventTypes.push(EcsWorldEventType::Unicast);
+        m_unicastEvents.push_back({ _eid, _event.release(), false, 0u });
+        pushEventType(EcsWorldEventType::Unicast);
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool EcsWorldEventsQueue::addBroadcastFrameEvent(Event* _event)
+    {
+        m_broadcastEvents.push_back({ c_invalidEntityId, _event, true, m_world->getFrameArena().getFrameIndex() });
+        pushEventType(EcsWorldEventType::Broadcast);
         return true;
     }
 
+    //////////////////////////////////////////
+    bool EcsWorldEventsQueue::addUnicastFrameEvent(EntityId _eid, Event* _event)
+    {
+        m_unicastEvents.push_back({ _eid, _event, true, m_world->getFrameArena().getFrameIndex() });
+        pushEventType(EcsWorldEventType::Unicast);
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::checkFrameEventsBeforeArenaSwap(U32 _frameIndex) const
+    {
+#if (MAZE_DEBUG)
+        // Frame events of the previous generation are still alive after the swap,
+        // anything older is in the arena which is about to be rewound
+        for (Size i = m_broadcastEventsHead, in = m_broadcastEvents.size(); i < in; ++i)
+            MAZE_DEBUG_ASSERT(!m_broadcastEvents[i].frameArena || m_broadcastEvents[i].frameIndex == _frameIndex);
+
+        for (Size i = m_unicastEventsHead, in = m_unicastEvents.size(); i < in; ++i)
+            MAZE_DEBUG_ASSERT(!m_unicastEvents[i].frameArena || m_unicastEvents[i].frameIndex == _frameIndex);
+#endif
+    }
+
     //////////////////////////////////////////
     void EcsWorldEventsQueue::processEntityAddedToSample(
         ComponentSystemEventHandlerPtr const& _handler,
@@ -290,7 +433,7 @@ namespace Maze
         entity->setComponentsChanged(true);
 
         m_componentsChangedEntities.push(_id);
-        m_eventTypes.push(EcsWorldEventType::ComponentsChanged);
+        pushEventType(EcsWorldEventType::ComponentsChanged);
     }
 
     //////////////////////////////////////////
@@ -304,7 +447,7 @@ namespace Maze
 
         entity->setActiveChanged(true);
         m_activeChangedEntities.push(_id);
-        m_eventTypes.push(EcsWorldEventType::ActiveChanged);
+        pushEventType(EcsWorldEventType::ActiveChanged);
 
         m_world->sendEventImmediate<EntityActiveChangedEvent>(_id, entity->getActiveInHierarchy());
     }
@@ -373,6 +516,97 @@ namespace Maze
         m_world->removeEntityNow(entity->getId());
     }
 
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::invokeAddingEntitiesEvent()
+    {
+        MAZE_PROFILE_EVENT("EcsWorldEventsQueue::invokeAddingEntitiesEvent");
+
+        S32 batchSize = m_addingEntitiesBatches.front();
+        m_addingEntitiesBatches.pop();
+
+        if (batchSize == 0)
+            return;
+
+        Vector<EntityPtr> entities;
+        Vector<Entity*> entitiesRaw;
+        entities.reserve(batchSize);
+        entitiesRaw.reserve(batchSize);
+        for (S32 i = 0; i < batchSize; ++i)
+        {
+            EntityPtr const& entity = m_addingEntities.front();
+
+            m_addingEntitiesById.erase(entity->getId());
+
+            m_world->addEntityNow(entity);
+
+            entity->setAdding(false);
+            entity->setActiveInHierarchyPrevFrame(entity->getActiveInHierarchy());
+
+            entities.emplace_back(entity);
+            entitiesRaw.push_back(entity.get());
+            m_addingEntities.pop_front();
+        }
+
+        if (!m_world->eventEntityAdded.empty())
+            for (EntityPtr const& entity : entities)
+                m_world->eventEntityAdded(entity);
+
+        m_world->processEntitiesAddedForSamples(entitiesRaw.data(), entitiesRaw.size());
+
+        for (EntityPtr const& entity : entities)
+            m_world->sendEventImmediate<EntityAddedEvent>(entity->getId());
+
+        if (!m_world->eventEntitiesAdded.empty())
+            m_world->eventEntitiesAdded(entities);
+    }
+
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::invokeRemovingEntitiesEvent()
+    {
+        MAZE_PROFILE_EVENT("EcsWorldEventsQueue::invokeRemovingEntitiesEvent");
+
+        S32 batchSize = m_removingEntitiesBatches.front();
+        m_removingEntitiesBatches.pop();
+
+        Vector<EntityPtr> entities;
+        entities.reserve(batchSize);
+        for (S32 i = 0; i < batchSize; ++i)
+        {
+            EntityId entityId = m_removingEntities.front();
+            m_removingEntities.pop();
+
+            EntityPtr const& entity = m_world->getEntity(entityId);
+            if (!entity || !entity->getRemoving())
+                continue;
+
+            entities.emplace_back(entity);
+        }
+
+        for (EntityPtr const& entity : entities)
+            m_world->sendEventImmediate<EntityRemovedEvent>(entity->getId(), EcsEventParams(false));
+
+        Vector<Entity*> entitiesRaw;
+        entitiesRaw.reserve(entities.size());
+        for (EntityPtr const& entity : entities)
+        {
+            entity->setEcsWorld(nullptr);
+            entity->setRemoving(false);
+
+            if (!m_world->eventEntityRemoved.empty())
+                m_world->eventEntityRemoved(entity);
+
+            entitiesRaw.push_back(entity.get());
+        }
+
+        m_world->processEntitiesRemovedForSamples(entitiesRaw.data(), entitiesRaw.size());
+
+        for (Entity* entity : entitiesRaw)
+            m_world->removeEntityNow(entity->getId());
+
+        if (!m_world->eventEntitiesRemoved.empty())
+            m_world->eventEntitiesRemoved(entities);
+    }
+
     //////////////////////////////////////////
     void EcsWorldEventsQueue::invokeAddingToSampleEntityEvent()
     {
@@ -469,10 +703,12 @@ namespace Maze
     {
         MAZE_PROFILE_EVENT("EcsWorldEventsQueue::invokeBroadcastEvent");
 
-        EventUPtr evt = eastl::move(m_broadcastEvents.front());
-        m_broadcastEvents.pop();
+        // Copy - the handlers may queue new events
+        QueuedEvent queuedEvent = m_broadcastEvents[m_broadcastEventsHead++];
+
+        m_world->broadcastEventImmediate(queuedEvent.event);
 
-        m_world->broadcastEventImmediate(evt.get());
+        DestroyQueuedEvent(queuedEvent);
     }
 
     //////////////////////////////////////////
@@ -480,10 +716,55 @@ namespace Maze
     {
         MAZE_PROFILE_EVENT("EcsWorldEventsQueue::invokeUnicastEvent");
 
-        std::pair<EntityId, EventUPtr> evt = eastl::move(m_unicastEvents.front());
-        m_unicastEvents.pop();
+        QueuedEvent queuedEvent = m_unicastEvents[m_unicastEventsHead++];
+
+        m_world->sendEventImmediate(queuedEvent.entityId, queuedEvent.event);
+
+        DestroyQueuedEvent(queuedEvent);
+    }
 
-        m_world->sendEventImmediate(evt.first, evt.second.get());
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::pushEventType(EcsWorldEventType _eventType)
+    {
+        m_eventTypes.push_back(_eventType);
+    }
+
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::compactQueues()
+    {
+        if (m_eventTypesHead == m_eventTypes.size())
+        {
+            m_eventTypes.clear();
+            m_eventTypesHead = 0u;
+        }
+
+        if (m_broadcastEventsHead == m_broadcastEvents.size())
+        {
+            m_broadcastEvents.clear();
+            m_broadcastEventsHead = 0u;
+        }
+
+        if (m_unicastEventsHead == m_unicastEvents.size())
+        {
+            m_unicastEvents.clear();
+            m_unicastEventsHead = 0u;
+        }
+    }
+
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::DestroyQueuedEvent(QueuedEvent const& _queuedEvent)
+    {
+        if (_queuedEvent.frameArena)
+            _queuedEvent.event->~Event();
+        else
+            delete _queuedEvent.event;
+    }
+
+    //////////////////////////////////////////
+    void EcsWorldEventsQueue::DestroyQueuedEvents(FastVector<QueuedEvent>& _events, Size _head)
+    {
+        for (Size i = _head, in = _events.size(); i < in; ++i)
+            DestroyQueuedEvent(_events[i]);
     }
 
     //////////////////////////////////////////
@@ -491,7 +772,8 @@ namespace Maze
     {
         MAZE_DEBUG_ASSERT(!m_processingEvents);
 
-        while (!m_eventTypes.empty()) { m_eventTypes.pop(); }
+        m_eventTypes.clear();
+        m_eventTypesHead = 0u;
         for (EntityPtr const& entity : m_addingEntities)
         {
             entity->setEcsWorld(nullptr);
@@ -503,9 +785,18 @@ namespace Maze
         m_addingEntities.clear();
         m_addingEntitiesById.clear();
         while (!m_removingEntities.empty()) { m_removingEntities.pop(); }
+        while (!m_addingEntitiesBatches.empty()) { m_addingEntitiesBatches.pop(); }
+        while (!m_removingEntitiesBatches.empty()) { m_removingEntitiesBatches.pop(); }
         while (!m_componentsChangedEntities.empty()) { m_componentsChangedEntities.pop(); }
         while (!m_activeChangedEntities.empty()) { m_activeChangedEntities.pop(); }
-        while (!m_broadcastEvents.empty()) { m_broadcastEvents.pop(); }
+
+        DestroyQueuedEvents(m_broadcastEvents, m_broadcastEventsHead);
+        m_broadcastEvents.clear();
+        m_broadcastEventsHead = 0u;
+
+        DestroyQueuedEvents(m_unicastEvents, m_unicastEventsHead);
+        m_unicastEvents.clear();
+        m_unicastEventsHead = 0u;
     }
 
 
@@ -28,6 +28,9 @@
 #include "maze-core/ecs/MazeEntitiesSample.hpp"
 #include "maze-core/ecs/MazeEntity.hpp"
 #include "maze-core/managers/MazeEntityManager.hpp"
+#include "maze-core/managers/MazeTaskManager.hpp"
+#include "maze-core/ecs/MazeEcsWorld.hpp"
+#include "maze-core/ecs/MazeTransform3DHierarchy.hpp"
 
 
 //////////////////////////////////////////
@@ -63,6 +66,32 @@ namespace Maze
         return true;
     }
 
+    //////////////////////////////////////////
+    JobSystem* IEntitiesSample::beginParallelChunks()
+    {
+        TaskManager* taskManager = TaskManager::GetInstancePtr();
+        if (!taskManager || taskManager->getJobSystem().getWorkersCount() == 0)
+            return nullptr;
+
+        if (!m_worldRaw)
+            return nullptr;
+
+        // Lazy world transform calculation writes the parents caches.
+        // Nested queries are started when the transforms are already clean
+        if (!m_worldRaw->getParallelPhase() && m_worldRaw->getTransform3DHierarchy())
+            m_worldRaw->getTransform3DHierarchy()->update();
+
+        // Sample content is changed only by the deferred commands, so the data is stable during the query
+        m_worldRaw->beginParallelPhase();
+        return &taskManager->getJobSystem();
+    }
+
+    //////////////////////////////////////////
+    void IEntitiesSample::endParallelChunks()
+    {
+        m_worldRaw->endParallelPhase();
+    }
+
 
     //////////////////////////////////////////
     MAZE_IMPLEMENT_METACLASS(EntitiesSample);
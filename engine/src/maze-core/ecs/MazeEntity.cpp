@@ -165,6 +165,13 @@ namespace Maze
         setFlags(_entity->m_flags);
         setSerializationId(_entity->getSerializationId());
 
+        // The root copy opens the batch, the whole hierarchy joins it
+        bool ownBatch =
+            _copyData.getStackDepth() == 1 &&
+            _copyData.getBatchWorldInsertion() &&
+            _copyData.getWorld()->beginEntitiesBatch();
+
+        // Added before the components are copied, so they are initialized in the world
         _copyData.getWorld()->addEntity(getSharedPtr());
 
         for (auto const& componentData : _entity->m_components)
@@ -189,6 +196,9 @@ namespace Maze
         // Root entity serialized
         if (_copyData.getStackDepth() == 0)
         {
+            if (ownBatch)
+                _copyData.getWorld()->endEntitiesBatch();
+
             // Remap component properties
             for (EntityCopyData::ComponentPropertyData const& data : _copyData.getComponentProperties())
             {
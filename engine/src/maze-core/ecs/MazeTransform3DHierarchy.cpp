@@ -0,0 +1,217 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeCoreHeader.hpp"
+#include "maze-core/ecs/MazeTransform3DHierarchy.hpp"
+#include "maze-core/ecs/components/MazeTransform3D.hpp"
+#include "maze-core/managers/MazeTaskManager.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class Transform3DHierarchy
+    //
+    //////////////////////////////////////////
+    Transform3DHierarchy::Transform3DHierarchy()
+    {
+    }
+
+    //////////////////////////////////////////
+    Transform3DHierarchy::~Transform3DHierarchy()
+    {
+        // Transforms may outlive the world
+        for (Transform3D* transform : m_transforms)
+        {
+            transform->m_hierarchy = nullptr;
+            transform->m_hierarchyIndex = -1;
+        }
+    }
+
+    //////////////////////////////////////////
+    void Transform3DHierarchy::addTransform(Transform3D* _transform)
+    {
+        if (_transform->m_hierarchy == this)
+            return;
+
+        if (_transform->m_hierarchy)
+            _transform->m_hierarchy->removeTransform(_transform);
+
+        _transform->m_hierarchy = this;
+        _transform->m_hierarchyIndex = (S32)m_transforms.size();
+        m_transforms.push_back(_transform);
+        m_parentIndices.push_back(-1);
+
+        m_orderDirty = true;
+    }
+
+    //////////////////////////////////////////
+    void Transform3DHierarchy::removeTransform(Transform3D* _transform)
+    {
+        if (_transform->m_hierarchy != this)
+            return;
+
+        S32 index = _transform->m_hierarchyIndex;
+        MAZE_DEBUG_ASSERT(index >= 0 && index < (S32)m_transforms.size() && m_transforms[index] == _transform);
+
+        _transform->m_hierarchy = nullptr;
+        _transform->m_hierarchyIndex = -1;
+
+        S32 lastIndex = (S32)m_transforms.size() - 1;
+        if (index != lastIndex)
+        {
+            m_transforms[index] = m_transforms[lastIndex];
+            m_parentIndices[index] = m_parentIndices[lastIndex];
+            m_transforms[index]->m_hierarchyIndex = index;
+        }
+        m_transforms.pop_back();
+        m_parentIndices.pop_back();
+
+        m_orderDirty = true;
+    }
+
+    //////////////////////////////////////////
+    void Transform3DHierarchy::update()
+    {
+        MAZE_PROFILE_EVENT("Transform3DHierarchy::update");
+
+        if (m_orderDirty)
+            rebuildOrder();
+
+        // External parents may be shared, so these roots are processed serially
+        for (S32 index : m_externalRoots)
+        {
+            Transform3D* transform = m_transforms[index];
+            if (transform->m_flags & Transform3D::WorldTransformDirty)
+                transform->calculateWorldTransform();
+        }
+
+        TaskManager* taskManager = TaskManager::GetInstancePtr();
+        for (Size i = 0, in = getLevelsCount(); i < in; ++i)
+        {
+            S32 begin = m_levelOffsets[i];
+            S32 end = m_levelOffsets[i + 1];
+
+            if (taskManager && end - begin >= c_parallelLevelSizeMin)
+            {
+                taskManager->parallelFor(
+                    end - begin,
+                    0,
+                    [this, begin](S32 _begin, S32 _end)
+                    {
+                        updateTransforms(begin + _begin, begin + _end);
+                    });
+            }
+            else
+            {
+                updateTransforms(begin, end);
+            }
+        }
+    }
+
+    //////////////////////////////////////////
+    void Transform3DHierarchy::updateTransforms(S32 _begin, S32 _end)
+    {
+        for (S32 i = _begin; i < _end; ++i)
+        {
+            Transform3D* transform = m_transforms[i];
+            if (!(transform->m_flags & Transform3D::WorldTransformDirty))
+                continue;
+
+            // World matrices stay in the components, so the references given out by
+            // Transform3D::getWorldTransform are not invalidated by the order rebuilds
+            S32 parentIndex = m_parentIndices[i];
+            if (parentIndex >= 0)
+                m_transforms[parentIndex]->m_worldTransform.transform(transform->getLocalTransform(), transform->m_worldTransform);
+            else
+            if (!transform->m_parent)
+                transform->m_worldTransform = transform->getLocalTransform();
+            else
+                continue;
+
+            transform->m_flags &= ~Transform3D::WorldTransformDirty;
+        }
+    }
+
+    //////////////////////////////////////////
+    void Transform3DHierarchy::rebuildOrder()
+    {
+        MAZE_PROFILE_EVENT("Transform3DHierarchy::rebuildOrder");
+
+        m_transformsScratch.clear();
+        m_levelOffsets.clear();
+        m_externalRoots.clear();
+
+        for (Transform3D* transform : m_transforms)
+            if (!transform->m_parent || transform->m_parent->m_hierarchy != this)
+                m_transformsScratch.push_back(transform);
+
+        Size levelBegin = 0u;
+        while (levelBegin < m_transformsScratch.size())
+        {
+            m_levelOffsets.push_back((S32)levelBegin);
+
+            Size levelEnd = m_transformsScratch.size();
+            for (Size i = levelBegin; i < levelEnd; ++i)
+                for (Transform3D* child : m_transformsScratch[i]->m_children)
+                    if (child->m_hierarchy == this)
+                        m_transformsScratch.push_back(child);
+
+            levelBegin = levelEnd;
+        }
+        m_levelOffsets.push_back((S32)m_transformsScratch.size());
+
+        MAZE_DEBUG_ASSERT(m_transformsScratch.size() == m_transforms.size());
+
+        for (S32 i = 0, in = (S32)m_transformsScratch.size(); i < in; ++i)
+            m_transformsScratch[i]->m_hierarchyIndex = i;
+
+        m_parentIndices.resize(m_transformsScratch.size());
+        for (S32 i = 0, in = (S32)m_transformsScratch.size(); i < in; ++i)
+        {
+            Transform3D* parent = m_transformsScratch[i]->m_parent.get();
+            if (parent && parent->m_hierarchy == this)
+            {
+                m_parentIndices[i] = parent->m_hierarchyIndex;
+            }
+            else
+            {
+                m_parentIndices[i] = -1;
+                if (parent)
+                    m_externalRoots.push_back(i);
+            }
+        }
+
+        m_transforms.swap(m_transformsScratch);
+
+        m_orderDirty = false;
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -78,9 +78,11 @@ namespace Maze
 
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(LinearMovement3DSystem,
+    COMPONENT_SYSTEM_EVENT_HANDLER_RW(LinearMovement3DSystem,
         MAZE_ECS_TAGS(MAZE_HS("default")),
         {},
+        MAZE_ECS_READS(LinearMovement3D),
+        MAZE_ECS_WRITES(Transform3D),
         UpdateEvent const& _event,
         Entity* _entity,
         LinearMovement3D* _linearMovement,
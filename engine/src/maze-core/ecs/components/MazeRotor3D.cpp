@@ -52,6 +52,8 @@ namespace Maze
     //////////////////////////////////////////
     Rotor3D::Rotor3D()
     {
+        // Owned dense component should be registered before the entity archetype is evaluated
+        GetEcsDenseComponentId<Rotor3DData>();
     }
 
     //////////////////////////////////////////
@@ -76,18 +78,60 @@ namespace Maze
         return true;
     }
 
+    //////////////////////////////////////////
+    void Rotor3D::FillDenseData(Entity* _entity, U8* _data)
+    {
+        Rotor3DData& data = *reinterpret_cast<Rotor3DData*>(_data);
+        data.transform = _entity->getComponentRaw<Transform3D>();
+
+        Rotor3D* rotor = _entity->getComponentRaw<Rotor3D>();
+        if (rotor)
+            rotor->writeDenseData(data);
+    }
+
+    //////////////////////////////////////////
+    void Rotor3D::writeDenseData(Rotor3DData& _data) const
+    {
+        Vec3F axis = m_axis.normalizedCopy();
+        _data.axisX = axis.x;
+        _data.axisY = axis.y;
+        _data.axisZ = axis.z;
+        _data.speed = m_speed;
+        _data.active = m_active;
+    }
+
+    //////////////////////////////////////////
+    void Rotor3D::updateDenseData()
+    {
+        Entity* entity = getEntityRaw();
+        if (!entity || !entity->getEcsWorld())
+            return;
+
+        Rotor3DData* data = entity->getEcsWorld()->getDenseComponent<Rotor3DData>(entity);
+        if (data)
+            writeDenseData(*data);
+    }
+
 
     //////////////////////////////////////////
+    // Rotors are read from the archetype columns, so the pass does not touch the components
     COMPONENT_SYSTEM_EVENT_HANDLER(Rotor3DSystem,
         MAZE_ECS_TAGS(MAZE_HS("default")),
         {},
         UpdateEvent const& _event,
-        Entity* _entity,
-        Rotor3D* _rotor,
-        Transform3D* _transform)
+        EcsWorld* _world)
     {
-        if (_rotor->getActive())
-            _transform->rotate(_rotor->getAxis().normalizedCopy(), _rotor->getSpeed() * _event.getDt());
+        F32 dt = _event.getDt();
+        _world->queryDense<Rotor3DData>(
+            [dt](Size _count, EntityId const* _entityIds, Rotor3DData* _rotors)
+            {
+                for (Size i = 0; i < _count; ++i)
+                {
+                    Rotor3DData const& rotor = _rotors[i];
+                    if (rotor.active && rotor.transform)
+                        rotor.transform->rotate(Vec3F(rotor.axisX, rotor.axisY, rotor.axisZ), rotor.speed * dt);
+                }
+            });
     }
     
 } // namespace Maze
@@ -117,9 +117,11 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(SinMovement3DSystem,
-        MAZE_ECS_TAGS(MAZE_HS("default")), 
+    COMPONENT_SYSTEM_EVENT_HANDLER_RW(SinMovement3DSystem,
+        MAZE_ECS_TAGS(MAZE_HS("default")),
         {},
+        MAZE_ECS_NONE,
+        MAZE_ECS_WRITES(SinMovement3D, Transform3D),
         UpdateEvent const& _event,
         Entity* _entity,
         SinMovement3D* _sinMovement,
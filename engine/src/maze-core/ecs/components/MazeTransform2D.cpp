@@ -97,7 +97,7 @@ namespace Maze
 
         Transform2D* transform2D = static_cast<Transform2D*>(_component);
         m_flags = transform2D->m_flags;
-        m_flags |= (Flags::LocalTransformDirty | Flags::LocalTransformChangedCurrentFrame);
+        m_flags |= (Flags::LocalTransformDirty | Flags::LocalTransformChangedCurrentFrame | Flags::WorldAABBDirty);
 
         for (Size i = 0, in = transform2D->m_children.size(); i < in; ++i)
         {
@@ -291,7 +291,7 @@ namespace Maze
             m_size);
 
         m_flags &= ~Flags::LocalTransformDirty;
-        m_flags |= Flags::WorldTransformDirty;
+        m_flags |= (Flags::WorldTransformDirty | Flags::WorldAABBDirty);
 
         return m_localTransform;
     }
@@ -660,9 +660,11 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(Transform2DPreUpdate,
+    COMPONENT_SYSTEM_EVENT_HANDLER_RW(Transform2DPreUpdate,
         {},
         {},
+        MAZE_ECS_NONE,
+        MAZE_ECS_WRITES(Transform2D),
         PreUpdateEvent const& _event,
         Entity* _entity,
         Transform2D* _transform2D)
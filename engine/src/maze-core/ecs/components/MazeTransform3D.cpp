@@ -29,6 +29,7 @@
 #include "maze-core/ecs/MazeEntity.hpp"
 #include "maze-core/ecs/MazeEcsWorld.hpp"
 #include "maze-core/ecs/MazeComponentSystemHolder.hpp"
+#include "maze-core/ecs/MazeTransform3DHierarchy.hpp"
 
 
 //////////////////////////////////////////
@@ -55,6 +56,9 @@ namespace Maze
     //////////////////////////////////////////
     Transform3D::~Transform3D()
     {
+        if (m_hierarchy)
+            m_hierarchy->removeTransform(this);
+
         while (!m_children.empty())
             m_children.front()->setParent(Transform3DPtr());
     }
@@ -271,6 +275,9 @@ namespace Maze
         
         m_parent = _parent;
 
+        if (m_hierarchy)
+            m_hierarchy->invalidateOrder();
+
         m_flags |= ParentChangedCurrentFrame;
 
         dirtyWorldTransform(
@@ -467,6 +474,32 @@ namespace Maze
             _transform3D->getEntityRaw()->setDisabledByHierarchy(true);
     }
 
+    //////////////////////////////////////////
+    COMPONENT_SYSTEM_EVENT_HANDLER_EX(Transform3DHierarchyAdd,
+        {},
+        {},
+        (U8)EntitiesSampleFlags::IncludeInactive,
+        EntityAddedToSampleEvent const& _event,
+        Entity* _entity,
+        Transform3D* _transform3D)
+    {
+        if (_entity->getEcsWorld() && _entity->getEcsWorld()->getTransform3DHierarchy())
+            _entity->getEcsWorld()->getTransform3DHierarchy()->addTransform(_transform3D);
+    }
+
+    //////////////////////////////////////////
+    COMPONENT_SYSTEM_EVENT_HANDLER_EX(Transform3DHierarchyRemove,
+        {},
+        {},
+        (U8)EntitiesSampleFlags::IncludeInactive,
+        EntityRemovedFromSampleEvent const& _event,
+        Entity* _entity,
+        Transform3D* _transform3D)
+    {
+        if (_transform3D && _transform3D->getHierarchy())
+            _transform3D->getHierarchy()->removeTransform(_transform3D);
+    }
+
     //////////////////////////////////////////
     COMPONENT_SYSTEM_EVENT_HANDLER(Transform3DActiveChangedEvent,
         {},
@@ -480,9 +513,13 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(Transform3DPreUpdate,
+    // Only own flags are changed, so the transforms are processed on the job system workers
+    COMPONENT_SYSTEM_EVENT_HANDLER_RW_EX(Transform3DPreUpdate,
         {},
         {},
+        (U8)EntitiesSampleFlags::ProcessEventsParallel,
+        MAZE_ECS_NONE,
+        MAZE_ECS_WRITES(Transform3D),
         PreUpdateEvent const& _event,
         Entity* _entity,
         Transform3D* _transform3D)
@@ -32,6 +32,8 @@
 #include "maze-core/assets/MazeAssetFile.hpp"
 #include "maze-core/assets/MazeAssetUnitEntityPrefab.hpp"
 #include "maze-core/managers/MazeEntityManager.hpp"
+#include "maze-core/ecs/MazeEntity.hpp"
+#include "maze-core/ecs/MazeEcsWorld.hpp"
 #include "maze-core/helpers/MazeFileHelper.hpp"
 
 
@@ -281,10 +283,42 @@ namespace Maze
         EntityCopyData copyData;
         copyData.setWorld(_world);
         copyData.setScene(_scene);
+        copyData.setBatchWorldInsertion(true);
 
         return _entity->createCopy(copyData);
     }
 
+    //////////////////////////////////////////
+    Vector<EntityPtr> EntityPrefabManager::instantiatePrefabs(
+        EntityPtr const& _entity,
+        S32 _count,
+        EcsWorld* _world,
+        EcsScene* _scene)
+    {
+        Vector<EntityPtr> entities;
+        if (!_entity || !_world || _count <= 0)
+            return entities;
+
+        bool batch = _world->beginEntitiesBatch();
+
+        entities.reserve(_count);
+        for (S32 i = 0; i < _count; ++i)
+        {
+            EntityCopyData copyData;
+            copyData.setWorld(_world);
+            copyData.setScene(_scene);
+
+            EntityPtr entity = _entity->createCopy(copyData);
+            if (entity)
+                entities.emplace_back(eastl::move(entity));
+        }
+
+        if (batch)
+            _world->endEntitiesBatch();
+
+        return entities;
+    }
+
     //////////////////////////////////////////
     EntityPtr EntityPrefabManager::instantiatePrefab(
         HashedCString _name,
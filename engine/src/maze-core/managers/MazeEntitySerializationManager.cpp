@@ -35,6 +35,7 @@
 #include "maze-core/managers/MazeInputManager.hpp"
 #include "maze-core/managers/MazeEntityPrefabManager.hpp"
 #include "maze-core/managers/MazeAssetUnitManager.hpp"
+#include "maze-core/managers/MazeUpdateManager.hpp"
 #include "maze-core/ecs/components/MazeTransform2D.hpp"
 #include "maze-core/ecs/components/MazeTransform3D.hpp"
 #include "maze-core/ecs/helpers/MazeEcsHelper.inl"
@@ -78,7 +79,13 @@ namespace Maze
     {
         s_instance = nullptr;
 
-        
+        AssetManager::s_eventAssetManagerInitialized.unsubscribe(this);
+
+        if (AssetManager::GetInstancePtr())
+        {
+            AssetManager::GetInstancePtr()->eventAssetFileRemoved.unsubscribe(this);
+            AssetManager::GetInstancePtr()->eventAssetFileMoved.unsubscribe(this);
+        }
     }
 
     //////////////////////////////////////////
@@ -90,9 +97,65 @@ namespace Maze
     //////////////////////////////////////////
     bool EntitySerializationManager::init()
     {
+        if (AssetManager::GetInstancePtr())
+            subscribeAssetManager();
+        else
+            AssetManager::s_eventAssetManagerInitialized.subscribe(this, &EntitySerializationManager::notifyAssetManagerInitialized);
+
         return true;
     }
 
+    //////////////////////////////////////////
+    void EntitySerializationManager::subscribeAssetManager()
+    {
+        AssetManager::GetInstancePtr()->eventAssetFileRemoved.subscribe(this, &EntitySerializationManager::notifyAssetFileRemoved);
+        AssetManager::GetInstancePtr()->eventAssetFileMoved.subscribe(this, &EntitySerializationManager::notifyAssetFileMoved);
+    }
+
+    //////////////////////////////////////////
+    void EntitySerializationManager::notifyAssetManagerInitialized()
+    {
+        subscribeAssetManager();
+    }
+
+    //////////////////////////////////////////
+    void EntitySerializationManager::notifyAssetFileRemoved(AssetFilePtr const& _assetFile)
+    {
+        MAZE_MUTEX_SCOPED_LOCK(m_prefabDataBlocksCacheMutex);
+        m_prefabDataBlocksCache.erase(_assetFile->getFullPath());
+    }
+
+    //////////////////////////////////////////
+    void EntitySerializationManager::notifyAssetFileMoved(AssetFilePtr const& _assetFile, Path const& _prevFullPath)
+    {
+        MAZE_MUTEX_SCOPED_LOCK(m_prefabDataBlocksCacheMutex);
+        m_prefabDataBlocksCache.erase(_prevFullPath);
+    }
+
+    //////////////////////////////////////////
+    void EntitySerializationManager::clearPrefabDataBlocksCache() const
+    {
+        MAZE_MUTEX_SCOPED_LOCK(m_prefabDataBlocksCacheMutex);
+        m_prefabDataBlocksCache.clear();
+    }
+
+    //////////////////////////////////////////
+    // The same blocks as restoreDataBlockEcsIds rewrites
+    static bool HasDataBlockEcsIds(DataBlock const& _dataBlock)
+    {
+        for (DataBlock const* subBlock : _dataBlock)
+        {
+            if (StringHelper::IsEndsWith(subBlock->getName().str, ":EntityId") ||
+                StringHelper::IsEndsWith(subBlock->getName().str, ":Array<EntityId>"))
+                return true;
+
+            if (HasDataBlockEcsIds(*subBlock))
+                return true;
+        }
+
+        return false;
+    }
+
     //////////////////////////////////////////
     void PrepareEntitiesToSerialize(
         Vector<EntitySerializationData>& _entityComponents,
@@ -852,11 +915,56 @@ namespace Maze
         EcsWorld* _world,
         EcsScene* _scene) const
     {
-        DataBlock dataBlock = _assetFile->readAsDataBlock();
+        SharedPtr<DataBlock> dataBlock;
+        bool hasEcsIds = false;
+        {
+            MAZE_MUTEX_SCOPED_LOCK(m_prefabDataBlocksCacheMutex);
+
+            if (m_prefabDataBlocksCache.size() >= c_prefabDataBlocksCacheMaxSize &&
+                m_prefabDataBlocksCache.find(_assetFile->getFullPath()) == m_prefabDataBlocksCache.end())
+            {
+                // Evict the least recently used prefab
+                auto lruIt = m_prefabDataBlocksCache.begin();
+                for (auto it = m_prefabDataBlocksCache.begin(), end = m_prefabDataBlocksCache.end(); it != end; ++it)
+                    if (it->second.lastUseIndex < lruIt->second.lastUseIndex)
+                        lruIt = it;
+                m_prefabDataBlocksCache.erase(lruIt);
+            }
+
+            PrefabDataBlockCacheEntry& cacheEntry = m_prefabDataBlocksCache[_assetFile->getFullPath()];
+            cacheEntry.lastUseIndex = ++m_prefabDataBlocksCacheUseIndex;
+
+            // The file is checked once per frame, not on every instantiation
+            UpdateManager* updateManager = UpdateManager::GetInstancePtr();
+            if (!cacheEntry.dataBlock || !updateManager || cacheEntry.checkFrameIndex != updateManager->getFrameIndex())
+            {
+                FileStats fileStats = _assetFile->getFileStats();
+                if (!cacheEntry.dataBlock ||
+                    cacheEntry.lastChangeTimeUTC != fileStats.getLastChangeTimeUTC() ||
+                    cacheEntry.fileSize != fileStats.fileSize)
+                {
+                    cacheEntry.dataBlock = MakeShared<DataBlock>(_assetFile->readAsDataBlock());
+                    cacheEntry.hasEcsIds = HasDataBlockEcsIds(*cacheEntry.dataBlock);
+                    cacheEntry.lastChangeTimeUTC = fileStats.getLastChangeTimeUTC();
+                    cacheEntry.fileSize = fileStats.fileSize;
+
+                    MAZE_WARNING_IF(cacheEntry.dataBlock->getS32(MAZE_HCS("_version")) == 0, "Invalid prefab with no version!");
+                }
+
+                if (updateManager)
+                    cacheEntry.checkFrameIndex = updateManager->getFrameIndex();
+            }
+
+            dataBlock = cacheEntry.dataBlock;
+            hasEcsIds = cacheEntry.hasEcsIds;
+        }
 
-        MAZE_WARNING_IF(dataBlock.getS32(MAZE_HCS("_version")) == 0, "Invalid prefab with no version!");
+        // Without the ids loadEntities only reads the block
+        if (!hasEcsIds)
+            return loadPrefab(*dataBlock, _world, _scene);
 
-        return loadPrefab(dataBlock, _world, _scene);
+        DataBlock dataBlockCopy = *dataBlock;
+        return loadPrefab(dataBlockCopy, _world, _scene);
     }
 
     //////////////////////////////////////////
@@ -29,6 +29,7 @@
 #include "maze-core/preprocessor/MazePreprocessor_Memory.hpp"
 #include "maze-core/memory/MazeMemory.hpp"
 #include "maze-core/managers/MazeUpdateManager.hpp"
+#include "maze-core/data/MazeDataBlock.hpp"
 
 
 //////////////////////////////////////////
@@ -53,6 +54,7 @@ namespace Maze
     TaskManager::~TaskManager()
     {
         shutdownBackgroundThread();
+        m_jobSystem.shutdown();
 
         s_instance = nullptr;
     }
@@ -71,6 +73,11 @@ namespace Maze
         s_mainThreadId = std::this_thread::get_id();
         UpdateManager::GetInstancePtr()->addUpdatable(this);
 
+        if (!m_jobSystem.init(
+            _config.getS32(MAZE_HCS("jobWorkersCount"), -1),
+            (U32)_config.getS32(MAZE_HCS("jobsPageSize"), 4096)))
+            return false;
+
         return true;
     }
 
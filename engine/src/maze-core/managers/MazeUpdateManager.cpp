@@ -105,6 +105,7 @@ namespace Maze
         m_deltaTime = scaledDeltaTime;
 
         m_appTime += scaledDeltaTime;
+        ++m_frameIndex;
 
         Updater::processUpdate(scaledDeltaTime);
     }
@@ -0,0 +1,414 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeCoreHeader.hpp"
+#include "maze-core/math/MazeDynamicAABBTree3D.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class DynamicAABBTree3D
+    //
+    //////////////////////////////////////////
+    DynamicAABBTree3D::DynamicAABBTree3D(F32 _fatMargin)
+        : m_fatMargin(_fatMargin)
+    {
+    }
+
+    //////////////////////////////////////////
+    S32 DynamicAABBTree3D::createProxy(AABB3D const& _aabb, void* _userData)
+    {
+        S32 proxyId = allocateNode();
+
+        Node& node = m_nodes[proxyId];
+        node.aabb = calculateFatAABB(_aabb);
+        node.userData = _userData;
+        node.height = 0;
+
+        insertLeaf(proxyId);
+        ++m_proxiesCount;
+
+        return proxyId;
+    }
+
+    //////////////////////////////////////////
+    void DynamicAABBTree3D::destroyProxy(S32 _proxyId)
+    {
+        MAZE_DEBUG_ASSERT(_proxyId >= 0 && _proxyId < (S32)m_nodes.size());
+        MAZE_DEBUG_ASSERT(m_nodes[_proxyId].isLeaf());
+
+        removeLeaf(_proxyId);
+        freeNode(_proxyId);
+        --m_proxiesCount;
+    }
+
+    //////////////////////////////////////////
+    bool DynamicAABBTree3D::moveProxy(S32 _proxyId, AABB3D const& _aabb)
+    {
+        MAZE_DEBUG_ASSERT(_proxyId >= 0 && _proxyId < (S32)m_nodes.size());
+        MAZE_DEBUG_ASSERT(m_nodes[_proxyId].isLeaf());
+
+        AABB3D const& treeAABB = m_nodes[_proxyId].aabb;
+        if (treeAABB.contains(_aabb))
+        {
+            // The fat AABB is also rebuilt when the object has shrunk noticeably,
+            // otherwise it would keep failing the culling tests with a stale size
+            AABB3D hugeAABB(
+                _aabb.getMin() - Vec3F(4.0f * m_fatMargin),
+                _aabb.getMax() + Vec3F(4.0f * m_fatMargin));
+            if (hugeAABB.contains(treeAABB))
+                return false;
+        }
+
+        removeLeaf(_proxyId);
+        m_nodes[_proxyId].aabb = calculateFatAABB(_aabb);
+        insertLeaf(_proxyId);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void DynamicAABBTree3D::clear()
+    {
+        m_nodes.clear();
+        m_root = c_nullNode;
+        m_freeList = c_nullNode;
+        m_proxiesCount = 0;
+    }
+
+    //////////////////////////////////////////
+    S32 DynamicAABBTree3D::allocateNode()
+    {
+        if (m_freeList == c_nullNode)
+        {
+            S32 nodesCount = (S32)m_nodes.size();
+            S32 newNodesCount = Math::Max(16, nodesCount * 2);
+            m_nodes.resize(newNodesCount);
+
+            for (S32 i = nodesCount; i < newNodesCount - 1; ++i)
+            {
+                m_nodes[i].parent = i + 1;
+                m_nodes[i].height = -1;
+            }
+            m_nodes[newNodesCount - 1].parent = c_nullNode;
+            m_nodes[newNodesCount - 1].height = -1;
+
+            m_freeList = nodesCount;
+        }
+
+        S32 nodeId = m_freeList;
+        Node& node = m_nodes[nodeId];
+        m_freeList = node.parent;
+        node.parent = c_nullNode;
+        node.child1 = c_nullNode;
+        node.child2 = c_nullNode;
+        node.height = 0;
+        node.userData = nullptr;
+
+        return nodeId;
+    }
+
+    //////////////////////////////////////////
+    void DynamicAABBTree3D::freeNode(S32 _nodeId)
+    {
+        Node& node = m_nodes[_nodeId];
+        node.parent = m_freeList;
+        node.child1 = c_nullNode;
+        node.child2 = c_nullNode;
+        node.height = -1;
+        node.userData = nullptr;
+        m_freeList = _nodeId;
+    }
+
+    //////////////////////////////////////////
+    void DynamicAABBTree3D::insertLeaf(S32 _leaf)
+    {
+        if (m_root == c_nullNode)
+        {
+            m_root = _leaf;
+            m_nodes[m_root].parent = c_nullNode;
+            return;
+        }
+
+        // Find the best sibling using the surface area heuristic
+        AABB3D leafAABB = m_nodes[_leaf].aabb;
+        S32 index = m_root;
+        while (!m_nodes[index].isLeaf())
+        {
+            Node const& node = m_nodes[index];
+            S32 child1 = node.child1;
+            S32 child2 = node.child2;
+
+            F32 area = node.aabb.getSurfaceArea();
+            F32 combinedArea = node.aabb.unionCopy(leafAABB).getSurfaceArea();
+
+            // Cost of creating a new parent for this node and the new leaf
+            F32 cost = 2.0f * combinedArea;
+
+            // Minimum cost of pushing the leaf further down the tree
+            F32 inheritanceCost = 2.0f * (combinedArea - area);
+
+            auto calculateDescendCost =
+                [&](S32 _childId)
+                {
+                    Node const& child = m_nodes[_childId];
+                    F32 childCombinedArea = child.aabb.unionCopy(leafAABB).getSurfaceArea();
+                    if (child.isLeaf())
+                        return childCombinedArea + inheritanceCost;
+
+                    return (childCombinedArea - child.aabb.getSurfaceArea()) + inheritanceCost;
+                };
+
+            F32 cost1 = calculateDescendCost(child1);
+            F32 cost2 = calculateDescendCost(child2);
+
+            if (cost < cost1 && cost < cost2)
+                break;
+
+            index = (cost1 < cost2) ? child1 : child2;
+        }
+
+        S32 sibling = index;
+
+        // Create a new parent. Node references are not valid after the allocation
+        S32 oldParent = m_nodes[sibling].parent;
+        S32 newParent = allocateNode();
+
+        Node& newParentNode = m_nodes[newParent];
+        newParentNode.parent = oldParent;
+        newParentNode.userData = nullptr;
+        newParentNode.aabb = m_nodes[sibling].aabb.unionCopy(leafAABB);
+        newParentNode.height = m_nodes[sibling].height + 1;
+        newParentNode.child1 = sibling;
+        newParentNode.child2 = _leaf;
+
+        if (oldParent != c_nullNode)
+        {
+            if (m_nodes[oldParent].child1 == sibling)
+                m_nodes[oldParent].child1 = newParent;
+            else
+                m_nodes[oldParent].child2 = newParent;
+        }
+        else
+        {
+            m_root = newParent;
+        }
+
+        m_nodes[sibling].parent = newParent;
+        m_nodes[_leaf].parent = newParent;
+
+        refitAncestors(m_nodes[_leaf].parent);
+    }
+
+    //////////////////////////////////////////
+    void DynamicAABBTree3D::removeLeaf(S32 _leaf)
+    {
+        if (_leaf == m_root)
+        {
+            m_root = c_nullNode;
+            return;
+        }
+
+        S32 parent = m_nodes[_leaf].parent;
+        S32 grandParent = m_nodes[parent].parent;
+        S32 sibling = (m_nodes[parent].child1 == _leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        if (grandParent != c_nullNode)
+        {
+            // Destroy the parent and connect the sibling to the grand parent
+            if (m_nodes[grandParent].child1 == parent)
+                m_nodes[grandParent].child1 = sibling;
+            else
+                m_nodes[grandParent].child2 = sibling;
+
+            m_nodes[sibling].parent = grandParent;
+            freeNode(parent);
+
+            refitAncestors(grandParent);
+        }
+        else
+        {
+            m_root = sibling;
+            m_nodes[sibling].parent = c_nullNode;
+            freeNode(parent);
+        }
+
+        m_nodes[_leaf].parent = c_nullNode;
+    }
+
+    //////////////////////////////////////////
+    void DynamicAABBTree3D::refitAncestors(S32 _nodeId)
+    {
+        S32 index = _nodeId;
+        while (index != c_nullNode)
+        {
+            index = balance(index);
+
+            Node& node = m_nodes[index];
+            Node const& child1 = m_nodes[node.child1];
+            Node const& child2 = m_nodes[node.child2];
+
+            node.height = 1 + Math::Max(child1.height, child2.height);
+            node.aabb = child1.aabb.unionCopy(child2.aabb);
+
+            index = node.parent;
+        }
+    }
+
+    //////////////////////////////////////////
+    S32 DynamicAABBTree3D::balance(S32 _nodeId)
+    {
+        S32 iA = _nodeId;
+        Node& a = m_nodes[iA];
+        if (a.isLeaf() || a.height < 2)
+            return iA;
+
+        S32 iB = a.child1;
+        S32 iC = a.child2;
+        Node& b = m_nodes[iB];
+        Node& c = m_nodes[iC];
+
+        S32 heightDelta = c.height - b.height;
+
+        // Rotate C up
+        if (heightDelta > 1)
+        {
+            S32 iF = c.child1;
+            S32 iG = c.child2;
+            Node& f = m_nodes[iF];
+            Node& g = m_nodes[iG];
+
+            // Swap A and C
+            c.child1 = iA;
+            c.parent = a.parent;
+            a.parent = iC;
+
+            if (c.parent != c_nullNode)
+            {
+                if (m_nodes[c.parent].child1 == iA)
+                    m_nodes[c.parent].child1 = iC;
+                else
+                    m_nodes[c.parent].child2 = iC;
+            }
+            else
+            {
+                m_root = iC;
+            }
+
+            // Rotate
+            if (f.height > g.height)
+            {
+                c.child2 = iF;
+                a.child2 = iG;
+                g.parent = iA;
+                a.aabb = b.aabb.unionCopy(g.aabb);
+                c.aabb = a.aabb.unionCopy(f.aabb);
+
+                a.height = 1 + Math::Max(b.height, g.height);
+                c.height = 1 + Math::Max(a.height, f.height);
+            }
+            else
+            {
+                c.child2 = iG;
+                a.child2 = iF;
+                f.parent = iA;
+                a.aabb = b.aabb.unionCopy(f.aabb);
+                c.aabb = a.aabb.unionCopy(g.aabb);
+
+                a.height = 1 + Math::Max(b.height, f.height);
+                c.height = 1 + Math::Max(a.height, g.height);
+            }
+
+            return iC;
+        }
+
+        // Rotate B up
+        if (heightDelta < -1)
+        {
+            S32 iD = b.child1;
+            S32 iE = b.child2;
+            Node& d = m_nodes[iD];
+            Node& e = m_nodes[iE];
+
+            // Swap A and B
+            b.child1 = iA;
+            b.parent = a.parent;
+            a.parent = iB;
+
+            if (b.parent != c_nullNode)
+            {
+                if (m_nodes[b.parent].child1 == iA)
+                    m_nodes[b.parent].child1 = iB;
+                else
+                    m_nodes[b.parent].child2 = iB;
+            }
+            else
+            {
+                m_root = iB;
+            }
+
+            // Rotate
+            if (d.height > e.height)
+            {
+                b.child2 = iD;
+                a.child1 = iE;
+                e.parent = iA;
+                a.aabb = c.aabb.unionCopy(e.aabb);
+                b.aabb = a.aabb.unionCopy(d.aabb);
+
+                a.height = 1 + Math::Max(c.height, e.height);
+                b.height = 1 + Math::Max(a.height, d.height);
+            }
+            else
+            {
+                b.child2 = iE;
+                a.child1 = iD;
+                d.parent = iA;
+                a.aabb = c.aabb.unionCopy(d.aabb);
+                b.aabb = a.aabb.unionCopy(e.aabb);
+
+                a.height = 1 + Math::Max(c.height, d.height);
+                b.height = 1 + Math::Max(a.height, e.height);
+            }
+
+            return iB;
+        }
+
+        return iA;
+    }
+
+    //////////////////////////////////////////
+    AABB3D DynamicAABBTree3D::calculateFatAABB(AABB3D const& _aabb) const
+    {
+        Vec3F margin(m_fatMargin);
+        return AABB3D(_aabb.getMin() - margin, _aabb.getMax() + margin);
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,190 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeCoreHeader.hpp"
+#include "maze-core/memory/MazeFrameArena.hpp"
+#include "maze-core/memory/MazeNedMemoryAllocator.hpp"
+#include "maze-core/math/MazeMath.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class LinearArena
+    //
+    //////////////////////////////////////////
+    LinearArena::LinearArena(Size _chunkSize)
+        : m_chunkSize(_chunkSize)
+    {
+    }
+
+    //////////////////////////////////////////
+    LinearArena::~LinearArena()
+    {
+        freeChunks();
+    }
+
+    //////////////////////////////////////////
+    void* LinearArena::allocate(Size _size, Size _alignment)
+    {
+        MAZE_DEBUG_ASSERT(_alignment > 0u && _alignment <= c_maxAlignment && (_alignment & (_alignment - 1u)) == 0u);
+
+        if (_size == 0u)
+            _size = 1u;
+
+        for (;;)
+        {
+            Chunk* chunk = m_currentChunk.load(std::memory_order_acquire);
+            if (chunk)
+            {
+                Size offset = chunk->offset.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Size alignedOffset = Math::Align(offset, _alignment);
+                    Size newOffset = alignedOffset + _size;
+                    if (newOffset > chunk->capacity)
+                        break;
+
+                    if (chunk->offset.compare_exchange_weak(offset, newOffset, std::memory_order_relaxed))
+                        return chunk->data + alignedOffset;
+                }
+            }
+
+            MAZE_MUTEX_SCOPED_LOCK(m_chunksMutex);
+
+            // Another thread has already added a new chunk
+            if (m_currentChunk.load(std::memory_order_relaxed) != chunk)
+                continue;
+
+            Size capacity = Math::Max(m_chunkSize, Math::Align(_size, c_maxAlignment));
+            if (!addChunk(capacity))
+                return nullptr;
+        }
+    }
+
+    //////////////////////////////////////////
+    void LinearArena::reset()
+    {
+        m_peakUsedSize = Math::Max(m_peakUsedSize, getUsedSize());
+
+        if (m_chunks.size() > 1u)
+        {
+            Size capacity = getCapacity();
+            freeChunks();
+            addChunk(capacity);
+        }
+        else
+        if (!m_chunks.empty())
+        {
+            m_chunks.front()->offset.store(0u, std::memory_order_relaxed);
+        }
+    }
+
+    //////////////////////////////////////////
+    void LinearArena::release()
+    {
+        freeChunks();
+    }
+
+    //////////////////////////////////////////
+    Size LinearArena::getUsedSize() const
+    {
+        Size result = 0u;
+        for (Chunk const* chunk : m_chunks)
+            result += chunk->offset.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    //////////////////////////////////////////
+    Size LinearArena::getCapacity() const
+    {
+        Size result = 0u;
+        for (Chunk const* chunk : m_chunks)
+            result += chunk->capacity;
+        return result;
+    }
+
+    //////////////////////////////////////////
+    LinearArena::Chunk* LinearArena::addChunk(Size _capacity)
+    {
+        // Header and data share one allocation
+        Size headerSize = Math::Align(sizeof(Chunk), c_maxAlignment);
+        U8* memory = static_cast<U8*>(NedMemoryAllocator::AllocateBytesAligned(c_maxAlignment, headerSize + _capacity));
+        MAZE_ERROR_RETURN_VALUE_IF(!memory, nullptr, "Failed to allocate arena chunk of %u bytes!", (U32)_capacity);
+
+        Chunk* chunk = ::new (memory) Chunk();
+        chunk->data = memory + headerSize;
+        chunk->capacity = _capacity;
+        m_chunks.push_back(chunk);
+
+        m_currentChunk.store(chunk, std::memory_order_release);
+        return chunk;
+    }
+
+    //////////////////////////////////////////
+    void LinearArena::freeChunks()
+    {
+        m_currentChunk.store(nullptr, std::memory_order_relaxed);
+
+        for (Chunk* chunk : m_chunks)
+        {
+            chunk->~Chunk();
+            NedMemoryAllocator::DeallocateBytesAligned(c_maxAlignment, chunk);
+        }
+        m_chunks.clear();
+    }
+
+
+    //////////////////////////////////////////
+    // Class FrameArena
+    //
+    //////////////////////////////////////////
+    FrameArena::FrameArena(Size _chunkSize)
+    {
+        m_arenas[0].setChunkSize(_chunkSize);
+        m_arenas[1].setChunkSize(_chunkSize);
+    }
+
+    //////////////////////////////////////////
+    void FrameArena::swap()
+    {
+        m_currentArenaIndex ^= 1u;
+        m_arenas[m_currentArenaIndex].reset();
+        ++m_frameIndex;
+    }
+
+    //////////////////////////////////////////
+    void FrameArena::release()
+    {
+        m_arenas[0].release();
+        m_arenas[1].release();
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
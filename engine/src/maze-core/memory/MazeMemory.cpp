@@ -60,8 +60,18 @@ namespace Maze
         U64 totalMemoryAllocationSize = 0;
         for (MemoryAllocatorBase* allocator : memoryAllocators)
         {
-            totalMemoryAllocationSize += allocator->getAllocatedMemorySize();
-            result += StdString(allocator->getName()) + " -> " + StringHelper::F32ToStringFormatted((F32)allocator->getAllocatedMemorySize() / (1024*1024)).c_str() + " MB\n";
+            MemoryAllocatorStats stats = allocator->getStats();
+            totalMemoryAllocationSize += stats.allocatedMemorySize;
+            result += StdString(allocator->getName()) + " -> " + StringHelper::F32ToStringFormatted((F32)stats.allocatedMemorySize / (1024*1024)).c_str() + " MB";
+            if (stats.blockSize > 0u)
+            {
+                result += StdString(" (pages: ") + StringHelper::ToString((U32)stats.pagesCount).c_str() +
+                    ", peak: " + StringHelper::ToString((U32)stats.peakPagesCount).c_str() +
+                    ", used blocks: " + StringHelper::ToString((U32)stats.usedBlocksCount).c_str() +
+                    ", free blocks: " + StringHelper::ToString((U32)stats.freeBlocksCount).c_str() +
+                    ", cached blocks: " + StringHelper::ToString((U32)stats.cachedBlocksCount).c_str() + ")";
+            }
+            result += "\n";
         }
 
         result += (StdString)"TOTAL ALLOCATED MEMORY SIZE: " + StringHelper::ToString(totalMemoryAllocationSize).c_str() + "(" + StringHelper::ToString((F64)totalMemoryAllocationSize/(1024.0f*1024.0f)).c_str() + "MB)";
@@ -69,6 +79,16 @@ namespace Maze
         return result;
     }
 
+    //////////////////////////////////////////
+    MAZE_CORE_API Size TrimMemoryAllocators()
+    {
+        Size releasedSize = 0u;
+        for (MemoryAllocatorBase* allocator : s_memoryAllocators)
+            releasedSize += allocator->trim();
+
+        return releasedSize;
+    }
+
 
 } // namespace Maze
 //////////////////////////////////////////
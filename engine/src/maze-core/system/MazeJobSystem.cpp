@@ -0,0 +1,474 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+//////////////////////////////////////////
+#include "MazeCoreHeader.hpp"
+#include "maze-core/system/MazeJobSystem.hpp"
+#include "maze-core/helpers/MazeLogHelper.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    static MAZE_THREAD_LOCAL S32 s_currentWorkerIndex = -1;
+
+    //////////////////////////////////////////
+    static S32 const c_workerSpinCount = 64;
+
+
+    //////////////////////////////////////////
+    // Class JobWorkStealingQueue
+    //
+    //////////////////////////////////////////
+    void JobWorkStealingQueue::init(U32 _capacity)
+    {
+        MAZE_DEBUG_ASSERT((_capacity & (_capacity - 1)) == 0);
+
+        m_buffer.reset(new std::atomic<U32>[_capacity]);
+        m_mask = S64(_capacity) - 1;
+        m_top.store(0, std::memory_order_relaxed);
+        m_bottom.store(0, std::memory_order_relaxed);
+    }
+
+    //////////////////////////////////////////
+    bool JobWorkStealingQueue::push(U32 _jobIndex)
+    {
+        S64 bottom = m_bottom.load(std::memory_order_relaxed);
+        S64 top = m_top.load(std::memory_order_acquire);
+        if (bottom - top > m_mask)
+            return false;
+
+        m_buffer[bottom & m_mask].store(_jobIndex, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool JobWorkStealingQueue::pop(U32& _outJobIndex)
+    {
+        S64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        S64 top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        _outJobIndex = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top != bottom)
+            return true;
+
+        // The last element - race with thieves
+        bool result = m_top.compare_exchange_strong(
+            top,
+            top + 1,
+            std::memory_order_seq_cst,
+            std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return result;
+    }
+
+    //////////////////////////////////////////
+    bool JobWorkStealingQueue::steal(U32& _outJobIndex)
+    {
+        S64 top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        S64 bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+            return false;
+
+        _outJobIndex = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+        return m_top.compare_exchange_strong(
+            top,
+            top + 1,
+            std::memory_order_seq_cst,
+            std::memory_order_relaxed);
+    }
+
+
+    //////////////////////////////////////////
+    // Class JobSystem
+    //
+    //////////////////////////////////////////
+    JobSystem::JobSystem()
+    {
+    }
+
+    //////////////////////////////////////////
+    JobSystem::~JobSystem()
+    {
+        shutdown();
+    }
+
+    //////////////////////////////////////////
+    bool JobSystem::init(
+        S32 _workersCount,
+        U32 _jobsPageSize)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(m_jobPagesCount > 0, false, "JobSystem is already initialized!");
+
+        if (_workersCount < 0)
+            _workersCount = Math::Max((S32)std::thread::hardware_concurrency() - 1, 0);
+
+#if (MAZE_PLATFORM == MAZE_PLATFORM_EMSCRIPTEN)
+        _workersCount = 0;
+#endif
+
+        m_jobsPageShift = 0;
+        while ((1u << m_jobsPageShift) < Math::Max(_jobsPageSize, 1u))
+            ++m_jobsPageShift;
+        m_jobsPageMask = (1u << m_jobsPageShift) - 1u;
+
+        m_freeJobsHead.store(U64(JobHandle::c_invalidIndex), std::memory_order_relaxed);
+        if (!addJobsPage())
+            return false;
+
+        m_workersCount = _workersCount;
+        m_queues.reset(new JobWorkStealingQueue[m_workersCount + 1]);
+        for (S32 i = 0; i < m_workersCount + 1; ++i)
+            m_queues[i].init(m_jobsPageMask + 1u);
+
+        m_shutdown.store(false);
+        s_currentWorkerIndex = 0;
+
+        m_workerThreads.reserve(m_workersCount);
+        for (S32 i = 1; i <= m_workersCount; ++i)
+            m_workerThreads.emplace_back(&JobSystem::workerThreadEntry, this, i);
+
+        Debug::Log("JobSystem initialized with %d workers.", m_workersCount);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void JobSystem::shutdown()
+    {
+        if (m_jobPagesCount == 0)
+            return;
+
+        // Drain the queues, so nobody waits for a job that will never run
+        while (executeNextJob(GetCurrentWorkerIndex())) {}
+
+        {
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_shutdown.store(true);
+        }
+        m_sleepCondVar.notify_all();
+
+        for (std::thread& workerThread : m_workerThreads)
+            if (workerThread.joinable())
+                workerThread.join();
+        m_workerThreads.clear();
+
+        if (s_currentWorkerIndex == 0)
+            s_currentWorkerIndex = -1;
+
+        m_queues.reset();
+        for (U32 i = 0; i < m_jobPagesCount; ++i)
+        {
+            delete[] m_jobPages[i];
+            m_jobPages[i] = nullptr;
+        }
+        m_jobPagesCount = 0;
+        m_workersCount = 0;
+    }
+
+    //////////////////////////////////////////
+    S32 JobSystem::GetCurrentWorkerIndex()
+    {
+        return s_currentWorkerIndex;
+    }
+
+    //////////////////////////////////////////
+    U32 JobSystem::allocateJob()
+    {
+        for (;;)
+        {
+            U64 head = m_freeJobsHead.load(std::memory_order_acquire);
+            U32 index = U32(head & 0xFFFFFFFFu);
+            if (index == JobHandle::c_invalidIndex)
+            {
+                // Pool is exhausted - grow it, or help to finish something if the limit is reached
+                if (!addJobsPage() && !executeNextJob(GetCurrentWorkerIndex()))
+                    std::this_thread::yield();
+                continue;
+            }
+
+            U32 next = getJob(index).nextFree.load(std::memory_order_relaxed);
+            U64 newHead = (((head >> 32) + 1) << 32) | U64(next);
+            if (m_freeJobsHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return index;
+        }
+    }
+
+    //////////////////////////////////////////
+    bool JobSystem::addJobsPage()
+    {
+        MAZE_MUTEX_SCOPED_LOCK(m_jobPagesMutex);
+
+        // Someone has already refilled the pool
+        if (U32(m_freeJobsHead.load(std::memory_order_acquire) & 0xFFFFFFFFu) != JobHandle::c_invalidIndex)
+            return true;
+
+        MAZE_WARNING_RETURN_VALUE_IF(m_jobPagesCount == c_jobPagesMax, false, "Jobs pool limit is reached!");
+
+        U32 pageSize = m_jobsPageMask + 1u;
+        m_jobPages[m_jobPagesCount] = new Job[pageSize];
+        U32 firstIndex = m_jobPagesCount << m_jobsPageShift;
+        ++m_jobPagesCount;
+
+        for (U32 i = pageSize; i > 0; --i)
+            releaseJob(firstIndex + i - 1);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    JobHandle JobSystem::initJob(U32 _index, JobHandle _parent)
+    {
+        Job& job = getJob(_index);
+        job.unfinishedJobs.store(1, std::memory_order_relaxed);
+        job.parentIndex = JobHandle::c_invalidIndex;
+
+        if (_parent.isValid())
+        {
+            if (addChildJob(_parent))
+                job.parentIndex = _parent.index;
+            else
+                MAZE_ERROR("Child job can not be added - the parent job is already completed!");
+        }
+
+        JobHandle handle;
+        handle.index = _index;
+        handle.generation = job.generation.load(std::memory_order_relaxed);
+        return handle;
+    }
+
+    //////////////////////////////////////////
+    bool JobSystem::addChildJob(JobHandle _parent)
+    {
+        Job& parent = getJob(_parent.index);
+
+        // Finished job (zero counter) can not be revived
+        S32 unfinishedJobs = parent.unfinishedJobs.load(std::memory_order_acquire);
+        do
+        {
+            if (unfinishedJobs <= 0)
+                return false;
+        }
+        while (!parent.unfinishedJobs.compare_exchange_weak(unfinishedJobs, unfinishedJobs + 1, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        // The slot could be reused by another job - the counter is returned then
+        if (parent.generation.load(std::memory_order_acquire) != _parent.generation)
+        {
+            finishJob(_parent.index);
+            return false;
+        }
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void JobSystem::releaseJob(U32 _index)
+    {
+        for (;;)
+        {
+            U64 head = m_freeJobsHead.load(std::memory_order_relaxed);
+            getJob(_index).nextFree.store(U32(head & 0xFFFFFFFFu), std::memory_order_relaxed);
+            U64 newHead = (((head >> 32) + 1) << 32) | U64(_index);
+            if (m_freeJobsHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed))
+                return;
+        }
+    }
+
+    //////////////////////////////////////////
+    void JobSystem::run(JobHandle _handle)
+    {
+        MAZE_DEBUG_ASSERT(_handle.isValid());
+
+        m_queuedJobsCount.fetch_add(1);
+
+        S32 workerIndex = GetCurrentWorkerIndex();
+        if (workerIndex < 0 || !m_queues[workerIndex].push(_handle.index))
+        {
+            MAZE_MUTEX_SCOPED_LOCK(m_externalQueueMutex);
+            m_externalQueue.push_back(_handle.index);
+            m_externalQueueSize.fetch_add(1, std::memory_order_release);
+        }
+
+        if (m_sleepingWorkersCount.load() > 0)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+            }
+            m_sleepCondVar.notify_one();
+        }
+    }
+
+    //////////////////////////////////////////
+    bool JobSystem::isCompleted(JobHandle _handle) const
+    {
+        if (!_handle.isValid())
+            return true;
+
+        return getJob(_handle.index).generation.load(std::memory_order_acquire) != _handle.generation;
+    }
+
+    //////////////////////////////////////////
+    void JobSystem::wait(JobHandle _handle)
+    {
+        S32 workerIndex = GetCurrentWorkerIndex();
+        while (!isCompleted(_handle))
+        {
+            if (!executeNextJob(workerIndex))
+                std::this_thread::yield();
+        }
+    }
+
+    //////////////////////////////////////////
+    void JobSystem::executeJob(U32 _index)
+    {
+        Job& job = getJob(_index);
+        job.invokeFunction(job.functionStorage);
+        job.destroyFunction(job.functionStorage);
+        job.invokeFunction = nullptr;
+        job.destroyFunction = nullptr;
+
+        finishJob(_index);
+    }
+
+    //////////////////////////////////////////
+    void JobSystem::finishJob(U32 _index)
+    {
+        while (_index != JobHandle::c_invalidIndex)
+        {
+            Job& job = getJob(_index);
+            if (job.unfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+
+            U32 parentIndex = job.parentIndex;
+
+            // Generation change means completion for the all handles of this job
+            job.generation.fetch_add(1, std::memory_order_release);
+            releaseJob(_index);
+
+            _index = parentIndex;
+        }
+    }
+
+    //////////////////////////////////////////
+    bool JobSystem::fetchJob(S32 _workerIndex, U32& _outJobIndex)
+    {
+        if (_workerIndex >= 0 && m_queues[_workerIndex].pop(_outJobIndex))
+            return true;
+
+        if (m_externalQueueSize.load(std::memory_order_acquire) > 0)
+        {
+            MAZE_MUTEX_SCOPED_LOCK(m_externalQueueMutex);
+            if (!m_externalQueue.empty())
+            {
+                _outJobIndex = m_externalQueue.front();
+                m_externalQueue.pop_front();
+                m_externalQueueSize.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        S32 queuesCount = m_workersCount + 1;
+        S32 startIndex = _workerIndex >= 0 ? _workerIndex + 1 : 0;
+        for (S32 i = 0; i < queuesCount; ++i)
+        {
+            S32 victimIndex = (startIndex + i) % queuesCount;
+            if (victimIndex == _workerIndex)
+                continue;
+
+            if (m_queues[victimIndex].steal(_outJobIndex))
+                return true;
+        }
+
+        return false;
+    }
+
+    //////////////////////////////////////////
+    bool JobSystem::executeNextJob(S32 _workerIndex)
+    {
+        U32 jobIndex;
+        if (!fetchJob(_workerIndex, jobIndex))
+            return false;
+
+        m_queuedJobsCount.fetch_sub(1);
+        executeJob(jobIndex);
+        return true;
+    }
+
+    //////////////////////////////////////////
+    S32 JobSystem::calculateGrainSize(S32 _count) const
+    {
+        // Several chunks per thread to balance uneven work
+        S32 chunksCount = (m_workersCount + 1) * 4;
+        return Math::Max(1, (_count + chunksCount - 1) / chunksCount);
+    }
+
+    //////////////////////////////////////////
+    void JobSystem::workerThreadEntry(S32 _workerIndex)
+    {
+        MAZE_PROFILE_THREAD("JobWorker");
+
+        s_currentWorkerIndex = _workerIndex;
+
+        while (!m_shutdown.load(std::memory_order_relaxed))
+        {
+            if (executeNextJob(_workerIndex))
+                continue;
+
+            bool executed = false;
+            for (S32 i = 0; i < c_workerSpinCount && !executed; ++i)
+            {
+                std::this_thread::yield();
+                executed = executeNextJob(_workerIndex);
+            }
+
+            if (executed)
+                continue;
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingWorkersCount.fetch_add(1);
+            m_sleepCondVar.wait(
+                lock,
+                [this]() { return m_shutdown.load() || m_queuedJobsCount.load() > 0; });
+            m_sleepingWorkersCount.fetch_sub(1);
+        }
+
+        s_currentWorkerIndex = -1;
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
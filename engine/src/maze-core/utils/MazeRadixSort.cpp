@@ -0,0 +1,130 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeCoreHeader.hpp"
+#include "maze-core/utils/MazeRadixSort.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class RadixSorter
+    //
+    //////////////////////////////////////////
+    void RadixSorter::sort(Vector<RadixSortKeyIndex>& _items)
+    {
+        MAZE_PROFILE_EVENT("RadixSorter::sort");
+
+        Size count = _items.size();
+        if (count <= c_insertionSortThreshold)
+        {
+            InsertionSort(_items.data(), count);
+            return;
+        }
+
+        // All 8 histograms are built in a single pass over the keys
+        U32 histograms[8][256];
+        memset(histograms, 0, sizeof(histograms));
+
+        RadixSortKeyIndex const* items = _items.data();
+        for (Size i = 0; i < count; ++i)
+        {
+            U64 key = items[i].key;
+            ++histograms[0][(key >>  0) & 0xFF];
+            ++histograms[1][(key >>  8) & 0xFF];
+            ++histograms[2][(key >> 16) & 0xFF];
+            ++histograms[3][(key >> 24) & 0xFF];
+            ++histograms[4][(key >> 32) & 0xFF];
+            ++histograms[5][(key >> 40) & 0xFF];
+            ++histograms[6][(key >> 48) & 0xFF];
+            ++histograms[7][(key >> 56) & 0xFF];
+        }
+
+        m_scratch.resize(count);
+
+        RadixSortKeyIndex* src = _items.data();
+        RadixSortKeyIndex* dst = m_scratch.data();
+        bool sortedInScratch = false;
+
+        U64 firstKey = src[0].key;
+        for (U32 pass = 0; pass < 8; ++pass)
+        {
+            U32 shift = pass * 8;
+            U32* histogram = histograms[pass];
+
+            // Every key has the same byte here - the pass would not change the order
+            if (histogram[(firstKey >> shift) & 0xFF] == (U32)count)
+                continue;
+
+            U32 offset = 0;
+            for (U32 b = 0; b < 256; ++b)
+            {
+                U32 bucketSize = histogram[b];
+                histogram[b] = offset;
+                offset += bucketSize;
+            }
+
+            for (Size i = 0; i < count; ++i)
+            {
+                RadixSortKeyIndex const& item = src[i];
+                dst[histogram[(item.key >> shift) & 0xFF]++] = item;
+            }
+
+            std::swap(src, dst);
+            sortedInScratch = !sortedInScratch;
+        }
+
+        if (sortedInScratch)
+            _items.swap(m_scratch);
+    }
+
+    //////////////////////////////////////////
+    void RadixSorter::clear()
+    {
+        m_scratch.clear();
+        m_scratch.shrink_to_fit();
+    }
+
+    //////////////////////////////////////////
+    void RadixSorter::InsertionSort(RadixSortKeyIndex* _items, Size _count)
+    {
+        for (Size i = 1; i < _count; ++i)
+        {
+            RadixSortKeyIndex item = _items[i];
+
+            Size j = i;
+            for (; j > 0 && _items[j - 1].key > item.key; --j)
+                _items[j] = _items[j - 1];
+
+            _items[j] = item;
+        }
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,366 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeGraphicsHeader.hpp"
+#include "maze-graphics/MazeLightClusterGrid.hpp"
+#include "maze-graphics/MazeTexture2D.hpp"
+#include "maze-graphics/MazeShaderManager.hpp"
+#include "maze-graphics/MazeGlobalShaderUniform.hpp"
+#include "maze-graphics/MazeRenderSystem.hpp"
+#include "maze-core/managers/MazeTaskManager.hpp"
+#include "maze-core/utils/MazeProfiler.hpp"
+#include "maze-core/math/MazeMath.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    static U32 const c_lightsTextureWidth = 64;
+    static U32 const c_gridTextureWidth = 64;
+    static U32 const c_indicesTextureWidth = 256;
+
+    //////////////////////////////////////////
+    // Light ranges are calculated in parallel above this count
+    static S32 const c_parallelLightsCountMin = 64;
+
+
+    //////////////////////////////////////////
+    // Class LightClusterGrid
+    //
+    //////////////////////////////////////////
+    LightClusterGrid::LightClusterGrid()
+    {
+    }
+
+    //////////////////////////////////////////
+    LightClusterGrid::~LightClusterGrid()
+    {
+    }
+
+    //////////////////////////////////////////
+    LightClusterGridPtr LightClusterGrid::Create(RenderSystem* _renderSystem)
+    {
+        LightClusterGridPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(LightClusterGrid, object, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool LightClusterGrid::init(RenderSystem* _renderSystem)
+    {
+        U32 lightsTextureHeight = (MAZE_CLUSTERED_LIGHTS_MAX * 2 + c_lightsTextureWidth - 1) / c_lightsTextureWidth;
+        U32 gridTextureHeight = (c_clustersCount + c_gridTextureWidth - 1) / c_gridTextureWidth;
+        U32 indicesTextureHeight = (MAZE_CLUSTERED_LIGHT_INDICES_MAX + c_indicesTextureWidth - 1) / c_indicesTextureWidth;
+
+        m_lightsTexture = createDataTexture(_renderSystem, c_lightsTextureWidth, lightsTextureHeight, PixelFormat::RGBA_F32);
+        m_gridTexture = createDataTexture(_renderSystem, c_gridTextureWidth, gridTextureHeight, PixelFormat::RG_F32);
+        m_indicesTexture = createDataTexture(_renderSystem, c_indicesTextureWidth, indicesTextureHeight, PixelFormat::R_F32);
+
+        if (!m_lightsTexture || !m_gridTexture || !m_indicesTexture)
+            return false;
+
+        // Whole rows are uploaded, so the data is kept in the texture size
+        m_lightsData.resize((Size)c_lightsTextureWidth * lightsTextureHeight, Vec4F::c_zero);
+        m_gridData.resize((Size)c_gridTextureWidth * gridTextureHeight, Vec2F::c_zero);
+        m_indicesData.resize((Size)c_indicesTextureWidth * indicesTextureHeight, 0.0f);
+
+        m_lightRanges.reserve(MAZE_CLUSTERED_LIGHTS_MAX);
+        m_slices.resize(c_gridSizeZ);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    Texture2DPtr LightClusterGrid::createDataTexture(
+        RenderSystem* _renderSystem,
+        U32 _width,
+        U32 _height,
+        PixelFormat::Enum _pixelFormat)
+    {
+        Texture2DPtr texture = Texture2D::Create(_renderSystem);
+        MAZE_ERROR_RETURN_VALUE_IF(!texture, nullptr, "Texture creation failed!");
+
+        if (!texture->loadEmpty(Vec2U(_width, _height), _pixelFormat))
+            return nullptr;
+
+        texture->setMagFilter(TextureFilter::Nearest);
+        texture->setMinFilter(TextureFilter::Nearest);
+        texture->setWrapS(TextureWrap::ClampToEdge);
+        texture->setWrapT(TextureWrap::ClampToEdge);
+
+        return texture;
+    }
+
+    //////////////////////////////////////////
+    S32 LightClusterGrid::calculateSlice(F32 _viewZ) const
+    {
+        S32 slice = (S32)Math::Floor(Math::Log(Math::Max(_viewZ, m_nearZ)) * m_sliceScale + m_sliceBias);
+        return Math::Clamp(slice, 0, (S32)c_gridSizeZ - 1);
+    }
+
+    //////////////////////////////////////////
+    void LightClusterGrid::calculateClusterRange(
+        TMat const& _viewMatrix,
+        Mat4F const& _projectionMatrix,
+        Vec4F const& _posRadiusWS,
+        ClusterRange& _outRange) const
+    {
+        _outRange.visible = false;
+
+        Vec3F positionVS = _viewMatrix.transform(Vec3F(_posRadiusWS.x, _posRadiusWS.y, _posRadiusWS.z));
+        F32 radius = _posRadiusWS.w;
+
+        F32 minZ = positionVS.z - radius;
+        F32 maxZ = positionVS.z + radius;
+        if (maxZ < m_nearZ || minZ > m_farZ)
+            return;
+
+        minZ = Math::Max(minZ, m_nearZ);
+        maxZ = Math::Min(maxZ, m_farZ);
+
+        // Projection of the view space AABB (clipped by the near plane) contains the sphere projection
+        Vec2F ndcMin(F32_MAX, F32_MAX);
+        Vec2F ndcMax(-F32_MAX, -F32_MAX);
+        for (S32 i = 0; i < 8; ++i)
+        {
+            Vec4F cornerVS(
+                positionVS.x + ((i & 1) ? radius : -radius),
+                positionVS.y + ((i & 2) ? radius : -radius),
+                (i & 4) ? maxZ : minZ,
+                1.0f);
+            Vec4F cornerCS = cornerVS * _projectionMatrix;
+            if (cornerCS.w <= 0.0f)
+                continue;
+
+            Vec2F cornerNDC = Vec2F(cornerCS.x, cornerCS.y) / cornerCS.w;
+            ndcMin.x = Math::Min(ndcMin.x, cornerNDC.x);
+            ndcMin.y = Math::Min(ndcMin.y, cornerNDC.y);
+            ndcMax.x = Math::Max(ndcMax.x, cornerNDC.x);
+            ndcMax.y = Math::Max(ndcMax.y, cornerNDC.y);
+        }
+
+        if (ndcMax.x < -1.0f || ndcMax.y < -1.0f || ndcMin.x > 1.0f || ndcMin.y > 1.0f)
+            return;
+
+        S32 minX = (S32)Math::Floor((ndcMin.x * 0.5f + 0.5f) * c_gridSizeX);
+        S32 maxX = (S32)Math::Floor((ndcMax.x * 0.5f + 0.5f) * c_gridSizeX);
+        S32 minY = (S32)Math::Floor((ndcMin.y * 0.5f + 0.5f) * c_gridSizeY);
+        S32 maxY = (S32)Math::Floor((ndcMax.y * 0.5f + 0.5f) * c_gridSizeY);
+
+        _outRange.minX = (U16)Math::Clamp(minX, 0, (S32)c_gridSizeX - 1);
+        _outRange.maxX = (U16)Math::Clamp(maxX, 0, (S32)c_gridSizeX - 1);
+        _outRange.minY = (U16)Math::Clamp(minY, 0, (S32)c_gridSizeY - 1);
+        _outRange.maxY = (U16)Math::Clamp(maxY, 0, (S32)c_gridSizeY - 1);
+        _outRange.minZ = (U16)calculateSlice(minZ);
+        _outRange.maxZ = (U16)calculateSlice(maxZ);
+        _outRange.visible = true;
+    }
+
+    //////////////////////////////////////////
+    void LightClusterGrid::build(
+        TMat const& _viewMatrix,
+        Mat4F const& _projectionMatrix,
+        F32 _nearZ,
+        F32 _farZ,
+        LightClusterGridLight const* _lights,
+        S32 _lightsCount)
+    {
+        MAZE_PROFILE_EVENT("LightClusterGrid::build");
+
+        m_nearZ = Math::Max(_nearZ, 0.0001f);
+        m_farZ = Math::Max(_farZ, m_nearZ + 0.0001f);
+
+        F32 logFarNear = Math::Log(m_farZ / m_nearZ);
+        m_sliceScale = (F32)c_gridSizeZ / logFarNear;
+        m_sliceBias = -(F32)c_gridSizeZ * Math::Log(m_nearZ) / logFarNear;
+
+        m_lightsCount = Math::Min(_lightsCount, (S32)MAZE_CLUSTERED_LIGHTS_MAX);
+
+        for (S32 i = 0; i < m_lightsCount; ++i)
+        {
+            m_lightsData[i * 2 + 0] = _lights[i].posRadiusWS;
+            m_lightsData[i * 2 + 1] = Vec4F(_lights[i].color, 1.0f);
+        }
+
+        m_lightRanges.resize(m_lightsCount);
+
+        TaskManager* taskManager = TaskManager::GetInstancePtr();
+
+        auto calculateRanges =
+            [&](S32 _begin, S32 _end)
+            {
+                for (S32 i = _begin; i < _end; ++i)
+                    calculateClusterRange(_viewMatrix, _projectionMatrix, _lights[i].posRadiusWS, m_lightRanges[i]);
+            };
+
+        if (taskManager && m_lightsCount >= c_parallelLightsCountMin)
+            taskManager->parallelFor(m_lightsCount, 0, calculateRanges);
+        else
+            calculateRanges(0, m_lightsCount);
+
+        // Slices are independent, each one collects its own index list
+        if (taskManager && m_lightsCount >= c_parallelLightsCountMin)
+        {
+            taskManager->parallelFor(
+                (S32)c_gridSizeZ,
+                1,
+                [this](S32 _begin, S32 _end)
+                {
+                    for (S32 z = _begin; z < _end; ++z)
+                        buildSlice((U32)z);
+                });
+        }
+        else
+        {
+            for (U32 z = 0; z < c_gridSizeZ; ++z)
+                buildSlice(z);
+        }
+
+        // Merge slice index lists
+        U32 indicesCount = 0;
+        for (U32 z = 0; z < c_gridSizeZ; ++z)
+        {
+            SliceData& slice = m_slices[z];
+            slice.baseOffset = indicesCount;
+
+            U32 sliceIndicesCount = Math::Min((U32)slice.indices.size(), (U32)MAZE_CLUSTERED_LIGHT_INDICES_MAX - indicesCount);
+            if (sliceIndicesCount > 0)
+            {
+                for (U32 i = 0; i < sliceIndicesCount; ++i)
+                    m_indicesData[indicesCount + i] = (F32)slice.indices[i];
+            }
+
+            for (U32 c = getClusterIndex(0, 0, z), ce = getClusterIndex(0, 0, z + 1); c < ce; ++c)
+            {
+                Vec2F& cluster = m_gridData[c];
+                U32 start = (U32)cluster.x;
+                U32 count = Math::Min((U32)cluster.y, sliceIndicesCount - Math::Min(start, sliceIndicesCount));
+                cluster = Vec2F((F32)(slice.baseOffset + start), (F32)count);
+            }
+
+            indicesCount += sliceIndicesCount;
+        }
+
+        m_lightIndicesCount = (S32)indicesCount;
+    }
+
+    //////////////////////////////////////////
+    void LightClusterGrid::buildSlice(U32 _z)
+    {
+        SliceData& slice = m_slices[_z];
+        slice.indices.clear();
+
+        U32 counts[c_gridSizeX * c_gridSizeY] = { 0 };
+
+        for (S32 i = 0; i < m_lightsCount; ++i)
+        {
+            ClusterRange const& range = m_lightRanges[i];
+            if (!range.visible || _z < range.minZ || _z > range.maxZ)
+                continue;
+
+            for (U32 y = range.minY; y <= range.maxY; ++y)
+                for (U32 x = range.minX; x <= range.maxX; ++x)
+                    ++counts[y * c_gridSizeX + x];
+        }
+
+        U32 offsets[c_gridSizeX * c_gridSizeY];
+        U32 sliceIndicesCount = 0;
+        for (U32 c = 0; c < c_gridSizeX * c_gridSizeY; ++c)
+        {
+            offsets[c] = sliceIndicesCount;
+            m_gridData[getClusterIndex(0, 0, _z) + c] = Vec2F((F32)sliceIndicesCount, (F32)counts[c]);
+            sliceIndicesCount += counts[c];
+        }
+
+        slice.indices.resize(sliceIndicesCount);
+
+        for (S32 i = 0; i < m_lightsCount; ++i)
+        {
+            ClusterRange const& range = m_lightRanges[i];
+            if (!range.visible || _z < range.minZ || _z > range.maxZ)
+                continue;
+
+            for (U32 y = range.minY; y <= range.maxY; ++y)
+                for (U32 x = range.minX; x <= range.maxX; ++x)
+                    slice.indices[offsets[y * c_gridSizeX + x]++] = (U32)i;
+        }
+    }
+
+    //////////////////////////////////////////
+    void LightClusterGrid::upload(
+        ShaderManager* _shaderManager,
+        Vec4F const& _viewportRect)
+    {
+        MAZE_PROFILE_EVENT("LightClusterGrid::upload");
+
+        U32 lightsRows = ((U32)m_lightsCount * 2 + c_lightsTextureWidth - 1) / c_lightsTextureWidth;
+        if (lightsRows > 0)
+        {
+            m_lightsTexture->uploadImageRegion(
+                reinterpret_cast<U8 const*>(m_lightsData.data()),
+                PixelFormat::RGBA_F32,
+                c_lightsTextureWidth, lightsRows,
+                0, 0);
+        }
+
+        m_gridTexture->uploadImageRegion(
+            reinterpret_cast<U8 const*>(m_gridData.data()),
+            PixelFormat::RG_F32,
+            c_gridTextureWidth, (U32)m_gridTexture->getHeight(),
+            0, 0);
+
+        U32 indicesRows = ((U32)m_lightIndicesCount + c_indicesTextureWidth - 1) / c_indicesTextureWidth;
+        if (indicesRows > 0)
+        {
+            m_indicesTexture->uploadImageRegion(
+                reinterpret_cast<U8 const*>(m_indicesData.data()),
+                PixelFormat::R_F32,
+                c_indicesTextureWidth, indicesRows,
+                0, 0);
+        }
+
+        if (!_shaderManager)
+            return;
+
+        _shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_clusterLightsTexture"))->setValue(m_lightsTexture);
+        _shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_clusterGridTexture"))->setValue(m_gridTexture);
+        _shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_clusterIndicesTexture"))->setValue(m_indicesTexture);
+        _shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_clusterGridSize"))->setValue(
+            Vec4F((F32)c_gridSizeX, (F32)c_gridSizeY, (F32)c_gridSizeZ, (F32)m_lightsCount));
+        _shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_clusterDepthParams"))->setValue(
+            Vec4F(m_nearZ, m_farZ, m_sliceScale, m_sliceBias));
+        _shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_clusterScreenParams"))->setValue(
+            Vec4F(
+                _viewportRect.x,
+                _viewportRect.y,
+                1.0f / Math::Max(_viewportRect.z, 1.0f),
+                1.0f / Math::Max(_viewportRect.w, 1.0f)));
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -33,6 +33,129 @@
 //////////////////////////////////////////
 namespace Maze
 {
+    //////////////////////////////////////////
+    // Struct MeshSkeletonAnimationKeyTimes
+    //
+    //////////////////////////////////////////
+    bool MeshSkeletonAnimationKeyTimes::tryMakeUniform(F32 _spacingTolerance)
+    {
+        if (isUniform())
+            return true;
+
+        S32 count = (S32)times.size();
+        if (count < 3)
+            return false;
+
+        F32 firstTime = times[0];
+        F32 interval = (times[count - 1] - firstTime) / (F32)(count - 1);
+        if (interval <= 0.0f)
+            return false;
+
+        F32 maxDeviation = interval * _spacingTolerance;
+        for (S32 i = 1; i < count - 1; ++i)
+            if (Math::Abs(times[i] - (firstTime + interval * (F32)i)) > maxDeviation)
+                return false;
+
+        setUniform(firstTime, interval);
+        return true;
+    }
+
+
+    //////////////////////////////////////////
+    // Class MeshSkeletonAnimationCurve
+    //
+    //////////////////////////////////////////
+    void MeshSkeletonAnimationCurve::compress(MeshSkeletonAnimationCompressionParams const& _params)
+    {
+        S32 count = (S32)m_values.size();
+        if (count <= 1)
+            return;
+
+        bool isConstant = true;
+        for (S32 i = 1; i < count; ++i)
+        {
+            if (Math::Abs(m_values[i] - m_values[0]) > _params.valueTolerance)
+            {
+                isConstant = false;
+                break;
+            }
+        }
+
+        if (isConstant)
+        {
+            m_keyTimes.clear();
+            m_values.resize(1);
+            return;
+        }
+
+        m_keyTimes.tryMakeUniform(_params.uniformSpacingTolerance);
+    }
+
+
+    //////////////////////////////////////////
+    // Class MeshSkeletonRotationCurve
+    //
+    //////////////////////////////////////////
+    void MeshSkeletonRotationCurve::modifyValues(std::function<void(Quaternion&)> const& _cb)
+    {
+        if (!isQuantized())
+        {
+            for (Quaternion& value : m_values)
+                _cb(value);
+            return;
+        }
+
+        for (MeshSkeletonQuantizedQuaternion& value : m_quantizedValues)
+        {
+            Quaternion q = value.toQuaternion();
+            _cb(q);
+            q.normalize();
+            value = MeshSkeletonQuantizedQuaternion::FromQuaternion(q);
+        }
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonRotationCurve::compress(MeshSkeletonAnimationCompressionParams const& _params)
+    {
+        S32 count = getKeysCount();
+        if (count == 0)
+            return;
+
+        if (count > 1 && !isQuantized())
+        {
+            bool isConstant = true;
+            for (S32 i = 1; i < count; ++i)
+            {
+                if (1.0f - Math::Abs(m_values[i].dot(m_values[0])) > _params.rotationTolerance)
+                {
+                    isConstant = false;
+                    break;
+                }
+            }
+
+            if (isConstant)
+            {
+                m_keyTimes.clear();
+                m_values.resize(1);
+            }
+        }
+
+        if (getKeysCount() > 1)
+            m_keyTimes.tryMakeUniform(_params.uniformSpacingTolerance);
+
+        if (_params.quantizeRotations && !isQuantized())
+        {
+            m_quantizedValues.resize(m_values.size());
+            for (S32 i = 0, n = (S32)m_values.size(); i < n; ++i)
+            {
+                Quaternion q = m_values[i];
+                q.normalize();
+                m_quantizedValues[i] = MeshSkeletonQuantizedQuaternion::FromQuaternion(q);
+            }
+            m_values.clear();
+        }
+    }
+
 
     //////////////////////////////////////////
     // Struct MeshSkeletonAnimationBone
@@ -55,6 +178,36 @@ namespace Maze
         _outScale.z = scale[2].evaluate(_time);
     }
 
+    //////////////////////////////////////////
+    void MeshSkeletonAnimationBone::evaluateBoneTransform(
+        F32 _time,
+        MeshSkeletonAnimationBoneCursor& _cursor,
+        Vec3F& _outTranslation,
+        Quaternion& _outRotation,
+        Vec3F& _outScale) const
+    {
+        _outTranslation.x = translation[0].evaluate(_time, _cursor.translation[0]);
+        _outTranslation.y = translation[1].evaluate(_time, _cursor.translation[1]);
+        _outTranslation.z = translation[2].evaluate(_time, _cursor.translation[2]);
+
+        _outRotation = rotation.evaluate(_time, _cursor.rotation);
+
+        _outScale.x = scale[0].evaluate(_time, _cursor.scale[0]);
+        _outScale.y = scale[1].evaluate(_time, _cursor.scale[1]);
+        _outScale.z = scale[2].evaluate(_time, _cursor.scale[2]);
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimationBone::compress(MeshSkeletonAnimationCompressionParams const& _params)
+    {
+        for (S32 i = 0; i < 3; ++i)
+        {
+            translation[i].compress(_params);
+            scale[i].compress(_params);
+        }
+        rotation.compress(_params);
+    }
+
 
     //////////////////////////////////////////
     // Class MeshSkeletonAnimation
@@ -108,6 +261,34 @@ namespace Maze
             _outScale);
     }
 
+    //////////////////////////////////////////
+    void MeshSkeletonAnimation::evaluateBoneTransform(
+        MeshSkeleton::BoneIndex _i,
+        F32 _time,
+        MeshSkeletonAnimationBoneCursor& _cursor,
+        Vec3F& _outTranslation,
+        Quaternion& _outRotation,
+        Vec3F& _outScale) const
+    {
+        MAZE_DEBUG_ASSERT(_i >= 0 && _i < (MeshSkeleton::BoneIndex)m_boneAnimations.size());
+
+        MeshSkeletonAnimationBone const& animationBone = m_boneAnimations[_i];
+
+        animationBone.evaluateBoneTransform(
+            _time,
+            _cursor,
+            _outTranslation,
+            _outRotation,
+            _outScale);
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimation::compress(MeshSkeletonAnimationCompressionParams const& _params)
+    {
+        for (MeshSkeletonAnimationBone& boneAnimation : m_boneAnimations)
+            boneAnimation.compress(_params);
+    }
+
 
 } // namespace Maze
 //////////////////////////////////////////
@@ -30,11 +30,20 @@
 #include "maze-graphics/managers/MazeGraphicsManager.hpp"
 #include "maze-graphics/MazeMeshSkeleton.hpp"
 #include "maze-graphics/MazeMeshSkeletonAnimation.hpp"
+#include "maze-core/math/MazeSimd.hpp"
+#include <atomic>
 
 
 //////////////////////////////////////////
 namespace Maze
 {
+    //////////////////////////////////////////
+    // Animators are updated on the job system workers
+    static std::atomic<U32> s_lodUpdatesCount[(Size)MeshSkeletonAnimationLOD::MAX];
+    static std::atomic<U32> s_lodEvaluatedPosesCount{ 0u };
+    static std::atomic<U32> s_lodInterpolatedPosesCount{ 0u };
+    static std::atomic<U64> s_lodSampledBonesCount{ 0u };
+
 
     //////////////////////////////////////////
     // Class MeshSkeletonAnimator
@@ -66,14 +75,29 @@ namespace Maze
     {
         _dt *= m_animationSpeed;
 
-        F32 totalWeight = 0.0f;
         for (MeshSkeletonAnimatorPlayerPtr const& player : m_players)
-        {
             player->update(_dt);
 
+        if (!m_skeleton || m_bonesGlobalTransforms.empty())
+            return;
+
+        updateLOD();
+        s_lodUpdatesCount[(Size)m_lod].fetch_add(1u, std::memory_order_relaxed);
+
+        // The last pose is kept
+        if (m_lod == MeshSkeletonAnimationLOD::Frozen)
+            return;
+
+        updatePose();
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::updatePose()
+    {
+        F32 totalWeight = 0.0f;
+        for (MeshSkeletonAnimatorPlayerPtr const& player : m_players)
             if (player->getAnimation() && !player->getAdditive())
                 totalWeight += player->getTotalWeight();
-        }
 
         if (totalWeight > 0.0f)
         {
@@ -85,22 +109,50 @@ namespace Maze
                     m_playersBlendWeights[i] = m_players[i]->getTotalWeight() / totalWeight;
             }
 
-            for (auto& boneTransformsDirty : m_bonesTransformsDirty)
-                boneTransformsDirty = true;
-
-            for (MeshSkeleton::BoneIndex i = 0, in = (MeshSkeleton::BoneIndex)m_bonesGlobalTransforms.size(); i < in; ++i)
+            if (m_lod == MeshSkeletonAnimationLOD::Full)
+            {
+                evaluatePose(m_bonesOrder.begin(), (S32)m_bonesOrder.size());
+                m_lodPosesValid = false;
+            }
+            else
             {
-                auto& bone = m_skeleton->getBone(i);
+                bool reducedBones = (m_lod == MeshSkeletonAnimationLOD::ReducedBones);
+                S32 interval = Math::Max(
+                    1,
+                    reducedBones ? m_lodSettings.reducedBonesUpdateInterval : m_lodSettings.reducedUpdateInterval);
+
+                Size poseBytes = m_pose.size() * sizeof(F32);
+                if (!m_lodPosesValid || ++m_lodUpdatesSinceEvaluation >= interval)
+                {
+                    if (reducedBones)
+                        evaluatePose(m_lodReducedBones.begin(), (S32)m_lodReducedBones.size());
+                    else
+                        evaluatePose(m_bonesOrder.begin(), (S32)m_bonesOrder.size());
+
+                    // The shown pose is one evaluation behind, so it is always interpolated towards the latest one
+                    memcpy(m_lodPoseFrom.begin(), m_lodPosesValid ? m_lodPoseTo.begin() : m_pose.begin(), poseBytes);
+                    memcpy(m_lodPoseTo.begin(), m_pose.begin(), poseBytes);
+                    m_lodUpdatesSinceEvaluation = 0;
+                    m_lodPosesValid = true;
+                }
+                else
+                {
+                    s_lodInterpolatedPosesCount.fetch_add(1u, std::memory_order_relaxed);
+                }
 
-                calculateBoneTransforms(i);
-                
-                // Calculate animation delta
-                m_bonesSkinningTransforms[i] =
-                    (m_skeleton->getRootTransform().transform(m_bonesGlobalTransforms[i])).transform(bone.inversedBindPoseTransformMS);
+                F32 t = (F32)m_lodUpdatesSinceEvaluation / (F32)interval;
+                memset(m_pose.begin(), 0, poseBytes);
+                blendPose(m_lodPoseFrom.begin(), 1.0f - t);
+                blendPose(m_lodPoseTo.begin(), t);
+                normalizePoseRotations();
             }
+
+            calculatePoseTransforms();
         }
         else
         {
+            m_lodPosesValid = false;
+
             // Reset to Bind pose
             for (S32 i = 0; i < MESH_SKELETON_ANIMATOR_PLAYERS_COUNT; ++i)
             {
@@ -110,9 +162,6 @@ namespace Maze
                     m_playersBlendWeights[i] = 0.0f;
             }
 
-            for (auto& boneTransformsDirty : m_bonesTransformsDirty)
-                boneTransformsDirty = false;
-
             TMat rootTransformInv = m_skeleton->getRootTransform().inversed();
             for (MeshSkeleton::BoneIndex i = 0, in = (MeshSkeleton::BoneIndex)m_bonesGlobalTransforms.size(); i < in; ++i)
             {
@@ -120,7 +169,6 @@ namespace Maze
                 m_bonesSkinningTransforms[i] = TMat::c_identity;
             }
         }
-      
     }
 
     //////////////////////////////////////////
@@ -133,15 +181,36 @@ namespace Maze
             m_bonesGlobalTransforms.resize(m_skeleton->getBonesCount(), TMat::c_identity);
             m_bonesSkinningTransforms.resize(m_skeleton->getBonesCount(), TMat::c_identity);
 
-            m_bonesTransformsDirty.resize(m_skeleton->getBonesCount());
-
+            // Pose channels are padded to the SIMD width
+            m_poseStride = (S32)((m_skeleton->getBonesCount() + 3) & ~Size(3));
+            m_pose.clear();
+            m_pose.resize((Size)(m_poseStride * (S32)PoseChannel::MAX), 0.0f);
+            m_samplePose.clear();
+            m_samplePose.resize((Size)(m_poseStride * (S32)PoseChannel::MAX), 0.0f);
+            m_lodPoseFrom.clear();
+            m_lodPoseFrom.resize((Size)(m_poseStride * (S32)PoseChannel::MAX), 0.0f);
+            m_lodPoseTo.clear();
+            m_lodPoseTo.resize((Size)(m_poseStride * (S32)PoseChannel::MAX), 0.0f);
+
+            rebuildBonesOrder();
+            rebuildBindPose();
+            rebuildLODReducedBones();
         }
         else
         {
             m_bonesGlobalTransforms.clear();
             m_bonesSkinningTransforms.clear();
-            m_bonesTransformsDirty.clear();
+            m_bonesOrder.clear();
+            m_pose.clear();
+            m_samplePose.clear();
+            m_bindPose.clear();
+            m_lodPoseFrom.clear();
+            m_lodPoseTo.clear();
+            m_lodReducedBones.clear();
+            m_poseStride = 0;
         }
+
+        m_lodPosesValid = false;
     }
 
     //////////////////////////////////////////
@@ -225,109 +294,424 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    void MeshSkeletonAnimator::calculateBoneTransforms(MeshSkeleton::BoneIndex _i)
+    void MeshSkeletonAnimator::rebuildBonesOrder()
     {
-        if (m_bonesTransformsDirty[_i])
+        S32 bonesCount = (S32)m_skeleton->getBonesCount();
+
+        // Bone depths in the hierarchy, parents are always placed before the children
+        FastVector<S32> depths((Size)bonesCount, -1);
+        for (S32 i = 0; i < bonesCount; ++i)
         {
-            MeshSkeleton::Bone& bone = m_skeleton->getBone(_i);
+            S32 depth = 0;
+            for (MeshSkeleton::BoneIndex parentIndex = m_skeleton->getBone(i).parentBoneIndex;
+                 parentIndex != -1;
+                 parentIndex = m_skeleton->getBone(parentIndex).parentBoneIndex)
+            {
+                if (depths[parentIndex] >= 0)
+                {
+                    depth += depths[parentIndex] + 1;
+                    break;
+                }
+                ++depth;
+            }
+            depths[i] = depth;
+        }
 
-            // Base layer
-            Vec3F boneTranslationFinal = Vec3F::c_zero;
-            Quaternion boneRotationFinal = Quaternion::c_identity;
-            Vec3F boneScaleFinal = Vec3F::c_zero;
-            bool firstRotation = true;
-            F32 accumulatedRotationWeight = 0.0f;
+        m_bonesOrder.resize((Size)bonesCount);
+        for (S32 i = 0; i < bonesCount; ++i)
+            m_bonesOrder[i] = i;
 
-            // Additive layer
-            //Vec3F additiveBoneTranslationFinal = Vec3F::c_zero;
-            //Quaternion additiveBoneRotationFinal = Quaternion::c_identity;
-            //Vec3F additiveBoneScaleFinal = Vec3F::c_one;
-            //bool additiveFirstRotation = true;
-            //F32 additiveAccumulatedRotationWeight = 0.0f;
+        eastl::stable_sort(
+            m_bonesOrder.begin(),
+            m_bonesOrder.end(),
+            [&depths](MeshSkeleton::BoneIndex _a, MeshSkeleton::BoneIndex _b)
+            {
+                return depths[_a] < depths[_b];
+            });
+    }
 
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::rebuildBindPose()
+    {
+        S32 bonesCount = (S32)m_skeleton->getBonesCount();
+        S32 stride = m_poseStride;
 
-            for (S32 i = 0; i < MESH_SKELETON_ANIMATOR_PLAYERS_COUNT; ++i)
+        m_bindPose.clear();
+        m_bindPose.resize((Size)(stride * (S32)PoseChannel::MAX), 0.0f);
+        F32* pose = m_bindPose.begin();
+
+        // Same space as m_bonesGlobalTransforms
+        TMat rootTransformInv = m_skeleton->getRootTransform().inversed();
+        Vector<TMat> bindTransforms((Size)bonesCount);
+        for (S32 i = 0; i < bonesCount; ++i)
+            bindTransforms[i] = rootTransformInv.transform(m_skeleton->getBone(i).inversedBindPoseTransformMS.inversed());
+
+        Mat3F rotation;
+        for (S32 i = 0; i < bonesCount; ++i)
+        {
+            MeshSkeleton::BoneIndex parentIndex = m_skeleton->getBone(i).parentBoneIndex;
+
+            TMat localTransform = (parentIndex != -1) ? bindTransforms[parentIndex].inversed().transform(bindTransforms[i])
+                                                      : bindTransforms[i];
+
+            Vec3F translation = localTransform.getTranslation();
+            Vec3F scale = localTransform.getScaleSignless();
+
+            localTransform.getMat3(rotation);
+            for (S32 c = 0; c < 3; ++c)
             {
-                F32 weight = m_playersBlendWeights[i];
-                if (weight == 0.0f)
-                    continue;
+                rotation[0][c] /= scale.x;
+                rotation[1][c] /= scale.y;
+                rotation[2][c] /= scale.z;
+            }
+            Quaternion q(rotation);
+            q.normalize();
+
+            pose[(S32)PoseChannel::TranslationX * stride + i] = translation.x;
+            pose[(S32)PoseChannel::TranslationY * stride + i] = translation.y;
+            pose[(S32)PoseChannel::TranslationZ * stride + i] = translation.z;
+            pose[(S32)PoseChannel::RotationW * stride + i] = q.w;
+            pose[(S32)PoseChannel::RotationX * stride + i] = q.x;
+            pose[(S32)PoseChannel::RotationY * stride + i] = q.y;
+            pose[(S32)PoseChannel::RotationZ * stride + i] = q.z;
+            pose[(S32)PoseChannel::ScaleX * stride + i] = scale.x;
+            pose[(S32)PoseChannel::ScaleY * stride + i] = scale.y;
+            pose[(S32)PoseChannel::ScaleZ * stride + i] = scale.z;
+        }
+    }
 
-                Vec3F boneTranslation;
-                Quaternion boneRotation(0.0f, 0.0f, 0.0f, 0.0f);
-                Vec3F boneScale;
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::rebuildLODReducedBones()
+    {
+        m_lodReducedBones.clear();
 
-                m_players[i]->evaluateBoneTransform(
-                    _i,
-                    boneTranslation,
-                    boneRotation,
-                    boneScale);
+        if (!m_skeleton)
+            return;
 
+        S32 bonesCount = (S32)m_skeleton->getBonesCount();
 
-                if (!m_players[i]->getAdditive())
-                {
-                    boneTranslationFinal += boneTranslation * weight;
-                    boneScaleFinal += boneScale * weight;
+        FastVector<S32> childrenCount((Size)bonesCount, 0);
+        FastVector<S32> firstChild((Size)bonesCount, -1);
+        for (S32 i = 0; i < bonesCount; ++i)
+        {
+            MeshSkeleton::BoneIndex parentIndex = m_skeleton->getBone(i).parentBoneIndex;
+            if (parentIndex == -1)
+                continue;
 
-                    if (firstRotation)
-                    {
-                        boneRotationFinal = boneRotation;
-                        firstRotation = false;
-                        accumulatedRotationWeight = weight;
-                    }
-                    else
-                    {
-                        F32 t = weight / (weight + accumulatedRotationWeight);
-                        boneRotationFinal = Quaternion::Slerp(t, boneRotationFinal, boneRotation);
-                        accumulatedRotationWeight += weight;
-                    }
-                }
-                else
-                {
-                    // #TODO:
-                    /*
-                    additiveBoneTranslationFinal += (boneTranslation + bone.inversedBindPoseTransformMS[3]) * weight;
-                    // additiveBoneScaleFinal += boneScale * weight;
+            if (childrenCount[parentIndex]++ == 0)
+                firstChild[parentIndex] = i;
+        }
 
-                    if (additiveFirstRotation)
-                    {
-                        additiveBoneRotationFinal = boneRotation;
-                        additiveFirstRotation = false;
-                        additiveAccumulatedRotationWeight = weight;
-                    }
-                    else
-                    {
-                        F32 t = weight / (weight + additiveAccumulatedRotationWeight);
-                        additiveBoneRotationFinal = Quaternion::Slerp(t, additiveBoneRotationFinal, boneRotation);
-                        additiveAccumulatedRotationWeight += weight;
-                    }
-                    */
-                }
+        // Parents are visited before the children
+        FastVector<U8> skipped((Size)bonesCount, 0u);
+        for (MeshSkeleton::BoneIndex i : m_bonesOrder)
+        {
+            MeshSkeleton::BoneIndex parentIndex = m_skeleton->getBone(i).parentBoneIndex;
+            if (parentIndex == -1)
+                continue;
+
+            if (skipped[parentIndex] || childrenCount[i] == 0)
+            {
+                skipped[i] = 1u;
+                continue;
             }
 
+            if (childrenCount[parentIndex] < m_lodSettings.reducedBonesHubChildrenMin)
+                continue;
 
-            TMat boneRotationMatrix;
+            // Non-branching chain down to a leaf
+            MeshSkeleton::BoneIndex chainBone = i;
+            while (childrenCount[chainBone] == 1)
+                chainBone = firstChild[chainBone];
 
-            //additiveBoneRotationFinal.toRotationMatrix(boneRotationMatrix);
-            //TMat additiveMat = TMat::CreateTranslation(additiveBoneTranslationFinal).transform(
-            //    boneRotationMatrix).transform(
-            //        TMat::CreateScale(additiveBoneScaleFinal));
+            if (childrenCount[chainBone] == 0)
+                skipped[i] = 1u;
+        }
 
-            (boneRotationFinal).toRotationMatrix(boneRotationMatrix);
-            m_bonesGlobalTransforms[_i] = TMat::CreateTranslation(boneTranslationFinal).transform(
-                boneRotationMatrix).transform(
-                    TMat::CreateScale(boneScaleFinal));
-            
+        for (MeshSkeleton::BoneIndex i : m_bonesOrder)
+            if (!skipped[i])
+                m_lodReducedBones.push_back(i);
+    }
 
-            // Apply parent transform
-            if (bone.parentBoneIndex != -1)
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::notifyRendered(F32 _screenSize)
+    {
+        MAZE_MUTEX_SCOPED_LOCK(m_lodRenderedMutex);
+
+        m_lodRenderedOnce = true;
+        m_lodScreenSize = Math::Max(m_lodScreenSize, _screenSize);
+
+        // The frozen pose is stale - it is evaluated before the render units use it.
+        // Full LOD is kept until the next update selects the LOD by the screen size
+        if (m_lod == MeshSkeletonAnimationLOD::Frozen && m_skeleton && !m_bonesGlobalTransforms.empty())
+        {
+            m_lod = MeshSkeletonAnimationLOD::Full;
+            m_lodNotRenderedUpdates = 0;
+            updatePose();
+        }
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::setLODSettings(MeshSkeletonAnimationLODSettings const& _settings)
+    {
+        bool reducedBonesChanged = (m_lodSettings.reducedBonesHubChildrenMin != _settings.reducedBonesHubChildrenMin);
+
+        m_lodSettings = _settings;
+
+        if (reducedBonesChanged)
+        {
+            rebuildLODReducedBones();
+            m_lodPosesValid = false;
+        }
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::updateLOD()
+    {
+        F32 screenSize = m_lodScreenSize;
+        m_lodScreenSize = -1.0f;
+
+        if (!m_lodSettings.enabled || !m_lodRenderedOnce)
+        {
+            m_lod = MeshSkeletonAnimationLOD::Full;
+            return;
+        }
+
+        if (screenSize < 0.0f)
+        {
+            // Short gaps (staggered shadow cascades, a camera cut) keep the current LOD
+            if (++m_lodNotRenderedUpdates >= m_lodSettings.frozenDelayUpdates)
             {
-                calculateBoneTransforms(bone.parentBoneIndex);
-                m_bonesGlobalTransforms[_i] = m_bonesGlobalTransforms[bone.parentBoneIndex].transform(m_bonesGlobalTransforms[_i]);
+                m_lod = MeshSkeletonAnimationLOD::Frozen;
+                m_lodPosesValid = false;
             }
+            return;
+        }
+
+        m_lodNotRenderedUpdates = 0;
+
+        if (screenSize >= m_lodSettings.fullScreenSize)
+            m_lod = MeshSkeletonAnimationLOD::Full;
+        else
+        if (screenSize >= m_lodSettings.reducedScreenSize)
+            m_lod = MeshSkeletonAnimationLOD::Reduced;
+        else
+            m_lod = MeshSkeletonAnimationLOD::ReducedBones;
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::evaluatePose(
+        MeshSkeleton::BoneIndex const* _bones,
+        S32 _bonesCount)
+    {
+        // Skipped bones stay in the bind pose for every player
+        if (_bonesCount < (S32)m_bonesOrder.size())
+            memcpy(m_samplePose.begin(), m_bindPose.begin(), m_samplePose.size() * sizeof(F32));
+
+        // Blend local poses of the base layer players
+        memset(m_pose.begin(), 0, m_pose.size() * sizeof(F32));
+        for (S32 i = 0; i < MESH_SKELETON_ANIMATOR_PLAYERS_COUNT; ++i)
+        {
+            F32 weight = m_playersBlendWeights[i];
+            if (weight == 0.0f || m_players[i]->getAdditive())
+                continue;
+
+            // #TODO: Additive layer
+            samplePlayerPose(m_players[i].get(), _bones, _bonesCount);
+            blendPose(m_samplePose.begin(), weight);
+
+            s_lodSampledBonesCount.fetch_add((U64)_bonesCount, std::memory_order_relaxed);
+        }
+        normalizePoseRotations();
+
+        s_lodEvaluatedPosesCount.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    //////////////////////////////////////////
+    MeshSkeletonAnimationLODStats MeshSkeletonAnimator::GetLODStats()
+    {
+        MeshSkeletonAnimationLODStats stats;
+        for (Size i = 0; i < (Size)MeshSkeletonAnimationLOD::MAX; ++i)
+            stats.updatesCount[i] = s_lodUpdatesCount[i].load(std::memory_order_relaxed);
+        stats.evaluatedPosesCount = s_lodEvaluatedPosesCount.load(std::memory_order_relaxed);
+        stats.interpolatedPosesCount = s_lodInterpolatedPosesCount.load(std::memory_order_relaxed);
+        stats.sampledBonesCount = s_lodSampledBonesCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::ResetLODStats()
+    {
+        for (Size i = 0; i < (Size)MeshSkeletonAnimationLOD::MAX; ++i)
+            s_lodUpdatesCount[i].store(0u, std::memory_order_relaxed);
+        s_lodEvaluatedPosesCount.store(0u, std::memory_order_relaxed);
+        s_lodInterpolatedPosesCount.store(0u, std::memory_order_relaxed);
+        s_lodSampledBonesCount.store(0u, std::memory_order_relaxed);
+    }
 
-            m_bonesTransformsDirty[_i] = false;
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::samplePlayerPose(
+        MeshSkeletonAnimatorPlayer* _player,
+        MeshSkeleton::BoneIndex const* _bones,
+        S32 _bonesCount)
+    {
+        S32 stride = m_poseStride;
+        F32* pose = m_samplePose.begin();
+
+        Vec3F translation;
+        Quaternion rotation(0.0f, 0.0f, 0.0f, 0.0f);
+        Vec3F scale;
+        for (S32 b = 0; b < _bonesCount; ++b)
+        {
+            MeshSkeleton::BoneIndex i = _bones[b];
+
+            _player->evaluateBoneTransform(
+                i,
+                translation,
+                rotation,
+                scale);
+
+            pose[(S32)PoseChannel::TranslationX * stride + i] = translation.x;
+            pose[(S32)PoseChannel::TranslationY * stride + i] = translation.y;
+            pose[(S32)PoseChannel::TranslationZ * stride + i] = translation.z;
+            pose[(S32)PoseChannel::RotationW * stride + i] = rotation.w;
+            pose[(S32)PoseChannel::RotationX * stride + i] = rotation.x;
+            pose[(S32)PoseChannel::RotationY * stride + i] = rotation.y;
+            pose[(S32)PoseChannel::RotationZ * stride + i] = rotation.z;
+            pose[(S32)PoseChannel::ScaleX * stride + i] = scale.x;
+            pose[(S32)PoseChannel::ScaleY * stride + i] = scale.y;
+            pose[(S32)PoseChannel::ScaleZ * stride + i] = scale.z;
+        }
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::blendPose(
+        F32 const* _sourcePose,
+        F32 _weight)
+    {
+        S32 stride = m_poseStride;
+        F32* pose = m_pose.begin();
+        F32 const* sample = _sourcePose;
+
+        F32* rotationW = pose + (S32)PoseChannel::RotationW * stride;
+        F32* rotationX = pose + (S32)PoseChannel::RotationX * stride;
+        F32* rotationY = pose + (S32)PoseChannel::RotationY * stride;
+        F32* rotationZ = pose + (S32)PoseChannel::RotationZ * stride;
+        F32 const* sampleRotationW = sample + (S32)PoseChannel::RotationW * stride;
+        F32 const* sampleRotationX = sample + (S32)PoseChannel::RotationX * stride;
+        F32 const* sampleRotationY = sample + (S32)PoseChannel::RotationY * stride;
+        F32 const* sampleRotationZ = sample + (S32)PoseChannel::RotationZ * stride;
+
+        Simd4F weight = Simd4F::Splat(_weight);
+
+        // Translation and scale are blended linearly
+        static S32 const c_linearChannels[] =
+        {
+            (S32)PoseChannel::TranslationX, (S32)PoseChannel::TranslationY, (S32)PoseChannel::TranslationZ,
+            (S32)PoseChannel::ScaleX, (S32)PoseChannel::ScaleY, (S32)PoseChannel::ScaleZ
+        };
+        for (S32 channel : c_linearChannels)
+        {
+            F32* values = pose + channel * stride;
+            F32 const* sampleValues = sample + channel * stride;
+            for (S32 i = 0; i < stride; i += 4)
+                Simd4F::MulAdd(Simd4F::Load(sampleValues + i), weight, Simd4F::Load(values + i)).store(values + i);
         }
-    };
+
+        // Rotations are accumulated in the hemisphere of the current sum and normalized after all players
+        for (S32 i = 0; i < stride; i += 4)
+        {
+            Simd4F w = Simd4F::Load(rotationW + i);
+            Simd4F x = Simd4F::Load(rotationX + i);
+            Simd4F y = Simd4F::Load(rotationY + i);
+            Simd4F z = Simd4F::Load(rotationZ + i);
+            Simd4F sw = Simd4F::Load(sampleRotationW + i);
+            Simd4F sx = Simd4F::Load(sampleRotationX + i);
+            Simd4F sy = Simd4F::Load(sampleRotationY + i);
+            Simd4F sz = Simd4F::Load(sampleRotationZ + i);
+
+            Simd4F dot = w * sw + x * sx + y * sy + z * sz;
+            Simd4F signedWeight = Simd4F::NegateIfNegative(weight, dot);
+
+            Simd4F::MulAdd(sw, signedWeight, w).store(rotationW + i);
+            Simd4F::MulAdd(sx, signedWeight, x).store(rotationX + i);
+            Simd4F::MulAdd(sy, signedWeight, y).store(rotationY + i);
+            Simd4F::MulAdd(sz, signedWeight, z).store(rotationZ + i);
+        }
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::normalizePoseRotations()
+    {
+        S32 stride = m_poseStride;
+        F32* pose = m_pose.begin();
+
+        F32* rotationW = pose + (S32)PoseChannel::RotationW * stride;
+        F32* rotationX = pose + (S32)PoseChannel::RotationX * stride;
+        F32* rotationY = pose + (S32)PoseChannel::RotationY * stride;
+        F32* rotationZ = pose + (S32)PoseChannel::RotationZ * stride;
+
+        Simd4F const lengthSqMin = Simd4F::Splat(1e-12f);
+        for (S32 i = 0; i < stride; i += 4)
+        {
+            Simd4F w = Simd4F::Load(rotationW + i);
+            Simd4F x = Simd4F::Load(rotationX + i);
+            Simd4F y = Simd4F::Load(rotationY + i);
+            Simd4F z = Simd4F::Load(rotationZ + i);
+
+            Simd4F lengthInv = Simd4F::InvSqrt(Simd4F::Max(w * w + x * x + y * y + z * z, lengthSqMin));
+
+            (w * lengthInv).store(rotationW + i);
+            (x * lengthInv).store(rotationX + i);
+            (y * lengthInv).store(rotationY + i);
+            (z * lengthInv).store(rotationZ + i);
+        }
+    }
+
+    //////////////////////////////////////////
+    void MeshSkeletonAnimator::calculatePoseTransforms()
+    {
+        S32 stride = m_poseStride;
+        F32 const* pose = m_pose.begin();
+        TMat const& rootTransform = m_skeleton->getRootTransform();
+
+        Mat3F rotation;
+        for (MeshSkeleton::BoneIndex i : m_bonesOrder)
+        {
+            MeshSkeleton::Bone const& bone = m_skeleton->getBone(i);
+
+            Quaternion(
+                pose[(S32)PoseChannel::RotationW * stride + i],
+                pose[(S32)PoseChannel::RotationX * stride + i],
+                pose[(S32)PoseChannel::RotationY * stride + i],
+                pose[(S32)PoseChannel::RotationZ * stride + i]).toRotationMatrix(rotation);
+
+            F32 scaleX = pose[(S32)PoseChannel::ScaleX * stride + i];
+            F32 scaleY = pose[(S32)PoseChannel::ScaleY * stride + i];
+            F32 scaleZ = pose[(S32)PoseChannel::ScaleZ * stride + i];
+
+            // Scale, then rotation, then translation
+            TMat localTransform(
+                rotation[0][0] * scaleX, rotation[0][1] * scaleX, rotation[0][2] * scaleX,
+                rotation[1][0] * scaleY, rotation[1][1] * scaleY, rotation[1][2] * scaleY,
+                rotation[2][0] * scaleZ, rotation[2][1] * scaleZ, rotation[2][2] * scaleZ,
+                pose[(S32)PoseChannel::TranslationX * stride + i],
+                pose[(S32)PoseChannel::TranslationY * stride + i],
+                pose[(S32)PoseChannel::TranslationZ * stride + i]);
+
+            // Parent is already calculated
+            TMat& globalTransform = m_bonesGlobalTransforms[i];
+            if (bone.parentBoneIndex != -1)
+                m_bonesGlobalTransforms[bone.parentBoneIndex].transform(localTransform, globalTransform);
+            else
+                globalTransform = localTransform;
+
+            // Animation delta straight into the skinning palette
+            rootTransform.transform(globalTransform).transform(
+                bone.inversedBindPoseTransformMS,
+                m_bonesSkinningTransforms[i]);
+        }
+    }
 
     //////////////////////////////////////////
     S32 MeshSkeletonAnimator::findPlayerIndexForNewAnimation(
@@ -481,7 +865,10 @@ namespace Maze
     void MeshSkeletonAnimatorPlayer::rewindTo(F32 _time)
     {
         if (m_animation)
+        {
             m_currentTime = _time;
+            resetCursors();
+        }
     }
 
     //////////////////////////////////////////
@@ -503,6 +890,8 @@ namespace Maze
         m_looped = _loop;
         m_additive = _additive;
         m_pauseEnding = _pauseEnding;
+
+        resetCursors();
     }
 
     //////////////////////////////////////////
@@ -529,14 +918,26 @@ namespace Maze
         if (!m_animation)
             return;
 
+        MAZE_DEBUG_ASSERT(_i >= 0 && _i < (MeshSkeleton::BoneIndex)m_cursors.size());
+
         m_animation->evaluateBoneTransform(
             _i,
             m_currentTime,
+            m_cursors[_i],
             _outTranslation,
             _outRotation,
             _outScale);
     }
 
+    //////////////////////////////////////////
+    void MeshSkeletonAnimatorPlayer::resetCursors()
+    {
+        m_cursors.clear();
+
+        if (m_animation)
+            m_cursors.resize(m_animation->getBoneAnimations().size());
+    }
+
     //////////////////////////////////////////
     void MeshSkeletonAnimatorPlayer::setState(State _state)
     {
@@ -0,0 +1,182 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeGraphicsHeader.hpp"
+#include "maze-graphics/MazeSkinningPaletteBuffer.hpp"
+#include "maze-graphics/MazeTexture2D.hpp"
+#include "maze-graphics/MazeShaderManager.hpp"
+#include "maze-graphics/MazeGlobalShaderUniform.hpp"
+#include "maze-graphics/MazeRenderSystem.hpp"
+#include "maze-graphics/MazeMeshSkeletonAnimator.hpp"
+#include "maze-core/utils/MazeProfiler.hpp"
+#include "maze-core/math/MazeMath.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    static U32 const c_textureHeightMin = 4;
+
+
+    //////////////////////////////////////////
+    // Class SkinningPaletteBuffer
+    //
+    //////////////////////////////////////////
+    SkinningPaletteBuffer::SkinningPaletteBuffer()
+    {
+    }
+
+    //////////////////////////////////////////
+    SkinningPaletteBuffer::~SkinningPaletteBuffer()
+    {
+    }
+
+    //////////////////////////////////////////
+    SkinningPaletteBufferPtr SkinningPaletteBuffer::Create(RenderSystem* _renderSystem)
+    {
+        SkinningPaletteBufferPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(SkinningPaletteBuffer, object, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool SkinningPaletteBuffer::init(RenderSystem* _renderSystem)
+    {
+        m_renderSystem = _renderSystem;
+
+        m_texture = Texture2D::Create(_renderSystem);
+        MAZE_ERROR_RETURN_VALUE_IF(!m_texture, false, "Texture creation failed!");
+
+        if (!m_texture->loadEmpty(Vec2U(c_textureWidth, c_textureHeightMin), PixelFormat::RGBA_F32))
+            return false;
+
+        m_texture->setMagFilter(TextureFilter::Nearest);
+        m_texture->setMinFilter(TextureFilter::Nearest);
+        m_texture->setWrapS(TextureWrap::ClampToEdge);
+        m_texture->setWrapT(TextureWrap::ClampToEdge);
+
+        // Whole rows are uploaded, so the data is kept in the texture size
+        m_data.resize((Size)c_textureWidth * c_textureHeightMin, Vec4F::c_zero);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void SkinningPaletteBuffer::reset()
+    {
+        m_paletteOffsets.clear();
+        m_bonesCount = 0;
+        m_uploadedBonesCount = 0;
+    }
+
+    //////////////////////////////////////////
+    bool SkinningPaletteBuffer::ensureCapacity(S32 _bonesCount)
+    {
+        U32 texelsCount = (U32)_bonesCount * c_texelsPerBone;
+        U32 height = (U32)m_texture->getHeight();
+        if (texelsCount <= c_textureWidth * height)
+            return true;
+
+        U32 requiredHeight = (texelsCount + c_textureWidth - 1) / c_textureWidth;
+        while (height < requiredHeight)
+            height *= 2;
+
+        MAZE_ERROR_RETURN_VALUE_IF(
+            (S32)height > m_renderSystem->getTextureMaxSize(),
+            false,
+            "Skinning palette buffer is out of texture size! bonesCount=%d",
+            _bonesCount);
+
+        if (!m_texture->loadEmpty(Vec2U(c_textureWidth, height), PixelFormat::RGBA_F32))
+            return false;
+
+        m_data.resize((Size)c_textureWidth * height, Vec4F::c_zero);
+
+        // Texture storage is recreated, the palettes of the frame are uploaded again
+        m_uploadedBonesCount = 0;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    S32 SkinningPaletteBuffer::ensurePalette(MeshSkeletonAnimator const* _animator)
+    {
+        auto it = m_paletteOffsets.find(_animator);
+        if (it != m_paletteOffsets.end())
+            return it->second;
+
+        Vector<TMat> const& transforms = _animator->getBonesSkinningTransforms();
+        S32 bonesCount = (S32)transforms.size();
+        if (bonesCount == 0)
+            return -1;
+
+        if (!ensureCapacity(m_bonesCount + bonesCount))
+            return -1;
+
+        S32 offset = m_bonesCount;
+        Vec4F* texel = &m_data[(Size)offset * c_texelsPerBone];
+        for (TMat const& tm : transforms)
+        {
+            *texel++ = Vec4F(tm[0][0], tm[1][0], tm[2][0], tm[3][0]);
+            *texel++ = Vec4F(tm[0][1], tm[1][1], tm[2][1], tm[3][1]);
+            *texel++ = Vec4F(tm[0][2], tm[1][2], tm[2][2], tm[3][2]);
+        }
+
+        m_bonesCount += bonesCount;
+        m_paletteOffsets.emplace(_animator, offset);
+
+        return offset;
+    }
+
+    //////////////////////////////////////////
+    void SkinningPaletteBuffer::upload(ShaderManager* _shaderManager)
+    {
+        if (m_uploadedBonesCount < m_bonesCount)
+        {
+            MAZE_PROFILE_EVENT("SkinningPaletteBuffer::upload");
+
+            U32 firstRow = ((U32)m_uploadedBonesCount * c_texelsPerBone) / c_textureWidth;
+            U32 lastRow = ((U32)m_bonesCount * c_texelsPerBone - 1) / c_textureWidth;
+
+            m_texture->uploadImageRegion(
+                reinterpret_cast<U8 const*>(&m_data[(Size)firstRow * c_textureWidth]),
+                PixelFormat::RGBA_F32,
+                c_textureWidth, lastRow - firstRow + 1,
+                0, firstRow);
+
+            m_uploadedBonesCount = m_bonesCount;
+        }
+
+        if (!_shaderManager)
+            return;
+
+        _shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_skinningPaletteTexture"))->setValue(m_texture);
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
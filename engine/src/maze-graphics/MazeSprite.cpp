@@ -274,6 +274,24 @@ namespace Maze
             (m_colorPosition.y + m_colorSize.y) / th);
     }
 
+    //////////////////////////////////////////
+    void Sprite::setAtlasRegion(Texture2DPtr const& _atlasTexture, Vec4F const& _uvTransform)
+    {
+        if (m_atlasTexture == _atlasTexture && m_atlasUVTransform == _uvTransform)
+            return;
+
+        m_atlasTexture = _atlasTexture;
+        m_atlasUVTransform = _uvTransform;
+
+        eventDataChanged(this);
+    }
+
+    //////////////////////////////////////////
+    void Sprite::resetAtlasRegion()
+    {
+        setAtlasRegion(nullptr, Vec4F(1.0f, 1.0f, 0.0f, 0.0f));
+    }
+
     //////////////////////////////////////////
     String Sprite::toString() const
     {
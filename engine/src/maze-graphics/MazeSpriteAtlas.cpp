@@ -0,0 +1,568 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeGraphicsHeader.hpp"
+#include "maze-graphics/MazeSpriteAtlas.hpp"
+#include "maze-graphics/MazeSprite.hpp"
+#include "maze-graphics/MazeTexture2D.hpp"
+#include "maze-graphics/MazeRenderSystem.hpp"
+#include "maze-core/utils/MazeProfiler.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class SpriteAtlas
+    //
+    //////////////////////////////////////////
+    SpriteAtlas::SpriteAtlas()
+    {
+    }
+
+    //////////////////////////////////////////
+    SpriteAtlas::~SpriteAtlas()
+    {
+        clear();
+    }
+
+    //////////////////////////////////////////
+    SpriteAtlasPtr SpriteAtlas::Create(RenderSystem* _renderSystem)
+    {
+        SpriteAtlasPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(SpriteAtlas, object, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool SpriteAtlas::init(RenderSystem* _renderSystem)
+    {
+        if (!_renderSystem)
+            return false;
+
+        m_renderSystem = _renderSystem;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool SpriteAtlas::addSprite(Sprite* _sprite)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(!_sprite, false, "Sprite is null!");
+
+        if (m_spriteTextures.find(_sprite) == m_spriteTextures.end())
+        {
+            _sprite->eventDataChanged.subscribe(this, &SpriteAtlas::notifySpriteDataChanged);
+            attachSprite(_sprite, _sprite->getTexture());
+        }
+
+        return _sprite->getAtlasTexture() != nullptr;
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::removeSprite(Sprite* _sprite)
+    {
+        if (!_sprite)
+            return;
+
+        if (m_spriteTextures.find(_sprite) == m_spriteTextures.end())
+            return;
+
+        _sprite->eventDataChanged.unsubscribe(this);
+        detachSprite(_sprite);
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::clear()
+    {
+        Vector<Sprite*> sprites;
+        sprites.reserve(m_spriteTextures.size());
+        for (auto const& spriteData : m_spriteTextures)
+            sprites.push_back(spriteData.first);
+
+        for (Sprite* sprite : sprites)
+            removeSprite(sprite);
+
+        MAZE_DEBUG_ERROR_IF(!m_entries.empty(), "Atlas entries are not released!");
+        m_entries.clear();
+        m_pages.clear();
+    }
+
+    //////////////////////////////////////////
+    bool SpriteAtlas::isTextureSuitable(Texture2D const* _texture) const
+    {
+        if (!_texture)
+            return false;
+
+        if (_texture->getWidth() <= 0 || _texture->getHeight() <= 0)
+            return false;
+
+        if (_texture->getWidth() > c_textureSizeMax || _texture->getHeight() > c_textureSizeMax)
+            return false;
+
+        // Atlas pages are filtered linearly, pixel art textures should keep their own filtering
+        if (_texture->getMagFilter() != TextureFilter::Linear)
+            return false;
+
+        // Repeated and mirrored textures can't be sampled from a page region
+        if (_texture->getWrapS() != TextureWrap::ClampToEdge || _texture->getWrapT() != TextureWrap::ClampToEdge)
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::attachSprite(Sprite* _sprite, Texture2DPtr const& _texture)
+    {
+        m_spriteTextures[_sprite] = _texture.get();
+
+        if (!_texture)
+            return;
+
+        auto it = m_entries.find(_texture.get());
+        if (it == m_entries.end())
+        {
+            Entry& entry = m_entries[_texture.get()];
+            entry.texture = _texture;
+            entry.sprites.push_back(_sprite);
+
+            _texture->eventTextureLoaded.subscribe(this, &SpriteAtlas::notifyTextureLoaded);
+
+            if (!packEntry(entry))
+                updateEntrySprites(entry);
+        }
+        else
+        {
+            it->second.sprites.push_back(_sprite);
+            updateEntrySprites(it->second);
+        }
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::detachSprite(Sprite* _sprite)
+    {
+        auto spriteIt = m_spriteTextures.find(_sprite);
+        if (spriteIt == m_spriteTextures.end())
+            return;
+
+        Texture2D* texture = spriteIt->second;
+        m_spriteTextures.erase(spriteIt);
+
+        _sprite->resetAtlasRegion();
+
+        if (!texture)
+            return;
+
+        auto it = m_entries.find(texture);
+        if (it == m_entries.end())
+            return;
+
+        Entry& entry = it->second;
+        auto entrySpriteIt = eastl::find(entry.sprites.begin(), entry.sprites.end(), _sprite);
+        if (entrySpriteIt != entry.sprites.end())
+            entry.sprites.erase(entrySpriteIt);
+
+        if (entry.sprites.empty())
+        {
+            unpackEntry(entry);
+            entry.texture->eventTextureLoaded.unsubscribe(this);
+            m_entries.erase(it);
+        }
+    }
+
+    //////////////////////////////////////////
+    bool SpriteAtlas::packEntry(Entry& _entry)
+    {
+        MAZE_PROFILE_EVENT("SpriteAtlas::packEntry");
+
+        if (!isTextureSuitable(_entry.texture.get()))
+            return false;
+
+        Vec2S size = _entry.texture->getSize() + Vec2S(c_padding * 2);
+
+        S32 pageIndex = -1;
+        S32 shelfIndex = -1;
+        Rect2S rect;
+
+        for (S32 i = 0, in = (S32)m_pages.size(); i < in && pageIndex < 0; ++i)
+            if (allocateRegion(i, size, shelfIndex, rect))
+                pageIndex = i;
+
+        // Incremental repack - only the pages with enough released space are touched
+        for (S32 i = 0, in = (S32)m_pages.size(); i < in && pageIndex < 0; ++i)
+            if (m_pages[i].freedArea >= size.x * size.y && repackPage(i) && allocateRegion(i, size, shelfIndex, rect))
+                pageIndex = i;
+
+        if (pageIndex < 0)
+        {
+            S32 newPageIndex = createPage();
+            if (newPageIndex >= 0 && allocateRegion(newPageIndex, size, shelfIndex, rect))
+                pageIndex = newPageIndex;
+        }
+
+        if (pageIndex < 0)
+            return false;
+
+        _entry.pageIndex = pageIndex;
+        _entry.shelfIndex = shelfIndex;
+        _entry.rect = rect;
+
+        if (!uploadEntry(_entry))
+        {
+            unpackEntry(_entry);
+            return false;
+        }
+
+        updateEntrySprites(_entry);
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::unpackEntry(Entry& _entry)
+    {
+        if (_entry.pageIndex < 0)
+            return;
+
+        releaseRegion(_entry.pageIndex, _entry.shelfIndex, _entry.rect);
+
+        _entry.pageIndex = -1;
+        _entry.shelfIndex = -1;
+    }
+
+    //////////////////////////////////////////
+    bool SpriteAtlas::allocateRegion(
+        S32 _pageIndex,
+        Vec2S const& _size,
+        S32& _outShelfIndex,
+        Rect2S& _outRect)
+    {
+        Page& page = m_pages[_pageIndex];
+
+        for (S32 i = 0, in = (S32)page.shelves.size(); i < in; ++i)
+        {
+            Shelf& shelf = page.shelves[i];
+
+            // Too tall shelves are skipped to keep the wasted space low
+            if (_size.y > shelf.height || _size.y * 2 < shelf.height)
+                continue;
+
+            for (Size j = 0, jn = shelf.freeSlots.size(); j < jn; ++j)
+            {
+                Rect2S& slot = shelf.freeSlots[j];
+                if (slot.size.x < _size.x)
+                    continue;
+
+                _outShelfIndex = i;
+                _outRect = Rect2S(slot.position.x, shelf.y, _size.x, _size.y);
+
+                slot.position.x += _size.x;
+                slot.size.x -= _size.x;
+                if (slot.size.x == 0)
+                    shelf.freeSlots.erase(shelf.freeSlots.begin() + j);
+
+                return true;
+            }
+
+            if (c_pageSize - shelf.cursorX >= _size.x)
+            {
+                _outShelfIndex = i;
+                _outRect = Rect2S(shelf.cursorX, shelf.y, _size.x, _size.y);
+                shelf.cursorX += _size.x;
+                return true;
+            }
+        }
+
+        if (page.shelvesHeight + _size.y > c_pageSize || _size.x > c_pageSize)
+            return false;
+
+        Shelf shelf;
+        shelf.y = page.shelvesHeight;
+        shelf.height = _size.y;
+        shelf.cursorX = _size.x;
+        page.shelves.emplace_back(eastl::move(shelf));
+        page.shelvesHeight += _size.y;
+
+        _outShelfIndex = (S32)page.shelves.size() - 1;
+        _outRect = Rect2S(0, page.shelves.back().y, _size.x, _size.y);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::releaseRegion(
+        S32 _pageIndex,
+        S32 _shelfIndex,
+        Rect2S const& _rect)
+    {
+        Page& page = m_pages[_pageIndex];
+        Shelf& shelf = page.shelves[_shelfIndex];
+
+        page.freedArea += _rect.size.x * _rect.size.y;
+
+        shelf.freeSlots.emplace_back(Rect2S(_rect.position.x, shelf.y, _rect.size.x, shelf.height));
+        eastl::sort(
+            shelf.freeSlots.begin(),
+            shelf.freeSlots.end(),
+            [](Rect2S const& _a, Rect2S const& _b) { return _a.position.x < _b.position.x; });
+
+        // Merge adjacent slots
+        for (Size i = 1; i < shelf.freeSlots.size();)
+        {
+            Rect2S& prevSlot = shelf.freeSlots[i - 1];
+            Rect2S const& slot = shelf.freeSlots[i];
+            if (prevSlot.position.x + prevSlot.size.x == slot.position.x)
+            {
+                prevSlot.size.x += slot.size.x;
+                shelf.freeSlots.erase(shelf.freeSlots.begin() + i);
+            }
+            else
+                ++i;
+        }
+
+        // Return the tail slot to the shelf cursor
+        if (!shelf.freeSlots.empty() &&
+            shelf.freeSlots.back().position.x + shelf.freeSlots.back().size.x == shelf.cursorX)
+        {
+            shelf.cursorX = shelf.freeSlots.back().position.x;
+            shelf.freeSlots.pop_back();
+        }
+
+        // Empty top shelves are returned to the page
+        while (!page.shelves.empty() && page.shelves.back().cursorX == 0)
+        {
+            page.shelvesHeight -= page.shelves.back().height;
+            page.shelves.pop_back();
+        }
+    }
+
+    //////////////////////////////////////////
+    bool SpriteAtlas::repackPage(S32 _pageIndex)
+    {
+        MAZE_PROFILE_EVENT("SpriteAtlas::repackPage");
+
+        Vector<Entry*> entries;
+        for (auto& entryData : m_entries)
+            if (entryData.second.pageIndex == _pageIndex)
+                entries.push_back(&entryData.second);
+
+        eastl::sort(
+            entries.begin(),
+            entries.end(),
+            [](Entry const* _a, Entry const* _b) { return _a->rect.size.y > _b->rect.size.y; });
+
+        Page& page = m_pages[_pageIndex];
+        page.shelves.clear();
+        page.shelvesHeight = 0;
+        page.freedArea = 0;
+
+        for (Entry* entry : entries)
+        {
+            Vec2S size = entry->rect.size;
+            if (!allocateRegion(_pageIndex, size, entry->shelfIndex, entry->rect) || !uploadEntry(*entry))
+            {
+                entry->pageIndex = -1;
+                entry->shelfIndex = -1;
+            }
+
+            updateEntrySprites(*entry);
+        }
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    S32 SpriteAtlas::createPage()
+    {
+        if ((S32)m_pages.size() >= c_pagesMax)
+            return -1;
+
+        Texture2DPtr texture = Texture2D::Create(m_renderSystem);
+        MAZE_ERROR_RETURN_VALUE_IF(!texture, -1, "Texture creation failed!");
+
+        if (!texture->loadEmpty(Vec2U(c_pageSize, c_pageSize), PixelFormat::RGBA_U8))
+            return -1;
+
+        texture->setMagFilter(TextureFilter::Linear);
+        texture->setMinFilter(TextureFilter::Linear);
+        texture->setWrapS(TextureWrap::ClampToEdge);
+        texture->setWrapT(TextureWrap::ClampToEdge);
+
+        Page page;
+        page.texture = texture;
+        m_pages.emplace_back(eastl::move(page));
+
+        return (S32)m_pages.size() - 1;
+    }
+
+    //////////////////////////////////////////
+    bool SpriteAtlas::uploadEntry(Entry const& _entry)
+    {
+        MAZE_PROFILE_EVENT("SpriteAtlas::uploadEntry");
+
+        Vec2S const size = _entry.texture->getSize();
+        if (size + Vec2S(c_padding * 2) != _entry.rect.size)
+            return false;
+
+        // GPU copy - the padding is filled with the stretched edge pixels
+        S32 const x0 = _entry.rect.position.x;
+        S32 const y0 = _entry.rect.position.y;
+        S32 const x1 = x0 + c_padding;
+        S32 const y1 = y0 + c_padding;
+        S32 const x2 = x1 + size.x;
+        S32 const y2 = y1 + size.y;
+        Rect2S const srcRects[] =
+        {
+            Rect2S(0, 0, size.x, size.y),
+            Rect2S(0, 0, 1, size.y),
+            Rect2S(size.x - 1, 0, 1, size.y),
+            Rect2S(0, 0, size.x, 1),
+            Rect2S(0, size.y - 1, size.x, 1),
+            Rect2S(0, 0, 1, 1),
+            Rect2S(size.x - 1, 0, 1, 1),
+            Rect2S(0, size.y - 1, 1, 1),
+            Rect2S(size.x - 1, size.y - 1, 1, 1)
+        };
+        Rect2S const dstRects[] =
+        {
+            Rect2S(x1, y1, size.x, size.y),
+            Rect2S(x0, y1, c_padding, size.y),
+            Rect2S(x2, y1, c_padding, size.y),
+            Rect2S(x1, y0, size.x, c_padding),
+            Rect2S(x1, y2, size.x, c_padding),
+            Rect2S(x0, y0, c_padding, c_padding),
+            Rect2S(x2, y0, c_padding, c_padding),
+            Rect2S(x0, y2, c_padding, c_padding),
+            Rect2S(x2, y2, c_padding, c_padding)
+        };
+
+        Texture2DPtr const& pageTexture = m_pages[_entry.pageIndex].texture;
+        if (pageTexture->blitImageRegionsFrom(_entry.texture.get(), srcRects, dstRects, S32(sizeof(srcRects) / sizeof(srcRects[0]))))
+            return true;
+
+        // CPU fallback for the render systems without the texture blit
+        PixelSheet2D sourcePixelSheet;
+        if (!_entry.texture->readAsPixelSheet(sourcePixelSheet, PixelFormat::RGBA_U8))
+            return false;
+
+        if (sourcePixelSheet.getFormat() != PixelFormat::RGBA_U8 ||
+            sourcePixelSheet.getSize() + Vec2S(c_padding * 2) != _entry.rect.size)
+            return false;
+
+        S32 const srcWidth = sourcePixelSheet.getWidth();
+        S32 const srcHeight = sourcePixelSheet.getHeight();
+        S32 const width = _entry.rect.size.x;
+        S32 const height = _entry.rect.size.y;
+
+        m_uploadPixelSheet.setFormat(PixelFormat::RGBA_U8);
+        m_uploadPixelSheet.setSize(width, height);
+
+        // Padding is filled with the edge pixels
+        U32 const* src = reinterpret_cast<U32 const*>(sourcePixelSheet.getDataRO());
+        U32* dst = reinterpret_cast<U32*>(m_uploadPixelSheet.getDataRW());
+        for (S32 y = 0; y < height; ++y)
+        {
+            U32 const* srcRow = src + Math::Clamp(y - c_padding, 0, srcHeight - 1) * srcWidth;
+            U32* dstRow = dst + y * width;
+
+            for (S32 x = 0; x < c_padding; ++x)
+                dstRow[x] = srcRow[0];
+
+            memcpy(dstRow + c_padding, srcRow, srcWidth * sizeof(U32));
+
+            for (S32 x = c_padding + srcWidth; x < width; ++x)
+                dstRow[x] = srcRow[srcWidth - 1];
+        }
+
+        // Page textures have no mipmaps, so the region is uploaded as is
+        pageTexture->uploadImageRegion(
+            m_uploadPixelSheet.getDataRO(),
+            PixelFormat::RGBA_U8,
+            (U32)width,
+            (U32)height,
+            (U32)_entry.rect.position.x,
+            (U32)_entry.rect.position.y);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::updateEntrySprites(Entry const& _entry)
+    {
+        if (_entry.pageIndex < 0)
+        {
+            for (Sprite* sprite : _entry.sprites)
+                sprite->resetAtlasRegion();
+            return;
+        }
+
+        F32 const invPageSize = 1.0f / (F32)c_pageSize;
+        Vec2F scale = (Vec2F)_entry.texture->getSize() * invPageSize;
+        Vec2F offset = (Vec2F)(_entry.rect.position + Vec2S(c_padding)) * invPageSize;
+
+        Texture2DPtr const& pageTexture = m_pages[_entry.pageIndex].texture;
+        for (Sprite* sprite : _entry.sprites)
+            sprite->setAtlasRegion(pageTexture, Vec4F(scale, offset));
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::notifySpriteDataChanged(Sprite* _sprite)
+    {
+        auto it = m_spriteTextures.find(_sprite);
+        if (it == m_spriteTextures.end())
+            return;
+
+        // Sprite::setAtlasRegion also triggers this event - nothing to do until the texture is changed
+        if (it->second == _sprite->getTexture().get())
+            return;
+
+        detachSprite(_sprite);
+        attachSprite(_sprite, _sprite->getTexture());
+    }
+
+    //////////////////////////////////////////
+    void SpriteAtlas::notifyTextureLoaded(Texture2D* _texture)
+    {
+        auto it = m_entries.find(_texture);
+        if (it == m_entries.end())
+            return;
+
+        Entry& entry = it->second;
+
+        // Same size - pixels are updated in place
+        if (entry.pageIndex >= 0 &&
+            isTextureSuitable(_texture) &&
+            _texture->getSize() + Vec2S(c_padding * 2) == entry.rect.size &&
+            uploadEntry(entry))
+            return;
+
+        unpackEntry(entry);
+        if (!packEntry(entry))
+            updateEntrySprites(entry);
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
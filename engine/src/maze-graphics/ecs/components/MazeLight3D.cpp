@@ -59,7 +59,10 @@ namespace Maze
         MAZE_IMPLEMENT_METACLASS_PROPERTY(bool, shadowCast, false, getShadowCast, setShadowCast),
         MAZE_IMPLEMENT_METACLASS_PROPERTY(F32, shadowCastSize, 10.0f, getShadowCastSize, setShadowCastSize),
         MAZE_IMPLEMENT_METACLASS_PROPERTY(F32, shadowCastNearZ, 1.0f, getShadowCastNearZ, setShadowCastNearZ),
-        MAZE_IMPLEMENT_METACLASS_PROPERTY(F32, shadowCastFarZ, 50.0f, getShadowCastFarZ, setShadowCastFarZ));
+        MAZE_IMPLEMENT_METACLASS_PROPERTY(F32, shadowCastFarZ, 50.0f, getShadowCastFarZ, setShadowCastFarZ),
+        MAZE_IMPLEMENT_METACLASS_PROPERTY(S32, shadowCascadesCount, 1, getShadowCascadesCount, setShadowCascadesCount),
+        MAZE_IMPLEMENT_METACLASS_PROPERTY(Vec4F, shadowCascadeSplits, Vec4F(10.0f, 25.0f, 50.0f, 100.0f), getShadowCascadeSplits, setShadowCascadeSplits),
+        MAZE_IMPLEMENT_METACLASS_PROPERTY(S32, shadowDistantCascadesUpdateInterval, 1, getShadowDistantCascadesUpdateInterval, setShadowDistantCascadesUpdateInterval));
 
     //////////////////////////////////////////
     MAZE_IMPLEMENT_MEMORY_ALLOCATION_BLOCK(Light3D);
@@ -251,152 +251,109 @@ namespace Maze
 
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(MeshRendererDefaultPassGatherRenderUnits,
-        MAZE_ECS_TAGS(MAZE_HS("render")),
-        {},
-        Render3DDefaultPassGatherRenderUnitsEvent& _event,
-        Entity* _entity,
-        MeshRenderer* _meshRenderer,
-        Transform3D* _transform3D)
+    void MeshRenderer::gatherDefaultPassRenderUnits(
+        Transform3D* _transform3D,
+        DefaultPassParams const& _params,
+        Vector<RenderUnit>& _outRenderUnits)
     {
-        if (!_meshRenderer->getEnabled())
+        if (!m_enabled)
             return;
 
-        if (_meshRenderer->getRenderMask() && _meshRenderer->getRenderMask()->getMask() & _event.getPassParams()->renderMask)
-        {
-            if (_meshRenderer->getRenderMesh())
-            {
-                RenderMeshPtr const& renderMesh = _meshRenderer->getRenderMesh();
-
-                // Frustum culling (render meshes built from raw VAOs have no
-                // CPU-side bounds and are always drawn)
-                if (renderMesh->isAABBValid())
-                {
-                    Vec3F boundsCenterWS;
-                    F32 boundsRadiusWS;
-                    GraphicsUtilsHelper::CalculateWorldBoundingSphere(
-                        renderMesh->getAABB(),
-                        _transform3D->getWorldTransform(),
-                        boundsCenterWS,
-                        boundsRadiusWS);
-
-                    if (!_event.getPassParams()->cameraFrustum.containsSphere(boundsCenterWS, boundsRadiusWS))
-                        return;
-                }
+        if (!m_renderMask || !(m_renderMask->getMask() & _params.renderMask))
+            return;
 
-                Vector<MaterialAssetRef> const& materials = _meshRenderer->getMaterialRefs();
-                Vector<VertexArrayObjectPtr> const& vaos = renderMesh->getVertexArrayObjects();
+        RenderMeshPtr const& renderMesh = getRenderMesh();
+        if (!renderMesh)
+            return;
 
-                if (vaos.empty())
-                    return;
+        Vector<VertexArrayObjectPtr> const& vaos = renderMesh->getVertexArrayObjects();
+        if (vaos.empty())
+            return;
 
-                S32 c = (S32)Math::Max(vaos.size(), materials.size());
+        S32 c = (S32)Math::Max(vaos.size(), m_materialRefs.size());
 
-                for (S32 i = 0, in = c; i < in; ++i)
-                {
-                    MaterialPtr const* material = nullptr;
-                    if (!materials.empty())
-                        material = &materials[i % materials.size()].getMaterial();
+        for (S32 i = 0, in = c; i < in; ++i)
+        {
+            MaterialPtr const* material = nullptr;
+            if (!m_materialRefs.empty())
+                material = &m_materialRefs[i % m_materialRefs.size()].getMaterial();
 
-                    if (!material || !*material)
-                        material = &_meshRenderer->getRenderSystem()->getMaterialManager()->getErrorMaterial();
+            if (!material || !*material)
+                material = &m_renderSystem->getMaterialManager()->getErrorMaterial();
 
-                    RenderPassPtr const& firstRenderPass = (*material)->getFirstRenderPass();
-                    if (!firstRenderPass)
-                        continue;
+            RenderPassPtr const& firstRenderPass = (*material)->getFirstRenderPass();
+            if (!firstRenderPass)
+                continue;
 
 #if (MAZE_DEBUG)
-                    if (!firstRenderPass->getShader())
-                    {
-                        Debug::LogError("Mesh(EID: %u): Shader is null!", _entity->getId());
-                        return;
-                    }
-#endif
-                    VertexArrayObjectPtr const& vao = vaos[i % vaos.size()];
-
-                    _event.getRenderUnits()->emplace_back(
-                        firstRenderPass.get(),
-                        _transform3D->getWorldPosition(),
-                        _meshRenderer,
-                        i,
-                        reinterpret_cast<U64>(&_transform3D->getWorldTransform()),
-                        static_cast<S32>(vao->getResourceId().getIndex()));
-                }
+            if (!firstRenderPass->getShader())
+            {
+                Debug::LogError("Mesh(EID: %u): Shader is null!", getEntityId());
+                return;
             }
+#endif
+            VertexArrayObjectPtr const& vao = vaos[i % vaos.size()];
+
+            _outRenderUnits.emplace_back(
+                firstRenderPass.get(),
+                _transform3D->getWorldPosition(),
+                this,
+                i,
+                reinterpret_cast<U64>(&_transform3D->getWorldTransform()),
+                static_cast<S32>(vao->getResourceId().getIndex()));
         }
     }
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(MeshRendererShadowPassGatherRenderUnits,
-        MAZE_ECS_TAGS(MAZE_HS("render")),
-        {},
-        Render3DShadowPassGatherRenderUnitsEvent& _event,
-        Entity* _entity,
-        MeshRenderer* _meshRenderer,
-        Transform3D* _transform3D)
+    void MeshRenderer::gatherShadowPassRenderUnits(
+        Transform3D* _transform3D,
+        ShadowPassParams const& _params,
+        Vector<RenderUnit>& _outRenderUnits)
     {
-        if (!_meshRenderer->getEnabled())
+        if (!m_enabled)
+            return;
+
+        if (!m_renderMask || !(m_renderMask->getMask() & _params.renderMask))
+            return;
+
+        RenderMeshPtr const& renderMesh = getRenderMesh();
+        if (!renderMesh)
+            return;
+
+        Vector<VertexArrayObjectPtr> const& vaos = renderMesh->getVertexArrayObjects();
+        if (vaos.empty())
             return;
 
-        if (_meshRenderer->getRenderMask() && _meshRenderer->getRenderMask()->getMask() & _event.getPassParams()->renderMask)
+        S32 c = (S32)Math::Max(vaos.size(), m_materialRefs.size());
+
+        for (S32 i = 0, in = c; i < in; ++i)
         {
-            if (_meshRenderer->getRenderMesh())
-            {
-                RenderMeshPtr const& renderMesh = _meshRenderer->getRenderMesh();
-
-                // Frustum culling against the shadow casting volume
-                if (renderMesh->isAABBValid())
-                {
-                    Vec3F boundsCenterWS;
-                    F32 boundsRadiusWS;
-                    GraphicsUtilsHelper::CalculateWorldBoundingSphere(
-                        renderMesh->getAABB(),
-                        _transform3D->getWorldTransform(),
-                        boundsCenterWS,
-                        boundsRadiusWS);
-
-                    if (!_event.getPassParams()->mainLightFrustum.containsSphere(boundsCenterWS, boundsRadiusWS))
-                        return;
-                }
-
-                Vector<MaterialAssetRef> const& materials = _meshRenderer->getMaterialRefs();
-                Vector<VertexArrayObjectPtr> const& vaos = renderMesh->getVertexArrayObjects();
-
-                if (vaos.empty())
-                    return;
-
-                S32 c = (S32)Math::Max(vaos.size(), materials.size());
-
-                for (S32 i = 0, in = c; i < in; ++i)
-                {
-                    MaterialPtr const* material = nullptr;
-                    if (!materials.empty())
-                        material = &materials[i % materials.size()].getMaterial();
-
-                    if (!material || !*material)
-                        material = &_meshRenderer->getRenderSystem()->getMaterialManager()->getErrorMaterial();
-
-                    RenderPassPtr const& firstShadowRenderPass = (*material)->getFirstRenderPass(RenderPassType::Shadow);
-                    if (!firstShadowRenderPass)
-                        continue;
+            MaterialPtr const* material = nullptr;
+            if (!m_materialRefs.empty())
+                material = &m_materialRefs[i % m_materialRefs.size()].getMaterial();
+
+            if (!material || !*material)
+                material = &m_renderSystem->getMaterialManager()->getErrorMaterial();
+
+            RenderPassPtr const& firstShadowRenderPass = (*material)->getFirstRenderPass(RenderPassType::Shadow);
+            if (!firstShadowRenderPass)
+                continue;
 #if (MAZE_DEBUG)
-                    if (!firstShadowRenderPass->getShader())
-                    {
-                        Debug::LogError("Mesh(EID: %u): Shader is null!", _entity->getId());
-                        return;
-                    }
-#endif
-                    VertexArrayObjectPtr const& vao = vaos[i % vaos.size()];
-
-                    _event.getRenderUnits()->emplace_back(
-                        firstShadowRenderPass.get(),
-                        _transform3D->getWorldPosition(),
-                        _meshRenderer,
-                        i,
-                        reinterpret_cast<U64>(&_transform3D->getWorldTransform()),
-                        static_cast<S32>(vao->getResourceId().getIndex()));
-                }
+            if (!firstShadowRenderPass->getShader())
+            {
+                Debug::LogError("Mesh(EID: %u): Shader is null!", getEntityId());
+                return;
             }
+#endif
+            VertexArrayObjectPtr const& vao = vaos[i % vaos.size()];
+
+            _outRenderUnits.emplace_back(
+                firstShadowRenderPass.get(),
+                _transform3D->getWorldPosition(),
+                this,
+                i,
+                reinterpret_cast<U64>(&_transform3D->getWorldTransform()),
+                static_cast<S32>(vao->getResourceId().getIndex()));
         }
     }
 
@@ -154,6 +154,24 @@ namespace Maze
     }
 
 
+    //////////////////////////////////////////
+    inline AABB2D CalculateCanvasMeshBounds(
+        AABB3D const& _localAABB,
+        TMat const& _transform)
+    {
+        Vec2F lb = _transform.transform(Vec2F(_localAABB.getMinX(), _localAABB.getMinY()));
+        Vec2F rb = _transform.transform(Vec2F(_localAABB.getMaxX(), _localAABB.getMinY()));
+        Vec2F rt = _transform.transform(Vec2F(_localAABB.getMaxX(), _localAABB.getMaxY()));
+        Vec2F lt = _transform.transform(Vec2F(_localAABB.getMinX(), _localAABB.getMaxY()));
+
+        return AABB2D(
+            Math::Min(lb.x, rb.x, rt.x, lt.x),
+            Math::Min(lb.y, rb.y, rt.y, lt.y),
+            Math::Max(lb.x, rb.x, rt.x, lt.x),
+            Math::Max(lb.y, rb.y, rt.y, lt.y));
+    }
+
+
     //////////////////////////////////////////
     // Class RenderControllerModule2D
     //
@@ -298,9 +316,58 @@ namespace Maze
                 // View position
                 renderTarget->setViewPosition(canvasCameraPosition);
 
+                // Everything outside of the root viewport is clipped by the viewport itself
+                m_clipBoundsStack.clear();
+                if (canvas->getClipViewport() && canvas != rootCanvas)
+                {
+                    Vec2F renderTargetSize = (Vec2F)renderTarget->getRenderTargetSize();
+                    Rect2F p = viewport.intersectedCopy(rootViewport);
+                    Vec2F clipPosition = (p.position - rootViewport.position) * renderTargetSize;
+                    m_clipBoundsStack.emplace_back(
+                        AABB2D(clipPosition, clipPosition + p.size * renderTargetSize));
+                }
+                else
+                {
+                    m_clipBoundsStack.emplace_back(
+                        AABB2D(Vec2F::c_zero, viewportSize));
+                }
+
+
+                // Sprites which share the render pass and the texture (atlas page) with the previous sprite
+                // don't rebind u_baseMap, so RenderQueue merges their instanced quads into a single draw call
+                RenderPass const* spriteBatchRenderPass = nullptr;
+                ResourceId spriteBatchTexture2DId = c_invalidResourceId;
+
+                auto resetSpriteBatch =
+                    [&]()
+                    {
+                        spriteBatchRenderPass = nullptr;
+                        spriteBatchTexture2DId = c_invalidResourceId;
+                    };
+
+                auto selectSpriteRenderPass =
+                    [&](RenderPass* _renderPass, ResourceId _texture2DId, Texture2D const* _spriteTexture)
+                    {
+                        renderQueue->addSelectRenderPassCommand(_renderPass, false);
+
+                        if (spriteBatchRenderPass == _renderPass && spriteBatchTexture2DId == _texture2DId)
+                            return;
+
+                        renderQueue->addSetShaderUniformCommandTexture2D(MAZE_HCS("u_baseMap"), _texture2DId);
+                        renderQueue->addSetShaderUniformCommand(MAZE_HCS("u_baseMapTexelSize"), _spriteTexture->getInvSize());
+                        renderQueue->addBindTexturesCommand();
+
+                        spriteBatchRenderPass = _renderPass;
+                        spriteBatchTexture2DId = _texture2DId;
+                    };
 
                 for (auto const& commandData : canvasRenderData.commands)
                 {
+                    if (commandData.type != CanvasRenderCommandType::PushScissorMask &&
+                        commandData.type != CanvasRenderCommandType::PopScissorMask &&
+                        !isCanvasRenderCommandVisible(commandData, m_clipBoundsStack.back()))
+                        continue;
+
                     switch (commandData.type)
                     {
                         case CanvasRenderCommandType::DrawMeshRenderer:
@@ -310,6 +377,7 @@ namespace Maze
                                 {
                                     renderQueue->addSelectRenderPassCommand(_renderPass, true);
                                 });
+                            resetSpriteBatch();
                             break;
                         }
 
@@ -320,6 +388,7 @@ namespace Maze
                                 {
                                     renderQueue->addSelectRenderPassCommand(_renderPass, true);
                                 });
+                            resetSpriteBatch();
                             break;
                         }
 
@@ -335,24 +404,7 @@ namespace Maze
                                 DrawCanvasMeshRenderer(_renderTarget, renderQueue, commandData.meshRenderer, commandData.transform,
                                     [&](RenderPass* _renderPass)
                                     {
-                                        // #TODO
-                                        //bool isSpriteTextureSet = false;
-                                        //if (renderQueue->getCurrentRenderPass())
-                                        //{
-                                        //    ShaderUniformPtr const& shaderUniform = renderQueue->getCurrentRenderPass()->getShader()->ensureUniform(MAZE_HCS("u_baseMap"));
-                                        //    if (shaderUniform)
-                                        //        isSpriteTextureSet = spriteTexture != shaderUniform->getTexture().get();
-                                        //}
-
-                                        renderQueue->addSelectRenderPassCommand(_renderPass, false);
-
-                                        // if (!isSpriteTextureSet)
-                                        {
-                                            renderQueue->addSetShaderUniformCommandTexture2D(MAZE_HCS("u_baseMap"), texture2DId);
-                                            renderQueue->addSetShaderUniformCommand(MAZE_HCS("u_baseMapTexelSize"), spriteTexture->getInvSize());
-                                        }
-
-                                        renderQueue->addBindTexturesCommand();
+                                        selectSpriteRenderPass(_renderPass, texture2DId, spriteTexture);
                                     });
                             }
                             break;
@@ -364,30 +416,13 @@ namespace Maze
                             Texture2D const* spriteTexture = Texture2D::GetResourceFast(texture2DId);
                             if (!spriteTexture)
                                 spriteTexture = TextureManager::GetCurrentInstancePtr()->getBuiltinTexture2D(BuiltinTexture2DType::Error).get();
+
                             if (spriteTexture)
                             {
-
                                 DrawCanvasMeshRendererInstanced(_renderTarget, renderQueue, commandData.meshRendererInstanced,
                                     [&](RenderPass* _renderPass)
                                     {
-                                        // #TODO
-                                        //bool isSpriteTextureSet = false;
-                                        //if (renderQueue->getCurrentRenderPass())
-                                        //{
-                                        //    ShaderUniformPtr const& shaderUniform = renderQueue->getCurrentRenderPass()->getShader()->ensureUniform(MAZE_HCS("u_baseMap"));
-                                        //    if (shaderUniform)
-                                        //        isSpriteTextureSet = spriteTexture != shaderUniform->getTexture().get();
-                                        //}
-
-                                        renderQueue->addSelectRenderPassCommand(_renderPass, false);
-
-                                        // if (!isSpriteTextureSet)
-                                        {
-                                            renderQueue->addSetShaderUniformCommandTexture2D(MAZE_HCS("u_baseMap"), texture2DId);
-                                            renderQueue->addSetShaderUniformCommand(MAZE_HCS("u_baseMapTexelSize"), spriteTexture->getInvSize());
-                                        }
-
-                                        renderQueue->addBindTexturesCommand();
+                                        selectSpriteRenderPass(_renderPass, texture2DId, spriteTexture);
                                     });
                             }
                             break;
@@ -404,12 +439,19 @@ namespace Maze
                             rect.size /= renderTargetSize;
                             rect.position += rootViewport.position;
                             renderQueue->addPushScissorRectCommand(rect);
+
+                            AABB2D clipBounds = m_clipBoundsStack.back();
+                            clipBounds.applyIntersection(aabb);
+                            m_clipBoundsStack.emplace_back(clipBounds);
                             break;
                         }
 
                         case CanvasRenderCommandType::PopScissorMask:
                         {
                             renderQueue->addPopScissorRectCommand();
+
+                            if (m_clipBoundsStack.size() > 1)
+                                m_clipBoundsStack.pop_back();
                             break;
                         }
 
@@ -703,7 +745,52 @@ namespace Maze
 
         m_sortedMeshRenderersDirty = false;
     }
-    
+
+    //////////////////////////////////////////
+    bool RenderControllerModule2D::isCanvasRenderCommandVisible(
+        CanvasRenderCommand const& _command,
+        AABB2D const& _clipBounds) const
+    {
+        if (!_clipBounds.isValid())
+            return false;
+
+        switch (_command.type)
+        {
+            // Sprite quads never leave the transform rect
+            case CanvasRenderCommandType::DrawSpriteRenderer:
+            case CanvasRenderCommandType::DrawSpriteRendererInstanced:
+            {
+                return _clipBounds.intersects(_command.transform->getWorldAABB());
+            }
+
+            case CanvasRenderCommandType::DrawMeshRenderer:
+            {
+                RenderMeshPtr const& renderMesh = _command.meshRenderer->getRenderMesh();
+                if (!renderMesh || !renderMesh->isAABBValid())
+                    return true;
+
+                return _clipBounds.intersects(
+                    CalculateCanvasMeshBounds(renderMesh->getAABB(), _command.transform->getWorldTransform()));
+            }
+
+            // Instance matrices are in the world space already (text glyphs may overflow the transform rect)
+            case CanvasRenderCommandType::DrawMeshRendererInstanced:
+            {
+                RenderMeshPtr const& renderMesh = _command.meshRendererInstanced->getRenderMesh();
+                if (!renderMesh || !renderMesh->isAABBValid())
+                    return true;
+
+                for (TMat const& modelMatrix : _command.meshRendererInstanced->getModelMatrices())
+                    if (_clipBounds.intersects(CalculateCanvasMeshBounds(renderMesh->getAABB(), modelMatrix)))
+                        return true;
+
+                return false;
+            }
+
+            default:
+                return true;
+        }
+    }
     
 } // namespace Maze
 //////////////////////////////////////////
@@ -26,6 +26,7 @@
 //////////////////////////////////////////
 #include "MazeGraphicsHeader.hpp"
 #include "maze-graphics/ecs/components/MazeRenderControllerModule3D.hpp"
+#include "maze-graphics/MazeLightClusterGrid.hpp"
 #include "maze-core/ecs/MazeEcsWorld.hpp"
 #include "maze-core/utils/MazeProfiler.hpp"
 #include "maze-graphics/ecs/components/MazeCamera3D.hpp"
@@ -100,6 +101,27 @@ namespace Maze
         return key;
     }
 
+    //////////////////////////////////////////
+    static Mat4F ConvertTMatToMat4(TMat const& _tm)
+    {
+        Mat4F result;
+        result.setRow(0, Vec4F(_tm[0], 0.0f));
+        result.setRow(1, Vec4F(_tm[1], 0.0f));
+        result.setRow(2, Vec4F(_tm[2], 0.0f));
+        result.setRow(3, Vec4F(_tm[3], 1.0f));
+        return result;
+    }
+
+    //////////////////////////////////////////
+    static Size CalculateMaterialsKey(MeshRenderer const* _meshRenderer)
+    {
+        Size key = _meshRenderer->getMaterialRefs().size();
+        for (MaterialAssetRef const& materialRef : _meshRenderer->getMaterialRefs())
+            key = key * 31u + reinterpret_cast<Size>(materialRef.getMaterial().get());
+
+        return key;
+    }
+
 
     //////////////////////////////////////////
     // Class RenderControllerModule3D
@@ -136,13 +158,216 @@ namespace Maze
         m_cameras3DSample = _world->requestInclusiveSample<Camera3D>();
         m_lights3DSample = _world->requestInclusiveSample<Light3D>();
 
+        m_meshRenderersSample = _world->requestInclusiveSample<MeshRenderer, Transform3D>();
+        m_meshRenderersSample->eventEntityAdded.subscribe(this, &RenderControllerModule3D::notifyMeshRendererEntityAdded);
+        m_meshRenderersSample->eventEntityWillBeRemoved.subscribe(this, &RenderControllerModule3D::notifyMeshRendererEntityWillBeRemoved);
+        for (auto const& entityData : m_meshRenderersSample->getEntitiesData())
+            notifyMeshRendererEntityAdded(entityData.entity);
+
         return true;
     }
 
     //////////////////////////////////////////
     void RenderControllerModule3D::preRender()
     {
+        ++m_frameIndex;
+
+        // Renderers removed between the frames are reported to the shadow cascades of this frame
+        m_shadowCastersDirtyAABBs.clear();
+        m_shadowCastersDirtyAABBs.swap(m_shadowCastersRemovedAABBs);
+
+        for (Size i = 0; i < m_shadowCascadesCaches.size(); )
+        {
+            if (!m_shadowCascadesCaches[i].shadowBuffer.lock())
+                m_shadowCascadesCaches.erase(m_shadowCascadesCaches.begin() + i);
+            else
+                ++i;
+        }
+
+        updateMeshRenderersTree();
+
+        if (m_skinningPaletteBuffer)
+            m_skinningPaletteBuffer->reset();
+    }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::notifyMeshRendererEntityAdded(Entity* _entity)
+    {
+        if (m_meshRendererProxyIndices.find(_entity) != m_meshRendererProxyIndices.end())
+            return;
+
+        // The tree proxy is created on the next tree update, when the bounds are known
+        MeshRendererCullingProxy proxy;
+        proxy.entity = _entity;
+        proxy.meshRenderer = _entity->getComponentRaw<MeshRenderer>();
+        proxy.transform = _entity->getComponentRaw<Transform3D>();
 
+        m_meshRendererProxyIndices.emplace(_entity, (S32)m_meshRendererProxies.size());
+        m_meshRendererProxies.push_back(proxy);
+    }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::notifyMeshRendererEntityWillBeRemoved(Entity* _entity)
+    {
+        auto it = m_meshRendererProxyIndices.find(_entity);
+        if (it == m_meshRendererProxyIndices.end())
+            return;
+
+        S32 index = it->second;
+        S32 lastIndex = (S32)m_meshRendererProxies.size() - 1;
+        m_meshRendererProxyIndices.erase(it);
+
+        if (m_meshRendererProxies[index].treeProxyId != DynamicAABBTree3D::c_nullNode)
+        {
+            m_shadowCastersRemovedAABBs.push_back(m_meshRenderersTree.getFatAABB(m_meshRendererProxies[index].treeProxyId));
+            m_meshRenderersTree.destroyProxy(m_meshRendererProxies[index].treeProxyId);
+        }
+
+        m_meshRendererProxies.eraseUnordered(m_meshRendererProxies.begin() + index);
+
+        // The last proxy is moved into the freed slot
+        if (index < lastIndex)
+        {
+            MeshRendererCullingProxy const& movedProxy = m_meshRendererProxies[index];
+            m_meshRendererProxyIndices[movedProxy.entity] = index;
+            if (movedProxy.treeProxyId != DynamicAABBTree3D::c_nullNode)
+                m_meshRenderersTree.setUserData(movedProxy.treeProxyId, reinterpret_cast<void*>(Size(index)));
+        }
+
+        for (Size i = 0; i < m_unboundedMeshRendererProxies.size(); )
+        {
+            S32& unboundedIndex = m_unboundedMeshRendererProxies[i];
+            if (unboundedIndex == index)
+            {
+                m_unboundedMeshRendererProxies.eraseUnordered(m_unboundedMeshRendererProxies.begin() + i);
+                continue;
+            }
+
+            if (unboundedIndex == lastIndex)
+                unboundedIndex = index;
+
+            ++i;
+        }
+    }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::updateMeshRenderersTree()
+    {
+        MAZE_PROFILE_EVENT("3D Update Mesh Renderers Tree");
+
+        m_unboundedMeshRendererProxies.clear();
+
+        // Proxies are refitted only when the world transform or the mesh bounds are changed,
+        // the tree itself is touched only when an object leaves its fat AABB
+        for (S32 i = 0, in = (S32)m_meshRendererProxies.size(); i < in; ++i)
+        {
+            MeshRendererCullingProxy& proxy = m_meshRendererProxies[i];
+
+            RenderMeshPtr const& renderMesh = proxy.meshRenderer->getRenderMesh();
+            if (!renderMesh || !renderMesh->isAABBValid())
+            {
+                if (proxy.treeProxyId != DynamicAABBTree3D::c_nullNode)
+                {
+                    m_shadowCastersDirtyAABBs.push_back(m_meshRenderersTree.getFatAABB(proxy.treeProxyId));
+                    m_meshRenderersTree.destroyProxy(proxy.treeProxyId);
+                    proxy.treeProxyId = DynamicAABBTree3D::c_nullNode;
+                }
+
+                // Render meshes built from raw VAOs have no CPU-side bounds and are always drawn
+                if (renderMesh)
+                    m_unboundedMeshRendererProxies.push_back(i);
+
+                continue;
+            }
+
+            AABB3D const& localAABB = renderMesh->getAABB();
+            if (proxy.treeProxyId == DynamicAABBTree3D::c_nullNode)
+            {
+                AABB3D worldAABB = GraphicsUtilsHelper::CalculateWorldAABB(localAABB, proxy.transform->getWorldTransform());
+                m_shadowCastersDirtyAABBs.push_back(worldAABB);
+
+                proxy.localAABB = localAABB;
+                proxy.treeProxyId = m_meshRenderersTree.createProxy(
+                    worldAABB,
+                    reinterpret_cast<void*>(Size(i)));
+
+                proxy.enabled = proxy.meshRenderer->getEnabled();
+                proxy.renderMask = proxy.meshRenderer->getRenderMask() ? proxy.meshRenderer->getRenderMask()->getMask() : 0;
+                proxy.materialsKey = CalculateMaterialsKey(proxy.meshRenderer);
+                continue;
+            }
+
+            // A caster that is toggled, remasked or rematerialized changes the shadow in place
+            bool enabled = proxy.meshRenderer->getEnabled();
+            S32 renderMask = proxy.meshRenderer->getRenderMask() ? proxy.meshRenderer->getRenderMask()->getMask() : 0;
+            Size materialsKey = CalculateMaterialsKey(proxy.meshRenderer);
+            if (proxy.enabled != enabled || proxy.renderMask != renderMask || proxy.materialsKey != materialsKey)
+            {
+                m_shadowCastersDirtyAABBs.push_back(m_meshRenderersTree.getFatAABB(proxy.treeProxyId));
+
+                proxy.enabled = enabled;
+                proxy.renderMask = renderMask;
+                proxy.materialsKey = materialsKey;
+            }
+
+            if (proxy.transform->isWorldTransformChanged() || proxy.localAABB != localAABB)
+            {
+                AABB3D worldAABB = GraphicsUtilsHelper::CalculateWorldAABB(localAABB, proxy.transform->getWorldTransform());
+
+                // The fat AABB always encloses the previous bounds
+                m_shadowCastersDirtyAABBs.push_back(m_meshRenderersTree.getFatAABB(proxy.treeProxyId));
+                m_shadowCastersDirtyAABBs.push_back(worldAABB);
+
+                proxy.localAABB = localAABB;
+                m_meshRenderersTree.moveProxy(
+                    proxy.treeProxyId,
+                    worldAABB);
+            }
+        }
+    }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::gatherMeshRenderersDefaultPass(DefaultPassParams const& _params)
+    {
+        Frustum const& frustum = _params.cameraFrustum;
+        m_meshRenderersTree.query(
+            [&frustum](AABB3D const& _aabb)
+            {
+                return frustum.calculateAABBContainment(_aabb);
+            },
+            [&](S32 _proxyId, void* _userData)
+            {
+                MeshRendererCullingProxy const& proxy = m_meshRendererProxies[reinterpret_cast<Size>(_userData)];
+                proxy.meshRenderer->gatherDefaultPassRenderUnits(proxy.transform, _params, m_renderData);
+            });
+
+        for (S32 index : m_unboundedMeshRendererProxies)
+        {
+            MeshRendererCullingProxy const& proxy = m_meshRendererProxies[index];
+            proxy.meshRenderer->gatherDefaultPassRenderUnits(proxy.transform, _params, m_renderData);
+        }
+    }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::gatherMeshRenderersShadowPass(ShadowPassParams const& _params)
+    {
+        Frustum const& frustum = _params.mainLightFrustum;
+        m_meshRenderersTree.query(
+            [&frustum](AABB3D const& _aabb)
+            {
+                return frustum.calculateAABBContainment(_aabb);
+            },
+            [&](S32 _proxyId, void* _userData)
+            {
+                MeshRendererCullingProxy const& proxy = m_meshRendererProxies[reinterpret_cast<Size>(_userData)];
+                proxy.meshRenderer->gatherShadowPassRenderUnits(proxy.transform, _params, m_renderData);
+            });
+
+        for (S32 index : m_unboundedMeshRendererProxies)
+        {
+            MeshRendererCullingProxy const& proxy = m_meshRendererProxies[index];
+            proxy.meshRenderer->gatherShadowPassRenderUnits(proxy.transform, _params, m_renderData);
+        }
     }
 
     //////////////////////////////////////////
@@ -224,11 +449,12 @@ namespace Maze
             if (_params.drawFlag)
             {
                 m_renderData.clear();
-                m_renderDataSorted.clear();
+                m_renderDataSortItems.clear();
 
                 {
                     MAZE_PROFILE_EVENT("3D Default GatherRenderUnits");
-                    m_world->broadcastEventImmediate<Render3DDefaultPassGatherRenderUnitsEvent>(_renderTarget, &_params, &m_renderData);
+                    gatherMeshRenderersDefaultPass(_params);
+                    m_world->broadcastEventImmediate<Render3DDefaultPassGatherRenderUnitsEvent>(_renderTarget, &_params, &m_renderData, &m_renderDataMutex);
                 }
 
                 S32 renderDataSize = (S32)m_renderData.size();
@@ -236,27 +462,21 @@ namespace Maze
                 {
                     MAZE_PROFILE_EVENT("3D Prepare Render Queue");
 
-                    m_renderDataSorted.reserve(renderDataSize);
+                    m_renderDataSortItems.resize(renderDataSize);
 
                     for (S32 i = 0; i < renderDataSize; ++i)
                     {
                         RenderUnit& data = m_renderData[i];
-                        m_renderDataSorted.push_back(&m_renderData[i]);
                         data.sqrDistanceToCamera = (cameraPosition - data.worldPosition).squaredLength();
                         data.sortKey = BuildRenderUnitSortKey(data);
+                        m_renderDataSortItems[i] = RadixSortKeyIndex(data.sortKey, (U32)i);
                     }
                 }
 
                 {
                     MAZE_PROFILE_EVENT("3D Sort Render Queue");
-                    // Sort render queue
-                    eastl::sort(
-                        m_renderDataSorted.begin(),
-                        m_renderDataSorted.end(),
-                        [](RenderUnit const* _a, RenderUnit const* _b)
-                        {
-                            return _a->sortKey < _b->sortKey;
-                        });
+                    // Transparent back-to-front order is a part of the key
+                    m_renderDataSorter.sort(m_renderDataSortItems);
                 }
 
 
@@ -267,7 +487,7 @@ namespace Maze
                     MAZE_PROFILE_EVENT("3D Default Render Queue");
                     for (S32 i = 0; i < renderDataSize; ++i)
                     {
-                        RenderUnit const& renderUnit = *m_renderDataSorted[i];
+                        RenderUnit const& renderUnit = m_renderData[m_renderDataSortItems[i].index];
 
                         RenderPass* renderPass = renderUnit.renderPass;
                         ShaderPtr const& shader = renderPass->getShader();
@@ -305,6 +525,9 @@ namespace Maze
             if (_endRenderQueueCallback)
                 _endRenderQueueCallback(renderQueue);
 
+            if (_params.skinningPaletteBuffer)
+                _params.skinningPaletteBuffer->upload(m_renderSystem->getShaderManager().get());
+
             {
                 MAZE_PROFILE_EVENT("3D Draw Render Queue");
                 renderQueue->draw();
@@ -317,21 +540,31 @@ namespace Maze
     //////////////////////////////////////////
     void RenderControllerModule3D::drawShadowPass(
         RenderBuffer* _shadowBuffer,
-        ShadowPassParams const& _params)
+        ShadowPassParams const& _params,
+        bool* _outDynamicCasters,
+        bool _clearDepth)
     {
         Vec3F lightPosition = _params.mainLightTransform.getTranslation();
 
         RenderQueuePtr const& renderQueue = _shadowBuffer->getRenderQueue();
 
+        if (_outDynamicCasters)
+            *_outDynamicCasters = false;
+
         if (_shadowBuffer->beginDraw())
         {
             renderQueue->clear();
 
-            renderQueue->addClearCurrentRenderTargetCommand(
-                false,
-                true);
+            // Only the cascade tile is cleared, the other cascades of the atlas are kept
+            // (if the render system does not limit the clear by the scissor rect, see drawMainLightShadowCascades)
+            renderQueue->addPushScissorRectCommand(_params.viewport);
+
+            if (_clearDepth)
+                renderQueue->addClearCurrentRenderTargetCommand(
+                    false,
+                    true);
 
-            _shadowBuffer->setViewport(0.0f, 0.0f, 1.0f, 1.0f);
+            _shadowBuffer->setViewport(_params.viewport);
 
             // Projection matrix
             _shadowBuffer->setProjectionMatrix(_params.mainLightProjectionMatrix);
@@ -349,16 +582,39 @@ namespace Maze
 
             {
                 MAZE_PROFILE_EVENT("3D Shadow GatherRenderUnits");
-                m_world->broadcastEventImmediate<Render3DShadowPassGatherRenderUnitsEvent>(_shadowBuffer, &_params, &m_renderData);
+                gatherMeshRenderersShadowPass(_params);
+
+                Size trackedRenderUnitsCount = m_renderData.size();
+                m_world->broadcastEventImmediate<Render3DShadowPassGatherRenderUnitsEvent>(_shadowBuffer, &_params, &m_renderData, &m_renderDataMutex);
+
+                if (_outDynamicCasters)
+                    *_outDynamicCasters = m_renderData.size() > trackedRenderUnitsCount || !m_unboundedMeshRendererProxies.empty();
             }
 
             S32 renderDataSize = (S32)m_renderData.size();
 
+            {
+                MAZE_PROFILE_EVENT("3D Sort Render Queue");
+
+                // Same keys as the default pass, but the depth is from the light -
+                // groups casters by pass and draws them front-to-back
+                m_renderDataSortItems.resize(renderDataSize);
+                for (S32 i = 0; i < renderDataSize; ++i)
+                {
+                    RenderUnit& data = m_renderData[i];
+                    data.sqrDistanceToCamera = (lightPosition - data.worldPosition).squaredLength();
+                    data.sortKey = BuildRenderUnitSortKey(data);
+                    m_renderDataSortItems[i] = RadixSortKeyIndex(data.sortKey, (U32)i);
+                }
+
+                m_renderDataSorter.sort(m_renderDataSortItems);
+            }
+
             {
                 MAZE_PROFILE_EVENT("3D Default Render Queue");
                 for (S32 i = 0; i < renderDataSize; ++i)
                 {
-                    RenderUnit const& renderUnit = m_renderData[i];
+                    RenderUnit const& renderUnit = m_renderData[m_renderDataSortItems[i].index];
 
                     renderQueue->addSelectRenderPassCommand(renderUnit.renderPass);
 
@@ -366,6 +622,11 @@ namespace Maze
                 }
             }
 
+            renderQueue->addPopScissorRectCommand();
+
+            if (_params.skinningPaletteBuffer)
+                _params.skinningPaletteBuffer->upload(m_renderSystem->getShaderManager().get());
+
             {
                 MAZE_PROFILE_EVENT("3D Draw Render Queue");
                 renderQueue->draw();
@@ -374,6 +635,290 @@ namespace Maze
             _shadowBuffer->endDraw();
         }
     }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::calculateShadowCascadesParams(
+        Light3D* _mainLight,
+        DefaultPassParams const& _params,
+        Vec2U const& _tileSize,
+        ShadowPassParams* _outCascadesParams)
+    {
+        S32 cascadesCount = _mainLight->getShadowCascadesCount();
+        TMat const& lightTransform = _mainLight->getTransform()->getWorldTransform();
+
+        // Single map is placed around the light itself
+        if (cascadesCount == 1)
+        {
+            ShadowPassParams& shadowParams = _outCascadesParams[0];
+            shadowParams.renderMask = _params.renderMask;
+            shadowParams.skinningPaletteBuffer = _params.skinningPaletteBuffer;
+            shadowParams.nearZ = _mainLight->getShadowCastNearZ();
+            shadowParams.farZ = _mainLight->getShadowCastFarZ();
+            shadowParams.mainLightTransform = lightTransform;
+            shadowParams.viewMatrix = lightTransform.inversed();
+            shadowParams.mainLightProjectionMatrix = Mat4F::CreateProjectionOrthographicLHMatrix(
+                -_mainLight->getShadowCastSize(),
+                +_mainLight->getShadowCastSize(),
+                -_mainLight->getShadowCastSize(),
+                +_mainLight->getShadowCastSize(),
+                shadowParams.nearZ,
+                shadowParams.farZ);
+            GraphicsUtilsHelper::CalculateCameraFrustum(
+                shadowParams.viewMatrix,
+                shadowParams.mainLightProjectionMatrix,
+                shadowParams.mainLightFrustum);
+            return;
+        }
+
+        // Cascades are fitted to the camera, only the light direction matters
+        TMat lightRotation = lightTransform;
+        lightRotation.resetScale();
+        lightRotation.setTranslation(Vec3F::c_zero);
+        TMat lightViewMatrix = lightRotation.inversed();
+
+        // Camera frustum edges in view space (any two points of the edge rays will do)
+        Mat4F inversedProjectionMatrix = _params.projectionMatrix.inversed();
+        Vec3F edgeStartsVS[4];
+        Vec3F edgeDirectionsVS[4];
+        for (S32 i = 0; i < 4; ++i)
+        {
+            F32 x = (i & 1) ? 1.0f : -1.0f;
+            F32 y = (i & 2) ? 1.0f : -1.0f;
+            Vec4F startVS = Vec4F(x, y, 0.0f, 1.0f) * inversedProjectionMatrix;
+            Vec4F endVS = Vec4F(x, y, 0.5f, 1.0f) * inversedProjectionMatrix;
+            edgeStartsVS[i] = startVS.xyz() / startVS.w;
+            edgeDirectionsVS[i] = endVS.xyz() / endVS.w - edgeStartsVS[i];
+        }
+
+        Vec4F const& splits = _mainLight->getShadowCascadeSplits();
+
+        // Casters in front of the cascade (towards the light) are taken within this distance
+        F32 castersDistance = Math::Max(_mainLight->getShadowCastFarZ(), 0.0f);
+
+        F32 sliceNearZ = _params.nearZ;
+        for (S32 c = 0; c < cascadesCount; ++c)
+        {
+            F32 sliceFarZ = Math::Clamp(splits[c], sliceNearZ, _params.farZ);
+
+            Vec3F cornersWS[8];
+            Vec3F centerWS = Vec3F::c_zero;
+            for (S32 i = 0; i < 4; ++i)
+            {
+                Vec3F const& edgeStart = edgeStartsVS[i];
+                Vec3F const& edgeDirection = edgeDirectionsVS[i];
+                cornersWS[i] = _params.cameraTransform.transform(
+                    edgeStart + edgeDirection * ((sliceNearZ - edgeStart.z) / edgeDirection.z));
+                cornersWS[i + 4] = _params.cameraTransform.transform(
+                    edgeStart + edgeDirection * ((sliceFarZ - edgeStart.z) / edgeDirection.z));
+                centerWS += cornersWS[i] + cornersWS[i + 4];
+            }
+            centerWS /= 8.0f;
+
+            // Bounding sphere of the slice does not depend on the camera rotation,
+            // so the cascade size is stable
+            F32 radius = 0.0f;
+            for (S32 i = 0; i < 8; ++i)
+                radius = Math::Max(radius, (cornersWS[i] - centerWS).length());
+            radius = Math::Max(Math::Ceil(radius * 16.0f) / 16.0f, 1.0f / 16.0f);
+
+            // Cascade moves by whole texels only - stops the shimmering of the shadow edges
+            F32 texelSize = 2.0f * radius / (F32)Math::Max(_tileSize.x, 1u);
+            Vec3F centerLS = lightViewMatrix.transform(centerWS);
+            centerLS.x = Math::Floor(centerLS.x / texelSize) * texelSize;
+            centerLS.y = Math::Floor(centerLS.y / texelSize) * texelSize;
+            centerLS.z = Math::Floor(centerLS.z / texelSize) * texelSize;
+
+            ShadowPassParams& shadowParams = _outCascadesParams[c];
+            shadowParams.renderMask = _params.renderMask;
+            shadowParams.skinningPaletteBuffer = _params.skinningPaletteBuffer;
+            shadowParams.cascadeIndex = c;
+            shadowParams.viewport = Rect2F((F32)(c % 2) * 0.5f, (F32)(c / 2) * 0.5f, 0.5f, 0.5f);
+            shadowParams.nearZ = centerLS.z - radius - castersDistance;
+            shadowParams.farZ = centerLS.z + radius;
+            shadowParams.viewMatrix = lightViewMatrix;
+            shadowParams.mainLightTransform = lightRotation;
+            shadowParams.mainLightTransform.setTranslation(
+                lightRotation.transform(Vec3F(centerLS.x, centerLS.y, shadowParams.nearZ)));
+            shadowParams.mainLightProjectionMatrix = Mat4F::CreateProjectionOrthographicLHMatrix(
+                centerLS.x - radius,
+                centerLS.x + radius,
+                centerLS.y - radius,
+                centerLS.y + radius,
+                shadowParams.nearZ,
+                shadowParams.farZ);
+            GraphicsUtilsHelper::CalculateCameraFrustum(
+                shadowParams.viewMatrix,
+                shadowParams.mainLightProjectionMatrix,
+                shadowParams.mainLightFrustum);
+
+            sliceNearZ = sliceFarZ;
+        }
+    }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::drawMainLightShadowCascades(
+        RenderBufferPtr const& _shadowBuffer,
+        Light3D* _mainLight,
+        DefaultPassParams& _params)
+    {
+        MAZE_PROFILE_EVENT("3D Shadow Cascades");
+
+        S32 cascadesCount = _mainLight->getShadowCascadesCount();
+        Vec2U shadowBufferSize = _shadowBuffer->getRenderTargetSize();
+        Vec2U tileSize = cascadesCount > 1 ? shadowBufferSize / 2u : shadowBufferSize;
+
+        ShadowCascadesCache* cache = nullptr;
+        for (ShadowCascadesCache& cascadesCache : m_shadowCascadesCaches)
+        {
+            if (cascadesCache.shadowBufferRaw == _shadowBuffer.get())
+            {
+                cache = &cascadesCache;
+                break;
+            }
+        }
+
+        if (!cache)
+        {
+            m_shadowCascadesCaches.emplace_back();
+            cache = &m_shadowCascadesCaches.back();
+            cache->shadowBufferRaw = _shadowBuffer.get();
+        }
+
+        // Dirty bounds of the skipped frames are lost, so the atlas is re-rendered in full
+        if (   cache->shadowBuffer.lock().get() != _shadowBuffer.get()
+            || cache->shadowBufferSize != shadowBufferSize
+            || cache->cascadesCount != cascadesCount
+            || cache->frameIndex + 1u < m_frameIndex)
+        {
+            cache->shadowBuffer = _shadowBuffer;
+            cache->shadowBufferSize = shadowBufferSize;
+            cache->cascadesCount = cascadesCount;
+            for (ShadowCascadeCache& cascadeCache : cache->cascades)
+                cascadeCache = ShadowCascadeCache();
+        }
+        cache->frameIndex = m_frameIndex;
+
+        ShadowPassParams cascadesParams[MAZE_SHADOW_CASCADES_MAX];
+        calculateShadowCascadesParams(_mainLight, _params, tileSize, cascadesParams);
+
+        Vec4F const& splits = _mainLight->getShadowCascadeSplits();
+        U32 updateInterval = (U32)_mainLight->getShadowDistantCascadesUpdateInterval();
+
+        // If the clear wipes the whole atlas the cascades can not be cached,
+        // so the atlas is cleared once and all of the cascades are redrawn
+        bool cacheAllowed = m_renderSystem->isScissoredClearSupported();
+        for (S32 i = 0; i < cascadesCount; ++i)
+        {
+            ShadowPassParams const& shadowParams = cascadesParams[i];
+            ShadowCascadeCache& cascadeCache = cache->cascades[i];
+
+            Mat4F viewProjectionMatrix = ConvertTMatToMat4(shadowParams.viewMatrix) * shadowParams.mainLightProjectionMatrix;
+
+            // Casters gathered by the events (skinned meshes, particles etc.) may change without moving
+            if (cascadeCache.valid && !cascadeCache.dirty)
+                cascadeCache.dirty = cascadeCache.dynamicCasters || isShadowCastersChanged(cascadeCache.frustum);
+
+            bool changed =
+                   !cacheAllowed
+                || !cascadeCache.valid
+                || cascadeCache.dirty
+                || cascadeCache.renderMask != shadowParams.renderMask
+                || cascadeCache.viewProjectionMatrix != viewProjectionMatrix;
+
+            // Distant cascades are staggered over the frames
+            bool updateAllowed =
+                   !cacheAllowed
+                || !cascadeCache.valid
+                || i == 0
+                || ((m_frameIndex + (U32)i) % updateInterval) == 0u;
+
+            if (changed && updateAllowed)
+            {
+                drawShadowPass(
+                    _shadowBuffer.get(),
+                    shadowParams,
+                    &cascadeCache.dynamicCasters,
+                    cacheAllowed || i == 0);
+
+                cascadeCache.viewProjectionMatrix = viewProjectionMatrix;
+                cascadeCache.frustum = shadowParams.mainLightFrustum;
+                cascadeCache.renderMask = shadowParams.renderMask;
+                cascadeCache.valid = true;
+                cascadeCache.dirty = false;
+            }
+
+            // Not updated cascade is sampled with the matrix it was rendered with
+            _params.mainLightShadowCascadeMatrices[i] = cascadeCache.viewProjectionMatrix;
+            _params.mainLightShadowCascadeRects[i] = Vec4F(
+                shadowParams.viewport.position.x,
+                shadowParams.viewport.position.y,
+                shadowParams.viewport.size.x,
+                shadowParams.viewport.size.y);
+            _params.mainLightShadowCascadeSplits[i] = cascadesCount > 1 ? Math::Min(splits[i], _params.farZ) : _params.farZ;
+        }
+
+        _params.mainLightShadowCascadesCount = cascadesCount;
+        _params.mainLightShadowMap = _shadowBuffer->getDepthTexture()->cast<Texture2D>();
+
+        // Shaders without the cascades support get the first cascade remapped to its atlas tile
+        Vec4F const& firstRect = _params.mainLightShadowCascadeRects[0];
+        Mat4F firstRectMatrix(
+            firstRect.z, 0.0f, 0.0f, 0.0f,
+            0.0f, firstRect.w, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,
+            2.0f * firstRect.x + firstRect.z - 1.0f, 2.0f * firstRect.y + firstRect.w - 1.0f, 0.0f, 1.0f);
+        _params.mainLightViewProjectionMatrix = _params.mainLightShadowCascadeMatrices[0] * firstRectMatrix;
+    }
+
+    //////////////////////////////////////////
+    bool RenderControllerModule3D::isShadowCastersChanged(Frustum const& _frustum) const
+    {
+        for (AABB3D const& aabb : m_shadowCastersDirtyAABBs)
+            if (_frustum.calculateAABBContainment(aabb) != AABBContainment::Outside)
+                return true;
+
+        return false;
+    }
+
+    //////////////////////////////////////////
+    void RenderControllerModule3D::updateShadowCascadesUniforms(DefaultPassParams const& _params)
+    {
+        ShaderManagerPtr const& shaderManager = m_renderSystem->getShaderManager();
+        if (!shaderManager)
+            return;
+
+        static HashedCString const c_cascadeMatrixUniformNames[MAZE_SHADOW_CASCADES_MAX] =
+        {
+            MAZE_HCS("u_global_shadowCascadeMatrix0"),
+            MAZE_HCS("u_global_shadowCascadeMatrix1"),
+            MAZE_HCS("u_global_shadowCascadeMatrix2"),
+            MAZE_HCS("u_global_shadowCascadeMatrix3")
+        };
+
+        Vec2F texelSize = Vec2F::c_zero;
+        if (_params.mainLightShadowMap && _params.mainLightShadowCascadesCount > 0)
+        {
+            Vec2S shadowMapSize = _params.mainLightShadowMap->getSize();
+            texelSize = Vec2F(
+                1.0f / (F32)Math::Max(shadowMapSize.x, 1),
+                1.0f / (F32)Math::Max(shadowMapSize.y, 1));
+        }
+
+        shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_shadowCascadesParams"))->setValue(
+            Vec4F((F32)_params.mainLightShadowCascadesCount, texelSize.x, texelSize.y, 0.0f));
+
+        if (_params.mainLightShadowCascadesCount == 0)
+            return;
+
+        shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_shadowCascadeSplits"))->setValue(
+            _params.mainLightShadowCascadeSplits);
+        shaderManager->ensureGlobalShaderUniform(MAZE_HCS("u_global_shadowCascadeRects"))->setValue(
+            _params.mainLightShadowCascadeRects, (U32)MAZE_SHADOW_CASCADES_MAX);
+
+        for (S32 i = 0; i < _params.mainLightShadowCascadesCount; ++i)
+            shaderManager->ensureGlobalShaderUniform(c_cascadeMatrixUniformNames[i])->setValue(
+                _params.mainLightShadowCascadeMatrices[i]);
+    }
     
     //////////////////////////////////////////
     void RenderControllerModule3D::draw(RenderTarget* _renderTarget)
@@ -422,7 +967,12 @@ namespace Maze
             defaultParams.clipViewport = camera->getClipViewport();
             defaultParams.lightingSettings = camera->getLightingSettings().get();
 
+            if (!m_skinningPaletteBuffer)
+                m_skinningPaletteBuffer = SkinningPaletteBuffer::Create(m_renderSystem.get());
+            defaultParams.skinningPaletteBuffer = m_skinningPaletteBuffer.get();
+
             S32 dynLightsCount = 0;
+            m_clusterLights.clear();
 
             // Find main light for this camera
             // Vector<Light3D*> lights3D;
@@ -446,7 +996,7 @@ namespace Maze
                         else
                         if (_light3D->getLightType() == Light3DType::Point)
                         {
-                            if (dynLightsCount < MAZE_DYNAMIC_LIGHTS_MAX)
+                            if (m_clusterLights.size() < MAZE_CLUSTERED_LIGHTS_MAX)
                             {
                                 TMat const& lightTm = _light3D->getTransform()->getWorldTransform();
                                 F32 lightRadiusWS = _light3D->getRadius() * lightTm.getScaleXSignless();
@@ -455,9 +1005,18 @@ namespace Maze
                                 if (!defaultParams.cameraFrustum.containsSphere(lightPosWS, lightRadiusWS))
                                     return;
 
-                                defaultParams.lightsPosRadius[dynLightsCount] = Vec4F(lightPosWS, lightRadiusWS);
-                                defaultParams.lightsColor[dynLightsCount] = _light3D->getColor().toVec3F32();
-                                ++dynLightsCount;
+                                LightClusterGridLight clusterLight;
+                                clusterLight.posRadiusWS = Vec4F(lightPosWS, lightRadiusWS);
+                                clusterLight.color = _light3D->getColor().toVec3F32();
+                                m_clusterLights.emplace_back(clusterLight);
+
+                                // Legacy uniform arrays keep the first lights only
+                                if (dynLightsCount < MAZE_DYNAMIC_LIGHTS_MAX)
+                                {
+                                    defaultParams.lightsPosRadius[dynLightsCount] = clusterLight.posRadiusWS;
+                                    defaultParams.lightsColor[dynLightsCount] = clusterLight.color;
+                                    ++dynLightsCount;
+                                }
                             }
                         }
                     }
@@ -474,47 +1033,48 @@ namespace Maze
                     shaderManager->getLightsPosRadiusUniform()->setValue(defaultParams.lightsPosRadius, dynLightsCount);
                     shaderManager->getLightsColorUniform()->setValue(defaultParams.lightsColor, dynLightsCount);
                 }
+
+                if (!m_lightClusterGrid)
+                    m_lightClusterGrid = LightClusterGrid::Create(m_renderSystem.get());
+
+                if (m_lightClusterGrid)
+                {
+                    MAZE_PROFILE_EVENT("3D Light Clusters");
+
+                    m_lightClusterGrid->build(
+                        defaultParams.viewMatrix,
+                        defaultParams.projectionMatrix,
+                        defaultParams.nearZ,
+                        defaultParams.farZ,
+                        m_clusterLights.data(),
+                        (S32)m_clusterLights.size());
+
+                    Vec2F renderTargetSize = (Vec2F)renderTarget->getRenderTargetSize();
+                    m_lightClusterGrid->upload(
+                        shaderManager.get(),
+                        Vec4F(
+                            renderTargetSize.x * defaultParams.viewport.position.x,
+                            renderTargetSize.y * defaultParams.viewport.position.y,
+                            renderTargetSize.x * defaultParams.viewport.size.x,
+                            renderTargetSize.y * defaultParams.viewport.size.y));
+                }
             }
 
             if (defaultParams.drawFlag && camera->getShadowBuffer() && mainLight && mainLight->getShadowCast())
             {
-                ShadowPassParams shadowParams;
-                shadowParams.renderMask = defaultParams.renderMask;
-                shadowParams.nearZ = mainLight->getShadowCastNearZ();
-                shadowParams.farZ = mainLight->getShadowCastFarZ();
-
-                shadowParams.mainLightTransform = mainLight->getTransform()->getWorldTransform();
-                shadowParams.viewMatrix = shadowParams.mainLightTransform.inversed();
-                shadowParams.mainLightProjectionMatrix = Mat4F::CreateProjectionOrthographicLHMatrix(
-                    -mainLight->getShadowCastSize(),
-                    +mainLight->getShadowCastSize(),
-                    -mainLight->getShadowCastSize(),
-                    +mainLight->getShadowCastSize(),
-                    shadowParams.nearZ,
-                    shadowParams.farZ);
-                GraphicsUtilsHelper::CalculateCameraFrustum(
-                    shadowParams.viewMatrix,
-                    shadowParams.mainLightProjectionMatrix,
-                    shadowParams.mainLightFrustum);
-
-                Mat4F mainLightTransformMat4;
-                mainLightTransformMat4.setRow(0, Vec4F(shadowParams.mainLightTransform[0], 0.0f));
-                mainLightTransformMat4.setRow(1, Vec4F(shadowParams.mainLightTransform[1], 0.0f));
-                mainLightTransformMat4.setRow(2, Vec4F(shadowParams.mainLightTransform[2], 0.0f));
-                mainLightTransformMat4.setRow(3, Vec4F(shadowParams.mainLightTransform[3], 1.0f));
-
-                drawShadowPass(
-                    camera->getShadowBuffer().get(),
-                    shadowParams);
-
-                defaultParams.mainLightViewProjectionMatrix = mainLightTransformMat4.inversedAffine() * shadowParams.mainLightProjectionMatrix;
-                defaultParams.mainLightShadowMap = camera->getShadowBuffer()->getDepthTexture()->cast<Texture2D>();
+                drawMainLightShadowCascades(
+                    camera->getShadowBuffer(),
+                    mainLight,
+                    defaultParams);
             }
             else
             {
                 defaultParams.mainLightShadowMap = m_renderSystem->getTextureManager()->getWhiteTexture();
             }
 
+            if (defaultParams.drawFlag)
+                updateShadowCascadesUniforms(defaultParams);
+
             m_world->broadcastEventImmediate<Render3DDefaultPrePassEvent>(_renderTarget, &defaultParams);
 
             drawDefaultPass(
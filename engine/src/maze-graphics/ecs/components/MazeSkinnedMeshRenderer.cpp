@@ -52,6 +52,7 @@
 #include "maze-graphics/MazeRenderQueue.hpp"
 #include "maze-graphics/helpers/MazeGraphicsUtilsHelper.hpp"
 #include "maze-graphics/MazeRenderCommands.hpp"
+#include "maze-graphics/MazeSkinningPaletteBuffer.hpp"
 #include "maze-core/ecs/MazeComponentSystemHolder.hpp"
 
 
@@ -254,7 +255,7 @@ namespace Maze
         DefaultPassParams const& _params,
         RenderUnit const& _renderUnit)
     {
-        if (!m_skeleton)
+        if (!m_skeleton || !_params.skinningPaletteBuffer)
             return;
 
         Vector<VertexArrayObjectPtr> const& vaos = getRenderMesh()->getVertexArrayObjects();
@@ -263,18 +264,22 @@ namespace Maze
         MAZE_DEBUG_WARNING_IF(vao == nullptr, "VAO is null!");
 
         TMat const* tm = reinterpret_cast<TMat const*>(_renderUnit.userData);
-        
-        auto const& animator = m_skeleton->getAnimator();
-        U16 bonesCount = Math::Min((U16)MAZE_SKELETON_BONES_MAX, (U16)animator->getBonesCount());
-        _renderQueue->addUploadShaderUniformCommand(
-            MAZE_HCS("u_boneSkinningTransforms"),
-            (TMat const*)&animator->getBonesSkinningTransforms()[0],
-            bonesCount);
-        
+
+        // Only the palette offset goes per instance, so the same meshes are merged into one instanced draw
+        S32 paletteOffset = _params.skinningPaletteBuffer->ensurePalette(m_skeleton->getAnimator().get());
+        if (paletteOffset < 0)
+            return;
+
+        Vec4F paletteData((F32)paletteOffset, 0.0f, 0.0f, 0.0f);
+        Vec4F const* uvStreams[MAZE_UV_CHANNELS_MAX] = { nullptr };
+        uvStreams[MAZE_SKINNING_PALETTE_UV_CHANNEL] = &paletteData;
+
         _renderQueue->addDrawVAOInstancedCommand(
             vao.get(),
             1,
-            tm);
+            tm,
+            nullptr,
+            uvStreams);
     }
 
     //////////////////////////////////////////
@@ -283,7 +288,7 @@ namespace Maze
         ShadowPassParams const& _params,
         RenderUnit const& _renderUnit)
     {
-        if (!m_skeleton)
+        if (!m_skeleton || !_params.skinningPaletteBuffer)
             return;
 
         Vector<VertexArrayObjectPtr> const& vaos = getRenderMesh()->getVertexArrayObjects();
@@ -293,17 +298,20 @@ namespace Maze
 
         TMat const* tm = reinterpret_cast<TMat const*>(_renderUnit.userData);
 
-        auto const& animator = m_skeleton->getAnimator();
-        U16 bonesCount = Math::Min((U16)MAZE_SKELETON_BONES_MAX, (U16)animator->getBonesCount());
-        _renderQueue->addUploadShaderUniformCommand(
-            MAZE_HCS("u_boneSkinningTransforms"),
-            (TMat const*)&animator->getBonesSkinningTransforms()[0],
-            bonesCount);
+        S32 paletteOffset = _params.skinningPaletteBuffer->ensurePalette(m_skeleton->getAnimator().get());
+        if (paletteOffset < 0)
+            return;
+
+        Vec4F paletteData((F32)paletteOffset, 0.0f, 0.0f, 0.0f);
+        Vec4F const* uvStreams[MAZE_UV_CHANNELS_MAX] = { nullptr };
+        uvStreams[MAZE_SKINNING_PALETTE_UV_CHANNEL] = &paletteData;
 
         _renderQueue->addDrawVAOInstancedCommand(
             vao.get(),
             1,
-            tm);
+            tm,
+            nullptr,
+            uvStreams);
     }
     
 
@@ -319,9 +327,11 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(SkinnedMeshRendererUpdateSystem,
+    COMPONENT_SYSTEM_EVENT_HANDLER_RW(SkinnedMeshRendererUpdateSystem,
         MAZE_ECS_TAGS(MAZE_HS("default"), MAZE_HS("render")),
         {},
+        MAZE_ECS_NONE,
+        MAZE_ECS_WRITES(SkinnedMeshRenderer),
         UpdateEvent const& _event,
         Entity* _entity,
         SkinnedMeshRenderer* _meshRenderer)
@@ -331,9 +341,32 @@ namespace Maze
 
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(SkinnedMeshRendererDefaultPassGatherRenderUnits,
+    // Projected bounds size relative to the viewport height.
+    // [1][1] of the projection is 1/tan(fovY/2) for the perspective and 2/height for the orthographic
+    static F32 CalculateBoundsScreenSize(
+        Vec3F const& _boundsCenterWS,
+        F32 _boundsRadiusWS,
+        DefaultPassParams const& _params)
+    {
+        F32 projectionScaleY = _params.projectionMatrix[1][1];
+
+        // Orthographic - the size doesn't depend on the distance
+        if (_params.projectionMatrix[3][3] != 0.0f)
+            return Math::Min(1.0f, _boundsRadiusWS * projectionScaleY);
+
+        F32 distance = (_boundsCenterWS - _params.cameraTransform.getTranslation()).length();
+        if (distance <= _boundsRadiusWS)
+            return 1.0f;
+
+        return Math::Min(1.0f, _boundsRadiusWS * projectionScaleY / distance);
+    }
+
+    //////////////////////////////////////////
+    // Culling and the animation LOD are evaluated on the job system workers
+    COMPONENT_SYSTEM_EVENT_HANDLER_EX(SkinnedMeshRendererDefaultPassGatherRenderUnits,
         MAZE_ECS_TAGS(MAZE_HS("render")),
         {},
+        (U8)EntitiesSampleFlags::ProcessEventsParallel,
         Render3DDefaultPassGatherRenderUnitsEvent& _event,
         Entity* _entity,
         SkinnedMeshRenderer* _meshRenderer,
@@ -355,6 +388,7 @@ namespace Maze
                 RenderMeshPtr const& renderMesh = _meshRenderer->getRenderMesh();
 
                 // Frustum culling with the inflated rest-pose bounds
+                F32 screenSize = 1.0f;
                 if (renderMesh->isAABBValid())
                 {
                     Vec3F boundsCenterWS;
@@ -369,8 +403,16 @@ namespace Maze
                         boundsCenterWS,
                         boundsRadiusWS * _meshRenderer->getBoundsInflation()))
                         return;
+
+                    screenSize = CalculateBoundsScreenSize(
+                        boundsCenterWS,
+                        boundsRadiusWS,
+                        *_event.getPassParams());
                 }
 
+                // Animation LOD of the next update
+                _meshRenderer->getSkeleton()->getAnimator()->notifyRendered(screenSize);
+
                 Vector<MaterialAssetRef> const& materials = _meshRenderer->getMaterialRefs();
                 Vector<VertexArrayObjectPtr> const& vaos = renderMesh->getVertexArrayObjects();
 
@@ -379,6 +421,7 @@ namespace Maze
 
                 S32 c = (S32)Math::Max(vaos.size(), materials.size());
 
+                MAZE_MUTEX_SCOPED_LOCK(_event.getRenderUnitsMutex());
                 for (S32 i = 0, in = c; i < in; ++i)
                 {
                     MaterialPtr const* material = nullptr;
@@ -411,9 +454,11 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(SkinnedMeshRendererShadowPassGatherRenderUnits,
+    // Culling and the animation LOD are evaluated on the job system workers
+    COMPONENT_SYSTEM_EVENT_HANDLER_EX(SkinnedMeshRendererShadowPassGatherRenderUnits,
         MAZE_ECS_TAGS(MAZE_HS("render")),
         {},
+        (U8)EntitiesSampleFlags::ProcessEventsParallel,
         Render3DShadowPassGatherRenderUnitsEvent& _event,
         Entity* _entity,
         SkinnedMeshRenderer* _meshRenderer,
@@ -452,6 +497,9 @@ namespace Maze
                         return;
                 }
 
+                // Shadow casters are kept animated at the lowest LOD
+                _meshRenderer->getSkeleton()->getAnimator()->notifyRendered(0.0f);
+
                 Vector<MaterialAssetRef> const& materials = _meshRenderer->getMaterialRefs();
                 Vector<VertexArrayObjectPtr> const& vaos = renderMesh->getVertexArrayObjects();
 
@@ -460,6 +508,7 @@ namespace Maze
 
                 S32 c = (S32)Math::Max(vaos.size(), materials.size());
 
+                MAZE_MUTEX_SCOPED_LOCK(_event.getRenderUnitsMutex());
                 for (S32 i = 0, in = c; i < in; ++i)
                 {
                     MaterialPtr const* material = nullptr;
@@ -49,6 +49,7 @@
 #include "maze-graphics/MazeRenderQueue.hpp"
 #include "maze-graphics/MazeRenderCommands.hpp"
 #include "maze-core/ecs/MazeComponentSystemHolder.hpp"
+#include "maze-core/ecs/MazeEntitiesSample.hpp"
 
 
 //////////////////////////////////////////
@@ -217,9 +218,13 @@ namespace Maze
 
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(SkinnedMeshSkeletonUpdateSystem,
+    // Animators are independent, so the poses are evaluated on the job system workers
+    COMPONENT_SYSTEM_EVENT_HANDLER_RW_EX(SkinnedMeshSkeletonUpdateSystem,
         MAZE_ECS_TAGS(MAZE_HS("default")),
         {},
+        (U8)EntitiesSampleFlags::ProcessEventsParallel,
+        MAZE_ECS_NONE,
+        MAZE_ECS_WRITES(SkinnedMeshSkeleton),
         UpdateEvent const& _event,
         Entity* _entity,
         SkinnedMeshSkeleton* _meshSkeleton)
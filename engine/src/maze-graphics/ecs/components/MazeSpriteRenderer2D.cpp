@@ -279,7 +279,7 @@ namespace Maze
             return whiteTexture->getResourceId();
         }
 
-        Texture2DPtr const& texture = getSprite()->getTexture();
+        Texture2DPtr const& texture = getSprite()->getRenderTexture();
         if (!texture)
             return c_invalidResourceId;
 
@@ -508,6 +508,17 @@ namespace Maze
             }
         }
 
+        // Sprite texture coords are remapped into the atlas page region
+        if (getSprite() && getSprite()->getAtlasTexture())
+        {
+            for (Vec4F& uv : m_localUV0s)
+            {
+                Vec2F uvLB = getSprite()->transformUVToRenderTexture(Vec2F(uv.x, uv.y));
+                Vec2F uvRT = getSprite()->transformUVToRenderTexture(Vec2F(uv.z, uv.w));
+                uv = Vec4F(uvLB, uvRT);
+            }
+        }
+
         m_meshRenderer->resize(totalQuadsCount);
 
         disableFlag(SpriteRenderer2D::Flags::MeshDataDirty);
@@ -608,6 +608,27 @@ namespace Maze
             _outRadius = worldHalfSize.length();
         }
 
+        //////////////////////////////////////////
+        MAZE_GRAPHICS_API AABB3D CalculateWorldAABB(
+            AABB3D const& _localAABB,
+            TMat const& _worldTransform)
+        {
+            Vec3F center = (_localAABB.getMin() + _localAABB.getMax()) * 0.5f;
+            Vec3F halfSize = (_localAABB.getMax() - _localAABB.getMin()) * 0.5f;
+
+            Vec3F worldCenter = _worldTransform.transform(center);
+
+            Vec3F const& axisX = _worldTransform[0];
+            Vec3F const& axisY = _worldTransform[1];
+            Vec3F const& axisZ = _worldTransform[2];
+            Vec3F worldHalfSize(
+                Math::Abs(axisX.x) * halfSize.x + Math::Abs(axisY.x) * halfSize.y + Math::Abs(axisZ.x) * halfSize.z,
+                Math::Abs(axisX.y) * halfSize.x + Math::Abs(axisY.y) * halfSize.y + Math::Abs(axisZ.y) * halfSize.z,
+                Math::Abs(axisX.z) * halfSize.x + Math::Abs(axisY.z) * halfSize.y + Math::Abs(axisZ.z) * halfSize.z);
+
+            return AABB3D(worldCenter - worldHalfSize, worldCenter + worldHalfSize);
+        }
+
     } // namespace GraphicsUtilsHelper
     //////////////////////////////////////////
 
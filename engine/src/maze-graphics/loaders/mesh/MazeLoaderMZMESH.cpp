@@ -41,7 +41,7 @@ namespace Maze
     #pragma warning(push)
     #pragma warning(disable:4307)
     MAZE_CONSTEXPR U32 const c_mzMeshHeaderMagic = Hash::CalculateFNV1("MZMESH");
-    MAZE_CONSTEXPR S32 const c_mzMeshHeaderVersion = 2;
+    MAZE_CONSTEXPR S32 const c_mzMeshHeaderVersion = 3;
     #pragma warning(pop)
 
 
@@ -70,43 +70,110 @@ namespace Maze
 
 
     //////////////////////////////////////////
-    inline MeshSkeletonAnimationCurve LoadMZMESHAnimationCurve(
+    // Animation curve flags (version 3+)
+    enum MZMESHCurveFlags : U8
+    {
+        MZMESHCurveFlagUniform      = MAZE_BIT(0),
+        MZMESHCurveFlagQuantized    = MAZE_BIT(1),
+    };
+
+
+    //////////////////////////////////////////
+    inline U32 LoadMZMESHCurveHeader(
         ByteBuffer const& _fileData,
-        U32& _bytesRead)
+        U32& _bytesRead,
+        S32 _version,
+        U8& _outFlags,
+        F32& _outStartTime,
+        F32& _outSampleInterval,
+        FastVector<F32>& _outTimes)
     {
+        _outFlags = 0u;
+        if (_version >= 3)
+            _bytesRead += _fileData.read(_bytesRead, &_outFlags, sizeof(_outFlags));
+
         U32 keysCount = 0u;
         _bytesRead += _fileData.read(_bytesRead, &keysCount, sizeof(keysCount));
 
-        FastVector<F32> times((Size)keysCount, 0.0f);
-        FastVector<F32> values((Size)keysCount, 0.0f);
-
-        if (keysCount > 0u)
+        if (_outFlags & MZMESHCurveFlagUniform)
         {
-            _bytesRead += _fileData.read(_bytesRead, times.begin(), keysCount * sizeof(F32));
-            _bytesRead += _fileData.read(_bytesRead, values.begin(), keysCount * sizeof(F32));
+            _bytesRead += _fileData.read(_bytesRead, &_outStartTime, sizeof(_outStartTime));
+            _bytesRead += _fileData.read(_bytesRead, &_outSampleInterval, sizeof(_outSampleInterval));
+        }
+        else
+        {
+            // Constant tracks have the single key without times
+            U32 timesCount = (_version >= 3 && keysCount == 1u) ? 0u : keysCount;
+            _outTimes.resize((Size)timesCount, 0.0f);
+            if (timesCount > 0u)
+                _bytesRead += _fileData.read(_bytesRead, _outTimes.begin(), timesCount * sizeof(F32));
         }
 
-        return MeshSkeletonAnimationCurve(eastl::move(times), eastl::move(values));
+        return keysCount;
     }
 
     //////////////////////////////////////////
-    inline MeshSkeletonRotationCurve LoadMZMESHRotationCurve(
+    inline MeshSkeletonAnimationCurve LoadMZMESHAnimationCurve(
         ByteBuffer const& _fileData,
-        U32& _bytesRead)
+        U32& _bytesRead,
+        S32 _version)
     {
-        U32 keysCount = 0u;
-        _bytesRead += _fileData.read(_bytesRead, &keysCount, sizeof(keysCount));
-
-        FastVector<F32> times((Size)keysCount, 0.0f);
-        FastVector<Quaternion> values((Size)keysCount, Quaternion::c_identity);
+        U8 flags = 0u;
+        F32 startTime = 0.0f;
+        F32 sampleInterval = 0.0f;
+        FastVector<F32> times;
+        U32 keysCount = LoadMZMESHCurveHeader(_fileData, _bytesRead, _version, flags, startTime, sampleInterval, times);
 
+        FastVector<F32> values((Size)keysCount, 0.0f);
         if (keysCount > 0u)
+            _bytesRead += _fileData.read(_bytesRead, values.begin(), keysCount * sizeof(F32));
+
+        MeshSkeletonAnimationCurve curve;
+        if (flags & MZMESHCurveFlagUniform)
+            curve.setUniformValues(startTime, sampleInterval, eastl::move(values));
+        else
+            curve.setValues(eastl::move(times), eastl::move(values));
+
+        return curve;
+    }
+
+    //////////////////////////////////////////
+    inline MeshSkeletonRotationCurve LoadMZMESHRotationCurve(
+        ByteBuffer const& _fileData,
+        U32& _bytesRead,
+        S32 _version)
+    {
+        U8 flags = 0u;
+        F32 startTime = 0.0f;
+        F32 sampleInterval = 0.0f;
+        FastVector<F32> times;
+        U32 keysCount = LoadMZMESHCurveHeader(_fileData, _bytesRead, _version, flags, startTime, sampleInterval, times);
+
+        MeshSkeletonRotationCurve curve;
+        if (flags & MZMESHCurveFlagQuantized)
+        {
+            FastVector<MeshSkeletonQuantizedQuaternion> values((Size)keysCount);
+            if (keysCount > 0u)
+                _bytesRead += _fileData.read(_bytesRead, values.begin(), keysCount * sizeof(MeshSkeletonQuantizedQuaternion));
+
+            if (flags & MZMESHCurveFlagUniform)
+                curve.setUniformQuantizedValues(startTime, sampleInterval, eastl::move(values));
+            else
+                curve.setQuantizedValues(eastl::move(times), eastl::move(values));
+        }
+        else
         {
-            _bytesRead += _fileData.read(_bytesRead, times.begin(), keysCount * sizeof(F32));
-            _bytesRead += _fileData.read(_bytesRead, values.begin(), keysCount * sizeof(Quaternion));
+            FastVector<Quaternion> values((Size)keysCount, Quaternion::c_identity);
+            if (keysCount > 0u)
+                _bytesRead += _fileData.read(_bytesRead, values.begin(), keysCount * sizeof(Quaternion));
+
+            if (flags & MZMESHCurveFlagUniform)
+                curve.setUniformValues(startTime, sampleInterval, eastl::move(values));
+            else
+                curve.setValues(eastl::move(times), eastl::move(values));
         }
 
-        return MeshSkeletonRotationCurve(eastl::move(times), eastl::move(values));
+        return curve;
     }
 
 
@@ -277,12 +344,12 @@ namespace Maze
                     MeshSkeletonAnimationBone& boneAnimation = boneAnimations[(Size)b];
 
                     for (S32 axis = 0; axis < 3; ++axis)
-                        boneAnimation.translation[axis] = LoadMZMESHAnimationCurve(_fileData, bytesRead);
+                        boneAnimation.translation[axis] = LoadMZMESHAnimationCurve(_fileData, bytesRead, header.version);
 
-                    boneAnimation.rotation = LoadMZMESHRotationCurve(_fileData, bytesRead);
+                    boneAnimation.rotation = LoadMZMESHRotationCurve(_fileData, bytesRead, header.version);
 
                     for (S32 axis = 0; axis < 3; ++axis)
-                        boneAnimation.scale[axis] = LoadMZMESHAnimationCurve(_fileData, bytesRead);
+                        boneAnimation.scale[axis] = LoadMZMESHAnimationCurve(_fileData, bytesRead, header.version);
                 }
 
                 animation->setBoneAnimations(eastl::move(boneAnimations));
@@ -299,6 +366,11 @@ namespace Maze
         if (_props.scale != 1.0f)
             _mesh.scale(_props.scale);
 
+        // Already compressed tracks are kept as is
+        if (_props.compressAnimations && _mesh.getSkeleton())
+            for (auto const& animationData : _mesh.getSkeleton()->getAnimations())
+                animationData.second->compress();
+
         return true;
     }
 
@@ -364,19 +436,47 @@ namespace Maze
         return true;
     }
 
+    //////////////////////////////////////////
+    template <typename TCurve>
+    inline void SaveMZMESHCurveHeader(
+        std::ofstream& _outputFile,
+        TCurve const& _curve,
+        U8 _flags)
+    {
+        if (_curve.isUniform())
+            _flags |= MZMESHCurveFlagUniform;
+        _outputFile.write((S8 const*)&_flags, sizeof(_flags));
+
+        U32 keysCount = (U32)_curve.getKeysCount();
+        _outputFile.write((S8 const*)&keysCount, sizeof(keysCount));
+
+        if (_curve.isUniform())
+        {
+            F32 startTime = _curve.getStartTime();
+            F32 sampleInterval = _curve.getSampleInterval();
+            _outputFile.write((S8 const*)&startTime, sizeof(startTime));
+            _outputFile.write((S8 const*)&sampleInterval, sizeof(sampleInterval));
+        }
+        else
+        {
+            // Constant tracks are stored without times
+            U32 timesCount = keysCount == 1u ? 0u : keysCount;
+            MAZE_DEBUG_ASSERT(timesCount == 0u || (U32)_curve.getTimes().size() == timesCount);
+            if (timesCount > 0u)
+                _outputFile.write((S8 const*)_curve.getTimes().begin(), timesCount * sizeof(F32));
+        }
+    }
+
     //////////////////////////////////////////
     inline void SaveMZMESHAnimationCurve(
         std::ofstream& _outputFile,
         MeshSkeletonAnimationCurve const& _curve)
     {
-        U32 keysCount = (U32)_curve.getValues().size();
-        _outputFile.write((S8 const*)&keysCount, sizeof(keysCount));
+        SaveMZMESHCurveHeader(_outputFile, _curve, 0u);
 
+        U32 keysCount = (U32)_curve.getKeysCount();
         if (keysCount > 0u)
-        {
-            _outputFile.write((S8 const*)_curve.getTimes().begin(), keysCount * sizeof(F32));
             _outputFile.write((S8 const*)_curve.getValues().begin(), keysCount * sizeof(F32));
-        }
     }
 
     //////////////////////////////////////////
@@ -384,13 +484,15 @@ namespace Maze
         std::ofstream& _outputFile,
         MeshSkeletonRotationCurve const& _curve)
     {
-        U32 keysCount = (U32)_curve.getValues().size();
-        _outputFile.write((S8 const*)&keysCount, sizeof(keysCount));
+        SaveMZMESHCurveHeader(_outputFile, _curve, _curve.isQuantized() ? (U8)MZMESHCurveFlagQuantized : (U8)0u);
 
+        U32 keysCount = (U32)_curve.getKeysCount();
         if (keysCount > 0u)
         {
-            _outputFile.write((S8 const*)_curve.getTimes().begin(), keysCount * sizeof(F32));
-            _outputFile.write((S8 const*)_curve.getValues().begin(), keysCount * sizeof(Quaternion));
+            if (_curve.isQuantized())
+                _outputFile.write((S8 const*)_curve.getQuantizedValues().begin(), keysCount * sizeof(MeshSkeletonQuantizedQuaternion));
+            else
+                _outputFile.write((S8 const*)_curve.getValues().begin(), keysCount * sizeof(Quaternion));
         }
     }
 
@@ -215,6 +215,9 @@ namespace Maze
         if (metaData.isParamExists(MAZE_HCS("generateTangents")))
             loaderProps.generateTangents = metaData.getBool(MAZE_HCS("generateTangents"));
 
+        if (metaData.isParamExists(MAZE_HCS("compressAnimations")))
+            loaderProps.compressAnimations = metaData.getBool(MAZE_HCS("compressAnimations"));
+
         if (!loaderProps.generateTangents)
         {
             Path tangentsFilePath = _assetFile->getFullPath() + ".mztangents";
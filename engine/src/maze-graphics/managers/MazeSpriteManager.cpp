@@ -36,6 +36,7 @@
 #include "maze-graphics/MazeRenderSystem.hpp"
 #include "maze-graphics/managers/MazeTextureManager.hpp"
 #include "maze-graphics/MazeSprite.hpp"
+#include "maze-graphics/MazeSpriteAtlas.hpp"
 #include "maze-graphics/assets/MazeAssetUnitSprite.hpp"
 
 
@@ -64,6 +65,12 @@ namespace Maze
     {
         m_defaultSpriteMaterial.reset();
 
+        if (m_spriteAtlas)
+        {
+            m_spriteAtlas->clear();
+            m_spriteAtlas.reset();
+        }
+
         m_spritesLibrary.clear();
 
         for (BuiltinSpriteType t = BuiltinSpriteType(1); t < BuiltinSpriteType::MAX; ++t)
@@ -82,6 +89,7 @@ namespace Maze
         m_renderSystem = _renderSystem;
         m_renderSystemRaw = _renderSystem.get();
 
+        m_spriteAtlas = SpriteAtlas::Create(m_renderSystemRaw);
 
         if (AssetUnitManager::GetInstancePtr())
         {
@@ -218,16 +226,33 @@ namespace Maze
     {
         MAZE_ERROR_IF(_sprite->getName().empty(), "Sprite with no name!");
 
+        if (m_spriteAtlas)
+        {
+            SpriteLibraryData const* prevData = getSpriteLibraryData(_sprite->getName().asHashedCString());
+            if (prevData && prevData->sprite && prevData->sprite != _sprite)
+                m_spriteAtlas->removeSprite(prevData->sprite.get());
+        }
+
         auto it2 = m_spritesLibrary.insert(
             _sprite->getName(),
             { _sprite, _callbacks, _info });
 
+        if (m_spriteAtlas)
+            m_spriteAtlas->addSprite(_sprite.get());
+
         return it2;
     }
 
     //////////////////////////////////////////
     void SpriteManager::removeSpriteFromLibrary(HashedCString _textureName)
     {
+        if (m_spriteAtlas)
+        {
+            SpriteLibraryData const* data = getSpriteLibraryData(_textureName);
+            if (data && data->sprite)
+                m_spriteAtlas->removeSprite(data->sprite.get());
+        }
+
         m_spritesLibrary.erase(_textureName);
     }
 
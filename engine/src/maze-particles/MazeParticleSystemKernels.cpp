@@ -0,0 +1,104 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeParticlesHeader.hpp"
+#include "maze-particles/MazeParticleSystemKernels.hpp"
+#include "maze-core/math/MazeSimd.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    namespace ParticleSystemKernels
+    {
+        //////////////////////////////////////////
+        MAZE_PARTICLES_API void UpdateLifes(
+            F32* _lifesCurrent,
+            F32* _lifesScalar,
+            F32 const* _lifesInitial,
+            F32 _dt,
+            S32 _count)
+        {
+            Simd4F const dt = Simd4F::Splat(_dt);
+            Simd4F const zero = Simd4F::Zero();
+            Simd4F const one = Simd4F::Splat(1.0f);
+
+            S32 i = 0;
+            for (; i + 4 <= _count; i += 4)
+            {
+                Simd4F current = Simd4F::Load(_lifesCurrent + i) - dt;
+                Simd4F scalar = one - current * Simd4F::Reciprocal(Simd4F::Load(_lifesInitial + i));
+
+                current.store(_lifesCurrent + i);
+                Simd4F::Max(Simd4F::Min(scalar, one), zero).store(_lifesScalar + i);
+            }
+
+            for (; i < _count; ++i)
+            {
+                F32 current = _lifesCurrent[i] - _dt;
+                _lifesScalar[i] = Math::Clamp01(1.0f - current / _lifesInitial[i]);
+                _lifesCurrent[i] = current;
+            }
+        }
+
+        //////////////////////////////////////////
+        MAZE_PARTICLES_API void MultiplyAdd(
+            F32* _values,
+            F32 const* _deltas,
+            F32 _scale,
+            S32 _count)
+        {
+            Simd4F const scale = Simd4F::Splat(_scale);
+
+            S32 i = 0;
+            for (; i + 4 <= _count; i += 4)
+                Simd4F::MulAdd(Simd4F::Load(_deltas + i), scale, Simd4F::Load(_values + i)).store(_values + i);
+
+            for (; i < _count; ++i)
+                _values[i] += _deltas[i] * _scale;
+        }
+
+        //////////////////////////////////////////
+        MAZE_PARTICLES_API void Multiply(
+            F32* _results,
+            F32 const* _values0,
+            F32 const* _values1,
+            S32 _count)
+        {
+            S32 i = 0;
+            for (; i + 4 <= _count; i += 4)
+                (Simd4F::Load(_values0 + i) * Simd4F::Load(_values1 + i)).store(_results + i);
+
+            for (; i < _count; ++i)
+                _results[i] = _values0[i] * _values1[i];
+        }
+
+    } // namespace ParticleSystemKernels
+
+} // namespace Maze
+//////////////////////////////////////////
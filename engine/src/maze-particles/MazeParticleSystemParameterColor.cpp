@@ -75,6 +75,89 @@ namespace Maze
         }
     }
 
+    //////////////////////////////////////////
+    void ParticleSystemParameterColor::sampleBatch(S32 const* _particleSeeds, F32 const* _scalars, Vec4F* _results, S32 _count) const
+    {
+        switch (m_mode)
+        {
+            case ParticleSystemParameterColorSamplingMode::Color:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = m_color0;
+                break;
+            }
+            case ParticleSystemParameterColorSamplingMode::Gradient:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = m_gradient0.evaluate(_scalars[i]);
+                break;
+            }
+            case ParticleSystemParameterColorSamplingMode::RandomBetweenColors:
+            {
+                Vec4F delta = m_color1 - m_color0;
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = delta * ((F32)_particleSeeds[i] * c_invParticleSystemParametersCount) + m_color0;
+                break;
+            }
+            case ParticleSystemParameterColorSamplingMode::RandomBetweenGradients:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                {
+                    Vec4F value0 = m_gradient0.evaluate(_scalars[i]);
+                    Vec4F value1 = m_gradient1.evaluate(_scalars[i]);
+                    _results[i] = Math::Lerp(value0, value1, (F32)_particleSeeds[i] * c_invParticleSystemParametersCount);
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    //////////////////////////////////////////
+    void ParticleSystemParameterColor::sampleBatch(S32 const* _particleSeeds, F32 _scalar, Vec4F* _results, S32 _count) const
+    {
+        MAZE_DEBUG_BP_IF(_scalar < 0.0f || _scalar > 1.0f);
+
+        switch (m_mode)
+        {
+            case ParticleSystemParameterColorSamplingMode::Color:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = m_color0;
+                break;
+            }
+            case ParticleSystemParameterColorSamplingMode::Gradient:
+            {
+                Vec4F value = m_gradient0.evaluate(_scalar);
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = value;
+                break;
+            }
+            case ParticleSystemParameterColorSamplingMode::RandomBetweenColors:
+            {
+                Vec4F delta = m_color1 - m_color0;
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = delta * ((F32)_particleSeeds[i] * c_invParticleSystemParametersCount) + m_color0;
+                break;
+            }
+            case ParticleSystemParameterColorSamplingMode::RandomBetweenGradients:
+            {
+                Vec4F value0 = m_gradient0.evaluate(_scalar);
+                Vec4F delta = m_gradient1.evaluate(_scalar) - value0;
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = delta * ((F32)_particleSeeds[i] * c_invParticleSystemParametersCount) + value0;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
     //////////////////////////////////////////
     void ParticleSystemParameterColor::loadFromJSONValue(Json::Value const& _value)
     {
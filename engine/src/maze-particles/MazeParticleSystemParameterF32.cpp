@@ -75,6 +75,89 @@ namespace Maze
         }
     }
 
+    //////////////////////////////////////////
+    void ParticleSystemParameterF32::sampleBatch(S32 const* _particleSeeds, F32 const* _scalars, F32* _results, S32 _count) const
+    {
+        switch (m_mode)
+        {
+            case ParticleSystemParameterF32SamplingMode::Constant:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = m_const0;
+                break;
+            }
+            case ParticleSystemParameterF32SamplingMode::Curve:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = m_curve0.evaluate(_scalars[i]);
+                break;
+            }
+            case ParticleSystemParameterF32SamplingMode::RandomBetweenConstants:
+            {
+                F32 delta = m_const1 - m_const0;
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = delta * ((F32)_particleSeeds[i] * c_invParticleSystemParametersCount) + m_const0;
+                break;
+            }
+            case ParticleSystemParameterF32SamplingMode::RandomBetweenCurves:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                {
+                    F32 value0 = m_curve0.evaluate(_scalars[i]);
+                    F32 value1 = m_curve1.evaluate(_scalars[i]);
+                    _results[i] = Math::Lerp(value0, value1, (F32)_particleSeeds[i] * c_invParticleSystemParametersCount);
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    //////////////////////////////////////////
+    void ParticleSystemParameterF32::sampleBatch(S32 const* _particleSeeds, F32 _scalar, F32* _results, S32 _count) const
+    {
+        MAZE_DEBUG_BP_IF(_scalar < 0.0f || _scalar > 1.0f);
+
+        switch (m_mode)
+        {
+            case ParticleSystemParameterF32SamplingMode::Constant:
+            {
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = m_const0;
+                break;
+            }
+            case ParticleSystemParameterF32SamplingMode::Curve:
+            {
+                F32 value = m_curve0.evaluate(_scalar);
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = value;
+                break;
+            }
+            case ParticleSystemParameterF32SamplingMode::RandomBetweenConstants:
+            {
+                F32 delta = m_const1 - m_const0;
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = delta * ((F32)_particleSeeds[i] * c_invParticleSystemParametersCount) + m_const0;
+                break;
+            }
+            case ParticleSystemParameterF32SamplingMode::RandomBetweenCurves:
+            {
+                F32 value0 = m_curve0.evaluate(_scalar);
+                F32 delta = m_curve1.evaluate(_scalar) - value0;
+                for (S32 i = 0; i < _count; ++i)
+                    _results[i] = delta * ((F32)_particleSeeds[i] * c_invParticleSystemParametersCount) + value0;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
     //////////////////////////////////////////
     void ParticleSystemParameterF32::loadFromJSONValue(Json::Value const& _value)
     {
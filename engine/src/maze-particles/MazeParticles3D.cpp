@@ -74,7 +74,7 @@ namespace Maze
             return;
 
         Vec3F pos = m_positions[0];
-        F32 size = m_sizes[0].current;
+        F32 size = m_sizesCurrent[0];
         F32 halfSize = size * 0.5f;
 
         AABB3D aabb(
@@ -88,10 +88,10 @@ namespace Maze
         for (S32 i = 0; i < aliveCount; )
         {
             // Alive
-            if (m_lifes[i].current >= 0.0f)
+            if (m_lifesCurrent[i] >= 0.0f)
             {
                 pos = m_positions[i];
-                size = m_sizes[i].current;
+                size = m_sizesCurrent[i];
                 halfSize = size * 0.5f;
 
                 aabb.applyUnion(
@@ -130,12 +130,17 @@ namespace Maze
         m_seeds.resize(_capacity);
         m_positions.resize(_capacity);
         m_directions.resize(_capacity);
-        m_rotations.resize(_capacity);
-        m_lifes.resize(_capacity);
-        m_sizes.resize(_capacity);
+        m_rotationsInitial.resize(_capacity);
+        m_rotationsCurrent.resize(_capacity);
+        m_lifesInitial.resize(_capacity);
+        m_lifesCurrent.resize(_capacity);
+        m_lifesScalar.resize(_capacity);
+        m_sizesInitial.resize(_capacity);
+        m_sizesCurrent.resize(_capacity);
         m_colorsInitial.resize(_capacity);
         m_colorsCurrent.resize(_capacity);
-        m_movements.resize(_capacity);
+        m_velocities.resize(_capacity);
+        m_accelerations.resize(_capacity);
         m_animationFrames.resize(_capacity);
 
         m_sqrDistanceToCamera.resize(_capacity);
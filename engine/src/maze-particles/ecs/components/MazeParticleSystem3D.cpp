@@ -299,7 +299,8 @@ namespace Maze
                     if (minCount > maxCount)
                         eastl::swap(minCount, maxCount);
 
-                    count += Random::RangeRandom(minCount, maxCount + 1);
+                    // rand() instead of the shared Mersenne Twister - systems are updated in parallel
+                    count += minCount + rand() % (maxCount - minCount + 1);
                     ++m_currentBurstIndex;
                 }
             }
@@ -617,9 +618,13 @@ namespace Maze
 
 
     //////////////////////////////////////////
-    COMPONENT_SYSTEM_EVENT_HANDLER(ParticleSystem3DSystem,
+    // Particle systems are independent, so they are simulated on the job system workers
+    COMPONENT_SYSTEM_EVENT_HANDLER_RW_EX(ParticleSystem3DSystem,
         MAZE_ECS_TAGS(MAZE_HS("default")),
         {},
+        (U8)EntitiesSampleFlags::ProcessEventsParallel,
+        MAZE_ECS_READS(Transform3D, RenderMask),
+        MAZE_ECS_WRITES(ParticleSystem3D),
         UpdateEvent const& _event,
         Entity* _entity,
         ParticleSystem3D* _particleSystem)
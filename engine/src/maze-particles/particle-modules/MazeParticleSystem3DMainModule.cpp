@@ -26,6 +26,7 @@
 //////////////////////////////////////////
 #include "MazeParticlesHeader.hpp"
 #include "maze-particles/particle-modules/MazeParticleSystem3DMainModule.hpp"
+#include "maze-particles/MazeParticleSystemKernels.hpp"
 #include "maze-graphics/managers/MazeGraphicsManager.hpp"
 #include "maze-core/managers/MazeAssetManager.hpp"
 #include "maze-core/ecs/MazeEntity.hpp"
@@ -122,96 +123,62 @@ namespace Maze
         F32 _emitterTimePercent,
         TMat const& _particleSystemWorldTransform)
     {
+        S32 count = _last - _first;
+        if (count <= 0)
+            return;
+
         TMat invParticleSystemWorldTransform = _particleSystemWorldTransform.inversed();
         invParticleSystemWorldTransform.setTranslation(Vec3F::c_zero);
         Vec3F gravityVector = invParticleSystemWorldTransform.transform(Vec3F::c_unitY);
-        
-        // Life
-        {
-            F32 valueF32;
-            for (S32 i = _first; i < _last; ++i)
-            {
-                S32 seed = _particles.accessSeed(i);
-                m_lifetime.sample(seed, _emitterTimePercent, valueF32);
 
-                Particles3D::ParticleLife& life = _particles.accessLife(i);
-                life.initial = valueF32;
-                life.current = valueF32;
-            }
-        }
+        S32 const* seeds = _particles.getSeeds() + _first;
 
-        // Size
-        {
-            F32 valueF32;
-            for (S32 i = _first; i < _last; ++i)
-            {
-                S32 seed = _particles.accessSeed(i);
-                m_size.sample(seed, _emitterTimePercent, valueF32);
+        // Life
+        m_lifetime.sampleBatch(seeds, _emitterTimePercent, _particles.getLifesInitial() + _first, count);
+        memcpy(_particles.getLifesCurrent() + _first, _particles.getLifesInitial() + _first, sizeof(F32) * count);
 
-                Particles3D::ParticleSize& size = _particles.accessSize(i);
-                size.initial = valueF32;
-                size.current = valueF32;
-            }
-        }
+        // Size
+        m_size.sampleBatch(seeds, _emitterTimePercent, _particles.getSizesInitial() + _first, count);
+        memcpy(_particles.getSizesCurrent() + _first, _particles.getSizesInitial() + _first, sizeof(F32) * count);
 
         // Rotation
-        if (m_alignToDirection)
         {
-            F32 valueF32;
-            for (S32 i = _first; i < _last; ++i)
-            {
-                S32 seed = _particles.accessSeed(i);
-                m_rotation.sample(seed, _emitterTimePercent, valueF32);
-
-                Vec3F& direction = _particles.accessDirection(i);
-                valueF32 += Vec2F(direction.x, direction.y).normalizedCopy().toAngle();
+            F32* rotations = _particles.getRotationsInitial() + _first;
+            m_rotation.sampleBatch(seeds, _emitterTimePercent, rotations, count);
 
-                Particles3D::ParticleRotation& rotation = _particles.accessRotation(i);
-                rotation.initial = valueF32;
-                rotation.current = valueF32;
-            }
-        }
-        else
-        {
-            F32 valueF32;
-            for (S32 i = _first; i < _last; ++i)
+            if (m_alignToDirection)
             {
-                S32 seed = _particles.accessSeed(i);
-                m_rotation.sample(seed, _emitterTimePercent, valueF32);
-
-                Particles3D::ParticleRotation& rotation = _particles.accessRotation(i);
-                rotation.initial = valueF32;
-                rotation.current = valueF32;
+                Vec3F const* directions = _particles.getDirections() + _first;
+                for (S32 i = 0; i < count; ++i)
+                    rotations[i] += Vec2F(directions[i].x, directions[i].y).normalizedCopy().toAngle();
             }
+
+            memcpy(_particles.getRotationsCurrent() + _first, rotations, sizeof(F32) * count);
         }
 
         // Color
-        {
-            Vec4F value;
-            for (S32 i = _first; i < _last; ++i)
-            {
-                S32 seed = _particles.accessSeed(i);
-                m_color.sample(seed, _emitterTimePercent, value);
-
-                _particles.accessColorInitial(i) = value;
-                _particles.accessColorCurrent(i) = value;
-            }
-        }
+        m_color.sampleBatch(seeds, _emitterTimePercent, _particles.getColorsInitial() + _first, count);
+        memcpy(_particles.getColorsCurrent() + _first, _particles.getColorsInitial() + _first, sizeof(Vec4F) * count);
 
         // Movement
         {
-            F32 speedValue;
-            F32 gravityValue;
-            for (S32 i = _first; i < _last; ++i)
+            F32 speeds[c_particlesBatchSize];
+            F32 gravities[c_particlesBatchSize];
+            for (S32 batchFirst = _first; batchFirst < _last; batchFirst += c_particlesBatchSize)
             {
-                S32 seed = _particles.accessSeed(i);
-                m_speed.sample(seed, _emitterTimePercent, speedValue);
-                m_gravity.sample(seed, _emitterTimePercent, gravityValue);
-
-                Particles3D::ParticleMovement& movement = _particles.accessMovement(i);
-                Vec3F& direction = _particles.accessDirection(i);
-                movement.velocity = direction * speedValue;
-                movement.acceleration = gravityVector * gravityValue;
+                S32 batchCount = Math::Min(_last - batchFirst, c_particlesBatchSize);
+                S32 const* batchSeeds = _particles.getSeeds() + batchFirst;
+                m_speed.sampleBatch(batchSeeds, _emitterTimePercent, speeds, batchCount);
+                m_gravity.sampleBatch(batchSeeds, _emitterTimePercent, gravities, batchCount);
+
+                Vec3F const* directions = _particles.getDirections() + batchFirst;
+                Vec3F* velocities = _particles.getVelocities() + batchFirst;
+                Vec3F* accelerations = _particles.getAccelerations() + batchFirst;
+                for (S32 i = 0; i < batchCount; ++i)
+                {
+                    velocities[i] = directions[i] * speeds[i];
+                    accelerations[i] = gravityVector * gravities[i];
+                }
             }
         }
     }
@@ -223,122 +190,105 @@ namespace Maze
         S32 _last,
         F32 _dt)
     {
+        S32 count = _last - _first;
+        if (count <= 0)
+            return;
 
-        // Life
-        for (S32 i = _first; i < _last; ++i)
-        {
-            Particles3D::ParticleLife& life = _particles.accessLife(i);
-
-            F32 currentLife = life.current;
-            currentLife -= _dt;
-
-            life.scalar = Math::Clamp01(1.0f - currentLife / life.initial);
+        S32 const* seeds = _particles.getSeeds() + _first;
+        F32 const* lifesScalar = _particles.getLifesScalar() + _first;
 
-            life.current = currentLife;
-        }
+        // Life
+        ParticleSystemKernels::UpdateLifes(
+            _particles.getLifesCurrent() + _first,
+            _particles.getLifesScalar() + _first,
+            _particles.getLifesInitial() + _first,
+            _dt,
+            count);
 
         // Size over lifetime
         if (m_sizeOverLifetime.enabled)
         {
-            F32 value;
-            for (S32 i = _first; i < _last; ++i)
-            {
-                S32 seed = _particles.accessSeed(i);
-                Particles3D::ParticleLife& life = _particles.accessLife(i);
-                Particles3D::ParticleSize& size = _particles.accessSize(i);
-
-                m_sizeOverLifetime.parameter.sample(seed, life.scalar, value);
-                size.current = size.initial * value;
-            }
+            F32* sizesCurrent = _particles.getSizesCurrent() + _first;
+            m_sizeOverLifetime.parameter.sampleBatch(seeds, lifesScalar, sizesCurrent, count);
+            ParticleSystemKernels::Multiply(sizesCurrent, _particles.getSizesInitial() + _first, sizesCurrent, count);
         }
 
         // Velocity over lifetime
         if (m_velocityOverLifetime.enabled)
         {
-            Vec3F value;
-            for (S32 i = _first; i < _last; ++i)
+            F32 valuesX[c_particlesBatchSize];
+            F32 valuesY[c_particlesBatchSize];
+            F32 valuesZ[c_particlesBatchSize];
+            for (S32 batchFirst = _first; batchFirst < _last; batchFirst += c_particlesBatchSize)
             {
-                S32 seed = _particles.accessSeed(i);
-                Particles3D::ParticleLife& life = _particles.accessLife(i);
-                Particles3D::ParticleMovement& movement = _particles.accessMovement(i);
-
-                m_velocityOverLifetime.linearXParameter.sample(seed, life.scalar, value.x);
-                m_velocityOverLifetime.linearYParameter.sample(seed, life.scalar, value.y);
-                m_velocityOverLifetime.linearZParameter.sample(seed, life.scalar, value.z);
-
-                movement.velocity += value * _dt;
+                S32 batchCount = Math::Min(_last - batchFirst, c_particlesBatchSize);
+                S32 const* batchSeeds = _particles.getSeeds() + batchFirst;
+                F32 const* batchLifesScalar = _particles.getLifesScalar() + batchFirst;
+                m_velocityOverLifetime.linearXParameter.sampleBatch(batchSeeds, batchLifesScalar, valuesX, batchCount);
+                m_velocityOverLifetime.linearYParameter.sampleBatch(batchSeeds, batchLifesScalar, valuesY, batchCount);
+                m_velocityOverLifetime.linearZParameter.sampleBatch(batchSeeds, batchLifesScalar, valuesZ, batchCount);
+
+                Vec3F* velocities = _particles.getVelocities() + batchFirst;
+                for (S32 i = 0; i < batchCount; ++i)
+                {
+                    velocities[i].x += valuesX[i] * _dt;
+                    velocities[i].y += valuesY[i] * _dt;
+                    velocities[i].z += valuesZ[i] * _dt;
+                }
             }
         }
 
         // Velocity limit
         if (m_velocityLimitOverLifetime.enabled)
         {
-            F32 value;
-            for (S32 i = _first; i < _last; ++i)
+            F32 limits[c_particlesBatchSize];
+            for (S32 batchFirst = _first; batchFirst < _last; batchFirst += c_particlesBatchSize)
             {
-                S32 seed = _particles.accessSeed(i);
-                Particles3D::ParticleLife& life = _particles.accessLife(i);
-                Particles3D::ParticleMovement& movement = _particles.accessMovement(i);
+                S32 batchCount = Math::Min(_last - batchFirst, c_particlesBatchSize);
+                m_velocityLimitOverLifetime.parameter.sampleBatch(
+                    _particles.getSeeds() + batchFirst, _particles.getLifesScalar() + batchFirst, limits, batchCount);
 
-                m_velocityLimitOverLifetime.parameter.sample(seed, life.scalar, value);
+                Vec3F* velocities = _particles.getVelocities() + batchFirst;
+                for (S32 i = 0; i < batchCount; ++i)
+                {
+                    F32 velocityLength = velocities[i].length();
 
-                F32 velocityLength = movement.velocity.length();
+                    if (velocityLength <= limits[i])
+                        continue;
 
-                if (velocityLength <= value)
-                    continue;
+                    if (velocityLength == 0.0f)
+                        continue;
 
-                if (velocityLength == 0.0f)
-                    continue;
-
-                movement.velocity *= value / velocityLength;
+                    velocities[i] *= limits[i] / velocityLength;
+                }
             }
         }
 
         // Rotation over lifetime
         if (m_rotationOverLifetime.enabled)
         {
-            F32 value;
-            for (S32 i = _first; i < _last; ++i)
+            F32 values[c_particlesBatchSize];
+            for (S32 batchFirst = _first; batchFirst < _last; batchFirst += c_particlesBatchSize)
             {
-                S32 seed = _particles.accessSeed(i);
-                Particles3D::ParticleLife& life = _particles.accessLife(i);
-                Particles3D::ParticleRotation& rotation = _particles.accessRotation(i);
-
-                m_rotationOverLifetime.parameter.sample(seed, life.scalar, value);
+                S32 batchCount = Math::Min(_last - batchFirst, c_particlesBatchSize);
+                m_rotationOverLifetime.parameter.sampleBatch(
+                    _particles.getSeeds() + batchFirst, _particles.getLifesScalar() + batchFirst, values, batchCount);
 
-                rotation.current += value * _dt;
+                ParticleSystemKernels::MultiplyAdd(_particles.getRotationsCurrent() + batchFirst, values, _dt, batchCount);
             }
         }
 
         // Color over lifetime
         if (m_colorOverLifetime.enabled)
         {
-            Vec4F value;
-            for (S32 i = _first; i < _last; ++i)
-            {
-                S32 seed = _particles.accessSeed(i);
-                Particles3D::ParticleLife& life = _particles.accessLife(i);
-                Vec4F const& initalColor = _particles.accessColorInitial(i);
-                Vec4F& currentColor = _particles.accessColorCurrent(i);
-
-                m_colorOverLifetime.parameter.sample(seed, life.scalar, value);
-
-                currentColor = initalColor * value;
-            }
+            Vec4F* colorsCurrent = _particles.getColorsCurrent() + _first;
+            m_colorOverLifetime.parameter.sampleBatch(seeds, lifesScalar, colorsCurrent, count);
+            ParticleSystemKernels::Multiply(colorsCurrent, _particles.getColorsInitial() + _first, colorsCurrent, count);
         }
 
         // Position
-        for (S32 i = _first; i < _last; ++i)
-        {
-            Particles3D::ParticleMovement& movement = _particles.accessMovement(i);
-            Vec3F& position = _particles.accessPosition(i);
-
-            movement.velocity += movement.acceleration * _dt;
-
-            position += movement.velocity * _dt;
-        }
-
-        
+        ParticleSystemKernels::MultiplyAdd(_particles.getVelocities() + _first, _particles.getAccelerations() + _first, _dt, count);
+        ParticleSystemKernels::MultiplyAdd(_particles.getPositions() + _first, _particles.getVelocities() + _first, _dt, count);
     }
 
     //////////////////////////////////////////
@@ -78,16 +78,19 @@ namespace Maze
         // Texture sheet animation
         if (m_textureSheetAnimation.enabled)
         {
-            F32 startFrame = 0;
-            for (S32 i = _first; i < _last; ++i)
+            F32 startFrames[c_particlesBatchSize];
+            for (S32 batchFirst = _first; batchFirst < _last; batchFirst += c_particlesBatchSize)
             {
-                S32 seed = _particles.accessSeed(i);
-                m_textureSheetAnimation.startFrame.sample(seed, _emitterTimePercent, startFrame);
+                S32 batchCount = Math::Min(_last - batchFirst, c_particlesBatchSize);
+                m_textureSheetAnimation.startFrame.sampleBatch(
+                    _particles.getSeeds() + batchFirst, _emitterTimePercent, startFrames, batchCount);
 
-                Particles3D::ParticleAnimationFrame& animationFrame = _particles.accessAnimationFrame(i);
-
-                animationFrame.initial = startFrame;
-                animationFrame.current = startFrame;
+                for (S32 i = 0; i < batchCount; ++i)
+                {
+                    Particles3D::ParticleAnimationFrame& animationFrame = _particles.accessAnimationFrame(batchFirst + i);
+                    animationFrame.initial = startFrames[i];
+                    animationFrame.current = startFrames[i];
+                }
             }
         }
     }
@@ -102,17 +105,18 @@ namespace Maze
         // Texture sheet animation
         if (m_textureSheetAnimation.enabled)
         {
-            F32 frameOverLifetime = 0.0f;
-            for (S32 i = _first; i < _last; ++i)
+            F32 framesOverLifetime[c_particlesBatchSize];
+            for (S32 batchFirst = _first; batchFirst < _last; batchFirst += c_particlesBatchSize)
             {
-                S32 seed = _particles.accessSeed(i);
-                Particles3D::ParticleLife& life = _particles.accessLife(i);
-
-                m_textureSheetAnimation.frameOverTime.sample(seed, life.scalar, frameOverLifetime);
+                S32 batchCount = Math::Min(_last - batchFirst, c_particlesBatchSize);
+                m_textureSheetAnimation.frameOverTime.sampleBatch(
+                    _particles.getSeeds() + batchFirst, _particles.getLifesScalar() + batchFirst, framesOverLifetime, batchCount);
 
-                Particles3D::ParticleAnimationFrame& animationFrame = _particles.accessAnimationFrame(i);
-
-                animationFrame.current = animationFrame.initial + frameOverLifetime;
+                for (S32 i = 0; i < batchCount; ++i)
+                {
+                    Particles3D::ParticleAnimationFrame& animationFrame = _particles.accessAnimationFrame(batchFirst + i);
+                    animationFrame.current = animationFrame.initial + framesOverLifetime[i];
+                }
             }
         }
     }
@@ -308,11 +312,8 @@ namespace Maze
 
             Vec3F position = _particles.accessPosition(index);
             Vec4F colorCurrent = _particles.accessColorCurrent(index);
-            Particles3D::ParticleSize const& size = _particles.accessSize(index);
-            F32 sizeCurrent = size.current;
-
-            Particles3D::ParticleRotation const& rotation = _particles.accessRotation(index);
-            F32 rotationCurrent = rotation.current;
+            F32 sizeCurrent = _particles.accessSizeCurrent(index);
+            F32 rotationCurrent = _particles.accessRotationCurrent(index);
 
             TMat& renderTransform = _particles.accessRenderTransform(i);
             Vec4F& renderColor = _particles.accessRenderColor(i);
@@ -356,7 +357,7 @@ namespace Maze
             // Apply particle size
 #if 0
             mat = mat.transformAffine(
-                TMat32::CreateAffineScale(size.current));
+                TMat32::CreateAffineScale(sizeCurrent));
 #else
             mat[0][0] *= sizeCurrent;
             mat[0][1] *= sizeCurrent;
@@ -390,7 +390,8 @@ namespace Maze
         Vec3F halfScale = zone.scale * 0.5f;
 
         Vec3F shift;
-        switch (Random::RangeRandomMT(0, 6))
+        // rand() instead of the shared Mersenne Twister - systems are updated in parallel
+        switch (rand() % 6)
         {
             case 0:
             {
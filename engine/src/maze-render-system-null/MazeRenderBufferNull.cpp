@@ -0,0 +1,189 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeRenderBufferNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-render-system-null/MazeRenderQueueNull.hpp"
+#include "maze-graphics/MazeTexture2D.hpp"
+#include "maze-graphics/MazeTexture2DMS.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class RenderBufferNull
+    //
+    //////////////////////////////////////////
+    MAZE_IMPLEMENT_METACLASS_WITH_PARENT(RenderBufferNull, RenderBuffer);
+
+    //////////////////////////////////////////
+    RenderBufferNull::RenderBufferNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderBufferNull::~RenderBufferNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderBufferNullPtr RenderBufferNull::Create(
+        RenderSystemNull* _renderSystem,
+        RenderBufferDeleter const& _deleter)
+    {
+        RenderBufferNullPtr object;
+        MAZE_CREATE_AND_INIT_MANAGED_SHARED_PTR_EX(RenderBufferNull, object, _deleter, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    RenderBufferNullPtr RenderBufferNull::Create(
+        RenderBufferNullPtr const& _renderBuffer,
+        RenderBufferDeleter const& _deleter)
+    {
+        RenderBufferNullPtr object;
+        MAZE_CREATE_AND_INIT_MANAGED_SHARED_PTR_EX(RenderBufferNull, object, _deleter, init(_renderBuffer));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool RenderBufferNull::init(RenderSystemNull* _renderSystem)
+    {
+        if (!RenderBuffer::init((RenderSystem*)_renderSystem))
+            return false;
+
+        m_renderQueue = RenderQueueNull::Create(this);
+        if (!m_renderQueue)
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool RenderBufferNull::init(RenderBufferNullPtr const& _renderBuffer)
+    {
+        if (!RenderBuffer::init(RenderBufferPtr(_renderBuffer)))
+            return false;
+
+        m_renderQueue = RenderQueueNull::Create(this);
+        if (!m_renderQueue)
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderBufferPtr RenderBufferNull::createCopy()
+    {
+        return RenderBufferNull::Create(cast<RenderBufferNull>());
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* RenderBufferNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystem->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    bool RenderBufferNull::setSize(Vec2U const& _size)
+    {
+        if (!RenderBuffer::setSize(_size))
+            return false;
+
+        for (Size i = 0; i < c_renderBufferColorTexturesMax; ++i)
+            resizeTexture(m_colorTextures[i], _size);
+
+        resizeTexture(m_depthTexture, _size);
+        resizeTexture(m_stencilTexture, _size);
+
+        eventRenderBufferSizeChanged(cast<RenderBuffer>());
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void RenderBufferNull::resizeTexture(TexturePtr const& _texture, Vec2U const& _size)
+    {
+        if (!_texture)
+            return;
+
+        switch (_texture->getType())
+        {
+            case TextureType::TwoDimensional:
+            {
+                Texture2D* texture2D = _texture->castRaw<Texture2D>();
+                texture2D->loadEmpty(_size, texture2D->getInternalPixelFormat());
+                break;
+            }
+            case TextureType::TwoDimensionalMultisample:
+            {
+                Texture2DMS* texture2D = _texture->castRaw<Texture2DMS>();
+                texture2D->loadEmpty(_size, texture2D->getInternalPixelFormat(), texture2D->getSamples());
+                break;
+            }
+            default:
+            {
+                MAZE_NOT_IMPLEMENTED;
+            }
+        }
+    }
+
+    //////////////////////////////////////////
+    void RenderBufferNull::endDraw()
+    {
+        RenderBuffer::endDraw();
+
+        eventRenderBufferEndDraw(this);
+    }
+
+    //////////////////////////////////////////
+    bool RenderBufferNull::processRenderTargetWillSet()
+    {
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void RenderBufferNull::processRenderTargetSet()
+    {
+    }
+
+    //////////////////////////////////////////
+    void RenderBufferNull::processRenderTargetWillReset()
+    {
+    }
+
+    //////////////////////////////////////////
+    void RenderBufferNull::blit(RenderBufferPtr const& _srcBuffer)
+    {
+        MAZE_ERROR_RETURN_IF(!_srcBuffer, "Source buffer is null!");
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
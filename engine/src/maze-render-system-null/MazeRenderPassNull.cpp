@@ -0,0 +1,97 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeRenderPassNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class RenderPassNull
+    //
+    //////////////////////////////////////////
+    RenderPassNull::RenderPassNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderPassNull::~RenderPassNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderPassNullPtr RenderPassNull::Create(
+        RenderSystem* _renderSystem,
+        RenderPassType _passType,
+        RenderPassDeleter const& _deleter)
+    {
+        RenderPassNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR_EX(RenderPassNull, object, _deleter, init(_renderSystem, _passType));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    RenderPassNullPtr RenderPassNull::Create(
+        RenderPassNullPtr const& _renderPass,
+        RenderPassDeleter const& _deleter)
+    {
+        RenderPassNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR_EX(RenderPassNull, object, _deleter, init(_renderPass));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool RenderPassNull::init(
+        RenderSystem* _renderSystem,
+        RenderPassType _passType)
+    {
+        if (!RenderPass::init(_renderSystem, _passType))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool RenderPassNull::init(RenderPassNullPtr const& _renderPass)
+    {
+        if (!RenderPass::init(_renderPass))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderPassPtr RenderPassNull::createCopy()
+    {
+        return RenderPassNull::Create(cast<RenderPassNull>());
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,328 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeRenderQueueNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-render-system-null/MazeShaderNull.hpp"
+#include "maze-render-system-null/instance-stream/MazeInstanceStreamsNull.hpp"
+#include "maze-graphics/MazeRenderPass.hpp"
+#include "maze-graphics/MazeShader.hpp"
+#include "maze-graphics/MazeShaderUniform.hpp"
+#include "maze-graphics/MazeRenderTarget.hpp"
+#include "maze-graphics/MazeTexture2D.hpp"
+#include "maze-graphics/MazeVertexArrayObject.hpp"
+#include "maze-core/managers/MazeUpdateManager.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    static HashedCString const c_renderTargetFlipYUniformName = MAZE_HASHED_CSTRING("u_renderTargetFlipY");
+
+
+    //////////////////////////////////////////
+    template <typename TCommand>
+    inline void UploadShaderUniformNull(
+        ShaderNull* _shader,
+        TCommand* _command)
+    {
+        if (!_shader)
+            return;
+
+        ShaderUniformPtr const& uniform = _shader->getUniform(_command->name);
+        if (uniform)
+            uniform->upload(_command->pointer, (Size)_command->count);
+    }
+
+
+    //////////////////////////////////////////
+    // Class RenderQueueNull
+    //
+    //////////////////////////////////////////
+    RenderQueueNull::RenderQueueNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderQueueNull::~RenderQueueNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderQueueNullPtr RenderQueueNull::Create(RenderTarget* _renderTarget)
+    {
+        RenderQueueNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(RenderQueueNull, object, init(_renderTarget));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool RenderQueueNull::init(RenderTarget* _renderTarget)
+    {
+        if (!RenderQueue::init(_renderTarget))
+            return false;
+
+        RenderSystemNull* renderSystem = getRenderSystemNullRaw();
+
+        m_instanceStreamModelMatrix = InstanceStreamModelMatrixNull::Create(renderSystem);
+        m_instanceStreamColor = InstanceStreamColorNull::Create(renderSystem);
+
+        m_maxInstancesPerDrawCall = m_instanceStreamModelMatrix->getMaxInstancesPerDrawCall();
+        m_maxInstancesPerDraw = m_instanceStreamModelMatrix->getMaxInstancePerDraw();
+
+        for (S32 i = 0; i < MAZE_UV_CHANNELS_MAX; ++i)
+        {
+            m_instanceStreamUVs[i] = InstanceStreamUVNull::Create(i, renderSystem);
+            m_maxInstancesPerDrawCall = Math::Min(m_maxInstancesPerDrawCall, m_instanceStreamUVs[i]->getMaxInstancesPerDrawCall());
+            m_maxInstancesPerDraw = Math::Min(m_maxInstancesPerDraw, m_instanceStreamUVs[i]->getMaxInstancePerDraw());
+        }
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* RenderQueueNull::getRenderSystemNullRaw() const
+    {
+        return m_renderTarget->getRenderSystem()->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    void RenderQueueNull::draw()
+    {
+        MAZE_PROFILE_EVENT("RenderQueueNull::draw");
+
+        RenderSystemNull* renderSystem = getRenderSystemNullRaw();
+        RenderSystemNullStats& stats = renderSystem->getStats();
+
+        m_drawTime = UpdateManager::GetInstancePtr()->getAppTime();
+        m_currentShader = nullptr;
+        m_scissorRectsDepth = 0;
+
+        m_instanceStreamModelMatrix->setOffset(0);
+        m_instanceStreamColor->setOffset(0);
+        for (S32 i = 0; i < MAZE_UV_CHANNELS_MAX; ++i)
+            m_instanceStreamUVs[i]->setOffset(0);
+
+        m_renderCommandsBuffer.executeAndClear(
+            [&](RenderCommand* _command)
+            {
+                switch (_command->type)
+                {
+                    case RenderCommandType::ClearCurrentRenderTarget:
+                    {
+                        RenderCommandClearCurrentRenderTarget* command = static_cast<RenderCommandClearCurrentRenderTarget*>(_command);
+                        renderSystem->clearCurrentRenderTarget(
+                            command->colorBuffer,
+                            command->depthBuffer,
+                            command->stencilBuffer);
+                        break;
+                    }
+                    case RenderCommandType::SetRenderPass:
+                    {
+                        RenderCommandSetRenderPass* command = static_cast<RenderCommandSetRenderPass*>(_command);
+                        bindRenderPass(command->renderPass);
+                        break;
+                    }
+                    case RenderCommandType::BindTextures:
+                    {
+                        break;
+                    }
+                    case RenderCommandType::DrawVAOInstanced:
+                    {
+                        RenderCommandDrawVAOInstanced* command = static_cast<RenderCommandDrawVAOInstanced*>(_command);
+
+                        if (m_currentShader && m_currentShader->isValid())
+                        {
+                            m_instanceStreamModelMatrix->castRaw<InstanceStreamModelMatrixNull>()->prepareForRender(m_currentShader, command->count);
+
+                            if (command->useColorStream)
+                                m_instanceStreamColor->castRaw<InstanceStreamColorNull>()->prepareForRender(m_currentShader, command->count);
+
+                            for (S32 i = 0; i < MAZE_UV_CHANNELS_MAX; ++i)
+                                if (command->uvMask & (1 << i))
+                                    m_instanceStreamUVs[i]->castRaw<InstanceStreamUVNull>()->prepareForRender(m_currentShader, command->count);
+
+                            Size indicesCount = command->vao->getIndicesCount();
+                            if (indicesCount > 0)
+                            {
+                                ++stats.drawCalls;
+                                stats.instancesCount += (U64)command->count;
+                                stats.indicesCount += (U64)indicesCount * (U64)command->count;
+
+                                ++m_drawCalls;
+                                m_renderTarget->getRenderSystem()->incDrawCall();
+                            }
+                        }
+
+                        m_instanceStreamModelMatrix->setOffset(m_instanceStreamModelMatrix->getOffset() + command->count);
+
+                        if (command->useColorStream)
+                            m_instanceStreamColor->setOffset(m_instanceStreamColor->getOffset() + command->count);
+
+                        for (S32 i = 0; i < MAZE_UV_CHANNELS_MAX; ++i)
+                            if (command->uvMask & (1 << i))
+                                m_instanceStreamUVs[i]->setOffset(m_instanceStreamUVs[i]->getOffset() + command->count);
+
+                        break;
+                    }
+                    case RenderCommandType::PushScissorRect:
+                    {
+                        ++m_scissorRectsDepth;
+                        ++stats.scissorRectChanges;
+                        break;
+                    }
+                    case RenderCommandType::PopScissorRect:
+                    {
+                        MAZE_ERROR_IF(m_scissorRectsDepth == 0, "Scissor rects stack is empty!");
+                        --m_scissorRectsDepth;
+                        ++stats.scissorRectChanges;
+                        break;
+                    }
+                    case RenderCommandType::EnableClipPlane:
+                    case RenderCommandType::DisableClipPlane:
+                    {
+                        ++stats.clipPlaneChanges;
+                        break;
+                    }
+                    case RenderCommandType::SetShaderUniformVec2F:
+                    {
+                        RenderCommandSetShaderUniformVec2F* command = static_cast<RenderCommandSetShaderUniformVec2F*>(_command);
+                        if (m_currentShader)
+                        {
+                            ShaderUniformPtr const& uniform = m_currentShader->getUniform(command->name);
+                            if (uniform)
+                                uniform->set(command->value);
+                        }
+                        break;
+                    }
+                    case RenderCommandType::SetShaderUniformTexture2D:
+                    {
+                        RenderCommandSetShaderUniformTexture2D* command = static_cast<RenderCommandSetShaderUniformTexture2D*>(_command);
+                        if (Texture2D const* texture = Texture2D::GetResourceFast(command->texture2DId))
+                        {
+                            if (m_currentShader)
+                            {
+                                ShaderUniformPtr const& uniform = m_currentShader->getUniform(command->name);
+                                if (uniform)
+                                    uniform->set(texture);
+                            }
+                        }
+                        break;
+                    }
+                    case RenderCommandType::UploadShaderUniformVec2F:
+                    {
+                        UploadShaderUniformNull(m_currentShader, static_cast<RenderCommandUploadShaderUniformVec2F*>(_command));
+                        break;
+                    }
+                    case RenderCommandType::UploadShaderUniformVec3F:
+                    {
+                        UploadShaderUniformNull(m_currentShader, static_cast<RenderCommandUploadShaderUniformVec3F*>(_command));
+                        break;
+                    }
+                    case RenderCommandType::UploadShaderUniformVec4F:
+                    {
+                        UploadShaderUniformNull(m_currentShader, static_cast<RenderCommandUploadShaderUniformVec4F*>(_command));
+                        break;
+                    }
+                    case RenderCommandType::UploadShaderUniformMat3F:
+                    {
+                        UploadShaderUniformNull(m_currentShader, static_cast<RenderCommandUploadShaderUniformMat3F*>(_command));
+                        break;
+                    }
+                    case RenderCommandType::UploadShaderUniformMat4F:
+                    {
+                        UploadShaderUniformNull(m_currentShader, static_cast<RenderCommandUploadShaderUniformMat4F*>(_command));
+                        break;
+                    }
+                    case RenderCommandType::UploadShaderUniformTMat:
+                    {
+                        UploadShaderUniformNull(m_currentShader, static_cast<RenderCommandUploadShaderUniformTMat*>(_command));
+                        break;
+                    }
+                    default:
+                    {
+                        Debug::LogError("Unsupported RenderCommand: %d", (S32)_command->type);
+                        break;
+                    }
+                }
+            });
+
+        clear();
+    }
+
+    //////////////////////////////////////////
+    void RenderQueueNull::clear()
+    {
+        RenderQueue::clear();
+
+        m_instanceStreamModelMatrix->setOffset(0);
+        m_instanceStreamColor->setOffset(0);
+        for (S32 i = 0; i < MAZE_UV_CHANNELS_MAX; ++i)
+            m_instanceStreamUVs[i]->setOffset(0);
+    }
+
+    //////////////////////////////////////////
+    void RenderQueueNull::bindRenderPass(RenderPass* _renderPass)
+    {
+        ++getRenderSystemNullRaw()->getStats().renderPassChanges;
+
+        // Fixed function state (blend, depth, stencil, cull) has nowhere to go,
+        // only the shader side is processed to keep uniforms traffic realistic
+        ShaderNull* shader = _renderPass->getShader()->castRaw<ShaderNull>();
+        m_currentShader = shader;
+
+        _renderPass->applyRenderPassUniforms();
+
+        if (shader->getViewMatrixUniform())
+            shader->getViewMatrixUniform()->set(m_renderTarget->getViewMatrix());
+
+        if (shader->getProjectionMatrixUniform())
+            shader->getProjectionMatrixUniform()->set(m_renderTarget->getProjectionMatrix());
+
+        if (shader->getProjectionParamsUniform())
+        {
+            shader->getProjectionParamsUniform()->set(
+                Vec4F{ m_renderTarget->getNear(), m_renderTarget->getFar(), 0.0f, 0.0f });
+        }
+
+        if (shader->getViewPositionUniform())
+            shader->getViewPositionUniform()->set(m_renderTarget->getViewPosition());
+
+        if (shader->getTimeUniform())
+            shader->getTimeUniform()->set(m_drawTime);
+
+        ShaderUniformPtr const& flipYUniform = shader->getUniform(c_renderTargetFlipYUniformName);
+        if (flipYUniform)
+            flipYUniform->set(1.0f);
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
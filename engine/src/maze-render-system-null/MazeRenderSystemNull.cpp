@@ -0,0 +1,293 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-render-system-null/MazeShaderManagerNull.hpp"
+#include "maze-render-system-null/MazeShaderNull.hpp"
+#include "maze-render-system-null/MazeShaderUniformNull.hpp"
+#include "maze-render-system-null/MazeTexture2DNull.hpp"
+#include "maze-render-system-null/MazeTexture2DMSNull.hpp"
+#include "maze-render-system-null/MazeTextureCubeNull.hpp"
+#include "maze-render-system-null/MazeVertexArrayObjectNull.hpp"
+#include "maze-render-system-null/MazeVertexBufferObjectNull.hpp"
+#include "maze-render-system-null/MazeMaterialNull.hpp"
+#include "maze-render-system-null/MazeRenderPassNull.hpp"
+#include "maze-render-system-null/MazeRenderBufferNull.hpp"
+#include "maze-render-system-null/MazeRenderWindowNull.hpp"
+#include "maze-graphics/MazeRenderTarget.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class RenderSystemNull
+    //
+    //////////////////////////////////////////
+    MAZE_IMPLEMENT_METACLASS_WITH_PARENT(RenderSystemNull, RenderSystem);
+
+    //////////////////////////////////////////
+    RenderSystemNull::RenderSystemNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull::~RenderSystemNull()
+    {
+        m_spriteManager.reset();
+        m_systemFontManager.reset();
+        m_materialManager.reset();
+        m_textureManager.reset();
+        m_renderMeshManager.reset();
+        m_shaderManager.reset();
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNullPtr RenderSystemNull::Create(RenderSystemNullConfig const& _config)
+    {
+        RenderSystemNullPtr renderSystem;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(RenderSystemNull, renderSystem, init(_config));
+        return renderSystem;
+    }
+
+    //////////////////////////////////////////
+    bool RenderSystemNull::init(RenderSystemNullConfig const& _config)
+    {
+        if (!RenderSystem::init())
+            return false;
+
+        m_config = _config;
+
+        ShaderManagerNull::Initialize(m_shaderManager, getSharedPtr());
+        if (!m_shaderManager)
+            return false;
+
+        processSystemInited();
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    String const& RenderSystemNull::getName()
+    {
+        static String s_name = "Null";
+        return s_name;
+    }
+
+    //////////////////////////////////////////
+    void RenderSystemNull::resetStats()
+    {
+        m_stats = RenderSystemNullStats();
+    }
+
+    //////////////////////////////////////////
+    bool RenderSystemNull::isTextureFormatSupported(PixelFormat::Enum _pixelFormat)
+    {
+        return _pixelFormat != PixelFormat::None;
+    }
+
+    //////////////////////////////////////////
+    S32 RenderSystemNull::getWindowMaxAntialiasingLevelSupport()
+    {
+        return m_config.antialiasingLevelMax;
+    }
+
+    //////////////////////////////////////////
+    S32 RenderSystemNull::getWindowCurrentAntialiasingLevelSupport()
+    {
+        return m_config.antialiasingLevelMax;
+    }
+
+    //////////////////////////////////////////
+    S32 RenderSystemNull::getTextureMaxSize()
+    {
+        return m_config.textureMaxSize;
+    }
+
+    //////////////////////////////////////////
+    S32 RenderSystemNull::getTextureMaxAntialiasingLevelSupport()
+    {
+        return m_config.antialiasingLevelMax;
+    }
+
+    //////////////////////////////////////////
+    F32 RenderSystemNull::getTextureMaxAnisotropyLevel()
+    {
+        return 16.0f;
+    }
+
+    //////////////////////////////////////////
+    bool RenderSystemNull::setCurrentRenderTarget(RenderTarget* _renderTarget)
+    {
+        if (m_currentRenderTarget == _renderTarget)
+            return true;
+
+        if (m_currentRenderTarget)
+        {
+            m_currentRenderTarget->processRenderTargetWillReset();
+            m_currentRenderTarget = nullptr;
+        }
+
+        if (_renderTarget)
+        {
+            if (!_renderTarget->processRenderTargetWillSet())
+                return false;
+        }
+
+        m_currentRenderTarget = _renderTarget;
+
+        if (m_currentRenderTarget)
+        {
+            m_currentRenderTarget->processRenderTargetSet();
+            ++m_stats.renderTargetChanges;
+        }
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void RenderSystemNull::clearCurrentRenderTarget(
+        bool _colorBuffer,
+        bool _depthBuffer,
+        bool _stencilBuffer)
+    {
+        if (!m_currentRenderTarget)
+            return;
+
+        if (_colorBuffer || _depthBuffer || _stencilBuffer)
+            ++m_stats.clears;
+    }
+
+    //////////////////////////////////////////
+    ShaderUniformPtr RenderSystemNull::createShaderUniform(
+        ShaderPtr const& _shader,
+        ShaderUniformType _type)
+    {
+        return ShaderUniformNull::Create(_shader, _type);
+    }
+
+    //////////////////////////////////////////
+    RenderWindowPtr RenderSystemNull::createRenderWindow(RenderWindowParams const& _params)
+    {
+        RenderWindowPtr window = RenderWindowNull::Create(this, _params);
+        if (!window)
+        {
+            MAZE_ERROR("RenderWindowNull cannot be created!");
+            return RenderWindowPtr();
+        }
+
+        if (!processRenderWindowCreated(window))
+        {
+            MAZE_ERROR("processRenderWindowCreated failed!");
+            return RenderWindowPtr();
+        }
+
+        return window;
+    }
+
+    //////////////////////////////////////////
+    VertexArrayObjectPtr RenderSystemNull::createVertexArrayObject(RenderTarget* _renderTarget)
+    {
+        return VertexArrayObjectNull::Create(this);
+    }
+
+    //////////////////////////////////////////
+    VertexBufferObjectPtr RenderSystemNull::createVertexBufferObject(
+        GPUByteBufferAccessType::Enum _accessType,
+        bool _singleMapping,
+        RenderTarget* _renderTarget)
+    {
+        return VertexBufferObjectNull::Create(this, _accessType, _singleMapping);
+    }
+
+    //////////////////////////////////////////
+    Texture2DPtr RenderSystemNull::createTexture2D()
+    {
+        return Texture2DNull::Create(this);
+    }
+
+    //////////////////////////////////////////
+    Texture2DMSPtr RenderSystemNull::createTexture2DMS()
+    {
+        return Texture2DMSNull::Create(this);
+    }
+
+    //////////////////////////////////////////
+    TextureCubePtr RenderSystemNull::createTextureCube()
+    {
+        return TextureCubeNull::Create(this);
+    }
+
+    //////////////////////////////////////////
+    MaterialPtr RenderSystemNull::createMaterial()
+    {
+        return MaterialNull::Create(this);
+    }
+
+    //////////////////////////////////////////
+    RenderPassPtr RenderSystemNull::createRenderPass(RenderPassType _passType)
+    {
+        return RenderPassNull::Create(this, _passType);
+    }
+
+    //////////////////////////////////////////
+    GPUVertexBufferPtr RenderSystemNull::createGPUVertexBuffer(
+        VertexDataDescription const& _vertexDataDescription,
+        Size _vertexCount,
+        GPUByteBufferAccessType::Enum _accessType,
+        void* _initialData)
+    {
+        // Instance streams of the null backend are plain CPU arrays
+        MAZE_ERROR("GPUVertexBuffer is not supported by Null render system!");
+        return nullptr;
+    }
+
+    //////////////////////////////////////////
+    GPUTextureBufferPtr RenderSystemNull::createGPUTextureBuffer(
+        Vec2U const& _size,
+        PixelFormat::Enum _pixelFormat,
+        GPUByteBufferAccessType::Enum _accessType,
+        void* _initialData)
+    {
+        // Instance streams of the null backend are plain CPU arrays
+        MAZE_ERROR("GPUTextureBuffer is not supported by Null render system!");
+        return nullptr;
+    }
+
+    //////////////////////////////////////////
+    RenderBufferPtr RenderSystemNull::createRenderBuffer(
+        RenderBuffer::RenderBufferDeleter const& _deleter,
+        RenderTarget* _renderTarget)
+    {
+        return RenderBufferNull::Create(this, _deleter);
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
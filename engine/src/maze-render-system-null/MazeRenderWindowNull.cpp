@@ -0,0 +1,125 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeRenderWindowNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-render-system-null/MazeRenderQueueNull.hpp"
+#include "maze-render-system-null/MazeWindowNull.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class RenderWindowNull
+    //
+    //////////////////////////////////////////
+    MAZE_IMPLEMENT_METACLASS_WITH_PARENT(RenderWindowNull, RenderWindow);
+
+    //////////////////////////////////////////
+    RenderWindowNull::RenderWindowNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    RenderWindowNull::~RenderWindowNull()
+    {
+        destroySystemWindow();
+    }
+
+    //////////////////////////////////////////
+    RenderWindowNullPtr RenderWindowNull::Create(
+        RenderSystemNull* _renderSystem,
+        RenderWindowParams const& _params)
+    {
+        RenderWindowNullPtr window;
+        MAZE_CREATE_AND_INIT_MANAGED_SHARED_PTR(RenderWindowNull, window, init(_renderSystem, _params));
+        return window;
+    }
+
+    //////////////////////////////////////////
+    bool RenderWindowNull::init(
+        RenderSystemNull* _renderSystem,
+        RenderWindowParams const& _params)
+    {
+        m_renderSystemNull = _renderSystem;
+
+        if (!RenderWindow::init(_params))
+            return false;
+
+        m_renderQueue = RenderQueueNull::Create(this);
+        if (!m_renderQueue)
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* RenderWindowNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystemNull;
+    }
+
+    //////////////////////////////////////////
+    WindowPtr RenderWindowNull::fetchSystemWindow(WindowParamsPtr const& _params)
+    {
+        // No OS window - the client size from the params is the back buffer size
+        return WindowNull::Create(_params);
+    }
+
+    //////////////////////////////////////////
+    void RenderWindowNull::swapBuffers()
+    {
+        ++getRenderSystemNullRaw()->getStats().presentedFrames;
+    }
+
+    //////////////////////////////////////////
+    bool RenderWindowNull::processRenderTargetWillSet()
+    {
+        return m_window != nullptr;
+    }
+
+    //////////////////////////////////////////
+    void RenderWindowNull::processRenderTargetSet()
+    {
+    }
+
+    //////////////////////////////////////////
+    void RenderWindowNull::processRenderTargetWillReset()
+    {
+    }
+
+    //////////////////////////////////////////
+    void RenderWindowNull::setVSync(S32 _vsync)
+    {
+        m_vsync = _vsync;
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
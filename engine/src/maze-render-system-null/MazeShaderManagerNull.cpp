@@ -0,0 +1,101 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeShaderManagerNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-render-system-null/MazeShaderNull.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class ShaderManagerNull
+    //
+    //////////////////////////////////////////
+    ShaderManagerNull::ShaderManagerNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    ShaderManagerNull::~ShaderManagerNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    void ShaderManagerNull::Initialize(ShaderManagerPtr& _object, RenderSystemPtr const& _renderSystem)
+    {
+        MAZE_CREATE_AND_INIT_SHARED_PTR(ShaderManagerNull, _object, init(_renderSystem));
+    }
+
+    //////////////////////////////////////////
+    bool ShaderManagerNull::init(RenderSystemPtr const& _renderSystem)
+    {
+        if (!ShaderManager::init(_renderSystem))
+            return false;
+
+        processSystemInited();
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* ShaderManagerNull::getRenderSystemNull()
+    {
+        return m_renderSystemRaw->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr const& ShaderManagerNull::createBuiltinShader(BuiltinShaderType _shaderType)
+    {
+        ShaderPtr& shader = m_builtinShaders[(Size)_shaderType];
+
+        // There is nothing to compile - builtin shaders only need the default uniforms
+        shader = ShaderNull::CreateFromSource(
+            m_renderSystem.lock(),
+            String(),
+            _shaderType.toCString());
+
+        return shader;
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr ShaderManagerNull::createShader()
+    {
+        return ShaderNull::Create(getRenderSystem());
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr ShaderManagerNull::createShader(AssetFilePtr const& _shaderFile)
+    {
+        return ShaderNull::CreateFromFile(getRenderSystem(), _shaderFile);
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,375 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeShaderNull.hpp"
+#include "maze-render-system-null/MazeShaderUniformNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-core/managers/MazeAssetManager.hpp"
+#include "maze-core/assets/MazeAssetFile.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+#include "maze-graphics/MazeVertex.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Uniforms which are set by the engine itself, they exist even if the source
+    // does not declare them (builtin shaders have no source at all)
+    static CString const c_defaultUniformNamesNull[] =
+    {
+        "u_clipDistance0",
+        "u_clipDistanceEnable",
+        "u_projectionMatrix",
+        "u_projectionParams",
+        "u_viewMatrix",
+        "u_modelMatrices",
+        "u_modelMatricesTexture",
+        "u_modelMatricesTextureSize",
+        "u_modelMatriciesOffset",
+        "u_viewPosition",
+        "u_time",
+        "u_mainLightColor",
+        "u_mainLightDirection",
+        "u_mainLightViewProjectionMatrix",
+        "u_mainLightShadowMap",
+        "u_renderTargetFlipY",
+        "u_colorsStream",
+        "u_uv0Stream",
+        "u_uv1Stream",
+        "u_uv2Stream",
+        "u_uv3Stream",
+        "u_uv4Stream",
+        "u_uv5Stream",
+        "u_uv6Stream",
+        "u_uv7Stream"
+    };
+
+    //////////////////////////////////////////
+    inline static bool IsIdentifierCharNull(Char _c)
+    {
+        return (_c >= 'a' && _c <= 'z') || (_c >= 'A' && _c <= 'Z') || (_c >= '0' && _c <= '9') || _c == '_';
+    }
+
+    //////////////////////////////////////////
+    // "vec4 u_color[4] = ..." -> "u_color"
+    inline static void ParseUniformDeclarationNull(
+        String const& _declaration,
+        Vector<String>& _outNames)
+    {
+        Size begin = 0;
+        while (begin < _declaration.size())
+        {
+            Size end = _declaration.find(',', begin);
+            if (end == String::npos)
+                end = _declaration.size();
+
+            Size nameEnd = _declaration.find_first_of("[=", begin);
+            if (nameEnd == String::npos || nameEnd > end)
+                nameEnd = end;
+
+            while (nameEnd > begin && !IsIdentifierCharNull(_declaration[nameEnd - 1]))
+                --nameEnd;
+
+            Size nameBegin = nameEnd;
+            while (nameBegin > begin && IsIdentifierCharNull(_declaration[nameBegin - 1]))
+                --nameBegin;
+
+            if (nameEnd > nameBegin)
+                _outNames.emplace_back(_declaration.substr(nameBegin, nameEnd - nameBegin));
+
+            begin = end + 1;
+        }
+    }
+
+    //////////////////////////////////////////
+    inline static void ParseUniformNamesNull(
+        String const& _source,
+        Vector<String>& _outNames)
+    {
+        static Size const c_keywordLength = 7;
+
+        Size position = 0;
+        while ((position = _source.find("uniform", position)) != String::npos)
+        {
+            Size declarationBegin = position + c_keywordLength;
+
+            bool isKeyword =
+                (position == 0 || !IsIdentifierCharNull(_source[position - 1])) &&
+                (declarationBegin < _source.size() && !IsIdentifierCharNull(_source[declarationBegin]));
+            if (!isKeyword)
+            {
+                position = declarationBegin;
+                continue;
+            }
+
+            Size declarationEnd = _source.find_first_of(";{", declarationBegin);
+            if (declarationEnd == String::npos)
+                break;
+
+            if (_source[declarationEnd] == '{')
+            {
+                // Uniform block - every member is a uniform
+                Size blockEnd = _source.find('}', declarationEnd);
+                if (blockEnd == String::npos)
+                    break;
+
+                Size memberBegin = declarationEnd + 1;
+                Size memberEnd;
+                while ((memberEnd = _source.find(';', memberBegin)) != String::npos && memberEnd < blockEnd)
+                {
+                    ParseUniformDeclarationNull(_source.substr(memberBegin, memberEnd - memberBegin), _outNames);
+                    memberBegin = memberEnd + 1;
+                }
+
+                position = blockEnd;
+            }
+            else
+            {
+                ParseUniformDeclarationNull(_source.substr(declarationBegin, declarationEnd - declarationBegin), _outNames);
+                position = declarationEnd;
+            }
+        }
+    }
+
+
+    //////////////////////////////////////////
+    // Class ShaderNull
+    //
+    //////////////////////////////////////////
+    MAZE_IMPLEMENT_METACLASS_WITH_PARENT(ShaderNull, Shader);
+
+    //////////////////////////////////////////
+    ShaderNull::ShaderNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    ShaderNull::~ShaderNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr ShaderNull::Create(RenderSystemPtr const& _renderSystem)
+    {
+        ShaderNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(ShaderNull, object, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr ShaderNull::CreateFromFile(
+        RenderSystemPtr const& _renderSystem,
+        AssetFilePtr const& _shaderFile)
+    {
+        ShaderNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(ShaderNull, object, init(_renderSystem, _shaderFile));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr ShaderNull::CreateFromSource(
+        RenderSystemPtr const& _renderSystem,
+        String const& _shaderSource,
+        CString _shaderName)
+    {
+        ShaderNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(ShaderNull, object, init(_renderSystem, _shaderSource, _shaderName));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr ShaderNull::Create(ShaderNullPtr const& _shader)
+    {
+        ShaderNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(ShaderNull, object, init(_shader));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool ShaderNull::init(RenderSystemPtr const& _renderSystem)
+    {
+        if (!Shader::init(_renderSystem))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool ShaderNull::init(
+        RenderSystemPtr const& _renderSystem,
+        AssetFilePtr const& _shaderFile)
+    {
+        if (!init(_renderSystem))
+            return false;
+
+        if (!loadFromAssetFile(_shaderFile))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool ShaderNull::init(
+        RenderSystemPtr const& _renderSystem,
+        String const& _shaderSource,
+        CString _shaderName)
+    {
+        if (!init(_renderSystem))
+            return false;
+
+        if (_shaderName)
+            setName(HashedString(_shaderName));
+
+        if (!loadFromSource(_shaderSource))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool ShaderNull::init(ShaderNullPtr const& _shader)
+    {
+        if (!Shader::init(_shader))
+            return false;
+
+        AssetFilePtr assetFile;
+        if (AssetManager::GetInstancePtr())
+            assetFile = AssetManager::GetInstancePtr()->getAssetFile(_shader->getName());
+
+        if (assetFile)
+        {
+            if (!loadFromAssetFile(assetFile))
+                return false;
+        }
+        else
+        {
+            if (!loadFromSources(
+                _shader->m_vertexShaderSource,
+                _shader->m_fragmentShaderSource))
+                return false;
+        }
+
+        for (auto const& uniformData : _shader->m_uniforms)
+        {
+            if (uniformData.second)
+                setUniform(uniformData.second->getName(), uniformData.second->getValue());
+        }
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    ShaderPtr ShaderNull::createCopy()
+    {
+        return ShaderNull::Create(cast<ShaderNull>());
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* ShaderNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystemRaw->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    bool ShaderNull::loadFromSource(String const& _shaderSource)
+    {
+        // Stages are not split, the uniforms scan works over the whole source
+        return loadNullShader(_shaderSource, String());
+    }
+
+    //////////////////////////////////////////
+    bool ShaderNull::loadFromSources(String const& _vertexShaderSource, String const& _fragmentShaderSource)
+    {
+        return loadNullShader(_vertexShaderSource, _fragmentShaderSource);
+    }
+
+    //////////////////////////////////////////
+    void ShaderNull::recompile()
+    {
+        cacheUniformVariants();
+        loadNullShader(m_vertexShaderSource, m_fragmentShaderSource);
+        applyCachedUniformVariants();
+    }
+
+    //////////////////////////////////////////
+    bool ShaderNull::loadNullShader(String const& _vertexShaderSource, String const& _fragmentShaderSource)
+    {
+        MAZE_PROFILE_EVENT("ShaderNull::loadNullShader");
+
+        m_vertexShaderSource = _vertexShaderSource;
+        m_fragmentShaderSource = _fragmentShaderSource;
+
+        m_loaded = false;
+        clearUniformsCache();
+        resetDefaultUniforms();
+
+        Vector<String> uniformNames;
+        ParseUniformNamesNull(m_vertexShaderSource, uniformNames);
+        ParseUniformNamesNull(m_fragmentShaderSource, uniformNames);
+
+        // Prefill uniforms cache
+        for (String const& uniformName : uniformNames)
+            createUniformFromShader(MAZE_HASHED_CSTRING(uniformName.c_str()));
+
+        for (CString uniformName : c_defaultUniformNamesNull)
+            createUniformFromShader(MAZE_HASHED_CSTRING(uniformName));
+
+        m_loaded = true;
+
+        assignDefaultUniforms();
+        processShaderLoaded();
+
+        ++getRenderSystemNullRaw()->getStats().shadersLoaded;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    ShaderUniformPtr const& ShaderNull::createUniformFromShader(HashedCString _uniformName, ShaderUniformType _type)
+    {
+        static ShaderUniformPtr const nullPointer;
+
+        UnorderedMap<U32, ShaderUniformPtr>::const_iterator it = m_uniforms.find(_uniformName.hash);
+        if (it != m_uniforms.end())
+            return it->second;
+
+        // Every requested uniform exists - there is no program to ask
+        ShaderUniformNullPtr newUniform = static_pointer_cast<ShaderUniformNull>(ShaderUniform::Create(getSharedPtr(), _type));
+        MAZE_ERROR_RETURN_VALUE_IF(!newUniform, nullPointer, "Shader Uniform creation error!");
+        newUniform->setName(_uniformName);
+        auto at = m_uniforms.emplace(_uniformName.hash, newUniform);
+        if (at.second)
+            return at.first->second;
+
+        return nullPointer;
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
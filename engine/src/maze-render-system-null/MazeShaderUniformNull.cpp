@@ -0,0 +1,140 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeShaderUniformNull.hpp"
+#include "maze-render-system-null/MazeShaderNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class ShaderUniformNull
+    //
+    //////////////////////////////////////////
+    ShaderUniformNull::ShaderUniformNull()
+    {
+
+    }
+
+    //////////////////////////////////////////
+    ShaderUniformNull::~ShaderUniformNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    ShaderUniformNullPtr ShaderUniformNull::Create(
+        ShaderPtr const& _shader,
+        ShaderUniformType _type)
+    {
+        ShaderUniformNullPtr object;
+        MAZE_CREATE_AND_INIT_MANAGED_SHARED_PTR(ShaderUniformNull, object, init(_shader, _type));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool ShaderUniformNull::init(ShaderPtr const& _shader, ShaderUniformType _type)
+    {
+        if (!ShaderUniform::init(_shader, _type))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    ShaderNull* ShaderUniformNull::getShaderNullRaw() const
+    {
+        return m_shaderRaw->castRaw<ShaderNull>();
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNullStats& ShaderUniformNull::getStats() const
+    {
+        return getShaderNullRaw()->getRenderSystemNullRaw()->getStats();
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::processSimpleUniformChanged()
+    {
+        ++getStats().uniformChanges;
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::processUploaded(Size _bytesCount)
+    {
+        RenderSystemNullStats& stats = getStats();
+        ++stats.uniformUploads;
+        stats.uniformUploadedBytes += (U64)_bytesCount;
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::upload(F32 const* _values, Size _count)
+    {
+        processUploaded(sizeof(F32) * _count);
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::upload(Vec2F const* _vectors, Size _count)
+    {
+        processUploaded(sizeof(Vec2F) * _count);
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::upload(Vec3F const* _vectors, Size _count)
+    {
+        processUploaded(sizeof(Vec3F) * _count);
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::upload(Vec4F const* _vectors, Size _count)
+    {
+        processUploaded(sizeof(Vec4F) * _count);
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::upload(Mat3F const* _matrices, Size _count)
+    {
+        processUploaded(sizeof(Mat3F) * _count);
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::upload(Mat4F const* _matrices, Size _count)
+    {
+        processUploaded(sizeof(Mat4F) * _count);
+    }
+
+    //////////////////////////////////////////
+    void ShaderUniformNull::upload(TMat const* _matrices, Size _count)
+    {
+        processUploaded(sizeof(TMat) * _count);
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,128 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeTexture2DMSNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-graphics/MazePixelSheet2D.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class Texture2DMSNull
+    //
+    //////////////////////////////////////////
+    MAZE_IMPLEMENT_METACLASS_WITH_PARENT(Texture2DMSNull, Texture2DMS);
+
+    //////////////////////////////////////////
+    Texture2DMSNull::Texture2DMSNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    Texture2DMSNull::~Texture2DMSNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    Texture2DMSNullPtr Texture2DMSNull::Create(RenderSystemNull* _renderSystem)
+    {
+        Texture2DMSNullPtr object;
+        MAZE_CREATE_AND_INIT_MANAGED_SHARED_PTR(Texture2DMSNull, object, init((RenderSystem*)_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DMSNull::init(RenderSystem* _renderSystem)
+    {
+        if (!Texture2DMS::init(_renderSystem))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* Texture2DMSNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystem->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DMSNull::loadEmpty(
+        Vec2U const& _size,
+        PixelFormat::Enum _internalPixelFormat,
+        S32 _samples)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(_size.x == 0 || _size.y == 0, false, "Invalid texture size!");
+
+        m_size = Vec2S((S32)_size.x, (S32)_size.y);
+        m_invSize = Vec2F(1.0f / (F32)_size.x, 1.0f / (F32)_size.y);
+        m_internalPixelFormat = _internalPixelFormat;
+        m_samples = Math::Clamp(_samples, 1, getRenderSystemNullRaw()->getConfig().antialiasingLevelMax);
+        m_loaded = true;
+
+        ++getRenderSystemNullRaw()->getStats().texturesLoaded;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void Texture2DMSNull::copyImageFrom(
+        U8 const* _pixels,
+        PixelFormat::Enum _pixelFormat,
+        U32 _width,
+        U32 _height,
+        U32 _x,
+        U32 _y)
+    {
+        getRenderSystemNullRaw()->getStats().textureUploadedBytes +=
+            (U64)PixelFormat::CalculateRequiredBytes(_width, _height, 1u, _pixelFormat);
+    }
+
+    //////////////////////////////////////////
+    void Texture2DMSNull::saveToFileAsTGA(String const& _fileName, Vec2U _size)
+    {
+        Debug::LogWarning("Texture2DMSNull: %s is not saved - there are no pixels", _fileName.c_str());
+    }
+
+    //////////////////////////////////////////
+    PixelSheet2D Texture2DMSNull::readAsPixelSheet(PixelFormat::Enum _outputFormat)
+    {
+        if (_outputFormat == PixelFormat::None)
+            _outputFormat = m_internalPixelFormat;
+
+        PixelSheet2D result(m_size, _outputFormat);
+        result.fill(U8(0));
+        return result;
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
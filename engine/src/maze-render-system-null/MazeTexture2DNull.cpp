@@ -0,0 +1,205 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeTexture2DNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-graphics/MazePixelSheet2D.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class Texture2DNull
+    //
+    //////////////////////////////////////////
+    MAZE_IMPLEMENT_METACLASS_WITH_PARENT(Texture2DNull, Texture2D);
+
+    //////////////////////////////////////////
+    Texture2DNull::Texture2DNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    Texture2DNull::~Texture2DNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    Texture2DNullPtr Texture2DNull::Create(RenderSystemNull* _renderSystem)
+    {
+        Texture2DNullPtr object;
+        MAZE_CREATE_AND_INIT_MANAGED_SHARED_PTR(Texture2DNull, object, init((RenderSystem*)_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::init(RenderSystem* _renderSystem)
+    {
+        if (!Texture2D::init(_renderSystem))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* Texture2DNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystem->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::loadTextureImpl(
+        Vector<PixelSheet2D> const& _pixelSheets,
+        PixelFormat::Enum _internalPixelFormat)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(_pixelSheets.empty(), false, "PixelSheets are empty!");
+
+        if (_internalPixelFormat == PixelFormat::None)
+            _internalPixelFormat = _pixelSheets[0].getFormat();
+
+        Vec2S size = _pixelSheets[0].getSize();
+        MAZE_ERROR_RETURN_VALUE_IF(size.x <= 0 || size.y <= 0, false, "Invalid texture size!");
+
+        m_size = size;
+        m_invSize = Vec2F(1.0f / (F32)size.x, 1.0f / (F32)size.y);
+        m_internalPixelFormat = _internalPixelFormat;
+        m_loaded = true;
+
+        RenderSystemNullStats& stats = getRenderSystemNullRaw()->getStats();
+        ++stats.texturesLoaded;
+        for (PixelSheet2D const& pixelSheet : _pixelSheets)
+            stats.textureUploadedBytes += (U64)pixelSheet.getTotalBytesCount();
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::setMagFilter(TextureFilter _value)
+    {
+        m_magFilter = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::setMinFilter(TextureFilter _value)
+    {
+        m_minFilter = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::setWrapS(TextureWrap _value)
+    {
+        m_wrapS = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::setWrapT(TextureWrap _value)
+    {
+        m_wrapT = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::setBorderColor(ColorU32 _value)
+    {
+        m_borderColor = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::setAnisotropyLevel(F32 _value)
+    {
+        m_anisotropyLevel = Math::Clamp(_value, 0.0f, getRenderSystemNullRaw()->getTextureMaxAnisotropyLevel());
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void Texture2DNull::copyImageFrom(
+        Texture2DPtr const& _texture,
+        U32 _x,
+        U32 _y)
+    {
+        MAZE_ERROR_RETURN_IF(!_texture, "Texture is null!");
+
+        getRenderSystemNullRaw()->getStats().textureUploadedBytes +=
+            (U64)PixelFormat::CalculateRequiredBytes(
+                (U32)_texture->getWidth(),
+                (U32)_texture->getHeight(),
+                1u,
+                _texture->getInternalPixelFormat());
+    }
+
+    //////////////////////////////////////////
+    void Texture2DNull::copyImageFrom(
+        U8 const* _pixels,
+        PixelFormat::Enum _pixelFormat,
+        U32 _width,
+        U32 _height,
+        U32 _x,
+        U32 _y)
+    {
+        getRenderSystemNullRaw()->getStats().textureUploadedBytes +=
+            (U64)PixelFormat::CalculateRequiredBytes(_width, _height, 1u, _pixelFormat);
+    }
+
+    //////////////////////////////////////////
+    void Texture2DNull::saveToFileAsTGA(
+        String const& _fileName,
+        Vec2U _size,
+        bool _resetAlpha)
+    {
+        Debug::LogWarning("Texture2DNull: %s is not saved - there are no pixels", _fileName.c_str());
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DNull::readAsPixelSheet(
+        PixelSheet2D& _outResult,
+        PixelFormat::Enum _outputFormat)
+    {
+        if (_outputFormat == PixelFormat::None)
+            _outputFormat = m_internalPixelFormat;
+
+        _outResult.setFormat(_outputFormat);
+        _outResult.setSize(m_size);
+        _outResult.fill(U8(0));
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void Texture2DNull::generateMipmaps()
+    {
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,147 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeTextureCubeNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-graphics/MazePixelSheet2D.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class TextureCubeNull
+    //
+    //////////////////////////////////////////
+    MAZE_IMPLEMENT_METACLASS_WITH_PARENT(TextureCubeNull, TextureCube);
+
+    //////////////////////////////////////////
+    TextureCubeNull::TextureCubeNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    TextureCubeNull::~TextureCubeNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    TextureCubeNullPtr TextureCubeNull::Create(RenderSystemNull* _renderSystem)
+    {
+        TextureCubeNullPtr object;
+        MAZE_CREATE_AND_INIT_MANAGED_SHARED_PTR(TextureCubeNull, object, init((RenderSystem*)_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool TextureCubeNull::init(RenderSystem* _renderSystem)
+    {
+        if (!TextureCube::init(_renderSystem))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* TextureCubeNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystem->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    bool TextureCubeNull::loadTexture(
+        Vector<PixelSheet2D> const _pixelSheets[6],
+        PixelFormat::Enum _internalPixelFormat)
+    {
+        for (Size face = 0; face < 6; ++face)
+            MAZE_ERROR_RETURN_VALUE_IF(_pixelSheets[face].empty(), false, "Cube face %d has no pixel sheets!", (S32)face);
+
+        if (_internalPixelFormat == PixelFormat::None)
+            _internalPixelFormat = _pixelSheets[0][0].getFormat();
+
+        m_size = _pixelSheets[0][0].getSize();
+        m_internalPixelFormat = _internalPixelFormat;
+        m_loaded = true;
+
+        RenderSystemNullStats& stats = getRenderSystemNullRaw()->getStats();
+        ++stats.texturesLoaded;
+        for (Size face = 0; face < 6; ++face)
+            for (PixelSheet2D const& pixelSheet : _pixelSheets[face])
+                stats.textureUploadedBytes += (U64)pixelSheet.getTotalBytesCount();
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool TextureCubeNull::setMagFilter(TextureFilter _value)
+    {
+        m_magFilter = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool TextureCubeNull::setMinFilter(TextureFilter _value)
+    {
+        m_minFilter = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool TextureCubeNull::setWrapS(TextureWrap _value)
+    {
+        m_wrapS = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool TextureCubeNull::setWrapT(TextureWrap _value)
+    {
+        m_wrapT = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool TextureCubeNull::setWrapR(TextureWrap _value)
+    {
+        m_wrapR = _value;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void TextureCubeNull::generateMipmaps()
+    {
+    }
+
+    //////////////////////////////////////////
+    void TextureCubeNull::reload()
+    {
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,117 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeVertexArrayObjectNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-graphics/MazeSubMesh.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class VertexArrayObjectNull
+    //
+    //////////////////////////////////////////
+    VertexArrayObjectNull::VertexArrayObjectNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    VertexArrayObjectNull::~VertexArrayObjectNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    VertexArrayObjectNullPtr VertexArrayObjectNull::Create(RenderSystemNull* _renderSystem)
+    {
+        VertexArrayObjectNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(VertexArrayObjectNull, object, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool VertexArrayObjectNull::init(RenderSystemNull* _renderSystem)
+    {
+        if (!VertexArrayObject::init((RenderSystem*)_renderSystem))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* VertexArrayObjectNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystem->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    void VertexArrayObjectNull::setIndices(
+        U8 const* _indicesData,
+        VertexAttributeType _indicesType,
+        Size _indicesCount)
+    {
+        MAZE_ERROR_RETURN_IF(
+            _indicesType != VertexAttributeType::U16 && _indicesType != VertexAttributeType::U32,
+            "Unsupported indices type: %d!",
+            (S32)_indicesType);
+
+        m_indicesType = _indicesType;
+        m_indicesCount = _indicesCount;
+
+        getRenderSystemNullRaw()->getStats().indexUploadedBytes +=
+            (U64)(GetVertexAttributeTypeSize(_indicesType) * _indicesCount);
+    }
+
+    //////////////////////////////////////////
+    void VertexArrayObjectNull::setVerticesData(
+        U8 const* _data,
+        VertexAttributeDescription _description,
+        Size _verticesCount)
+    {
+        getRenderSystemNullRaw()->getStats().vertexUploadedBytes +=
+            (U64)(GetVertexAttributeTypeSize(_description.type) * (Size)_description.count * _verticesCount);
+    }
+
+    //////////////////////////////////////////
+    SubMeshPtr VertexArrayObjectNull::readAsSubMesh() const
+    {
+        // Vertex data is not kept
+        return nullptr;
+    }
+
+#if MAZE_DEBUG
+    //////////////////////////////////////////
+    void VertexArrayObjectNull::debug()
+    {
+    }
+#endif
+
+
+} // namespace Maze
+//////////////////////////////////////////
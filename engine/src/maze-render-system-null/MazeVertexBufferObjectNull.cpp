@@ -0,0 +1,95 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeVertexBufferObjectNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class VertexBufferObjectNull
+    //
+    //////////////////////////////////////////
+    VertexBufferObjectNull::VertexBufferObjectNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    VertexBufferObjectNull::~VertexBufferObjectNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    VertexBufferObjectNullPtr VertexBufferObjectNull::Create(
+        RenderSystemNull* _renderSystem,
+        GPUByteBufferAccessType::Enum _accessType,
+        bool _singleMapping)
+    {
+        VertexBufferObjectNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(VertexBufferObjectNull, object, init(_renderSystem, _accessType, _singleMapping));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool VertexBufferObjectNull::init(
+        RenderSystemNull* _renderSystem,
+        GPUByteBufferAccessType::Enum _accessType,
+        bool _singleMapping)
+    {
+        if (!VertexBufferObject::init((RenderSystem*)_renderSystem, _accessType, _singleMapping))
+            return false;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    RenderSystemNull* VertexBufferObjectNull::getRenderSystemNullRaw() const
+    {
+        return m_renderSystem->castRaw<RenderSystemNull>();
+    }
+
+    //////////////////////////////////////////
+    void VertexBufferObjectNull::resize(Size _bytes)
+    {
+        m_sizeBytes = _bytes;
+    }
+
+    //////////////////////////////////////////
+    void VertexBufferObjectNull::upload(
+        void const* _data,
+        Size _bytes)
+    {
+        m_sizeBytes = Math::Max(m_sizeBytes, _bytes);
+        getRenderSystemNullRaw()->getStats().vertexUploadedBytes += (U64)_bytes;
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
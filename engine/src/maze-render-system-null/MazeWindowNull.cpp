@@ -0,0 +1,203 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/MazeWindowNull.hpp"
+#include "maze-core/managers/MazeWindowManager.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class WindowNull
+    //
+    //////////////////////////////////////////
+    WindowNull::WindowNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    WindowNull::~WindowNull()
+    {
+    }
+
+    //////////////////////////////////////////
+    WindowNullPtr WindowNull::Create(WindowParamsPtr const& _params)
+    {
+        WindowManager* windowManager = WindowManager::GetInstancePtr();
+        MAZE_ERROR_RETURN_VALUE_IF(!windowManager, WindowNullPtr(), "WindowManager is not exists!");
+
+        if (!windowManager->processWindowCanBeCreated(_params))
+            return WindowNullPtr();
+
+        WindowNullPtr window;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(WindowNull, window, init(_params));
+        if (!window)
+            return WindowNullPtr();
+
+        if (!windowManager->processWindowCreated(window))
+            return WindowNullPtr();
+
+        return window;
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::init(WindowParamsPtr const& _params)
+    {
+        if (!Window::init(_params))
+            return false;
+
+        m_clientSize = m_params->clientSize;
+        m_opened = true;
+
+        processWindowCreated();
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::isOpened()
+    {
+        return m_opened;
+    }
+
+    //////////////////////////////////////////
+    void WindowNull::setClientSize(Vec2U const& _size)
+    {
+        if (m_clientSize == _size)
+            return;
+
+        m_clientSize = _size;
+        m_params->clientSize = _size;
+
+        processWindowSizeChanged();
+    }
+
+    //////////////////////////////////////////
+    Vec2U WindowNull::getClientSize()
+    {
+        return m_clientSize;
+    }
+
+    //////////////////////////////////////////
+    Vec2U WindowNull::getFullSize()
+    {
+        return m_clientSize;
+    }
+
+    //////////////////////////////////////////
+    void WindowNull::setPosition(Vec2S const& _position)
+    {
+        if (m_position == _position)
+            return;
+
+        m_position = _position;
+
+        processWindowPositionChanged();
+    }
+
+    //////////////////////////////////////////
+    Vec2S WindowNull::getPosition()
+    {
+        return m_position;
+    }
+
+    //////////////////////////////////////////
+    void WindowNull::close()
+    {
+        if (!m_opened)
+            return;
+
+        processWindowWillClose();
+        m_opened = false;
+        processWindowClosed();
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::getFocused()
+    {
+        return m_focused;
+    }
+
+    //////////////////////////////////////////
+    void WindowNull::setFocused(bool _value)
+    {
+        if (m_focused == _value)
+            return;
+
+        m_focused = _value;
+
+        processWindowFocusChanged();
+    }
+
+    //////////////////////////////////////////
+    DisplayPtr const& WindowNull::getRelatedDisplay()
+    {
+        static DisplayPtr nullPointer;
+
+        WindowManager* windowManager = WindowManager::GetInstancePtr();
+        if (!windowManager || windowManager->getDisplays().empty())
+            return nullPointer;
+
+        return windowManager->getDisplays().front();
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::updateCursor()
+    {
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::updateTitle()
+    {
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::updateWindowMode()
+    {
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::updateMinimized()
+    {
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool WindowNull::updateCursorLock()
+    {
+        return true;
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
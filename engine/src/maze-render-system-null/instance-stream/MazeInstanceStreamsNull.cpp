@@ -0,0 +1,165 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemNullHeader.hpp"
+#include "maze-render-system-null/instance-stream/MazeInstanceStreamsNull.hpp"
+#include "maze-render-system-null/MazeRenderSystemNull.hpp"
+#include "maze-render-system-null/MazeShaderNull.hpp"
+#include "maze-graphics/MazeShaderUniform.hpp"
+#include "maze-graphics/config/MazeGraphicsConfig.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    static HashedCString const c_colorsStreamUniformName = MAZE_HASHED_CSTRING("u_colorsStream");
+
+    //////////////////////////////////////////
+    static HashedCString const c_uvStreamUniformNames[MAZE_UV_CHANNELS_MAX] =
+    {
+        MAZE_HASHED_CSTRING("u_uv0Stream"),
+        MAZE_HASHED_CSTRING("u_uv1Stream"),
+        MAZE_HASHED_CSTRING("u_uv2Stream"),
+        MAZE_HASHED_CSTRING("u_uv3Stream"),
+        MAZE_HASHED_CSTRING("u_uv4Stream"),
+        MAZE_HASHED_CSTRING("u_uv5Stream"),
+        MAZE_HASHED_CSTRING("u_uv6Stream"),
+        MAZE_HASHED_CSTRING("u_uv7Stream")
+    };
+
+
+    //////////////////////////////////////////
+    // Class InstanceStreamModelMatrixNull
+    //
+    //////////////////////////////////////////
+    InstanceStreamModelMatrixNullPtr InstanceStreamModelMatrixNull::Create(RenderSystemNull* _renderSystem)
+    {
+        InstanceStreamModelMatrixNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(InstanceStreamModelMatrixNull, object, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool InstanceStreamModelMatrixNull::init(RenderSystemNull* _renderSystem)
+    {
+        if (!InstanceStreamModelMatrix::init())
+            return false;
+
+        m_maxInstancesPerDrawCall = _renderSystem->getConfig().instancesPerDrawCall;
+        m_maxInstancesPerDraw = _renderSystem->getConfig().instancesPerDraw;
+        m_data.resize(m_maxInstancesPerDraw);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void InstanceStreamModelMatrixNull::prepareForRender(
+        ShaderNull* _shader,
+        S32 _instancesCount)
+    {
+        if (_shader->getModelMatricesUniform())
+            _shader->getModelMatricesUniform()->upload(&m_data[m_dataOffset], _instancesCount);
+    }
+
+
+    //////////////////////////////////////////
+    // Class InstanceStreamColorNull
+    //
+    //////////////////////////////////////////
+    InstanceStreamColorNullPtr InstanceStreamColorNull::Create(RenderSystemNull* _renderSystem)
+    {
+        InstanceStreamColorNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(InstanceStreamColorNull, object, init(_renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool InstanceStreamColorNull::init(RenderSystemNull* _renderSystem)
+    {
+        if (!InstanceStreamColor::init())
+            return false;
+
+        m_maxInstancesPerDrawCall = _renderSystem->getConfig().instancesPerDrawCall;
+        m_maxInstancesPerDraw = _renderSystem->getConfig().instancesPerDraw;
+        m_data.resize(m_maxInstancesPerDraw);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void InstanceStreamColorNull::prepareForRender(
+        ShaderNull* _shader,
+        S32 _instancesCount)
+    {
+        ShaderUniformPtr const& colorsStreamUniform = _shader->getUniform(c_colorsStreamUniformName);
+        if (colorsStreamUniform)
+            colorsStreamUniform->upload(&m_data[m_dataOffset], _instancesCount);
+    }
+
+
+    //////////////////////////////////////////
+    // Class InstanceStreamUVNull
+    //
+    //////////////////////////////////////////
+    InstanceStreamUVNullPtr InstanceStreamUVNull::Create(
+        S32 _index,
+        RenderSystemNull* _renderSystem)
+    {
+        InstanceStreamUVNullPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(InstanceStreamUVNull, object, init(_index, _renderSystem));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool InstanceStreamUVNull::init(
+        S32 _index,
+        RenderSystemNull* _renderSystem)
+    {
+        if (!InstanceStreamUV::init(_index))
+            return false;
+
+        m_maxInstancesPerDrawCall = _renderSystem->getConfig().instancesPerDrawCall;
+        m_maxInstancesPerDraw = _renderSystem->getConfig().instancesPerDraw;
+        m_data.resize(m_maxInstancesPerDraw);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void InstanceStreamUVNull::prepareForRender(
+        ShaderNull* _shader,
+        S32 _instancesCount)
+    {
+        ShaderUniformPtr const& uvStreamUniform = _shader->getUniform(c_uvStreamUniformNames[m_index]);
+        if (uvStreamUniform)
+            uvStreamUniform->upload(&m_data[m_dataOffset], _instancesCount);
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
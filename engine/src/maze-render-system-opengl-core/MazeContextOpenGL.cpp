@@ -32,6 +32,7 @@
 #include "maze-render-system-opengl-core/MazeTexture2DOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeExtensionsOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeRenderBufferOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeGPURingBufferOpenGL.hpp"
 
 
 //////////////////////////////////////////
@@ -418,7 +419,8 @@ namespace Maze
         }
 #endif
 
-        if (getExtensionsRaw()->getSupportArbBufferStorage() && 0) // #TODO: UniformTexture streams
+        // Instance stream textures are filled through the persistent ring buffer
+        if (GPURingBufferOpenGL::IsSupported(this))
         {
             Debug::Log("Model Matrices Arch: Uniform Texture");
             m_modelMatricesArchitecture = ModelMatricesArchitectureOpenGL::UniformTexture;
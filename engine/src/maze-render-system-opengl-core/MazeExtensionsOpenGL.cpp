@@ -240,6 +240,20 @@ namespace Maze
         m_supportFrameBufferObject = isGLES || hasGLExtension("GL_EXT_framebuffer_object");
         m_supportFrameBufferBlit = isGLES || hasGLExtension("GL_EXT_framebuffer_blit");
 
+        m_supportArbSync =
+                (m_context->hasMinVersion(3, 2) || (isGLES && m_context->hasMinVersion(3, 0)) || hasGLExtension("GL_ARB_sync"))
+            &&  mzglFenceSync && mzglClientWaitSync && mzglDeleteSync;
+
+        m_supportProgramBinary = false;
+        if (    (m_context->hasMinVersion(4, 1) || (isGLES && m_context->hasMinVersion(3, 0)) || hasGLExtension("GL_ARB_get_program_binary"))
+            &&  mzglGetProgramBinary && mzglProgramBinary && mzglGetIntegerv)
+        {
+            // Drivers are allowed to expose the API without any binary format
+            MZGLint programBinaryFormatsCount = 0;
+            MAZE_GL_CALL(mzglGetIntegerv(MAZE_GL_NUM_PROGRAM_BINARY_FORMATS, &programBinaryFormatsCount));
+            m_supportProgramBinary = (programBinaryFormatsCount > 0);
+        }
+
         if (mzglGetIntegerv)
         {
             MZGLint supportedCompressedTextureFormatsCount = 0;
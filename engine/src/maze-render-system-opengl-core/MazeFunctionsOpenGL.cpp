@@ -66,6 +66,9 @@ MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglGetIntegerv)(MZGLe
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglGetDoublev)(MZGLenum _pname, MZGLdouble* _params) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglGetBufferParameteriv)(MZGLenum _target, MZGLenum _value, MZGLint* _data) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglGetProgramiv)(MZGLuint _program, MZGLenum _pname, MZGLint* _param) = nullptr;
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglGetProgramBinary)(MZGLuint _program, MZGLsizei _bufSize, MZGLsizei* _length, MZGLenum* _binaryFormat, void* _binary) = nullptr;
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglProgramBinary)(MZGLuint _program, MZGLenum _binaryFormat, void const* _binary, MZGLsizei _length) = nullptr;
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglProgramParameteri)(MZGLuint _program, MZGLenum _pname, MZGLint _value) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API MZGLint (MAZE_GL_FUNCPTR *mzglGetUniformLocation)(MZGLuint _program, MZGLchar const* _name) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglGetActiveUniform)(MZGLuint _program, MZGLuint _index, MZGLsizei _bufSize, MZGLsizei* _length, MZGLint* _size, MZGLenum* _type, MZGLchar* _name) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API MZGLint (MAZE_GL_FUNCPTR *mzglGetAttribLocation)(MZGLuint _program, MZGLchar const* _name) = nullptr;
@@ -141,6 +144,9 @@ MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglDrawArraysInstance
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglVertexAttribDivisor)(MZGLuint _index, MZGLuint _divisor) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void* (MAZE_GL_FUNCPTR *mzglMapBufferRange)(MZGLenum _target, MZGLintptr _offset, MZGLsizeiptr _length, MZGLbitfield _access) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglFlushMappedBufferRange)(MZGLenum _target, MZGLintptr _offset, MZGLsizeiptr _length) = nullptr;
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API MZGLsync (MAZE_GL_FUNCPTR *mzglFenceSync)(MZGLenum _condition, MZGLbitfield _flags) = nullptr;
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API MZGLenum (MAZE_GL_FUNCPTR *mzglClientWaitSync)(MZGLsync _sync, MZGLbitfield _flags, MZGLuint64 _timeout) = nullptr;
+MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglDeleteSync)(MZGLsync _sync) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglPixelStorei)(MZGLenum _pname, MZGLint _param) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglGenTextures)(MZGLsizei _n, MZGLuint* _textures) = nullptr;
 MAZE_RENDER_SYSTEM_OPENGL_CORE_API void (MAZE_GL_FUNCPTR *mzglDeleteTextures)(MZGLsizei _n, MZGLuint const* _textures) = nullptr;
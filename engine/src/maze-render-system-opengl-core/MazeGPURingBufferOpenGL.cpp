@@ -0,0 +1,242 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemOpenGLCoreHeader.hpp"
+#include "maze-render-system-opengl-core/MazeGPURingBufferOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeContextOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeRenderSystemOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeExtensionsOpenGL.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+#include "maze-core/utils/MazeProfiler.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class GPURingBufferOpenGL
+    //
+    //////////////////////////////////////////
+    GPURingBufferOpenGL::GPURingBufferOpenGL()
+    {
+    }
+
+    //////////////////////////////////////////
+    GPURingBufferOpenGL::~GPURingBufferOpenGL()
+    {
+        deleteGLObjects();
+    }
+
+    //////////////////////////////////////////
+    GPURingBufferOpenGLPtr GPURingBufferOpenGL::Create(
+        ContextOpenGL* _context,
+        Size _regionSizeBytes)
+    {
+        GPURingBufferOpenGLPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(GPURingBufferOpenGL, object, init(_context, _regionSizeBytes));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool GPURingBufferOpenGL::IsSupported(ContextOpenGL* _context)
+    {
+        if (!_context || !_context->getExtensionsRaw())
+            return false;
+
+        return     _context->getExtensionsRaw()->getSupportArbBufferStorage()
+                && _context->getExtensionsRaw()->getSupportArbSync()
+                && mzglBufferStorage
+                && mzglMapBufferRange;
+    }
+
+    //////////////////////////////////////////
+    bool GPURingBufferOpenGL::init(
+        ContextOpenGL* _context,
+        Size _regionSizeBytes)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(!IsSupported(_context), false, "Persistent mapping is not supported!");
+        MAZE_ERROR_RETURN_VALUE_IF(_regionSizeBytes == 0, false, "Invalid region size!");
+
+        m_context = _context;
+        m_regionSizeBytes = _regionSizeBytes;
+
+        Size bufferSizeBytes = m_regionSizeBytes * c_regionsCount;
+
+        ContextOpenGLScopeBind contextScopedBind(m_context);
+        MAZE_GL_MUTEX_SCOPED_LOCK(m_context->getRenderSystemRaw());
+
+        MZGLbitfield flags = MAZE_GL_MAP_WRITE_BIT | MAZE_GL_MAP_PERSISTENT_BIT | MAZE_GL_MAP_COHERENT_BIT;
+
+        MAZE_GL_CALL(mzglGenBuffers(1, &m_glBuffer));
+        MAZE_GL_CALL(mzglBindBuffer(MAZE_GL_COPY_WRITE_BUFFER, m_glBuffer));
+        MAZE_GL_CALL(mzglBufferStorage(MAZE_GL_COPY_WRITE_BUFFER, (MZGLsizeiptr)bufferSizeBytes, nullptr, flags));
+        MAZE_GL_CALL(m_mappedPointer = (U8*)mzglMapBufferRange(MAZE_GL_COPY_WRITE_BUFFER, 0, (MZGLsizeiptr)bufferSizeBytes, flags));
+        MAZE_GL_CALL(mzglBindBuffer(MAZE_GL_COPY_WRITE_BUFFER, 0));
+
+        MAZE_ERROR_RETURN_VALUE_IF(!m_mappedPointer, false, "Ring buffer mapping failed!");
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void GPURingBufferOpenGL::deleteGLObjects()
+    {
+        if (!m_context || m_context->getIsDestroyed() || !m_context->isValid())
+        {
+            m_glBuffer = 0;
+            m_mappedPointer = nullptr;
+            return;
+        }
+
+        ContextOpenGLScopeBind contextScopedBind(m_context);
+        MAZE_GL_MUTEX_SCOPED_LOCK(m_context->getRenderSystemRaw());
+
+        for (U32 i = 0; i < c_regionsCount; ++i)
+        {
+            if (m_regionFences[i])
+            {
+                MAZE_GL_CALL(mzglDeleteSync(m_regionFences[i]));
+                m_regionFences[i] = nullptr;
+            }
+        }
+
+        if (m_glBuffer)
+        {
+            if (m_mappedPointer)
+            {
+                MAZE_GL_CALL(mzglBindBuffer(MAZE_GL_COPY_WRITE_BUFFER, m_glBuffer));
+                MAZE_GL_CALL(mzglUnmapBuffer(MAZE_GL_COPY_WRITE_BUFFER));
+                MAZE_GL_CALL(mzglBindBuffer(MAZE_GL_COPY_WRITE_BUFFER, 0));
+                m_mappedPointer = nullptr;
+            }
+
+            MAZE_GL_CALL(mzglDeleteBuffers(1, &m_glBuffer));
+            m_glBuffer = 0;
+        }
+    }
+
+    //////////////////////////////////////////
+    void GPURingBufferOpenGL::beginDraw(U32 _frameIndex)
+    {
+        MAZE_DEBUG_ERROR_RETURN_IF(m_drawStarted, "Draw is already started!");
+
+        m_drawStarted = true;
+
+        if (m_regionFrameValid && m_regionFrameIndex == _frameIndex)
+            return;
+
+        m_regionIndex = (m_regionIndex + 1) % c_regionsCount;
+        m_regionFrameIndex = _frameIndex;
+        m_regionFrameValid = true;
+        m_regionHead = 0;
+        m_regionFencedHead = 0;
+
+        waitRegion(m_regionIndex);
+    }
+
+    //////////////////////////////////////////
+    void GPURingBufferOpenGL::endDraw()
+    {
+        if (!m_drawStarted)
+            return;
+
+        m_drawStarted = false;
+
+        // Nothing was written by this draw. Either the region fence of the previous draw
+        // already covers all the data, or nothing was written since waitRegion released the region
+        if (m_regionHead == m_regionFencedHead)
+            return;
+
+        // Commands complete in order, so the new fence covers the previous draws of the frame
+        MZGLsync& fence = m_regionFences[m_regionIndex];
+        if (fence)
+        {
+            MAZE_GL_CALL(mzglDeleteSync(fence));
+        }
+
+        MAZE_GL_CALL(fence = mzglFenceSync(MAZE_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        m_regionFencedHead = m_regionHead;
+    }
+
+    //////////////////////////////////////////
+    Size GPURingBufferOpenGL::allocate(
+        Size _sizeBytes,
+        Size _alignment,
+        U8*& _outPointer)
+    {
+        MAZE_DEBUG_ERROR_RETURN_VALUE_IF(!m_drawStarted, c_invalidOffset, "Draw is not started!");
+        MAZE_DEBUG_ERROR_IF(_alignment == 0, "Alignment should be above 0!");
+
+        Size head = ((m_regionHead + _alignment - 1) / _alignment) * _alignment;
+        if (head + _sizeBytes > m_regionSizeBytes)
+        {
+            _outPointer = nullptr;
+            return c_invalidOffset;
+        }
+
+        m_regionHead = head + _sizeBytes;
+
+        Size offset = m_regionIndex * m_regionSizeBytes + head;
+        _outPointer = m_mappedPointer + offset;
+        return offset;
+    }
+
+    //////////////////////////////////////////
+    void GPURingBufferOpenGL::waitRegion(U32 _regionIndex)
+    {
+        MZGLsync& fence = m_regionFences[_regionIndex];
+        if (!fence)
+            return;
+
+        MZGLenum result = MAZE_GL_WAIT_FAILED;
+        MAZE_GL_CALL(result = mzglClientWaitSync(fence, 0, 0));
+
+        if (result == MAZE_GL_TIMEOUT_EXPIRED)
+        {
+            MAZE_PROFILE_EVENT("GPURingBufferOpenGL::waitRegion");
+
+            ++m_stallsCount;
+
+            // 1 second per attempt, flush only once
+            MZGLbitfield waitFlags = MAZE_GL_SYNC_FLUSH_COMMANDS_BIT;
+            do
+            {
+                MAZE_GL_CALL(result = mzglClientWaitSync(fence, waitFlags, 1000000000ull));
+                waitFlags = 0;
+            }
+            while (result == MAZE_GL_TIMEOUT_EXPIRED);
+        }
+
+        MAZE_ERROR_IF(result == MAZE_GL_WAIT_FAILED, "Ring buffer fence wait failed!");
+
+        MAZE_GL_CALL(mzglDeleteSync(fence));
+        fence = nullptr;
+    }
+
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -0,0 +1,247 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemOpenGLCoreHeader.hpp"
+#include "maze-render-system-opengl-core/MazeProgramBinaryCacheOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeFunctionsOpenGL.hpp"
+#include "maze-core/helpers/MazeFileHelper.hpp"
+#include "maze-core/helpers/MazeStringHelper.hpp"
+#include "maze-core/hash/MazeHashCRC.hpp"
+#include "maze-core/data/MazeByteBuffer.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    namespace
+    {
+        //////////////////////////////////////////
+        U32 const c_programBinaryFileMagic = 0x42505A4D; // "MZPB"
+
+        //////////////////////////////////////////
+        struct ProgramBinaryFileHeader
+        {
+            U32 magic;
+            U32 version;
+            U32 driverHash;
+            U32 vertexShaderHash;
+            U32 vertexShaderLength;
+            U32 fragmentShaderHash;
+            U32 fragmentShaderLength;
+            U32 binaryFormat;
+            U32 binaryLength;
+        };
+
+    } // namespace
+
+
+    //////////////////////////////////////////
+    // Class ProgramBinaryCacheOpenGL
+    //
+    //////////////////////////////////////////
+    ProgramBinaryCacheOpenGL::ProgramBinaryCacheOpenGL()
+    {
+    }
+
+    //////////////////////////////////////////
+    ProgramBinaryCacheOpenGL::~ProgramBinaryCacheOpenGL()
+    {
+        if (m_hitsCount || m_missesCount)
+            Debug::Log("Program binary cache: %d hits, %d misses.", m_hitsCount, m_missesCount);
+    }
+
+    //////////////////////////////////////////
+    ProgramBinaryCacheOpenGLPtr ProgramBinaryCacheOpenGL::Create(
+        Path const& _directory,
+        String const& _driverId)
+    {
+        ProgramBinaryCacheOpenGLPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(ProgramBinaryCacheOpenGL, object, init(_directory, _driverId));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool ProgramBinaryCacheOpenGL::init(
+        Path const& _directory,
+        String const& _driverId)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(_directory.empty(), false, "Program binary cache directory is empty!");
+
+        m_directory = _directory;
+        m_driverHash = Hash::CalculateCRC32(_driverId.c_str(), _driverId.size());
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    ProgramBinaryCacheKeyOpenGL ProgramBinaryCacheOpenGL::buildKey(
+        String const& _vertexShaderSource,
+        String const& _fragmentShaderSource) const
+    {
+        ProgramBinaryCacheKeyOpenGL key;
+        key.vertexShaderHash = Hash::CalculateCRC32(_vertexShaderSource.c_str(), _vertexShaderSource.size());
+        key.vertexShaderLength = (U32)_vertexShaderSource.size();
+        key.fragmentShaderHash = Hash::CalculateCRC32(_fragmentShaderSource.c_str(), _fragmentShaderSource.size());
+        key.fragmentShaderLength = (U32)_fragmentShaderSource.size();
+        key.driverHash = m_driverHash;
+        return key;
+    }
+
+    //////////////////////////////////////////
+    bool ProgramBinaryCacheOpenGL::loadProgramBinary(
+        MZGLuint _programId,
+        ProgramBinaryCacheKeyOpenGL const& _key)
+    {
+        MAZE_PROFILE_EVENT("ProgramBinaryCacheOpenGL::loadProgramBinary");
+
+        Path filePath = buildFilePath(_key);
+        if (!FileHelper::IsFileExists(filePath))
+        {
+            ++m_missesCount;
+            return false;
+        }
+
+        ByteBuffer fileData;
+        Size fileSize = FileHelper::ReadFileToByteBuffer(filePath, fileData);
+
+        ProgramBinaryFileHeader header;
+        bool headerValid = false;
+        if (fileSize >= sizeof(ProgramBinaryFileHeader))
+        {
+            memcpy(&header, fileData.getDataRO(), sizeof(ProgramBinaryFileHeader));
+            headerValid =
+                header.magic == c_programBinaryFileMagic &&
+                header.version == c_fileVersion &&
+                header.driverHash == _key.driverHash &&
+                header.vertexShaderHash == _key.vertexShaderHash &&
+                header.vertexShaderLength == _key.vertexShaderLength &&
+                header.fragmentShaderHash == _key.fragmentShaderHash &&
+                header.fragmentShaderLength == _key.fragmentShaderLength &&
+                header.binaryLength > 0 &&
+                fileSize == sizeof(ProgramBinaryFileHeader) + header.binaryLength;
+        }
+
+        // Truncated file, old version or a key collision - will be overwritten
+        if (!headerValid)
+        {
+            ++m_missesCount;
+            return false;
+        }
+
+        MAZE_GL_CALL(mzglProgramBinary(
+            _programId,
+            (MZGLenum)header.binaryFormat,
+            fileData.getDataRO() + sizeof(ProgramBinaryFileHeader),
+            (MZGLsizei)header.binaryLength));
+
+        MZGLint status = MAZE_GL_FALSE;
+        MAZE_GL_CALL(mzglGetProgramiv(_programId, MAZE_GL_LINK_STATUS, &status));
+        if (status == MAZE_GL_FALSE)
+        {
+            // Driver strings are the same, but the binary is not accepted (driver update
+            // without version change, different GPU settings) - every binary is suspicious now
+            MAZE_WARNING("Program binary is rejected by the driver, program binary cache is invalidated!");
+            invalidate();
+            ++m_missesCount;
+            return false;
+        }
+
+        ++m_hitsCount;
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool ProgramBinaryCacheOpenGL::saveProgramBinary(
+        MZGLuint _programId,
+        ProgramBinaryCacheKeyOpenGL const& _key)
+    {
+        MAZE_PROFILE_EVENT("ProgramBinaryCacheOpenGL::saveProgramBinary");
+
+        MZGLint binaryLength = 0;
+        MAZE_GL_CALL(mzglGetProgramiv(_programId, MAZE_GL_PROGRAM_BINARY_LENGTH, &binaryLength));
+        if (binaryLength <= 0)
+            return false;
+
+        Vector<U8> fileData(sizeof(ProgramBinaryFileHeader) + (Size)binaryLength);
+
+        MZGLsizei writtenLength = 0;
+        MZGLenum binaryFormat = 0;
+        MAZE_GL_CALL(mzglGetProgramBinary(
+            _programId,
+            (MZGLsizei)binaryLength,
+            &writtenLength,
+            &binaryFormat,
+            fileData.data() + sizeof(ProgramBinaryFileHeader)));
+        if (writtenLength <= 0)
+            return false;
+
+        ProgramBinaryFileHeader header;
+        header.magic = c_programBinaryFileMagic;
+        header.version = c_fileVersion;
+        header.driverHash = _key.driverHash;
+        header.vertexShaderHash = _key.vertexShaderHash;
+        header.vertexShaderLength = _key.vertexShaderLength;
+        header.fragmentShaderHash = _key.fragmentShaderHash;
+        header.fragmentShaderLength = _key.fragmentShaderLength;
+        header.binaryFormat = (U32)binaryFormat;
+        header.binaryLength = (U32)writtenLength;
+        memcpy(fileData.data(), &header, sizeof(ProgramBinaryFileHeader));
+
+        if (!FileHelper::IsDirectory(m_directory))
+            FileHelper::CreateDirectoryRecursive(m_directory);
+
+        Path filePath = buildFilePath(_key);
+        OutputFileStream outputFile(filePath.c_str(), std::ios::binary);
+        MAZE_WARNING_RETURN_VALUE_IF(!outputFile, false, "Failed to open file - %s", filePath.toUTF8().c_str());
+
+        outputFile.write((S8 const*)fileData.data(), sizeof(ProgramBinaryFileHeader) + (Size)writtenLength);
+
+        return outputFile.good();
+    }
+
+    //////////////////////////////////////////
+    void ProgramBinaryCacheOpenGL::invalidate()
+    {
+        if (FileHelper::IsDirectory(m_directory))
+            FileHelper::DeleteDirectory(m_directory);
+    }
+
+    //////////////////////////////////////////
+    Path ProgramBinaryCacheOpenGL::buildFilePath(ProgramBinaryCacheKeyOpenGL const& _key) const
+    {
+        U32 sourcesHash = Hash::CalculateCRC32((Char const*)&_key, sizeof(ProgramBinaryCacheKeyOpenGL));
+
+        String fileName;
+        StringHelper::FormatString(fileName, "/%08x%08x.mzglbin", _key.driverHash, sourcesHash);
+
+        return m_directory + Path(fileName);
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -40,6 +40,7 @@
 #include "maze-render-system-opengl-core/MazeVertexOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeRenderDrawTopologyOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeExtensionsOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeGPURingBufferOpenGL.hpp"
 #include "maze-core/services/MazeLogStream.hpp"
 #include "maze-core/math/MazeMathAlgebra.hpp"
 #include "maze-core/utils/MazeProfiler.hpp"
@@ -131,6 +132,18 @@ namespace Maze
             m_maxInstancesPerDraw = Math::Min(m_maxInstancesPerDraw, instanceStream->getMaxInstancePerDraw());
         }
 
+        if (    m_context->getModelMatricesArchitecture() == ModelMatricesArchitectureOpenGL::UniformTexture
+            &&  GPURingBufferOpenGL::IsSupported(m_context))
+        {
+            // Model matrix (4 x Vec3F) + color + UV channels (Vec4F) per instance.
+            // A region holds the instances of several full draw calls, because all the draws
+            // of the frame share it. Bigger frames fall back to the regular buffer mapping
+            Size instanceSizeBytes = sizeof(TMat) + sizeof(Vec4F) * (1 + MAZE_UV_CHANNELS_MAX);
+            m_instanceRingBuffer = GPURingBufferOpenGL::Create(
+                m_context,
+                (Size)m_maxInstancesPerDrawCall * instanceSizeBytes * 8);
+        }
+
         return true;
     }
 
@@ -408,6 +421,9 @@ namespace Maze
                 }
             });
 
+        if (m_instanceRingBuffer)
+            m_instanceRingBuffer->endDraw();
+
         m_context->getStateMachine()->bindVertexArrayObject(0);
         clear();
     }
@@ -565,11 +581,15 @@ namespace Maze
                 (S32)Math::Round(m_renderTarget->getRenderTargetWidth() * m_renderTarget->getViewport().size.x),
                 (S32)Math::Round(m_renderTarget->getRenderTargetHeight() * m_renderTarget->getViewport().size.y)));
 
-        m_instanceStreamModelMatrix->castRaw<InstanceStreamModelMatrixOpenGL>()->processDrawBegin();
-        m_instanceStreamColor->castRaw<InstanceStreamColorOpenGL>()->processDrawBegin();
+        GPURingBufferOpenGL* ringBuffer = m_instanceRingBuffer.get();
+        if (ringBuffer)
+            ringBuffer->beginDraw(UpdateManager::GetInstancePtr()->getFrameIndex());
+
+        m_instanceStreamModelMatrix->castRaw<InstanceStreamModelMatrixOpenGL>()->processDrawBegin(ringBuffer);
+        m_instanceStreamColor->castRaw<InstanceStreamColorOpenGL>()->processDrawBegin(ringBuffer);
 
         for (S32 i = 0; i < MAZE_UV_CHANNELS_MAX; ++i)
-            m_instanceStreamUVs[i]->castRaw<InstanceStreamUVOpenGL>()->processDrawBegin();
+            m_instanceStreamUVs[i]->castRaw<InstanceStreamUVOpenGL>()->processDrawBegin(ringBuffer);
         
     }
 
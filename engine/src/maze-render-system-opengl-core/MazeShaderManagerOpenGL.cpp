@@ -31,6 +31,7 @@
 #include "maze-render-system-opengl-core/MazeContextOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeFunctionsOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeShaderOpenGL.hpp"
+#include "maze-core/helpers/MazeFileHelper.hpp"
 
 
 //////////////////////////////////////////
@@ -112,9 +113,34 @@ namespace Maze
         m_contextOpenGL->eventGLContextWillBeDestroyed.subscribe(this, &ShaderManagerOpenGL::notifyGLContextWillBeDestroyed);
         m_contextOpenGL->eventGLContextSetup.subscribe(this, &ShaderManagerOpenGL::notifyGLContextSetup);
 
+        createProgramBinaryCache();
+
         return true;
     }
 
+    //////////////////////////////////////////
+    void ShaderManagerOpenGL::createProgramBinaryCache()
+    {
+        RenderSystemOpenGLConfig const& config = getRenderSystemOpenGL()->getConfig();
+        if (!config.programBinaryCacheEnabled)
+            return;
+
+        // Any driver update changes at least one of these strings
+        String driverId;
+        for (MZGLenum name : { MAZE_GL_VENDOR, MAZE_GL_RENDERER, MAZE_GL_VERSION, MAZE_GL_SHADING_LANGUAGE_VERSION })
+        {
+            CString value = (CString)mzglGetString(name);
+            driverId += value ? value : "";
+            driverId += '\n';
+        }
+
+        Path directory = config.programBinaryCacheDirectory;
+        if (directory.empty())
+            directory = FileHelper::GetDefaultTemporaryDirectory() + Path("/gl-program-cache");
+
+        m_programBinaryCache = ProgramBinaryCacheOpenGL::Create(directory, driverId);
+    }
+
     //////////////////////////////////////////
     void ShaderManagerOpenGL::notifyGLContextWillBeDestroyed(ContextOpenGL* _contextOpenGL)
     {
@@ -27,6 +27,7 @@
 #include "MazeRenderSystemOpenGLCoreHeader.hpp"
 #include "maze-render-system-opengl-core/MazeHeaderOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeShaderOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeProgramBinaryCacheOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeRenderSystemOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeContextOpenGL.hpp"
 #include "maze-render-system-opengl-core/MazeFunctionsOpenGL.hpp"
@@ -354,11 +355,6 @@ namespace Maze
         MAZE_GL_MUTEX_SCOPED_LOCK(getRenderSystemOpenGLRaw());
         MAZE_GL_CALL(m_programId = mzglCreateProgram());
 
-        MZGLuint vertexShaderId = 0;
-        MZGLuint fragmentShaderId = 0;
-
-
-
         String version = StringHelper::ToString(shaderManager->castRaw<ShaderManagerOpenGL>()->getGLSLVersion());
 
         String shaderVersion = "#version " + version;
@@ -422,23 +418,6 @@ namespace Maze
         MAZE_ERROR_IF(completeVertexShader.size() >= 100000, "Vertex shader size is too big - %d", (S32)completeVertexShader.size());
 
 
-        if (!compileGLShader(vertexShaderId, MAZE_GL_VERTEX_SHADER, completeVertexShader.c_str()))
-        {
-            Debug::LogError("Vertex shader compilation error!");
-            Debug::LogError("Shader: %s", getName().c_str());
-
-            Vector<String> words;
-            StringHelper::SplitWords(completeVertexShader, words, '\n');
-            for (Size i = 0; i < words.size(); ++i)
-                Debug::LogError("[%d]%s", i, words[i].c_str());
-
-            MAZE_FATAL("Failed to compile the vertex shader");
-
-            vertexShaderId = 0;
-            return false;
-        }
-
-
         String fragmentExtensionFeatures;
         if (currentContext->getExtensionsRaw()->getSupportClipDistance())
         {
@@ -460,13 +439,81 @@ namespace Maze
 
         MAZE_ERROR_IF(completeFragmentShader.size() >= 100000, "Fragment shader size is too big - %d", (S32)completeFragmentShader.size());
 
-        if (!compileGLShader(fragmentShaderId, MAZE_GL_FRAGMENT_SHADER, completeFragmentShader.c_str())) 
+        bool loadedFromCache = false;
+
+        ProgramBinaryCacheOpenGL* programBinaryCache = nullptr;
+        if (currentContext->getExtensionsRaw()->getSupportProgramBinary())
+            programBinaryCache = shaderManager->castRaw<ShaderManagerOpenGL>()->getProgramBinaryCache().get();
+
+        ProgramBinaryCacheKeyOpenGL programBinaryKey;
+        if (programBinaryCache)
+        {
+            programBinaryKey = programBinaryCache->buildKey(completeVertexShader, completeFragmentShader);
+            loadedFromCache = programBinaryCache->loadProgramBinary(m_programId, programBinaryKey);
+
+            // Failed glProgramBinary leaves the program in an unlinked state, start from scratch
+            if (!loadedFromCache)
+            {
+                MAZE_GL_CALL(mzglDeleteProgram(m_programId));
+                MAZE_GL_CALL(m_programId = mzglCreateProgram());
+            }
+        }
+
+        if (!loadedFromCache)
+        {
+            if (programBinaryCache && mzglProgramParameteri)
+                MAZE_GL_CALL(mzglProgramParameteri(m_programId, MAZE_GL_PROGRAM_BINARY_RETRIEVABLE_HINT, MAZE_GL_TRUE));
+
+            if (!compileAndLinkGLProgram(completeVertexShader, completeFragmentShader))
+                return false;
+
+            if (programBinaryCache)
+                programBinaryCache->saveProgramBinary(m_programId, programBinaryKey);
+        }
+
+        assignUniforms();
+        assignDefaultUniforms();
+        processShaderLoaded();
+
+        F32 msTime = F32(timer.getMicroseconds()) / 1000.0f;
+        Debug::Log("Shader %s loaded%s for %.1fms.", getName().c_str(), loadedFromCache ? " from the program binary cache" : "", msTime);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool ShaderOpenGL::compileAndLinkGLProgram(
+        String const& _completeVertexShader,
+        String const& _completeFragmentShader)
+    {
+        MAZE_PROFILE_EVENT("ShaderOpenGL::compileAndLinkGLProgram");
+
+        MZGLuint vertexShaderId = 0;
+        MZGLuint fragmentShaderId = 0;
+
+        if (!compileGLShader(vertexShaderId, MAZE_GL_VERTEX_SHADER, _completeVertexShader.c_str()))
+        {
+            Debug::LogError("Vertex shader compilation error!");
+            Debug::LogError("Shader: %s", getName().c_str());
+
+            Vector<String> words;
+            StringHelper::SplitWords(_completeVertexShader, words, '\n');
+            for (Size i = 0; i < words.size(); ++i)
+                Debug::LogError("[%d]%s", i, words[i].c_str());
+
+            MAZE_FATAL("Failed to compile the vertex shader");
+
+            vertexShaderId = 0;
+            return false;
+        }
+
+        if (!compileGLShader(fragmentShaderId, MAZE_GL_FRAGMENT_SHADER, _completeFragmentShader.c_str())) 
         {
              Debug::LogError("Fragment shader compilation error!");
              Debug::LogError("Shader: %s", getName().c_str());
 
             Vector<String> words;
-            StringHelper::SplitWords(completeFragmentShader, words, '\n');
+            StringHelper::SplitWords(_completeFragmentShader, words, '\n');
             for (Size i = 0; i < words.size(); ++i)
                 Debug::LogError("[%d]%s", i, words[i].c_str());
 
@@ -522,7 +569,7 @@ namespace Maze
                 Debug::LogError("Vertex Shader (%s):", getName().c_str());
                 
                 Vector<String> words;
-                StringHelper::SplitWords(completeVertexShader, words, '\n');
+                StringHelper::SplitWords(_completeVertexShader, words, '\n');
                 for (Size i = 0; i < words.size(); ++i)
                     Debug::LogError("[%d]%s", i, words[i].c_str());
             }
@@ -530,7 +577,7 @@ namespace Maze
                 Debug::LogError("Fragment Shader (%s):", getName().c_str());
                 
                 Vector<String> words;
-                StringHelper::SplitWords(completeFragmentShader, words, '\n');
+                StringHelper::SplitWords(_completeFragmentShader, words, '\n');
                 for (Size i = 0; i < words.size(); ++i)
                 {
                     Debug::LogError("[%d]%s", i, words[i].c_str());
@@ -590,13 +637,6 @@ namespace Maze
             fragmentShaderId = 0;
         }
 
-        assignUniforms();
-        assignDefaultUniforms();
-        processShaderLoaded();
-
-        F32 msTime = F32(timer.getMicroseconds()) / 1000.0f;
-        Debug::Log("Shader %s loaded for %.1fms.", getName().c_str(), msTime);
-
         return true;
     }
 
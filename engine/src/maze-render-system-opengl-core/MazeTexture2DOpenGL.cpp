@@ -815,6 +815,127 @@ namespace Maze
         generateMipmaps();
     }
 
+    //////////////////////////////////////////
+    void Texture2DOpenGL::uploadImageRegion(
+        U8 const* _pixels,
+        PixelFormat::Enum _pixelFormat,
+        U32 _width,
+        U32 _height,
+        U32 _x,
+        U32 _y)
+    {
+        MAZE_ERROR_RETURN_IF((S32)_x + (S32)_width > m_size.x, "Can't upload image region!");
+        MAZE_ERROR_RETURN_IF((S32)_y + (S32)_height > m_size.y, "Can't upload image region!");
+
+        if (m_glTexture == 0)
+            return;
+
+        ContextOpenGLScopeBind contextScopedBind(m_context);
+        MAZE_GL_MUTEX_SCOPED_LOCK(m_context->getRenderSystemRaw());
+        Texture2DOpenGLScopeBind textureScopedBind(this);
+
+        MZGLint originFormat = GetOpenGLOriginFormat(_pixelFormat);
+        MZGLint dataType = GetOpenGLDataType(_pixelFormat);
+
+        // The driver orders the upload before the next draws sampling the texture
+        MAZE_GL_CALL(mzglTexSubImage2D(MAZE_GL_TEXTURE_2D, 0, _x, _y, _width, _height, originFormat, dataType, _pixels));
+    }
+
+    //////////////////////////////////////////
+    bool Texture2DOpenGL::blitImageRegionsFrom(
+        Texture2D* _texture,
+        Rect2S const* _srcRects,
+        Rect2S const* _dstRects,
+        S32 _count)
+    {
+        if (!_texture || m_glTexture == 0)
+            return false;
+
+        Texture2DOpenGL* textureGL = _texture->castRaw<Texture2DOpenGL>();
+        if (textureGL->m_glTexture == 0)
+            return false;
+
+        if (!m_context->getExtensionsRaw()->getSupportFrameBufferObject()
+            || !m_context->getExtensionsRaw()->getSupportFrameBufferBlit())
+            return false;
+
+        ContextOpenGLScopeBind contextScopedBind(m_context);
+        MAZE_GL_MUTEX_SCOPED_LOCK(m_context->getRenderSystemRaw());
+
+        MZGLint readFramebuffer = 0;
+        MZGLint drawFramebuffer = 0;
+        MAZE_GL_CALL(mzglGetIntegerv(MAZE_GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer));
+        MAZE_GL_CALL(mzglGetIntegerv(MAZE_GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer));
+
+        MZGLuint sourceFrameBuffer = 0;
+        MZGLuint destFrameBuffer = 0;
+        MAZE_GL_CALL(mzglGenFramebuffers(1, &sourceFrameBuffer));
+        MAZE_GL_CALL(mzglGenFramebuffers(1, &destFrameBuffer));
+
+        bool result = false;
+        if (sourceFrameBuffer && destFrameBuffer)
+        {
+            MAZE_GL_CALL(mzglBindFramebuffer(MAZE_GL_READ_FRAMEBUFFER, sourceFrameBuffer));
+            MAZE_GL_CALL(mzglFramebufferTexture2D(MAZE_GL_READ_FRAMEBUFFER, MAZE_GL_COLOR_ATTACHMENT0, MAZE_GL_TEXTURE_2D, textureGL->m_glTexture, 0));
+
+            MAZE_GL_CALL(mzglBindFramebuffer(MAZE_GL_DRAW_FRAMEBUFFER, destFrameBuffer));
+            MAZE_GL_CALL(mzglFramebufferTexture2D(MAZE_GL_DRAW_FRAMEBUFFER, MAZE_GL_COLOR_ATTACHMENT0, MAZE_GL_TEXTURE_2D, m_glTexture, 0));
+
+            MZGLenum sourceStatus;
+            MAZE_GL_CALL(sourceStatus = mzglCheckFramebufferStatus(MAZE_GL_READ_FRAMEBUFFER));
+
+            MZGLenum destStatus;
+            MAZE_GL_CALL(destStatus = mzglCheckFramebufferStatus(MAZE_GL_DRAW_FRAMEBUFFER));
+
+            // Compressed and other non-renderable sources are not attachable
+            if ((sourceStatus == MAZE_GL_FRAMEBUFFER_COMPLETE) && (destStatus == MAZE_GL_FRAMEBUFFER_COMPLETE))
+            {
+                // Scissor test affects the blit
+                bool scissorTestEnabled = m_context->getScissorTestEnabled();
+                m_context->setScissorTestEnabled(false);
+
+                for (S32 i = 0; i < _count; ++i)
+                {
+                    Rect2S const& srcRect = _srcRects[i];
+                    Rect2S const& dstRect = _dstRects[i];
+                    MAZE_GL_CALL(
+                        mzglBlitFramebuffer(
+                            srcRect.position.x,
+                            srcRect.position.y,
+                            srcRect.position.x + srcRect.size.x,
+                            srcRect.position.y + srcRect.size.y,
+                            dstRect.position.x,
+                            dstRect.position.y,
+                            dstRect.position.x + dstRect.size.x,
+                            dstRect.position.y + dstRect.size.y,
+                            MAZE_GL_COLOR_BUFFER_BIT,
+                            MAZE_GL_NEAREST));
+                }
+
+                m_context->setScissorTestEnabled(scissorTestEnabled);
+
+                result = true;
+            }
+        }
+
+        // The driver orders the blits before the next draws sampling the texture,
+        // the framebuffers deletion is deferred by the driver as well
+        MAZE_GL_CALL(mzglBindFramebuffer(MAZE_GL_READ_FRAMEBUFFER, readFramebuffer));
+        MAZE_GL_CALL(mzglBindFramebuffer(MAZE_GL_DRAW_FRAMEBUFFER, drawFramebuffer));
+
+        if (sourceFrameBuffer)
+        {
+            MAZE_GL_CALL(mzglDeleteFramebuffers(1, &sourceFrameBuffer));
+        }
+
+        if (destFrameBuffer)
+        {
+            MAZE_GL_CALL(mzglDeleteFramebuffers(1, &destFrameBuffer));
+        }
+
+        return result;
+    }
+
     //////////////////////////////////////////
     void Texture2DOpenGL::notifyContextOpenGLDestroyed(ContextOpenGL* _contextOpenGL)
     {
@@ -155,7 +155,7 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    void InstanceStreamModelMatrixOpenGL::processDrawBegin()
+    void InstanceStreamModelMatrixOpenGL::processDrawBegin(GPURingBufferOpenGL* _ringBuffer)
     {
         switch (m_mode)
         {
@@ -164,6 +164,14 @@ namespace Maze
                 if (m_dataOffset == 0)
                     return;
 
+                if (UploadInstanceStreamTextureOpenGL(
+                    m_context,
+                    _ringBuffer,
+                    m_bufferInfo.buffer,
+                    &m_data[0],
+                    m_dataOffset * 4))
+                    return;
+
                 m_bufferInfo.mappedPointer = m_bufferInfo.buffer->map(0, m_bufferInfo.buffer->getElementsCount());
 
                 memcpy(
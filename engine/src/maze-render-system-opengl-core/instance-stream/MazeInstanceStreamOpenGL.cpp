@@ -27,6 +27,10 @@
 #include "MazeRenderSystemOpenGLCoreHeader.hpp"
 #include "maze-render-system-opengl-core/MazeHeaderOpenGL.hpp"
 #include "maze-render-system-opengl-core/instance-stream/MazeInstanceStreamOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeGPURingBufferOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeContextOpenGL.hpp"
+#include "maze-render-system-opengl-core/MazeRenderSystemOpenGL.hpp"
+#include "maze-graphics/MazeTexture2D.hpp"
 
 
 //////////////////////////////////////////
@@ -37,5 +41,58 @@ namespace Maze
     MAZE_IMPLEMENT_ENUMCLASS(InstanceStreamModeOpenGL);
 
 
+    //////////////////////////////////////////
+    MAZE_RENDER_SYSTEM_OPENGL_CORE_API bool UploadInstanceStreamTextureOpenGL(
+        ContextOpenGL* _context,
+        GPURingBufferOpenGL* _ringBuffer,
+        GPUTextureBufferPtr const& _textureBuffer,
+        void const* _data,
+        Size _elementsCount)
+    {
+        if (!_ringBuffer || _elementsCount == 0)
+            return false;
+
+        Texture2DPtr const& texture = _textureBuffer->getTexture();
+        U32 width = _textureBuffer->getSize().x;
+        U32 height = _textureBuffer->getSize().y;
+        Size bytesPerElement = _textureBuffer->getBytesPerElement();
+
+        _elementsCount = Math::Min(_elementsCount, (Size)width * (Size)height);
+        U32 rows = (U32)((_elementsCount + width - 1) / width);
+
+        // Whole rows are uploaded, the tail of the last row is just a garbage
+        U8* pointer = nullptr;
+        Size offset = _ringBuffer->allocate((Size)rows * width * bytesPerElement, 16, pointer);
+        if (offset == GPURingBufferOpenGL::c_invalidOffset)
+            return false;
+
+        memcpy(pointer, _data, _elementsCount * bytesPerElement);
+
+        MAZE_GL_MUTEX_SCOPED_LOCK(_context->getRenderSystemRaw());
+
+        if ((bytesPerElement & 4) != 4)
+        {
+            MAZE_GL_CALL(mzglPixelStorei(MAZE_GL_UNPACK_ALIGNMENT, 1));
+        }
+
+        MAZE_GL_CALL(mzglBindBuffer(MAZE_GL_PIXEL_UNPACK_BUFFER, _ringBuffer->getGLBuffer()));
+
+        texture->uploadImageRegion(
+            reinterpret_cast<U8 const*>(offset),
+            _textureBuffer->getPixelFormat(),
+            width, rows,
+            0, 0);
+
+        MAZE_GL_CALL(mzglBindBuffer(MAZE_GL_PIXEL_UNPACK_BUFFER, 0));
+
+        if ((bytesPerElement & 4) != 4)
+        {
+            MAZE_GL_CALL(mzglPixelStorei(MAZE_GL_UNPACK_ALIGNMENT, 4));
+        }
+
+        return true;
+    }
+
+
 } // namespace Maze
 //////////////////////////////////////////
@@ -211,7 +211,7 @@ namespace Maze
     }
 
     //////////////////////////////////////////
-    void InstanceStreamUVOpenGL::processDrawBegin()
+    void InstanceStreamUVOpenGL::processDrawBegin(GPURingBufferOpenGL* _ringBuffer)
     {
         switch (m_mode)
         {
@@ -220,6 +220,14 @@ namespace Maze
                 if (m_dataOffset == 0)
                     return;
 
+                if (UploadInstanceStreamTextureOpenGL(
+                    m_context,
+                    _ringBuffer,
+                    m_bufferInfo.buffer,
+                    &m_data[0],
+                    m_dataOffset))
+                    return;
+
                 m_bufferInfo.mappedPointer = m_bufferInfo.buffer->map(0, m_bufferInfo.buffer->getElementsCount());
 
                 memcpy(
@@ -102,6 +102,9 @@ namespace Maze
         AssignOpenGLFunctionDirect(_renderContext, mzglGetDoublev, nullptr);
         AssignOpenGLFunctionDirect(_renderContext, mzglGetBufferParameteriv, glGetBufferParameteriv);
         AssignOpenGLFunctionDirect(_renderContext, mzglGetProgramiv, glGetProgramiv);
+        AssignOpenGLFunctionDirect(_renderContext, mzglGetProgramBinary, glGetProgramBinary);
+        AssignOpenGLFunctionDirect(_renderContext, mzglProgramBinary, glProgramBinary);
+        AssignOpenGLFunctionDirect(_renderContext, mzglProgramParameteri, glProgramParameteri);
         AssignOpenGLFunctionDirect(_renderContext, mzglGetUniformLocation, glGetUniformLocation);
         AssignOpenGLFunctionDirect(_renderContext, mzglGetActiveUniform, glGetActiveUniform);
         AssignOpenGLFunctionDirect(_renderContext, mzglGetAttribLocation, glGetAttribLocation);
@@ -177,6 +180,9 @@ namespace Maze
         AssignOpenGLFunctionDirect(_renderContext, mzglVertexAttribDivisor, glVertexAttribDivisor);
         AssignOpenGLFunctionDirect(_renderContext, mzglMapBufferRange, glMapBufferRange);
         AssignOpenGLFunctionDirect(_renderContext, mzglFlushMappedBufferRange, glFlushMappedBufferRange);
+        AssignOpenGLFunctionDirect(_renderContext, mzglFenceSync, glFenceSync);
+        AssignOpenGLFunctionDirect(_renderContext, mzglClientWaitSync, glClientWaitSync);
+        AssignOpenGLFunctionDirect(_renderContext, mzglDeleteSync, glDeleteSync);
         AssignOpenGLFunctionDirect(_renderContext, mzglPixelStorei, glPixelStorei);
         AssignOpenGLFunctionDirect(_renderContext, mzglGenTextures, glGenTextures);
         AssignOpenGLFunctionDirect(_renderContext, mzglDeleteTextures, glDeleteTextures);
@@ -260,6 +266,9 @@ namespace Maze
         AssignOpenGLFunction(_renderContext, mzglGetDoublev, "glGetDoublev");
         AssignOpenGLFunction(_renderContext, mzglGetBufferParameteriv, "glGetBufferParameteriv");
         AssignOpenGLFunction(_renderContext, mzglGetProgramiv, "glGetProgramiv");
+        AssignOpenGLFunction(_renderContext, mzglGetProgramBinary, "glGetProgramBinary");
+        AssignOpenGLFunction(_renderContext, mzglProgramBinary, "glProgramBinary");
+        AssignOpenGLFunction(_renderContext, mzglProgramParameteri, "glProgramParameteri");
         AssignOpenGLFunction(_renderContext, mzglGetUniformLocation, "glGetUniformLocation");
         AssignOpenGLFunction(_renderContext, mzglGetActiveUniform, "glGetActiveUniform");
         AssignOpenGLFunction(_renderContext, mzglGetAttribLocation, "glGetAttribLocation");
@@ -339,6 +348,9 @@ namespace Maze
         AssignOpenGLFunction(_renderContext, mzglVertexAttribDivisor, "glVertexAttribDivisor");
         AssignOpenGLFunction(_renderContext, mzglMapBufferRange, "glMapBufferRange");
         AssignOpenGLFunction(_renderContext, mzglFlushMappedBufferRange, "glFlushMappedBufferRange");
+        AssignOpenGLFunction(_renderContext, mzglFenceSync, "glFenceSync");
+        AssignOpenGLFunction(_renderContext, mzglClientWaitSync, "glClientWaitSync");
+        AssignOpenGLFunction(_renderContext, mzglDeleteSync, "glDeleteSync");
         AssignOpenGLFunction(_renderContext, mzglPixelStorei, "glPixelStorei");
         AssignOpenGLFunction(_renderContext, mzglGenTextures, "glGenTextures");
         AssignOpenGLFunction(_renderContext, mzglDeleteTextures, "glDeleteTextures");
@@ -0,0 +1,247 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemVulkanHeader.hpp"
+#include "maze-render-system-vulkan/MazePipelineCacheVulkan.hpp"
+#include "maze-core/helpers/MazeFileHelper.hpp"
+#include "maze-core/hash/MazeHashCRC.hpp"
+#include "maze-core/data/MazeByteBuffer.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    namespace
+    {
+        //////////////////////////////////////////
+        U32 const c_pipelineCacheFileMagic = 0x43565A4D; // "MZVC"
+
+        //////////////////////////////////////////
+        struct PipelineCacheFileHeader
+        {
+            U32 magic;
+            U32 version;
+            U32 dataSize;
+            U32 dataHash;
+        };
+
+    } // namespace
+
+
+    //////////////////////////////////////////
+    // Class PipelineCacheVulkan
+    //
+    //////////////////////////////////////////
+    PipelineCacheVulkan::PipelineCacheVulkan()
+    {
+        memset(&m_physicalDeviceProperties, 0, sizeof(m_physicalDeviceProperties));
+    }
+
+    //////////////////////////////////////////
+    PipelineCacheVulkan::~PipelineCacheVulkan()
+    {
+        if (m_hitsCount || m_missesCount)
+            Debug::Log("Pipeline cache: %d hits, %d misses.", m_hitsCount, m_missesCount);
+
+        if (m_pipelineCache != VK_NULL_HANDLE)
+            vkDestroyPipelineCache(m_device, m_pipelineCache, nullptr);
+    }
+
+    //////////////////////////////////////////
+    PipelineCacheVulkanPtr PipelineCacheVulkan::Create(
+        VkDevice _device,
+        VkPhysicalDeviceProperties const& _physicalDeviceProperties,
+        Path const& _filePath)
+    {
+        PipelineCacheVulkanPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(PipelineCacheVulkan, object, init(_device, _physicalDeviceProperties, _filePath));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool PipelineCacheVulkan::init(
+        VkDevice _device,
+        VkPhysicalDeviceProperties const& _physicalDeviceProperties,
+        Path const& _filePath)
+    {
+        MAZE_PROFILE_EVENT("PipelineCacheVulkan::init");
+
+        m_device = _device;
+        m_physicalDeviceProperties = _physicalDeviceProperties;
+        m_filePath = _filePath;
+
+        Vector<U8> initialData;
+        if (!m_filePath.empty())
+            loadInitialData(initialData);
+
+        VkPipelineCacheCreateInfo pipelineCacheInfo = {};
+        pipelineCacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        pipelineCacheInfo.initialDataSize = initialData.size();
+        pipelineCacheInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+        VkResult result = vkCreatePipelineCache(m_device, &pipelineCacheInfo, nullptr, &m_pipelineCache);
+
+        // The driver is allowed to refuse the data it has produced itself - start empty then
+        if (result != VK_SUCCESS && !initialData.empty())
+        {
+            MAZE_WARNING("Pipeline cache data is rejected by the driver (result=%d), starting with an empty cache!", (S32)result);
+            pipelineCacheInfo.initialDataSize = 0;
+            pipelineCacheInfo.pInitialData = nullptr;
+            result = vkCreatePipelineCache(m_device, &pipelineCacheInfo, nullptr, &m_pipelineCache);
+            initialData.clear();
+        }
+
+        MAZE_ERROR_RETURN_VALUE_IF(result != VK_SUCCESS, false, "vkCreatePipelineCache failed! result=%d", (S32)result);
+
+        m_loadedDataSize = initialData.size();
+        if (m_loadedDataSize)
+            Debug::Log("Pipeline cache loaded: %u bytes.", (U32)m_loadedDataSize);
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool PipelineCacheVulkan::loadInitialData(Vector<U8>& _outData) const
+    {
+        if (!FileHelper::IsFileExists(m_filePath))
+            return false;
+
+        ByteBuffer fileData;
+        Size fileSize = FileHelper::ReadFileToByteBuffer(m_filePath, fileData);
+        if (fileSize < sizeof(PipelineCacheFileHeader))
+            return false;
+
+        PipelineCacheFileHeader header;
+        memcpy(&header, fileData.getDataRO(), sizeof(PipelineCacheFileHeader));
+
+        U8 const* data = fileData.getDataRO() + sizeof(PipelineCacheFileHeader);
+
+        // Old version or a truncated file - will be overwritten.
+        // Drivers do not have to survive corrupted cache data, so the hash is checked as well
+        if (header.magic != c_pipelineCacheFileMagic ||
+            header.version != c_fileVersion ||
+            fileSize != sizeof(PipelineCacheFileHeader) + header.dataSize ||
+            header.dataHash != Hash::CalculateCRC32((Char const*)data, header.dataSize))
+            return false;
+
+        // Another GPU or driver version
+        if (!isVulkanHeaderValid(data, header.dataSize))
+            return false;
+
+        _outData.assign(data, data + header.dataSize);
+        return true;
+    }
+
+    //////////////////////////////////////////
+    bool PipelineCacheVulkan::isVulkanHeaderValid(U8 const* _data, Size _size) const
+    {
+        if (_size < sizeof(VkPipelineCacheHeaderVersionOne))
+            return false;
+
+        VkPipelineCacheHeaderVersionOne header;
+        memcpy(&header, _data, sizeof(VkPipelineCacheHeaderVersionOne));
+
+        return
+            header.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne) &&
+            header.headerSize <= _size &&
+            header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+            header.vendorID == m_physicalDeviceProperties.vendorID &&
+            header.deviceID == m_physicalDeviceProperties.deviceID &&
+            memcmp(header.pipelineCacheUUID, m_physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+    //////////////////////////////////////////
+    void PipelineCacheVulkan::notifyPipelineCreated(VkPipelineCreationFeedback const& _feedback)
+    {
+        // No feedback - assume the worst
+        if (!(_feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT))
+        {
+            m_dirty = true;
+            return;
+        }
+
+        if (_feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT)
+        {
+            ++m_hitsCount;
+        }
+        else
+        {
+            ++m_missesCount;
+            m_dirty = true;
+        }
+    }
+
+    //////////////////////////////////////////
+    bool PipelineCacheVulkan::save()
+    {
+        if (!m_dirty || m_filePath.empty() || m_pipelineCache == VK_NULL_HANDLE)
+            return false;
+
+        MAZE_PROFILE_EVENT("PipelineCacheVulkan::save");
+
+        m_dirty = false;
+
+        Size dataSize = 0;
+        MAZE_VK_CALL(vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, nullptr));
+        if (dataSize == 0)
+            return false;
+
+        Vector<U8> fileData(sizeof(PipelineCacheFileHeader) + dataSize);
+        VkResult result = vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, fileData.data() + sizeof(PipelineCacheFileHeader));
+        MAZE_WARNING_RETURN_VALUE_IF(result != VK_SUCCESS, false, "vkGetPipelineCacheData failed! result=%d", (S32)result);
+
+        PipelineCacheFileHeader header;
+        header.magic = c_pipelineCacheFileMagic;
+        header.version = c_fileVersion;
+        header.dataSize = (U32)dataSize;
+        header.dataHash = Hash::CalculateCRC32((Char const*)fileData.data() + sizeof(PipelineCacheFileHeader), dataSize);
+        memcpy(fileData.data(), &header, sizeof(PipelineCacheFileHeader));
+
+        Path directory = FileHelper::GetDirectoryInPath(m_filePath);
+        if (!directory.empty() && !FileHelper::IsDirectory(directory))
+            FileHelper::CreateDirectoryRecursive(directory);
+
+        // Written to a temporary file first, so a crash during the save does not leave a truncated cache
+        Path tempFilePath = m_filePath + Path(".tmp");
+        {
+            OutputFileStream outputFile(tempFilePath.c_str(), std::ios::binary);
+            MAZE_WARNING_RETURN_VALUE_IF(!outputFile, false, "Failed to open file - %s", tempFilePath.toUTF8().c_str());
+
+            outputFile.write((S8 const*)fileData.data(), sizeof(PipelineCacheFileHeader) + dataSize);
+            if (!outputFile.good())
+                return false;
+        }
+
+        if (FileHelper::IsFileExists(m_filePath))
+            FileHelper::DeleteRegularFile(m_filePath);
+
+        return FileHelper::MoveRegularFile(tempFilePath, m_filePath);
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
@@ -161,11 +161,13 @@ namespace Maze
                                 clears.push_back(clearAttachment);
                             }
 
-                            if (!clears.empty())
+                            // Like glClear, the clear is limited by the scissor rect
+                            // (shadow atlas cascades are cleared one tile at a time)
+                            VkRect2D rect = stateMachine->calculateScissorRect();
+                            if (!clears.empty() && rect.extent.width > 0u && rect.extent.height > 0u)
                             {
                                 VkClearRect clearRect = {};
-                                clearRect.rect.offset = { 0, 0 };
-                                clearRect.rect.extent = { stateMachine->getRenderTargetSize().x, stateMachine->getRenderTargetSize().y };
+                                clearRect.rect = rect;
                                 clearRect.layerCount = 1u;
                                 vkCmdClearAttachments(cmd, (U32)clears.size(), clears.data(), 1u, &clearRect);
                             }
@@ -39,6 +39,8 @@
 #include "maze-render-system-vulkan/MazeRenderBufferVulkan.hpp"
 #include "maze-render-system-vulkan/MazeRenderWindowVulkan.hpp"
 #include "maze-graphics/MazeRenderTarget.hpp"
+#include "maze-core/helpers/MazeFileHelper.hpp"
+#include "maze-core/helpers/MazeStringHelper.hpp"
 #include "maze-core/services/MazeLogStream.hpp"
 
 #include <shaderc/shaderc.hpp>
@@ -114,6 +116,7 @@ namespace Maze
             vmaDestroyBuffer(m_allocator, m_zeroVertexBuffer, m_zeroVertexBufferAllocation);
 
         m_stateMachine.reset();
+        m_uploadManager.reset();
 
         for (VulkanFrameResources& frame : m_frameResources)
         {
@@ -130,8 +133,11 @@ namespace Maze
         if (m_descriptorPool != VK_NULL_HANDLE)
             vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
 
-        if (m_pipelineCache != VK_NULL_HANDLE)
-            vkDestroyPipelineCache(m_device, m_pipelineCache, nullptr);
+        if (m_pipelineCache)
+        {
+            m_pipelineCache->save();
+            m_pipelineCache.reset();
+        }
 
         if (m_globalSetLayout != VK_NULL_HANDLE)
             vkDestroyDescriptorSetLayout(m_device, m_globalSetLayout, nullptr);
@@ -197,10 +203,8 @@ namespace Maze
         if (!createAllocator())
             return false;
 
-        // Pipeline cache
-        VkPipelineCacheCreateInfo pipelineCacheInfo = {};
-        pipelineCacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-        MAZE_VK_CALL(vkCreatePipelineCache(m_device, &pipelineCacheInfo, nullptr, &m_pipelineCache));
+        if (!createPipelineCache())
+            return false;
 
         // A generous shared descriptor pool. Every ShaderVulkan grows its own
         // pool of set-1 material descriptor set *instances* from here - one
@@ -253,6 +257,10 @@ namespace Maze
         if (!createFrameResources())
             return false;
 
+        m_uploadManager = UploadManagerVulkan::Create(this, m_config.uploadStagingBufferSize);
+        if (!m_uploadManager)
+            return false;
+
         // Global uniform buffers/descriptor sets are created lazily, per
         // draw call, by acquireGlobalDescriptorSet() (see its banner
         // comment) - just size the shadow buffer and pool bookkeeping here.
@@ -589,6 +597,32 @@ namespace Maze
         vkUpdateDescriptorSets(_device, 1u, &write, 0u, nullptr);
     }
 
+    //////////////////////////////////////////
+    bool RenderSystemVulkan::createPipelineCache()
+    {
+        Path filePath;
+        if (m_config.pipelineCacheEnabled)
+        {
+            Path directory = m_config.pipelineCacheDirectory;
+            if (directory.empty())
+                directory = FileHelper::GetDefaultTemporaryDirectory() + Path("/vk-pipeline-cache");
+
+            // One file per GPU, so the machines with several GPUs do not overwrite each other's cache
+            String fileName;
+            StringHelper::FormatString(
+                fileName,
+                "/%08x%08x.mzvkpc",
+                m_physicalDeviceProperties.vendorID,
+                m_physicalDeviceProperties.deviceID);
+            filePath = directory + Path(fileName);
+        }
+
+        m_pipelineCache = PipelineCacheVulkan::Create(m_device, m_physicalDeviceProperties, filePath);
+        MAZE_ERROR_RETURN_VALUE_IF(!m_pipelineCache, false, "Failed to create pipeline cache!");
+
+        return true;
+    }
+
     //////////////////////////////////////////
     bool RenderSystemVulkan::createInstanceStreamBuffers()
     {
@@ -999,6 +1033,8 @@ namespace Maze
 
         MAZE_VK_CALL(vkResetCommandPool(m_device, frame.commandPool, 0u));
 
+        m_uploadManager->update();
+
         VkCommandBufferBeginInfo beginInfo = {};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -1055,6 +1091,9 @@ namespace Maze
 
         MAZE_VK_CALL(vkEndCommandBuffer(frame.commandBuffer));
 
+        // Everything the frame draws with should be uploaded first
+        m_uploadManager->flush();
+
         VkSubmitInfo submitInfo = {};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.commandBufferCount = 1u;
@@ -1071,6 +1110,16 @@ namespace Maze
         m_frameOpen = false;
 
         m_currentFrameIndex = (m_currentFrameIndex + 1u) % m_config.framesInFlight;
+
+        // Periodic save, so a crash or a killed process does not lose the whole session's pipelines
+        if (m_pipelineCache &&
+            m_pipelineCache->isDirty() &&
+            m_config.pipelineCacheSaveFramesInterval > 0u &&
+            m_frameGeneration >= m_pipelineCacheSaveFrame + m_config.pipelineCacheSaveFramesInterval)
+        {
+            m_pipelineCache->save();
+            m_pipelineCacheSaveFrame = m_frameGeneration;
+        }
     }
 
     //////////////////////////////////////////
@@ -1079,7 +1128,13 @@ namespace Maze
         if (m_frameOpen)
             endFrame(VK_NULL_HANDLE);
 
+        if (m_uploadManager)
+            m_uploadManager->flush();
+
         MAZE_VK_CALL(vkDeviceWaitIdle(m_device));
+
+        if (m_uploadManager)
+            m_uploadManager->update();
     }
 
     //////////////////////////////////////////
@@ -1112,10 +1167,12 @@ namespace Maze
         submitInfo.commandBufferCount = 1u;
         submitInfo.pCommandBuffers = &_commandBuffer;
 
-        // Simple synchronous wait - these are one-off setup/upload commands,
+        // These commands may depend on the data of the pending uploads
+        m_uploadManager->flush();
+
+        // Simple synchronous wait - these are one-off setup/readback commands,
         // not per-frame hot path, so a full queue-idle wait is an acceptable
-        // (if not maximally efficient) way to guarantee the staging buffer
-        // stays alive until the copy completes without extra fence bookkeeping
+        // (if not maximally efficient) way to get the results back
         MAZE_VK_CALL(vkQueueSubmit(m_graphicsQueue, 1u, &submitInfo, VK_NULL_HANDLE));
         MAZE_VK_CALL(vkQueueWaitIdle(m_graphicsQueue));
 
@@ -1469,7 +1526,7 @@ namespace Maze
             pipelineInfo.pDynamicState = &dynamicStateInfo;
             pipelineInfo.layout = m_depthResolvePipelineLayout;
 
-            MAZE_VK_CALL(vkCreateGraphicsPipelines(m_device, m_pipelineCache, 1u, &pipelineInfo, nullptr, &m_depthResolvePipeline));
+            MAZE_VK_CALL(vkCreateGraphicsPipelines(m_device, getPipelineCache(), 1u, &pipelineInfo, nullptr, &m_depthResolvePipeline));
             if (m_depthResolvePipeline == VK_NULL_HANDLE)
             {
                 m_depthResolveInitFailed = true;
@@ -638,9 +638,16 @@ namespace Maze
             m_depthFormat == VK_FORMAT_D32_SFLOAT_S8_UINT;
         renderingCreateInfo.stencilAttachmentFormat = depthFormatHasStencil ? m_depthFormat : VK_FORMAT_UNDEFINED;
 
+        // Tells whether the pipeline was found in the pipeline cache (core since Vulkan 1.3)
+        VkPipelineCreationFeedback creationFeedback = {};
+        VkPipelineCreationFeedbackCreateInfo creationFeedbackInfo = {};
+        creationFeedbackInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
+        creationFeedbackInfo.pNext = &renderingCreateInfo;
+        creationFeedbackInfo.pPipelineCreationFeedback = &creationFeedback;
+
         VkGraphicsPipelineCreateInfo pipelineInfo = {};
         pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        pipelineInfo.pNext = &renderingCreateInfo;
+        pipelineInfo.pNext = &creationFeedbackInfo;
         pipelineInfo.stageCount = 2u;
         pipelineInfo.pStages = stages;
         pipelineInfo.pVertexInputState = &vertexInputInfo;
@@ -657,10 +664,37 @@ namespace Maze
         VkResult result = vkCreateGraphicsPipelines(getDevice(), m_renderSystem->getPipelineCache(), 1u, &pipelineInfo, nullptr, &pipeline);
         MAZE_ERROR_IF(result != VK_SUCCESS, "vkCreateGraphicsPipelines failed! result=%d", (S32)result);
 
+        if (result == VK_SUCCESS && m_renderSystem->getPipelineCacheVulkan())
+            m_renderSystem->getPipelineCacheVulkan()->notifyPipelineCreated(creationFeedback);
+
         m_pipelines.emplace(key, pipeline);
         return pipeline;
     }
 
+    //////////////////////////////////////////
+    VkRect2D StateMachineVulkan::calculateScissorRect() const
+    {
+        VkRect2D scissor = {};
+        if (m_scissorTestEnabled)
+        {
+            // Same bottom-up-to-top-down origin correction as the
+            // viewport (mirrors StateMachineDX11::flushPipeline's
+            // identical scissor-rect handling)
+            S32 top = m_flipY
+                ? m_scissorRect.position.y
+                : (S32)m_renderTargetSize.y - m_scissorRect.position.y - m_scissorRect.size.y;
+            scissor.offset = { m_scissorRect.position.x, top };
+            scissor.extent = { (U32)m_scissorRect.size.x, (U32)m_scissorRect.size.y };
+        }
+        else
+        {
+            scissor.offset = { 0, 0 };
+            scissor.extent = { m_renderTargetSize.x, m_renderTargetSize.y };
+        }
+
+        return scissor;
+    }
+
     //////////////////////////////////////////
     void StateMachineVulkan::flushPipeline()
     {
@@ -707,23 +741,7 @@ namespace Maze
 
         if (m_scissorDirty)
         {
-            VkRect2D scissor = {};
-            if (m_scissorTestEnabled)
-            {
-                // Same bottom-up-to-top-down origin correction as the
-                // viewport above (mirrors StateMachineDX11::flushPipeline's
-                // identical scissor-rect handling)
-                S32 top = m_flipY
-                    ? m_scissorRect.position.y
-                    : (S32)m_renderTargetSize.y - m_scissorRect.position.y - m_scissorRect.size.y;
-                scissor.offset = { m_scissorRect.position.x, top };
-                scissor.extent = { (U32)m_scissorRect.size.x, (U32)m_scissorRect.size.y };
-            }
-            else
-            {
-                scissor.offset = { 0, 0 };
-                scissor.extent = { m_renderTargetSize.x, m_renderTargetSize.y };
-            }
+            VkRect2D scissor = calculateScissorRect();
             vkCmdSetScissor(cmd, 0u, 1u, &scissor);
             m_scissorDirty = false;
         }
@@ -273,23 +273,20 @@ namespace Maze
         MAZE_VK_CALL(vmaCreateImage(allocator, &imageInfo, &allocInfo, &m_image, &m_imageAllocation, nullptr));
         MAZE_ERROR_RETURN_VALUE_IF(m_image == VK_NULL_HANDLE, false, "vmaCreateImage failed!");
 
-        // Staging-buffer upload of every provided mip level, one command buffer for the
-        // whole texture (initial UNDEFINED -> TRANSFER_DST_OPTIMAL, copy each mip, then
-        // either TRANSFER_DST_OPTIMAL -> SHADER_READ_ONLY_OPTIMAL directly, or leave in
-        // TRANSFER_DST_OPTIMAL if generateMipmaps() (blit-based) still needs to run)
-        VkCommandBuffer commandBuffer = renderSystem->beginSingleTimeCommands();
+        // Staging upload of every provided mip level, recorded into the upload manager's
+        // batch (initial UNDEFINED -> TRANSFER_DST_OPTIMAL, copy each mip, then either
+        // TRANSFER_DST_OPTIMAL -> SHADER_READ_ONLY_OPTIMAL directly, or leave in
+        // TRANSFER_DST_OPTIMAL if generateMipmaps() (blit-based) still needs to run).
+        // The batch is submitted before the frame and before any single-time commands,
+        // so nothing here waits for the GPU
+        UploadManagerVulkan* uploadManager = renderSystem->getUploadManager().get();
 
         TransitionImageLayoutVulkan(
-            commandBuffer, m_image, m_aspect,
+            uploadManager->getCommandBuffer(), m_image, m_aspect,
             VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             m_mipLevels, 1u);
         m_currentLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 
-        Vector<VkBuffer> stagingBuffers;
-        Vector<VmaAllocation> stagingAllocations;
-        stagingBuffers.reserve(_pixelSheets.size());
-        stagingAllocations.reserve(_pixelSheets.size());
-
         for (Size mip = 0; mip < _pixelSheets.size() && mip < (Size)m_mipLevels; ++mip)
         {
             PixelSheet2D const& pixelSheet = _pixelSheets[mip];
@@ -318,31 +315,16 @@ namespace Maze
                 dataSize = texelsCount * 4;
             }
 
-            VkBufferCreateInfo stagingBufferInfo;
-            memset(&stagingBufferInfo, 0, sizeof(stagingBufferInfo));
-            stagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-            stagingBufferInfo.size = dataSize;
-            stagingBufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-            stagingBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-            VmaAllocationCreateInfo stagingAllocInfo;
-            memset(&stagingAllocInfo, 0, sizeof(stagingAllocInfo));
-            stagingAllocInfo.usage = VMA_MEMORY_USAGE_AUTO;
-            stagingAllocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-
-            VkBuffer stagingBuffer = VK_NULL_HANDLE;
-            VmaAllocation stagingAllocation = VK_NULL_HANDLE;
-            VmaAllocationInfo stagingAllocationInfo;
-            MAZE_VK_CALL(vmaCreateBuffer(allocator, &stagingBufferInfo, &stagingAllocInfo, &stagingBuffer, &stagingAllocation, &stagingAllocationInfo));
-
-            memcpy(stagingAllocationInfo.pMappedData, data, dataSize);
+            // Allocating may submit the current batch, so the command buffer is taken after it
+            UploadStagingVulkan staging = uploadManager->allocateStaging(dataSize);
+            if (!staging.mappedData)
+                continue;
 
-            stagingBuffers.push_back(stagingBuffer);
-            stagingAllocations.push_back(stagingAllocation);
+            memcpy(staging.mappedData, data, dataSize);
 
             VkBufferImageCopy region;
             memset(&region, 0, sizeof(region));
-            region.bufferOffset = 0;
+            region.bufferOffset = staging.offset;
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
             // vkCmdCopyBufferToImage requires a single aspect bit per region -
@@ -362,8 +344,8 @@ namespace Maze
             region.imageExtent.depth = 1;
 
             vkCmdCopyBufferToImage(
-                commandBuffer,
-                stagingBuffer,
+                uploadManager->getCommandBuffer(),
+                staging.buffer,
                 m_image,
                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 1, &region);
@@ -373,16 +355,13 @@ namespace Maze
         if (!needsGeneratedMips)
         {
             TransitionImageLayoutVulkan(
-                commandBuffer, m_image, m_aspect,
+                uploadManager->getCommandBuffer(), m_image, m_aspect,
                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
                 m_mipLevels, 1u);
             m_currentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         }
 
-        renderSystem->endSingleTimeCommands(commandBuffer);
-
-        for (Size i = 0; i < stagingBuffers.size(); ++i)
-            vmaDestroyBuffer(allocator, stagingBuffers[i], stagingAllocations[i]);
+        m_uploadTicket = uploadManager->finishUpload();
 
         if (!createImageView())
             return false;
@@ -524,6 +503,13 @@ namespace Maze
         renderSystem->endSingleTimeCommands(commandBuffer);
     }
 
+    //////////////////////////////////////////
+    bool Texture2DVulkan::isUploadCompleted() const
+    {
+        RenderSystemVulkan* renderSystem = getRenderSystemVulkanRaw();
+        return !renderSystem || renderSystem->getUploadManager()->isCompleted(m_uploadTicket);
+    }
+
     //////////////////////////////////////////
     void Texture2DVulkan::copyImageFrom(
         U8 const* _pixels,
@@ -563,27 +549,13 @@ namespace Maze
         }
 
         RenderSystemVulkan* renderSystem = getRenderSystemVulkanRaw();
-        VmaAllocator allocator = renderSystem->getAllocator();
+        UploadManagerVulkan* uploadManager = renderSystem->getUploadManager().get();
 
-        VkBufferCreateInfo stagingBufferInfo;
-        memset(&stagingBufferInfo, 0, sizeof(stagingBufferInfo));
-        stagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        stagingBufferInfo.size = dataSize;
-        stagingBufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        stagingBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        VmaAllocationCreateInfo stagingAllocInfo;
-        memset(&stagingAllocInfo, 0, sizeof(stagingAllocInfo));
-        stagingAllocInfo.usage = VMA_MEMORY_USAGE_AUTO;
-        stagingAllocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-
-        VkBuffer stagingBuffer = VK_NULL_HANDLE;
-        VmaAllocation stagingAllocation = VK_NULL_HANDLE;
-        VmaAllocationInfo stagingAllocationInfo;
-        MAZE_VK_CALL(vmaCreateBuffer(allocator, &stagingBufferInfo, &stagingAllocInfo, &stagingBuffer, &stagingAllocation, &stagingAllocationInfo));
-        memcpy(stagingAllocationInfo.pMappedData, data, dataSize);
+        UploadStagingVulkan staging = uploadManager->allocateStaging(dataSize);
+        MAZE_ERROR_RETURN_IF(!staging.mappedData, "Failed to allocate staging memory!");
+        memcpy(staging.mappedData, data, dataSize);
 
-        VkCommandBuffer commandBuffer = renderSystem->beginSingleTimeCommands();
+        VkCommandBuffer commandBuffer = uploadManager->getCommandBuffer();
 
         VkImageLayout oldLayout = m_currentLayout;
         transitionTo(commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
@@ -592,6 +564,7 @@ namespace Maze
         memset(&region, 0, sizeof(region));
         // See the identical narrowing in loadTextureImpl() - buffer<->image
         // copies need a single aspect bit, unlike whole-resource transitions
+        region.bufferOffset = staging.offset;
         region.imageSubresource.aspectMask =
             (m_aspect & VK_IMAGE_ASPECT_STENCIL_BIT) ? VK_IMAGE_ASPECT_DEPTH_BIT : m_aspect;
         region.imageSubresource.mipLevel = 0;
@@ -604,16 +577,14 @@ namespace Maze
 
         vkCmdCopyBufferToImage(
             commandBuffer,
-            stagingBuffer,
+            staging.buffer,
             m_image,
             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             1, &region);
 
         transitionTo(commandBuffer, oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : oldLayout);
 
-        renderSystem->endSingleTimeCommands(commandBuffer);
-
-        vmaDestroyBuffer(allocator, stagingBuffer, stagingAllocation);
+        m_uploadTicket = uploadManager->finishUpload();
     }
 
     //////////////////////////////////////////
@@ -115,6 +115,13 @@ namespace Maze
         m_currentLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     }
 
+    //////////////////////////////////////////
+    bool TextureCubeVulkan::isUploadCompleted() const
+    {
+        RenderSystemVulkan* renderSystem = getRenderSystemVulkanRaw();
+        return !renderSystem || renderSystem->getUploadManager()->isCompleted(m_uploadTicket);
+    }
+
     //////////////////////////////////////////
     bool TextureCubeVulkan::loadTexture(
         Vector<PixelSheet2D> const _pixelSheets[6],
@@ -182,17 +189,15 @@ namespace Maze
         MAZE_VK_CALL(vmaCreateImage(allocator, &imageInfo, &allocInfo, &m_image, &m_imageAllocation, nullptr));
         MAZE_ERROR_RETURN_VALUE_IF(m_image == VK_NULL_HANDLE, false, "vmaCreateImage (Cube) failed!");
 
-        VkCommandBuffer commandBuffer = renderSystem->beginSingleTimeCommands();
+        // Recorded into the upload manager's batch, see Texture2DVulkan::loadTextureImpl
+        UploadManagerVulkan* uploadManager = renderSystem->getUploadManager().get();
 
         TransitionImageLayoutVulkan(
-            commandBuffer, m_image, VK_IMAGE_ASPECT_COLOR_BIT,
+            uploadManager->getCommandBuffer(), m_image, VK_IMAGE_ASPECT_COLOR_BIT,
             VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             m_mipLevels, 6u);
         m_currentLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 
-        Vector<VkBuffer> stagingBuffers;
-        Vector<VmaAllocation> stagingAllocations;
-
         for (Size face = 0; face < 6; ++face)
         {
             for (Size mip = 0; mip < _pixelSheets[face].size() && mip < (Size)m_mipLevels; ++mip)
@@ -229,29 +234,16 @@ namespace Maze
                     dataSize = texelsCount * 4;
                 }
 
-                VkBufferCreateInfo stagingBufferInfo;
-                memset(&stagingBufferInfo, 0, sizeof(stagingBufferInfo));
-                stagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-                stagingBufferInfo.size = dataSize;
-                stagingBufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-                stagingBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-                VmaAllocationCreateInfo stagingAllocInfo;
-                memset(&stagingAllocInfo, 0, sizeof(stagingAllocInfo));
-                stagingAllocInfo.usage = VMA_MEMORY_USAGE_AUTO;
-                stagingAllocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-
-                VkBuffer stagingBuffer = VK_NULL_HANDLE;
-                VmaAllocation stagingAllocation = VK_NULL_HANDLE;
-                VmaAllocationInfo stagingAllocationInfo;
-                MAZE_VK_CALL(vmaCreateBuffer(allocator, &stagingBufferInfo, &stagingAllocInfo, &stagingBuffer, &stagingAllocation, &stagingAllocationInfo));
-                memcpy(stagingAllocationInfo.pMappedData, data, dataSize);
+                // Allocating may submit the current batch, so the command buffer is taken after it
+                UploadStagingVulkan staging = uploadManager->allocateStaging(dataSize);
+                if (!staging.mappedData)
+                    continue;
 
-                stagingBuffers.push_back(stagingBuffer);
-                stagingAllocations.push_back(stagingAllocation);
+                memcpy(staging.mappedData, data, dataSize);
 
                 VkBufferImageCopy region;
                 memset(&region, 0, sizeof(region));
+                region.bufferOffset = staging.offset;
                 region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
                 region.imageSubresource.mipLevel = (U32)mip;
                 region.imageSubresource.baseArrayLayer = (U32)face;
@@ -262,8 +254,8 @@ namespace Maze
                 region.imageExtent.depth = 1;
 
                 vkCmdCopyBufferToImage(
-                    commandBuffer,
-                    stagingBuffer,
+                    uploadManager->getCommandBuffer(),
+                    staging.buffer,
                     m_image,
                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                     1, &region);
@@ -271,15 +263,12 @@ namespace Maze
         }
 
         TransitionImageLayoutVulkan(
-            commandBuffer, m_image, VK_IMAGE_ASPECT_COLOR_BIT,
+            uploadManager->getCommandBuffer(), m_image, VK_IMAGE_ASPECT_COLOR_BIT,
             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
             m_mipLevels, 6u);
         m_currentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
-        renderSystem->endSingleTimeCommands(commandBuffer);
-
-        for (Size i = 0; i < stagingBuffers.size(); ++i)
-            vmaDestroyBuffer(allocator, stagingBuffers[i], stagingAllocations[i]);
+        m_uploadTicket = uploadManager->finishUpload();
 
         VkImageViewCreateInfo viewInfo;
         memset(&viewInfo, 0, sizeof(viewInfo));
@@ -0,0 +1,406 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+
+//////////////////////////////////////////
+#include "MazeRenderSystemVulkanHeader.hpp"
+#include "maze-render-system-vulkan/MazeUploadManagerVulkan.hpp"
+#include "maze-render-system-vulkan/MazeRenderSystemVulkan.hpp"
+#include "maze-core/services/MazeLogStream.hpp"
+
+
+//////////////////////////////////////////
+namespace Maze
+{
+    //////////////////////////////////////////
+    // Class UploadManagerVulkan
+    //
+    //////////////////////////////////////////
+    UploadManagerVulkan::UploadManagerVulkan()
+    {
+    }
+
+    //////////////////////////////////////////
+    UploadManagerVulkan::~UploadManagerVulkan()
+    {
+        if (m_device == VK_NULL_HANDLE)
+            return;
+
+        waitIdle();
+
+        for (UploadBatch& batch : m_freeBatches)
+            if (batch.fence != VK_NULL_HANDLE)
+                vkDestroyFence(m_device, batch.fence, nullptr);
+        m_freeBatches.clear();
+
+        if (m_commandPool != VK_NULL_HANDLE)
+            vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+
+        if (m_ringBuffer != VK_NULL_HANDLE)
+            vmaDestroyBuffer(m_allocator, m_ringBuffer, m_ringAllocation);
+    }
+
+    //////////////////////////////////////////
+    UploadManagerVulkanPtr UploadManagerVulkan::Create(
+        RenderSystemVulkan* _renderSystem,
+        VkDeviceSize _stagingBufferSize)
+    {
+        UploadManagerVulkanPtr object;
+        MAZE_CREATE_AND_INIT_SHARED_PTR(UploadManagerVulkan, object, init(_renderSystem, _stagingBufferSize));
+        return object;
+    }
+
+    //////////////////////////////////////////
+    bool UploadManagerVulkan::init(
+        RenderSystemVulkan* _renderSystem,
+        VkDeviceSize _stagingBufferSize)
+    {
+        MAZE_ERROR_RETURN_VALUE_IF(_stagingBufferSize == 0u, false, "Staging buffer size is zero!");
+
+        m_renderSystem = _renderSystem;
+        m_device = _renderSystem->getDevice();
+        m_allocator = _renderSystem->getAllocator();
+
+        // Graphics queue on purpose - texture uploads are followed by blit-based mipmaps generation
+        // and layout transitions to the shader stages, which a transfer-only queue can't do,
+        // and the submission order on a single queue is what makes the uploaded data visible
+        // to the frame without queue ownership transfers and semaphores
+        m_queue = _renderSystem->getGraphicsQueue();
+
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = _renderSystem->getGraphicsQueueFamilyIndex();
+        MAZE_VK_CALL(vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool));
+        MAZE_ERROR_RETURN_VALUE_IF(m_commandPool == VK_NULL_HANDLE, false, "Upload command pool creation failed!");
+
+        VkBufferCreateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = _stagingBufferSize;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        VmaAllocationInfo allocationInfo;
+        MAZE_VK_CALL(vmaCreateBuffer(m_allocator, &bufferInfo, &allocInfo, &m_ringBuffer, &m_ringAllocation, &allocationInfo));
+        MAZE_ERROR_RETURN_VALUE_IF(m_ringBuffer == VK_NULL_HANDLE, false, "Staging ring buffer creation failed!");
+
+        m_ringMappedData = (U8*)allocationInfo.pMappedData;
+        m_ringSize = _stagingBufferSize;
+
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void UploadManagerVulkan::beginBatch()
+    {
+        if (m_currentBatch.commandBuffer != VK_NULL_HANDLE)
+            return;
+
+        if (!m_freeBatches.empty())
+        {
+            m_currentBatch = std::move(m_freeBatches.back());
+            m_freeBatches.pop_back();
+        }
+        else
+        {
+            VkCommandBufferAllocateInfo cmdAllocInfo = {};
+            cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            cmdAllocInfo.commandPool = m_commandPool;
+            cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            cmdAllocInfo.commandBufferCount = 1u;
+            MAZE_VK_CALL(vkAllocateCommandBuffers(m_device, &cmdAllocInfo, &m_currentBatch.commandBuffer));
+
+            VkFenceCreateInfo fenceInfo = {};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            MAZE_VK_CALL(vkCreateFence(m_device, &fenceInfo, nullptr, &m_currentBatch.fence));
+        }
+
+        m_currentBatch.ticket = m_nextTicket++;
+        m_currentBatch.ringBytes = 0u;
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        MAZE_VK_CALL(vkBeginCommandBuffer(m_currentBatch.commandBuffer, &beginInfo));
+
+        // Destination resources may still be used by the previously submitted frames
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(
+            m_currentBatch.commandBuffer,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr);
+    }
+
+    //////////////////////////////////////////
+    UploadStagingVulkan UploadManagerVulkan::allocateStaging(
+        VkDeviceSize _size,
+        VkDeviceSize _alignment)
+    {
+        MAZE_PROFILE_EVENT("UploadManagerVulkan::allocateStaging");
+
+        if (_size == 0u)
+            return UploadStagingVulkan();
+
+        if (_size > m_ringSize)
+            return allocateDedicatedStaging(_size);
+
+        VkDeviceSize offset = 0u;
+        VkDeviceSize allocationSize = 0u;
+        for (;;)
+        {
+            if (m_ringUsed == 0u)
+                m_ringHead = 0u;
+
+            offset = ((m_ringHead + _alignment - 1u) / _alignment) * _alignment;
+            if (offset + _size > m_ringSize)
+                offset = 0u;
+
+            // Wrapping wastes the tail of the ring
+            allocationSize = (offset == 0u ? m_ringSize - m_ringHead : offset - m_ringHead) + _size;
+            if (offset == 0u && m_ringHead == 0u)
+                allocationSize = _size;
+
+            if (m_ringUsed + allocationSize <= m_ringSize)
+                break;
+
+            // The ring is full - the only way to get the space is to wait for the GPU
+            if (m_submittedBatches.empty())
+                flush();
+
+            waitOldestBatch();
+        }
+
+        beginBatch();
+
+        m_ringHead = offset + _size;
+        m_ringUsed += allocationSize;
+        m_currentBatch.ringBytes += allocationSize;
+
+        UploadStagingVulkan staging;
+        staging.buffer = m_ringBuffer;
+        staging.offset = offset;
+        staging.mappedData = m_ringMappedData + offset;
+        return staging;
+    }
+
+    //////////////////////////////////////////
+    UploadStagingVulkan UploadManagerVulkan::allocateDedicatedStaging(VkDeviceSize _size)
+    {
+        beginBatch();
+
+        VkBufferCreateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = _size;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        VmaAllocationInfo allocationInfo;
+        MAZE_VK_CALL(vmaCreateBuffer(m_allocator, &bufferInfo, &allocInfo, &buffer, &allocation, &allocationInfo));
+        MAZE_ERROR_RETURN_VALUE_IF(buffer == VK_NULL_HANDLE, UploadStagingVulkan(), "Staging buffer creation failed!");
+
+        m_currentBatch.dedicatedBuffers.push_back(buffer);
+        m_currentBatch.dedicatedAllocations.push_back(allocation);
+
+        UploadStagingVulkan staging;
+        staging.buffer = buffer;
+        staging.offset = 0u;
+        staging.mappedData = (U8*)allocationInfo.pMappedData;
+        return staging;
+    }
+
+    //////////////////////////////////////////
+    VkCommandBuffer UploadManagerVulkan::getCommandBuffer()
+    {
+        beginBatch();
+        return m_currentBatch.commandBuffer;
+    }
+
+    //////////////////////////////////////////
+    U64 UploadManagerVulkan::finishUpload()
+    {
+        if (m_currentBatch.commandBuffer == VK_NULL_HANDLE)
+            return c_completedTicket;
+
+        U64 ticket = m_currentBatch.ticket;
+
+        // Big batches are submitted early, so the GPU starts copying while the CPU prepares the next data
+        if (m_currentBatch.ringBytes >= m_ringSize / 4u || !m_currentBatch.dedicatedBuffers.empty())
+            flush();
+
+        return ticket;
+    }
+
+    //////////////////////////////////////////
+    U64 UploadManagerVulkan::uploadBuffer(
+        VkBuffer _dstBuffer,
+        VkDeviceSize _dstOffset,
+        void const* _data,
+        VkDeviceSize _size)
+    {
+        if (_size == 0u)
+            return c_completedTicket;
+
+        UploadStagingVulkan staging = allocateStaging(_size);
+        MAZE_ERROR_RETURN_VALUE_IF(!staging.mappedData, c_completedTicket, "Failed to allocate staging memory!");
+
+        memcpy(staging.mappedData, _data, (Size)_size);
+
+        VkBufferCopy copyRegion;
+        copyRegion.srcOffset = staging.offset;
+        copyRegion.dstOffset = _dstOffset;
+        copyRegion.size = _size;
+        vkCmdCopyBuffer(getCommandBuffer(), staging.buffer, _dstBuffer, 1, &copyRegion);
+
+        return finishUpload();
+    }
+
+    //////////////////////////////////////////
+    void UploadManagerVulkan::flush()
+    {
+        if (m_currentBatch.commandBuffer == VK_NULL_HANDLE)
+            return;
+
+        MAZE_PROFILE_EVENT("UploadManagerVulkan::flush");
+
+        // HOST_ACCESS_SEQUENTIAL_WRITE memory may be non-coherent (no-op on coherent memory)
+        if (m_currentBatch.ringBytes > 0u)
+            MAZE_VK_CALL(vmaFlushAllocation(m_allocator, m_ringAllocation, 0u, VK_WHOLE_SIZE));
+        for (VmaAllocation allocation : m_currentBatch.dedicatedAllocations)
+            MAZE_VK_CALL(vmaFlushAllocation(m_allocator, allocation, 0u, VK_WHOLE_SIZE));
+
+        // Uploaded data is visible to everything submitted after this batch
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        vkCmdPipelineBarrier(
+            m_currentBatch.commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr);
+
+        MAZE_VK_CALL(vkEndCommandBuffer(m_currentBatch.commandBuffer));
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1u;
+        submitInfo.pCommandBuffers = &m_currentBatch.commandBuffer;
+        MAZE_VK_CALL(vkQueueSubmit(m_queue, 1u, &submitInfo, m_currentBatch.fence));
+
+        m_submittedBatches.push_back(std::move(m_currentBatch));
+        m_currentBatch = UploadBatch();
+    }
+
+    //////////////////////////////////////////
+    void UploadManagerVulkan::update()
+    {
+        while (!m_submittedBatches.empty())
+        {
+            UploadBatch& batch = m_submittedBatches.front();
+            if (vkGetFenceStatus(m_device, batch.fence) != VK_SUCCESS)
+                break;
+
+            releaseBatch(batch);
+            m_submittedBatches.pop_front();
+        }
+    }
+
+    //////////////////////////////////////////
+    void UploadManagerVulkan::waitIdle()
+    {
+        flush();
+
+        while (waitOldestBatch())
+        {
+        }
+    }
+
+    //////////////////////////////////////////
+    bool UploadManagerVulkan::waitOldestBatch()
+    {
+        if (m_submittedBatches.empty())
+            return false;
+
+        MAZE_PROFILE_EVENT("UploadManagerVulkan::waitOldestBatch");
+
+        UploadBatch& batch = m_submittedBatches.front();
+        MAZE_VK_CALL(vkWaitForFences(m_device, 1u, &batch.fence, VK_TRUE, UINT64_MAX));
+
+        releaseBatch(batch);
+        m_submittedBatches.pop_front();
+        return true;
+    }
+
+    //////////////////////////////////////////
+    void UploadManagerVulkan::releaseBatch(UploadBatch& _batch)
+    {
+        // Batches are submitted to a single queue and are released in the submission order,
+        // so the ring memory is always released from its tail
+        m_ringUsed -= _batch.ringBytes;
+        if (m_ringUsed == 0u)
+            m_ringHead = 0u;
+
+        for (Size i = 0; i < _batch.dedicatedBuffers.size(); ++i)
+            vmaDestroyBuffer(m_allocator, _batch.dedicatedBuffers[i], _batch.dedicatedAllocations[i]);
+        _batch.dedicatedBuffers.clear();
+        _batch.dedicatedAllocations.clear();
+
+        m_completedTicket = _batch.ticket;
+
+        MAZE_VK_CALL(vkResetFences(m_device, 1u, &_batch.fence));
+        MAZE_VK_CALL(vkResetCommandBuffer(_batch.commandBuffer, 0u));
+        _batch.ringBytes = 0u;
+
+        m_freeBatches.push_back(std::move(_batch));
+    }
+
+    //////////////////////////////////////////
+    bool UploadManagerVulkan::isCompleted(U64 _ticket) const
+    {
+        return _ticket <= m_completedTicket;
+    }
+
+} // namespace Maze
+//////////////////////////////////////////
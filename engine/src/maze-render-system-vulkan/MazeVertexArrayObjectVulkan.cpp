@@ -137,39 +137,10 @@ namespace Maze
             m_indexBufferSizeBytes = bytes;
         }
 
-        // Index data is uploaded via a one-off staging buffer + copy - index buffers are
-        // device-local for fastest possible GPU reads during indexed draws, same reasoning
+        // Index data is uploaded via the staging ring buffer + asynchronous copy - index buffers
+        // are device-local for fastest possible GPU reads during indexed draws, same reasoning
         // as VertexBufferObjectVulkan's static/single-mapping path
-        VkBufferCreateInfo stagingBufferInfo;
-        memset(&stagingBufferInfo, 0, sizeof(stagingBufferInfo));
-        stagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        stagingBufferInfo.size = bytes;
-        stagingBufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        stagingBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        VmaAllocationCreateInfo stagingAllocInfo;
-        memset(&stagingAllocInfo, 0, sizeof(stagingAllocInfo));
-        stagingAllocInfo.usage = VMA_MEMORY_USAGE_AUTO;
-        stagingAllocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-
-        VkBuffer stagingBuffer = VK_NULL_HANDLE;
-        VmaAllocation stagingAllocation = VK_NULL_HANDLE;
-        VmaAllocationInfo stagingAllocationInfo;
-        MAZE_VK_CALL(vmaCreateBuffer(allocator, &stagingBufferInfo, &stagingAllocInfo, &stagingBuffer, &stagingAllocation, &stagingAllocationInfo));
-        memcpy(stagingAllocationInfo.pMappedData, _indicesData, bytes);
-        MAZE_VK_CALL(vmaFlushAllocation(allocator, stagingAllocation, 0, bytes));
-
-        VkCommandBuffer commandBuffer = renderSystem->beginSingleTimeCommands();
-
-        VkBufferCopy copyRegion;
-        copyRegion.srcOffset = 0;
-        copyRegion.dstOffset = 0;
-        copyRegion.size = bytes;
-        vkCmdCopyBuffer(commandBuffer, stagingBuffer, m_indexBuffer, 1, &copyRegion);
-
-        renderSystem->endSingleTimeCommands(commandBuffer);
-
-        vmaDestroyBuffer(allocator, stagingBuffer, stagingAllocation);
+        renderSystem->getUploadManager()->uploadBuffer(m_indexBuffer, 0u, _indicesData, bytes);
     }
 
     //////////////////////////////////////////
@@ -157,6 +157,13 @@ namespace Maze
         return true;
     }
 
+    //////////////////////////////////////////
+    bool VertexBufferObjectVulkan::isUploadCompleted() const
+    {
+        RenderSystemVulkan* renderSystem = getRenderSystemVulkanRaw();
+        return !renderSystem || renderSystem->getUploadManager()->isCompleted(m_uploadTicket);
+    }
+
     //////////////////////////////////////////
     void VertexBufferObjectVulkan::resize(Size _bytes)
     {
@@ -186,40 +193,9 @@ namespace Maze
             return;
         }
 
-        // Static/device-local path - one-off staging buffer + synchronous copy
+        // Static/device-local path - staging ring buffer + asynchronous copy
         RenderSystemVulkan* renderSystem = getRenderSystemVulkanRaw();
-        VmaAllocator allocator = renderSystem->getAllocator();
-
-        VkBufferCreateInfo stagingBufferInfo;
-        memset(&stagingBufferInfo, 0, sizeof(stagingBufferInfo));
-        stagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        stagingBufferInfo.size = _bytes;
-        stagingBufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        stagingBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        VmaAllocationCreateInfo stagingAllocInfo;
-        memset(&stagingAllocInfo, 0, sizeof(stagingAllocInfo));
-        stagingAllocInfo.usage = VMA_MEMORY_USAGE_AUTO;
-        stagingAllocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-
-        VkBuffer stagingBuffer = VK_NULL_HANDLE;
-        VmaAllocation stagingAllocation = VK_NULL_HANDLE;
-        VmaAllocationInfo stagingAllocationInfo;
-        MAZE_VK_CALL(vmaCreateBuffer(allocator, &stagingBufferInfo, &stagingAllocInfo, &stagingBuffer, &stagingAllocation, &stagingAllocationInfo));
-        memcpy(stagingAllocationInfo.pMappedData, _data, _bytes);
-        MAZE_VK_CALL(vmaFlushAllocation(allocator, stagingAllocation, 0, _bytes));
-
-        VkCommandBuffer commandBuffer = renderSystem->beginSingleTimeCommands();
-
-        VkBufferCopy copyRegion;
-        copyRegion.srcOffset = 0;
-        copyRegion.dstOffset = 0;
-        copyRegion.size = _bytes;
-        vkCmdCopyBuffer(commandBuffer, stagingBuffer, m_buffer, 1, &copyRegion);
-
-        renderSystem->endSingleTimeCommands(commandBuffer);
-
-        vmaDestroyBuffer(allocator, stagingBuffer, stagingAllocation);
+        m_uploadTicket = renderSystem->getUploadManager()->uploadBuffer(m_buffer, 0u, _data, _bytes);
     }
 
 
@@ -71,6 +71,10 @@
 #   include "maze-sound-system-openal/MazeSoundSystemOpenALPlugin.hpp"
 #endif
 
+#if MAZE_RENDER_SYSTEM_NULL_ENABLED
+#   include "maze-render-system-null/MazeRenderSystemNullPlugin.hpp"
+#endif
+
 
 //////////////////////////////////////////
 namespace Maze
@@ -203,6 +207,13 @@ namespace Maze
         }
 #endif
 
+#if MAZE_RENDER_SYSTEM_NULL_ENABLED
+        {
+            RenderSystemNullConfig config;
+            MAZE_LOAD_PLATFORM_PLUGIN(RenderSystemNull, config);
+        }
+#endif
+
 #if MAZE_SOUND_SYSTEM_OPENAL_ENABLED
         {
             SoundSystemOpenALConfig config;
@@ -212,6 +223,24 @@ namespace Maze
 
         MAZE_LOAD_PLATFORM_PLUGIN(LoaderPNG);
 
+        // "renderSystem" param or "-render-system <Name>" argument overrides the default render system
+        String renderSystemName = m_config.params.getString(MAZE_HCS("renderSystem"), String());
+        if (CString renderSystemArgument = m_systemManager->getCommandLineArgumentValue(MAZE_HCS("render-system")))
+            renderSystemName = renderSystemArgument;
+
+        if (!renderSystemName.empty())
+        {
+            RenderSystemPtr renderSystem;
+            for (auto const& renderSystemData : m_graphicsManager->getRenderSystems())
+                if (renderSystemData.first == renderSystemName)
+                    renderSystem = renderSystemData.second;
+
+            if (renderSystem)
+                m_graphicsManager->setDefaultRenderSystem(renderSystem);
+            else
+                Debug::LogWarning("Render System %s is not available!", renderSystemName.c_str());
+        }
+
         Debug::log << "Available Render Systems: " << endl;
         for (auto const& renderSystemData : m_graphicsManager->getRenderSystems())
         {
@@ -669,6 +669,9 @@ namespace Maze
                         }
 
                         meshSkeletonAnimation->setBoneAnimations(eastl::move(meshSkeletonAnimationBones));
+
+                        if (_props.compressAnimations)
+                            meshSkeletonAnimation->compress();
                     }
                 }
             }
@@ -0,0 +1,7 @@
+source var.sh
+
+SCRIPT=$(readlink -f "$0")
+SCRIPT_PATH=$(dirname "$SCRIPT")
+
+CMAKELISTS_DIR=$SCRIPT_PATH/../../
+source $MAZE_ENGINE_DIR/../examples/templates/prj/linux/configure-linux-makefiles-shared.sh
\ No newline at end of file
@@ -0,0 +1,6 @@
+SCRIPT=$(readlink -f "$0")
+SCRIPT_PATH=$(dirname "$SCRIPT")
+
+PROJECT_NAME="maze-tool-radix-sort-benchmark"
+MAZE_ENGINE_DIR="$SCRIPT_PATH/../../../../engine"
+PRJ_ROOT_DIR="$MAZE_ENGINE_DIR/../_otp/prj"
\ No newline at end of file
@@ -0,0 +1,4 @@
+set PROJECT_NAME=maze-tool-radix-sort-benchmark
+set MAZE_ENGINE_DIR=%~dp0..\..\..\..\engine
+set PRJ_ROOT_DIR=%MAZE_ENGINE_DIR%\..\_otp\prj
+set EXAMPLES_LIB_DIR=%MAZE_ENGINE_DIR%\..\examples\lib
\ No newline at end of file
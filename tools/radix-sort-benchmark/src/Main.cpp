@@ -0,0 +1,160 @@
+//////////////////////////////////////////
+//
+// Maze Engine
+// Copyright (C) 2021 Dmitriy "Tinaynox" Nosov (tinaynox@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+//////////////////////////////////////////
+
+
+//////////////////////////////////////////
+#include "maze-core/utils/MazeRadixSort.hpp"
+#include "maze-core/services/MazeLogService.hpp"
+#include "maze-core/helpers/MazeFileHelper.hpp"
+#include "maze-core/system/MazeTimer.hpp"
+#include <EASTL/sort.h>
+#include <random>
+
+
+//////////////////////////////////////////
+using namespace Maze;
+
+
+//////////////////////////////////////////
+// RenderQueueIndex values (maze-graphics)
+static U64 const c_opaqueRenderQueueIndex = 50u;
+static U64 const c_transparentRenderQueueIndex = 150u;
+
+//////////////////////////////////////////
+// Total count of sorted items for every array size
+static Size const c_itemsPerArraySize = 1u << 23;
+
+
+//////////////////////////////////////////
+// The same layout as BuildRenderUnitSortKey (MazeRenderControllerModule3D.cpp):
+// opaque units are grouped by shader and pass and go front-to-back,
+// every 5th unit is transparent and goes back-to-front
+void GenerateRenderUnitKeys(
+    Vector<RadixSortKeyIndex>& _items,
+    Size _count,
+    std::mt19937& _random)
+{
+    std::uniform_int_distribution<U32> shaderDistribution(0u, 31u);
+    std::uniform_int_distribution<U32> passDistribution(0u, 7u);
+    std::uniform_int_distribution<U32> transparentDistribution(0u, 4u);
+    std::uniform_real_distribution<F32> distanceDistribution(0.5f, 500.0f);
+
+    _items.resize(_count);
+    for (Size i = 0; i < _count; ++i)
+    {
+        F32 distance = distanceDistribution(_random);
+        U32 depthKey = U32(distance * distance * 1000.0f);
+
+        U64 shaderKey = shaderDistribution(_random);
+        U64 passKey = (shaderKey * 8u + passDistribution(_random)) & 0xFFF;
+
+        U64 key = 0u;
+        if (transparentDistribution(_random) != 0u)
+        {
+            key |= c_opaqueRenderQueueIndex << 56;
+            key |= shaderKey << 44;
+            key |= passKey << 32;
+            key |= U64(depthKey >> 16);
+        }
+        else
+        {
+            key |= c_transparentRenderQueueIndex << 56;
+            key |= U64(0xFFFFFFFFu - depthKey) << 24;
+            key |= shaderKey << 12;
+            key |= passKey;
+        }
+
+        _items[i] = RadixSortKeyIndex(key, (U32)i);
+    }
+}
+
+
+//////////////////////////////////////////
+S32 main(S32 _argc, S8 const* _argv[])
+{
+    LogService::GetInstancePtr()->setLogFile(FileHelper::GetBinaryDirectory() + "/maze-tool-radix-sort-benchmark.log");
+
+    Size const arraySizes[] = { 64u, 256u, 1024u, 4096u, 16384u, 65536u, 262144u };
+
+    std::mt19937 random(1337u);
+    RadixSorter radixSorter;
+    Vector<RadixSortKeyIndex> sourceItems;
+    Vector<RadixSortKeyIndex> radixItems;
+    Vector<RadixSortKeyIndex> eastlItems;
+    Timer timer;
+
+    Debug::Log("%10s %12s %12s %8s", "count", "radix, ns", "eastl, ns", "speedup");
+
+    for (Size arraySize : arraySizes)
+    {
+        GenerateRenderUnitKeys(sourceItems, arraySize, random);
+        Size iterationsCount = c_itemsPerArraySize / arraySize;
+
+        // Every iteration sorts a fresh copy, the copy alone is measured and subtracted
+        U32 usStart = timer.getMicroseconds();
+        for (Size i = 0; i < iterationsCount; ++i)
+            radixItems = sourceItems;
+        U32 usCopy = timer.getMicroseconds() - usStart;
+
+        usStart = timer.getMicroseconds();
+        for (Size i = 0; i < iterationsCount; ++i)
+        {
+            radixItems = sourceItems;
+            radixSorter.sort(radixItems);
+        }
+        U32 usRadix = timer.getMicroseconds() - usStart;
+
+        usStart = timer.getMicroseconds();
+        for (Size i = 0; i < iterationsCount; ++i)
+        {
+            eastlItems = sourceItems;
+            eastl::sort(
+                eastlItems.begin(),
+                eastlItems.end(),
+                [](RadixSortKeyIndex const& _a, RadixSortKeyIndex const& _b)
+                {
+                    return _a.key < _b.key;
+                });
+        }
+        U32 usEastl = timer.getMicroseconds() - usStart;
+
+        // eastl::sort is not stable, so only the keys are compared
+        for (Size i = 0; i < arraySize; ++i)
+        {
+            MAZE_ERROR_RETURN_VALUE_IF(radixItems[i].key != eastlItems[i].key, 1,
+                "Radix sort order mismatch at %u (count=%u)!", (U32)i, (U32)arraySize);
+        }
+
+        F64 nsRadix = F64(usRadix > usCopy ? usRadix - usCopy : 0u) * 1000.0 / F64(iterationsCount);
+        F64 nsEastl = F64(usEastl > usCopy ? usEastl - usCopy : 0u) * 1000.0 / F64(iterationsCount);
+
+        Debug::Log("%10u %12.1f %12.1f %7.2fx",
+            (U32)arraySize,
+            nsRadix,
+            nsEastl,
+            nsRadix > 0.0 ? nsEastl / nsRadix : 0.0);
+    }
+
+    return 0;
+}